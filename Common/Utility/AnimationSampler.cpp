@@ -0,0 +1,347 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "AnimationSampler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+#include "SimdOps.h"
+
+namespace common::utility
+{
+namespace
+{
+    // Coefficients of the polynomial slerp of D. Eberly ("A Fast and Accurate Algorithm for Computing SLERP"). It only
+    // needs multiplications and additions, so 4/8 rotations are interpolated together without acos/sin per lane. Last
+    // terms are scaled to correct the truncation error of the series.
+    constexpr float slerpMu = 1.85298109240830f;
+    constexpr float slerpU[8] = {1.0f / 3.0f,  1.0f / 10.0f, 1.0f / 21.0f,  1.0f / 36.0f,
+                                 1.0f / 55.0f, 1.0f / 78.0f, 1.0f / 105.0f, slerpMu / 136.0f};
+    constexpr float slerpV[8] = {1.0f / 3.0f,  2.0f / 5.0f,  3.0f / 7.0f,  4.0f / 9.0f,
+                                 5.0f / 11.0f, 6.0f / 13.0f, 7.0f / 15.0f, slerpMu * 8.0f / 17.0f};
+
+    template<typename Batch>
+    void LerpScalar(Batch& batch, const std::size_t begin)
+    {
+        for (std::size_t i = begin; i < batch.Factors.size(); ++i) {
+            const float t = batch.Factors[i];
+            batch.FromX[i] += (batch.ToX[i] - batch.FromX[i]) * t;
+            batch.FromY[i] += (batch.ToY[i] - batch.FromY[i]) * t;
+            batch.FromZ[i] += (batch.ToZ[i] - batch.FromZ[i]) * t;
+            batch.FromW[i] += (batch.ToW[i] - batch.FromW[i]) * t;
+        }
+    }
+
+    template<typename Batch>
+    void SlerpScalar(Batch& batch, const std::size_t begin)
+    {
+        for (std::size_t i = begin; i < batch.Factors.size(); ++i) {
+            const float ax = batch.FromX[i], ay = batch.FromY[i], az = batch.FromZ[i], aw = batch.FromW[i];
+            float bx = batch.ToX[i], by = batch.ToY[i], bz = batch.ToZ[i], bw = batch.ToW[i];
+
+            // Shortest path
+            float cosTheta = ax * bx + ay * by + az * bz + aw * bw;
+            if (cosTheta < 0.0f) {
+                bx = -bx, by = -by, bz = -bz, bw = -bw;
+                cosTheta = -cosTheta;
+            }
+
+            const float t = batch.Factors[i];
+            const float d = 1.0f - t;
+            const float cosThetaMinusOne = cosTheta - 1.0f;
+            float coefficientTo = 1.0f;
+            float coefficientFrom = 1.0f;
+            for (int k = 7; k >= 0; --k) {
+                coefficientTo = 1.0f + (slerpU[k] * t * t - slerpV[k]) * cosThetaMinusOne * coefficientTo;
+                coefficientFrom = 1.0f + (slerpU[k] * d * d - slerpV[k]) * cosThetaMinusOne * coefficientFrom;
+            }
+            coefficientTo *= t;
+            coefficientFrom *= d;
+
+            const float x = coefficientFrom * ax + coefficientTo * bx;
+            const float y = coefficientFrom * ay + coefficientTo * by;
+            const float z = coefficientFrom * az + coefficientTo * bz;
+            const float w = coefficientFrom * aw + coefficientTo * bw;
+            const float inverseLength = 1.0f / std::sqrt(x * x + y * y + z * z + w * w);
+            batch.FromX[i] = x * inverseLength;
+            batch.FromY[i] = y * inverseLength;
+            batch.FromZ[i] = z * inverseLength;
+            batch.FromW[i] = w * inverseLength;
+        }
+    }
+
+#if defined(COMMON_SIMD_AVX2) || defined(COMMON_SIMD_SSE2)
+    // Every lane is another channel. Returns number of the processed items, the rest is processed by the scalar loop.
+    template<typename Batch>
+    std::size_t LerpSimd(Batch& batch)
+    {
+        using Reg = SimdOps::Reg;
+        const std::size_t simdCount = batch.Factors.size() / SimdOps::Width * SimdOps::Width;
+
+        for (std::size_t i = 0; i < simdCount; i += SimdOps::Width) {
+            const Reg t = SimdOps::Load(&batch.Factors[i]);
+            for (auto [from, to]: {std::pair{&batch.FromX, &batch.ToX}, std::pair{&batch.FromY, &batch.ToY},
+                                   std::pair{&batch.FromZ, &batch.ToZ}, std::pair{&batch.FromW, &batch.ToW}}) {
+                const Reg a = SimdOps::Load(&(*from)[i]);
+                const Reg b = SimdOps::Load(&(*to)[i]);
+                SimdOps::Store(&(*from)[i], SimdOps::Add(a, SimdOps::Mul(SimdOps::Sub(b, a), t)));
+            }
+        }
+
+        return simdCount;
+    }
+
+    template<typename Batch>
+    std::size_t SlerpSimd(Batch& batch)
+    {
+        using Reg = SimdOps::Reg;
+        const std::size_t simdCount = batch.Factors.size() / SimdOps::Width * SimdOps::Width;
+        const Reg one = SimdOps::Set1(1.0f);
+        const Reg signMask = SimdOps::Set1(-0.0f);
+
+        for (std::size_t i = 0; i < simdCount; i += SimdOps::Width) {
+            const Reg ax = SimdOps::Load(&batch.FromX[i]), ay = SimdOps::Load(&batch.FromY[i]);
+            const Reg az = SimdOps::Load(&batch.FromZ[i]), aw = SimdOps::Load(&batch.FromW[i]);
+            Reg bx = SimdOps::Load(&batch.ToX[i]), by = SimdOps::Load(&batch.ToY[i]);
+            Reg bz = SimdOps::Load(&batch.ToZ[i]), bw = SimdOps::Load(&batch.ToW[i]);
+
+            // Shortest path: sign bit of the dot product flips the target quaternion without a branch
+            Reg cosTheta = SimdOps::Add(SimdOps::Add(SimdOps::Mul(ax, bx), SimdOps::Mul(ay, by)),
+                                        SimdOps::Add(SimdOps::Mul(az, bz), SimdOps::Mul(aw, bw)));
+            const Reg sign = SimdOps::And(cosTheta, signMask);
+            cosTheta = SimdOps::Xor(cosTheta, sign);
+            bx = SimdOps::Xor(bx, sign), by = SimdOps::Xor(by, sign);
+            bz = SimdOps::Xor(bz, sign), bw = SimdOps::Xor(bw, sign);
+
+            const Reg t = SimdOps::Load(&batch.Factors[i]);
+            const Reg d = SimdOps::Sub(one, t);
+            const Reg tSquared = SimdOps::Mul(t, t);
+            const Reg dSquared = SimdOps::Mul(d, d);
+            const Reg cosThetaMinusOne = SimdOps::Sub(cosTheta, one);
+            Reg coefficientTo = one;
+            Reg coefficientFrom = one;
+            for (int k = 7; k >= 0; --k) {
+                const Reg u = SimdOps::Set1(slerpU[k]);
+                const Reg v = SimdOps::Set1(slerpV[k]);
+                const Reg termTo = SimdOps::Mul(SimdOps::Sub(SimdOps::Mul(u, tSquared), v), cosThetaMinusOne);
+                const Reg termFrom = SimdOps::Mul(SimdOps::Sub(SimdOps::Mul(u, dSquared), v), cosThetaMinusOne);
+                coefficientTo = SimdOps::Add(one, SimdOps::Mul(termTo, coefficientTo));
+                coefficientFrom = SimdOps::Add(one, SimdOps::Mul(termFrom, coefficientFrom));
+            }
+            coefficientTo = SimdOps::Mul(coefficientTo, t);
+            coefficientFrom = SimdOps::Mul(coefficientFrom, d);
+
+            const Reg x = SimdOps::Add(SimdOps::Mul(coefficientFrom, ax), SimdOps::Mul(coefficientTo, bx));
+            const Reg y = SimdOps::Add(SimdOps::Mul(coefficientFrom, ay), SimdOps::Mul(coefficientTo, by));
+            const Reg z = SimdOps::Add(SimdOps::Mul(coefficientFrom, az), SimdOps::Mul(coefficientTo, bz));
+            const Reg w = SimdOps::Add(SimdOps::Mul(coefficientFrom, aw), SimdOps::Mul(coefficientTo, bw));
+            const Reg length = SimdOps::Sqrt(SimdOps::Add(SimdOps::Add(SimdOps::Mul(x, x), SimdOps::Mul(y, y)),
+                                                          SimdOps::Add(SimdOps::Mul(z, z), SimdOps::Mul(w, w))));
+            SimdOps::Store(&batch.FromX[i], SimdOps::Div(x, length));
+            SimdOps::Store(&batch.FromY[i], SimdOps::Div(y, length));
+            SimdOps::Store(&batch.FromZ[i], SimdOps::Div(z, length));
+            SimdOps::Store(&batch.FromW[i], SimdOps::Div(w, length));
+        }
+
+        return simdCount;
+    }
+#endif
+
+    // Hermite spline of the glTF specification, tangents are scaled with the keyframe duration
+    glm::vec4 SampleCubicSpline(const GltfAnimationChannel& channel,
+                                const std::size_t key,
+                                const float t,
+                                const float keyDuration)
+    {
+        const float t2 = t * t;
+        const float t3 = t2 * t;
+        const glm::vec4& value = channel.Values[key * 3 + 1];
+        const glm::vec4& outTangent = channel.Values[key * 3 + 2];
+        const glm::vec4& nextInTangent = channel.Values[(key + 1) * 3];
+        const glm::vec4& nextValue = channel.Values[(key + 1) * 3 + 1];
+
+        const glm::vec4 result = (2.0f * t3 - 3.0f * t2 + 1.0f) * value +
+                                 keyDuration * (t3 - 2.0f * t2 + t) * outTangent +
+                                 (-2.0f * t3 + 3.0f * t2) * nextValue + keyDuration * (t3 - t2) * nextInTangent;
+
+        return channel.Path == GltfAnimationPath::ROTATION ? glm::normalize(result) : result;
+    }
+} // namespace
+
+void AnimationSampler::InterpolationBatch::Reserve(const std::size_t count)
+{
+    for (auto* values: {&FromX, &FromY, &FromZ, &FromW, &ToX, &ToY, &ToZ, &ToW, &Factors}) {
+        values->reserve(count);
+    }
+    Channels.reserve(count);
+}
+
+void AnimationSampler::InterpolationBatch::Clear()
+{
+    for (auto* values: {&FromX, &FromY, &FromZ, &FromW, &ToX, &ToY, &ToZ, &ToW, &Factors}) {
+        values->clear();
+    }
+    Channels.clear();
+}
+
+void AnimationSampler::InterpolationBatch::Add(const glm::vec4& from,
+                                               const glm::vec4& to,
+                                               const float factor,
+                                               const std::uint32_t channel)
+{
+    FromX.push_back(from.x);
+    FromY.push_back(from.y);
+    FromZ.push_back(from.z);
+    FromW.push_back(from.w);
+    ToX.push_back(to.x);
+    ToY.push_back(to.y);
+    ToZ.push_back(to.z);
+    ToW.push_back(to.w);
+    Factors.push_back(factor);
+    Channels.push_back(channel);
+}
+
+AnimationSampler::AnimationSampler(const GltfAnimation& animation) : animation_{&animation}
+{
+    const auto channelCount = animation_->Channels.size();
+    for (const auto& channel: animation_->Channels) {
+        if (channel.Times.empty()) {
+            throw std::runtime_error("Animation channel doesn't have any keyframes!");
+        }
+        animatedNodes_.push_back(channel.NodeIndex);
+    }
+
+    cursors_.assign(channelCount, 0);
+    values_.resize(channelCount);
+    lerpBatch_.Reserve(channelCount);
+    slerpBatch_.Reserve(channelCount);
+
+    std::ranges::sort(animatedNodes_);
+    animatedNodes_.erase(std::unique(animatedNodes_.begin(), animatedNodes_.end()), animatedNodes_.end());
+    nodeTransforms_.Resize(animatedNodes_.size());
+    nodeMatrices_.resize(animatedNodes_.size());
+}
+
+void AnimationSampler::Sample(float time, const bool loop)
+{
+    const float duration = animation_->Duration;
+    if (loop && duration > 0.0f) {
+        time = std::fmod(time, duration);
+        time = time < 0.0f ? time + duration : time;
+    }
+    const bool rewind = time < lastTime_;
+    lastTime_ = time;
+
+    lerpBatch_.Clear();
+    slerpBatch_.Clear();
+
+    const auto& channels = animation_->Channels;
+    for (std::uint32_t channelIndex = 0; channelIndex < channels.size(); ++channelIndex) {
+        const auto& channel = channels[channelIndex];
+        const auto& times = channel.Times;
+        const bool isCubic = channel.Interpolation == GltfInterpolation::CUBICSPLINE;
+        const auto keyValue = [&](const std::size_t key) -> const glm::vec4& {
+            return channel.Values[isCubic ? key * 3 + 1 : key];
+        };
+
+        // Outside of the keyframes the first/last value is used
+        if (time <= times.front() || times.size() == 1) {
+            values_[channelIndex] = keyValue(0);
+            cursors_[channelIndex] = 0;
+            continue;
+        }
+        if (time >= times.back()) {
+            values_[channelIndex] = keyValue(times.size() - 1);
+            cursors_[channelIndex] = static_cast<std::uint32_t>(times.size() - 2);
+            continue;
+        }
+
+        // times[key] <= time < times[key + 1], cached cursor only moves forward during the playback
+        std::size_t key = cursors_[channelIndex];
+        if (rewind || times[key] > time) {
+            key = static_cast<std::size_t>(std::upper_bound(times.begin(), times.end(), time) - times.begin()) - 1;
+        }
+        while (times[key + 1] <= time) {
+            ++key;
+        }
+        cursors_[channelIndex] = static_cast<std::uint32_t>(key);
+
+        const float keyDuration = times[key + 1] - times[key];
+        const float factor = (time - times[key]) / keyDuration;
+        switch (channel.Interpolation) {
+            case GltfInterpolation::STEP:
+                values_[channelIndex] = keyValue(key);
+                break;
+            case GltfInterpolation::CUBICSPLINE:
+                values_[channelIndex] = SampleCubicSpline(channel, key, factor, keyDuration);
+                break;
+            case GltfInterpolation::LINEAR: {
+                auto& batch = channel.Path == GltfAnimationPath::ROTATION ? slerpBatch_ : lerpBatch_;
+                batch.Add(keyValue(key), keyValue(key + 1), factor, channelIndex);
+                break;
+            }
+        }
+    }
+
+#if defined(COMMON_SIMD_AVX2) || defined(COMMON_SIMD_SSE2)
+    const std::size_t lerpProcessed = LerpSimd(lerpBatch_);
+    const std::size_t slerpProcessed = SlerpSimd(slerpBatch_);
+#else
+    const std::size_t lerpProcessed = 0;
+    const std::size_t slerpProcessed = 0;
+#endif
+    LerpScalar(lerpBatch_, lerpProcessed);
+    SlerpScalar(slerpBatch_, slerpProcessed);
+
+    // Results are written to the "from" arrays
+    for (const auto* batch: {&lerpBatch_, &slerpBatch_}) {
+        for (std::size_t i = 0; i < batch->Channels.size(); ++i) {
+            values_[batch->Channels[i]] = glm::vec4(batch->FromX[i], batch->FromY[i], batch->FromZ[i], batch->FromW[i]);
+        }
+    }
+}
+
+void AnimationSampler::Apply(GltfModelHandler& model)
+{
+    const auto& channels = animation_->Channels;
+    for (std::size_t i = 0; i < channels.size(); ++i) {
+        auto& node = model.Nodes[channels[i].NodeIndex];
+        const glm::vec4& value = values_[i];
+        switch (channels[i].Path) {
+            case GltfAnimationPath::TRANSLATION:
+                node.Translation = glm::vec3(value);
+                break;
+            case GltfAnimationPath::ROTATION:
+                node.Rotation = glm::quat(value.w, value.x, value.y, value.z);
+                break;
+            case GltfAnimationPath::SCALE:
+                node.Scale = glm::vec3(value);
+                break;
+        }
+    }
+
+    // Local transforms of all animated nodes are composed with one batch call
+    for (std::size_t i = 0; i < animatedNodes_.size(); ++i) {
+        const auto& node = model.Nodes[animatedNodes_[i]];
+        nodeTransforms_.Set(i, node.Translation, node.Rotation, node.Scale);
+    }
+    ComposeModelMatrices(nodeTransforms_, nodeMatrices_);
+
+    for (std::size_t i = 0; i < animatedNodes_.size(); ++i) {
+        model.Nodes[animatedNodes_[i]].LocalTransform = nodeMatrices_[i];
+        model.NodeHierarchy.SetLocalTransform(model.NodeHierarchy.GetFlatIndex(animatedNodes_[i]), nodeMatrices_[i]);
+    }
+}
+
+void AnimationSampler::ResetCursors()
+{
+    std::ranges::fill(cursors_, 0);
+    lastTime_ = 0.0f;
+}
+} // namespace common::utility
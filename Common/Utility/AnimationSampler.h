@@ -0,0 +1,98 @@
+/**
+ * @file    AnimationSampler.h
+ * @brief   This file contains a sampler that evaluates all channels of a glTF animation at once with cached keyframe
+ *          cursors and SSE/AVX2 lerp and slerp kernels (scalar fallback on other targets).
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "BatchTransform.h"
+#include "CoreDefines.h"
+#include "GlfwModelHandler.h"
+
+namespace common::utility
+{
+/**
+ * @brief Samples all channels of an animation. Every channel keeps the keyframe index of the last sample, so monotonic
+ * playback moves the cursor forward a few keys instead of a binary search per channel per frame (binary search is only
+ * used when the time goes backwards, e.g. when the animation loops). LINEAR channels are interpolated in batches,
+ * translations and scales with lerp and rotations with a polynomial slerp approximation (max error ~1e-5).
+ */
+class COMMON_API AnimationSampler
+{
+public:
+    /**
+     * @param animation Animation that will be sampled, it must outlive the sampler.
+     */
+    explicit AnimationSampler(const GltfAnimation& animation);
+
+    /**
+     * @brief Evaluates all channels.
+     * @param time Time in seconds.
+     * @param loop Wraps the time with the duration of the animation, otherwise values are clamped at the last keyframe.
+     */
+    void Sample(float time, bool loop = true);
+
+    /**
+     * @brief Writes the sampled values to the animated nodes, composes their local transforms and marks them as dirty
+     * in the node hierarchy of the model. NodeHierarchy.Update() must be called after it to get world transforms.
+     * @param model Model that owns the animation.
+     */
+    void Apply(GltfModelHandler& model);
+
+    /**
+     * @brief Moves all cursors to the first keyframe.
+     */
+    void ResetCursors();
+
+    /**
+     * @return Returns sampled value of every channel (xyz for translation and scale, xyzw quaternion for rotation).
+     */
+    [[nodiscard]] std::span<const glm::vec4> GetValues() const { return values_; }
+
+    /**
+     * @return Returns the animation that is sampled.
+     */
+    [[nodiscard]] const GltfAnimation& GetAnimation() const { return *animation_; }
+
+private:
+    // Keyframe pairs of LINEAR channels in structure of arrays layout, every item is interpolated with its own factor
+    struct InterpolationBatch
+    {
+        std::vector<float> FromX, FromY, FromZ, FromW;
+        std::vector<float> ToX, ToY, ToZ, ToW;
+        std::vector<float> Factors;
+        std::vector<std::uint32_t> Channels;
+
+        void Reserve(std::size_t count);
+
+        void Clear();
+
+        void Add(const glm::vec4& from, const glm::vec4& to, float factor, std::uint32_t channel);
+    };
+
+    const GltfAnimation* animation_;
+    std::vector<std::uint32_t> cursors_;
+    std::vector<glm::vec4> values_;
+    float lastTime_ = 0.0f;
+
+    InterpolationBatch lerpBatch_;
+    InterpolationBatch slerpBatch_;
+
+    // Unique animated nodes and the transforms that are composed for them in Apply
+    std::vector<std::uint32_t> animatedNodes_;
+    TransformArrays nodeTransforms_;
+    std::vector<glm::mat4> nodeMatrices_;
+};
+} // namespace common::utility
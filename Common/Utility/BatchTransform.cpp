@@ -0,0 +1,229 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "BatchTransform.h"
+
+#include <stdexcept>
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include "SimdOps.h"
+
+namespace common::utility
+{
+void TransformArrays::Resize(const std::size_t count)
+{
+    PositionX.resize(count, 0.0f);
+    PositionY.resize(count, 0.0f);
+    PositionZ.resize(count, 0.0f);
+    RotationX.resize(count, 0.0f);
+    RotationY.resize(count, 0.0f);
+    RotationZ.resize(count, 0.0f);
+    RotationW.resize(count, 1.0f);
+    ScaleX.resize(count, 1.0f);
+    ScaleY.resize(count, 1.0f);
+    ScaleZ.resize(count, 1.0f);
+}
+
+void TransformArrays::Set(const std::size_t index,
+                          const glm::vec3& position,
+                          const glm::quat& rotation,
+                          const glm::vec3& scale)
+{
+    PositionX[index] = position.x;
+    PositionY[index] = position.y;
+    PositionZ[index] = position.z;
+    RotationX[index] = rotation.x;
+    RotationY[index] = rotation.y;
+    RotationZ[index] = rotation.z;
+    RotationW[index] = rotation.w;
+    ScaleX[index] = scale.x;
+    ScaleY[index] = scale.y;
+    ScaleZ[index] = scale.z;
+}
+
+namespace
+{
+    // Rotation terms are calculated like glm::mat3_cast and the products are summed in glm's order without FMA, so
+    // all kernels give the same results with viewProjection * translate(position) * mat4_cast(rotation) * scale(scale)
+    // of glm (unless the compiler contracts the glm path into FMA instructions).
+    template<bool ApplyViewProjection>
+    void ComposeScalar(const TransformArrays& transforms,
+                       const glm::mat4& viewProjection,
+                       const std::span<glm::mat4> matrices,
+                       const std::size_t begin)
+    {
+        for (std::size_t i = begin; i < transforms.Size(); ++i) {
+            const float x = transforms.RotationX[i];
+            const float y = transforms.RotationY[i];
+            const float z = transforms.RotationZ[i];
+            const float w = transforms.RotationW[i];
+            const float xx = x * x, yy = y * y, zz = z * z;
+            const float xy = x * y, xz = x * z, yz = y * z;
+            const float wx = w * x, wy = w * y, wz = w * z;
+
+            const float sx = transforms.ScaleX[i], sy = transforms.ScaleY[i], sz = transforms.ScaleZ[i];
+
+            glm::mat4 model;
+            model[0] = glm::vec4(1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy), 0.0f) * sx;
+            model[1] = glm::vec4(2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx), 0.0f) * sy;
+            model[2] = glm::vec4(2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy), 0.0f) * sz;
+            model[3] = glm::vec4(transforms.PositionX[i], transforms.PositionY[i], transforms.PositionZ[i], 1.0f);
+
+            if constexpr (ApplyViewProjection) {
+                matrices[i] = viewProjection * model;
+            } else {
+                matrices[i] = model;
+            }
+        }
+    }
+
+#if defined(COMMON_SIMD_AVX2)
+    // Rows of a matrix column of 8 objects are transposed into 8 column vectors
+    void StoreColumn(const SimdOps::Reg (&rows)[4], glm::mat4* matrices, const int column)
+    {
+        using Reg = SimdOps::Reg;
+        const Reg t0 = _mm256_unpacklo_ps(rows[0], rows[1]);
+        const Reg t1 = _mm256_unpackhi_ps(rows[0], rows[1]);
+        const Reg t2 = _mm256_unpacklo_ps(rows[2], rows[3]);
+        const Reg t3 = _mm256_unpackhi_ps(rows[2], rows[3]);
+        const Reg objects[4] = {_mm256_shuffle_ps(t0, t2, 0x44), _mm256_shuffle_ps(t0, t2, 0xEE),
+                                _mm256_shuffle_ps(t1, t3, 0x44), _mm256_shuffle_ps(t1, t3, 0xEE)};
+        for (int i = 0; i < 4; ++i) {
+            _mm_storeu_ps(glm::value_ptr(matrices[i][column]), _mm256_castps256_ps128(objects[i]));
+            _mm_storeu_ps(glm::value_ptr(matrices[i + 4][column]), _mm256_extractf128_ps(objects[i], 1));
+        }
+    }
+#elif defined(COMMON_SIMD_SSE2)
+    // Rows of a matrix column of 4 objects are transposed into 4 column vectors
+    void StoreColumn(const SimdOps::Reg (&rows)[4], glm::mat4* matrices, const int column)
+    {
+        SimdOps::Reg r0 = rows[0], r1 = rows[1], r2 = rows[2], r3 = rows[3];
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        _mm_storeu_ps(glm::value_ptr(matrices[0][column]), r0);
+        _mm_storeu_ps(glm::value_ptr(matrices[1][column]), r1);
+        _mm_storeu_ps(glm::value_ptr(matrices[2][column]), r2);
+        _mm_storeu_ps(glm::value_ptr(matrices[3][column]), r3);
+    }
+#endif
+
+#if defined(COMMON_SIMD_AVX2) || defined(COMMON_SIMD_SSE2)
+    /**
+     * Every lane of a register belongs to another object. Matrix elements of Width objects are calculated together and
+     * transposed back to column major glm matrices while storing. Returns number of the processed objects.
+     */
+    template<bool ApplyViewProjection>
+    std::size_t ComposeSimd(const TransformArrays& transforms,
+                            const glm::mat4& viewProjection,
+                            const std::span<glm::mat4> matrices)
+    {
+        using Reg = SimdOps::Reg;
+        const std::size_t simdCount = transforms.Size() / SimdOps::Width * SimdOps::Width;
+
+        Reg vp[4][4];
+        for (int column = 0; column < 4; ++column) {
+            for (int row = 0; row < 4; ++row) {
+                vp[column][row] = SimdOps::Set1(viewProjection[column][row]);
+            }
+        }
+        const Reg zero = SimdOps::Set1(0.0f);
+        const Reg one = SimdOps::Set1(1.0f);
+        const Reg two = SimdOps::Set1(2.0f);
+
+        for (std::size_t i = 0; i < simdCount; i += SimdOps::Width) {
+            const Reg x = SimdOps::Load(&transforms.RotationX[i]);
+            const Reg y = SimdOps::Load(&transforms.RotationY[i]);
+            const Reg z = SimdOps::Load(&transforms.RotationZ[i]);
+            const Reg w = SimdOps::Load(&transforms.RotationW[i]);
+            const Reg xx = SimdOps::Mul(x, x), yy = SimdOps::Mul(y, y), zz = SimdOps::Mul(z, z);
+            const Reg xy = SimdOps::Mul(x, y), xz = SimdOps::Mul(x, z), yz = SimdOps::Mul(y, z);
+            const Reg wx = SimdOps::Mul(w, x), wy = SimdOps::Mul(w, y), wz = SimdOps::Mul(w, z);
+            const Reg sx = SimdOps::Load(&transforms.ScaleX[i]);
+            const Reg sy = SimdOps::Load(&transforms.ScaleY[i]);
+            const Reg sz = SimdOps::Load(&transforms.ScaleZ[i]);
+
+            // Rows 0-2 of the model matrix columns, row 3 is 0 for the rotation columns and 1 for the translation
+            const Reg model[4][3] = {
+                {SimdOps::Mul(SimdOps::Sub(one, SimdOps::Mul(two, SimdOps::Add(yy, zz))), sx),
+                 SimdOps::Mul(SimdOps::Mul(two, SimdOps::Add(xy, wz)), sx),
+                 SimdOps::Mul(SimdOps::Mul(two, SimdOps::Sub(xz, wy)), sx)},
+                {SimdOps::Mul(SimdOps::Mul(two, SimdOps::Sub(xy, wz)), sy),
+                 SimdOps::Mul(SimdOps::Sub(one, SimdOps::Mul(two, SimdOps::Add(xx, zz))), sy),
+                 SimdOps::Mul(SimdOps::Mul(two, SimdOps::Add(yz, wx)), sy)},
+                {SimdOps::Mul(SimdOps::Mul(two, SimdOps::Add(xz, wy)), sz),
+                 SimdOps::Mul(SimdOps::Mul(two, SimdOps::Sub(yz, wx)), sz),
+                 SimdOps::Mul(SimdOps::Sub(one, SimdOps::Mul(two, SimdOps::Add(xx, yy))), sz)},
+                {SimdOps::Load(&transforms.PositionX[i]), SimdOps::Load(&transforms.PositionY[i]),
+                 SimdOps::Load(&transforms.PositionZ[i])}};
+
+            for (int column = 0; column < 4; ++column) {
+                Reg rows[4];
+                for (int row = 0; row < 4; ++row) {
+                    if constexpr (ApplyViewProjection) {
+                        // Same summation order with glm's mat4 * mat4
+                        const Reg sum = SimdOps::Add(SimdOps::Add(SimdOps::Mul(vp[0][row], model[column][0]),
+                                                                  SimdOps::Mul(vp[1][row], model[column][1])),
+                                                     SimdOps::Mul(vp[2][row], model[column][2]));
+                        rows[row] = column == 3 ? SimdOps::Add(sum, vp[3][row]) : SimdOps::Add(sum, zero);
+                    } else {
+                        rows[row] = row < 3 ? model[column][row] : (column == 3 ? one : zero);
+                    }
+                }
+                StoreColumn(rows, &matrices[i], column);
+            }
+        }
+
+        return simdCount;
+    }
+#endif
+
+    template<bool ApplyViewProjection>
+    void Compose(const TransformArrays& transforms,
+                 const glm::mat4& viewProjection,
+                 const std::span<glm::mat4> matrices)
+    {
+        if (matrices.size() < transforms.Size()) {
+            throw std::runtime_error("Output matrix span is smaller than the transform count!");
+        }
+
+#if defined(COMMON_SIMD_AVX2) || defined(COMMON_SIMD_SSE2)
+        const std::size_t processed = ComposeSimd<ApplyViewProjection>(transforms, viewProjection, matrices);
+#else
+        const std::size_t processed = 0;
+#endif
+
+        ComposeScalar<ApplyViewProjection>(transforms, viewProjection, matrices, processed);
+    }
+} // namespace
+
+void ComposeModelMatrices(const TransformArrays& transforms, const std::span<glm::mat4> models)
+{
+    Compose<false>(transforms, glm::mat4(1.0f), models);
+}
+
+void ComposeMvpMatrices(const TransformArrays& transforms,
+                        const glm::mat4& viewProjection,
+                        const std::span<glm::mat4> mvps)
+{
+    Compose<true>(transforms, viewProjection, mvps);
+}
+
+void ComposeMvpMatricesScalar(const TransformArrays& transforms,
+                              const glm::mat4& viewProjection,
+                              const std::span<glm::mat4> mvps)
+{
+    if (mvps.size() < transforms.Size()) {
+        throw std::runtime_error("Output matrix span is smaller than the transform count!");
+    }
+
+    ComposeScalar<true>(transforms, viewProjection, mvps, 0);
+}
+
+const char* GetBatchTransformBackend()
+{
+    return simdBackendName;
+}
+} // namespace common::utility
@@ -0,0 +1,91 @@
+/**
+ * @file    BatchTransform.h
+ * @brief   This file contains batch transform functions that compose model and MVP matrices of many objects at once
+ *          from structure of arrays transforms with SSE/AVX2 kernels (scalar fallback on other targets).
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include "CoreDefines.h"
+
+namespace common::utility
+{
+/**
+ * @brief Translation, rotation (unit quaternion) and scale of N objects in structure of arrays layout. Every component
+ * is kept in its own array, so SIMD kernels load the same component of 4 (SSE) or 8 (AVX2) objects with one load.
+ */
+struct COMMON_API TransformArrays
+{
+    std::vector<float> PositionX, PositionY, PositionZ;
+    std::vector<float> RotationX, RotationY, RotationZ, RotationW;
+    std::vector<float> ScaleX, ScaleY, ScaleZ;
+
+    /**
+     * @brief Resizes all component arrays. New objects have identity transforms.
+     * @param count Number of the objects.
+     */
+    void Resize(std::size_t count);
+
+    /**
+     * @brief Writes the transform of an object.
+     * @param index Index of the object.
+     * @param position Translation of the object.
+     * @param rotation Rotation of the object (must be normalized).
+     * @param scale Scale of the object.
+     */
+    void Set(std::size_t index, const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale);
+
+    /**
+     * @brief Returns number of the objects.
+     * @return Returns number of the objects.
+     */
+    [[nodiscard]] std::size_t Size() const { return PositionX.size(); }
+};
+
+/**
+ * @brief Composes model matrices (translate * rotate * scale) of all objects.
+ * @param transforms Transforms of the objects.
+ * @param models Output matrices, it must have at least transforms.Size() elements.
+ */
+COMMON_API void ComposeModelMatrices(const TransformArrays& transforms, std::span<glm::mat4> models);
+
+/**
+ * @brief Composes MVP matrices (viewProjection * model) of all objects. View-projection matrix is shared, so it is
+ * calculated once by the caller instead of once per object.
+ * @param transforms Transforms of the objects.
+ * @param viewProjection Projection * view matrix.
+ * @param mvps Output matrices, it must have at least transforms.Size() elements.
+ */
+COMMON_API void ComposeMvpMatrices(const TransformArrays& transforms,
+                                   const glm::mat4& viewProjection,
+                                   std::span<glm::mat4> mvps);
+
+/**
+ * @brief Scalar version of ComposeMvpMatrices. SIMD kernels use it for the remaining objects, and it can be used as
+ * reference for comparisons.
+ * @param transforms Transforms of the objects.
+ * @param viewProjection Projection * view matrix.
+ * @param mvps Output matrices, it must have at least transforms.Size() elements.
+ */
+COMMON_API void ComposeMvpMatricesScalar(const TransformArrays& transforms,
+                                         const glm::mat4& viewProjection,
+                                         std::span<glm::mat4> mvps);
+
+/**
+ * @brief Returns name of the kernel that is selected at compile time.
+ * @return Returns "AVX2", "SSE2" or "Scalar".
+ */
+COMMON_API const char* GetBatchTransformBackend();
+} // namespace common::utility
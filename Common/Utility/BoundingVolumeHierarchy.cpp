@@ -0,0 +1,446 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "BoundingVolumeHierarchy.h"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+namespace common::utility
+{
+namespace
+{
+    // Half of the surface area of a box, the constant factor doesn't change the SAH comparisons
+    float HalfArea(const glm::vec3& min, const glm::vec3& max)
+    {
+        const glm::vec3 size = max - min;
+        return size.x * size.y + size.y * size.z + size.z * size.x;
+    }
+
+    // Entry distance of a ray into a box (0 if the origin is inside), or max float if it misses the box
+    float IntersectBox(const glm::vec3& origin,
+                       const glm::vec3& inverseDirection,
+                       const glm::vec3& min,
+                       const glm::vec3& max,
+                       const float maxDistance)
+    {
+        const glm::vec3 t1 = (min - origin) * inverseDirection;
+        const glm::vec3 t2 = (max - origin) * inverseDirection;
+        const glm::vec3 tNear = glm::min(t1, t2);
+        const glm::vec3 tFar = glm::max(t1, t2);
+        const float entry = std::max({tNear.x, tNear.y, tNear.z, 0.0f});
+        const float exit = std::min({tFar.x, tFar.y, tFar.z, maxDistance});
+        return entry <= exit ? entry : std::numeric_limits<float>::max();
+    }
+
+    struct Bin
+    {
+        glm::vec3 Min = glm::vec3(std::numeric_limits<float>::max());
+        glm::vec3 Max = glm::vec3(std::numeric_limits<float>::lowest());
+        std::uint32_t Count = 0;
+
+        void Grow(const glm::vec3& min, const glm::vec3& max)
+        {
+            Min = glm::min(Min, min);
+            Max = glm::max(Max, max);
+        }
+
+        void Grow(const Bin& other)
+        {
+            Min = glm::min(Min, other.Min);
+            Max = glm::max(Max, other.Max);
+            Count += other.Count;
+        }
+
+        [[nodiscard]] float Cost() const { return Count == 0 ? 0.0f : static_cast<float>(Count) * HalfArea(Min, Max); }
+    };
+} // namespace
+
+Ray CreateScreenRay(const glm::mat4& viewProjection, const glm::vec2& ndc)
+{
+    // Points on the near and far planes of a [-1, 1] depth projection, the line is the same for [0, 1] depth
+    const glm::mat4 inverseViewProjection = glm::inverse(viewProjection);
+    glm::vec4 nearPoint = inverseViewProjection * glm::vec4(ndc, -1.0f, 1.0f);
+    glm::vec4 farPoint = inverseViewProjection * glm::vec4(ndc, 1.0f, 1.0f);
+    nearPoint /= nearPoint.w;
+    farPoint /= farPoint.w;
+
+    Ray ray;
+    ray.Origin = glm::vec3(nearPoint);
+    ray.Direction = glm::normalize(glm::vec3(farPoint) - glm::vec3(nearPoint));
+    return ray;
+}
+
+void BoundingVolumeHierarchy::Build(const BoundsArrays& bounds)
+{
+    const auto count = static_cast<std::uint32_t>(bounds.Size());
+    objectMin_.resize(count);
+    objectMax_.resize(count);
+    objectIndices_.resize(count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        const glm::vec3 center{bounds.CenterX[i], bounds.CenterY[i], bounds.CenterZ[i]};
+        const glm::vec3 extent{bounds.ExtentX[i], bounds.ExtentY[i], bounds.ExtentZ[i]};
+        objectMin_[i] = center - extent;
+        objectMax_[i] = center + extent;
+        objectIndices_[i] = i;
+    }
+
+    BuildTree();
+}
+
+void BoundingVolumeHierarchy::Build(const std::vector<GltfNode>& nodes)
+{
+    objectMin_.resize(nodes.size());
+    objectMax_.resize(nodes.size());
+    objectIndices_.clear();
+    for (std::uint32_t i = 0; i < nodes.size(); ++i) {
+        objectMin_[i] = nodes[i].BoundsMin;
+        objectMax_[i] = nodes[i].BoundsMax;
+        if (nodes[i].MeshIndex != UINT32_MAX) {
+            objectIndices_.push_back(i);
+        }
+    }
+
+    BuildTree();
+}
+
+void BoundingVolumeHierarchy::BuildTree()
+{
+    nodes_.clear();
+    objectLeaves_.assign(objectMin_.size(), UINT32_MAX);
+    firstDirty_ = UINT32_MAX;
+    lastDirty_ = 0;
+    if (objectIndices_.empty()) {
+        dirty_.clear();
+        return;
+    }
+
+    // Binary tree with N leaves has at most 2N - 1 nodes, so the node references are not invalidated while splitting
+    nodes_.reserve(2 * objectIndices_.size() - 1);
+    nodes_.push_back({.FirstObject = 0,
+                      .ObjectCount = static_cast<std::uint32_t>(objectIndices_.size()),
+                      .LeftChild = UINT32_MAX,
+                      .Parent = UINT32_MAX});
+    UpdateNodeBounds(nodes_[0]);
+
+    std::vector<std::uint32_t> stack{0};
+    while (!stack.empty()) {
+        const auto nodeIndex = stack.back();
+        stack.pop_back();
+
+        Subdivide(nodeIndex);
+        const auto& node = nodes_[nodeIndex];
+        if (node.LeftChild != UINT32_MAX) {
+            stack.push_back(node.LeftChild + 1);
+            stack.push_back(node.LeftChild);
+            continue;
+        }
+
+        for (std::uint32_t i = node.FirstObject; i < node.FirstObject + node.ObjectCount; ++i) {
+            objectLeaves_[objectIndices_[i]] = nodeIndex;
+        }
+    }
+
+    dirty_.assign(nodes_.size(), 0);
+}
+
+void BoundingVolumeHierarchy::Subdivide(const std::uint32_t nodeIndex)
+{
+    auto& node = nodes_[nodeIndex];
+    if (node.ObjectCount <= MaxLeafObjectCount) {
+        return;
+    }
+
+    const auto first = objectIndices_.begin() + node.FirstObject;
+    const auto last = first + node.ObjectCount;
+    const auto centerOf = [&](const std::uint32_t objectIndex) {
+        return (objectMin_[objectIndex] + objectMax_[objectIndex]) * 0.5f;
+    };
+
+    glm::vec3 centerMin{std::numeric_limits<float>::max()};
+    glm::vec3 centerMax{std::numeric_limits<float>::lowest()};
+    for (auto it = first; it != last; ++it) {
+        centerMin = glm::min(centerMin, centerOf(*it));
+        centerMax = glm::max(centerMax, centerOf(*it));
+    }
+
+    // Box centers are put into bins on every axis, the best plane between two bins has the minimum
+    // (left count * left area + right count * right area)
+    int bestAxis = -1;
+    std::uint32_t bestSplit = 0;
+    float bestCost = std::numeric_limits<float>::max();
+    for (int axis = 0; axis < 3; ++axis) {
+        const float extent = centerMax[axis] - centerMin[axis];
+        if (extent <= 0.0f) {
+            continue;
+        }
+
+        const float scale = static_cast<float>(BinCount) / extent;
+        std::array<Bin, BinCount> bins{};
+        for (auto it = first; it != last; ++it) {
+            const auto bin = std::min(static_cast<std::uint32_t>((centerOf(*it)[axis] - centerMin[axis]) * scale),
+                                      BinCount - 1);
+            bins[bin].Grow(objectMin_[*it], objectMax_[*it]);
+            ++bins[bin].Count;
+        }
+
+        std::array<float, BinCount - 1> leftCosts{};
+        Bin left;
+        for (std::uint32_t i = 0; i + 1 < BinCount; ++i) {
+            left.Grow(bins[i]);
+            leftCosts[i] = left.Cost();
+        }
+
+        Bin right;
+        for (std::uint32_t i = BinCount - 1; i > 0; --i) {
+            right.Grow(bins[i]);
+            const float cost = leftCosts[i - 1] + right.Cost();
+            if (cost < bestCost) {
+                bestAxis = axis;
+                bestSplit = i;
+                bestCost = cost;
+            }
+        }
+    }
+
+    auto middle = first;
+    if (bestAxis >= 0) {
+        const float scale = static_cast<float>(BinCount) / (centerMax[bestAxis] - centerMin[bestAxis]);
+        middle = std::partition(first, last, [&](const std::uint32_t objectIndex) {
+            const auto bin = std::min(
+                    static_cast<std::uint32_t>((centerOf(objectIndex)[bestAxis] - centerMin[bestAxis]) * scale),
+                    BinCount - 1);
+            return bin < bestSplit;
+        });
+    }
+
+    // All centers are at the same point, the objects are split in half
+    if (middle == first || middle == last) {
+        middle = first + node.ObjectCount / 2;
+    }
+
+    const auto leftCount = static_cast<std::uint32_t>(middle - first);
+    const auto leftChild = static_cast<std::uint32_t>(nodes_.size());
+    nodes_.push_back({.FirstObject = node.FirstObject,
+                      .ObjectCount = leftCount,
+                      .LeftChild = UINT32_MAX,
+                      .Parent = nodeIndex});
+    nodes_.push_back({.FirstObject = node.FirstObject + leftCount,
+                      .ObjectCount = node.ObjectCount - leftCount,
+                      .LeftChild = UINT32_MAX,
+                      .Parent = nodeIndex});
+    UpdateNodeBounds(nodes_[leftChild]);
+    UpdateNodeBounds(nodes_[leftChild + 1]);
+    node.LeftChild = leftChild;
+}
+
+void BoundingVolumeHierarchy::UpdateNodeBounds(Node& node) const
+{
+    if (node.LeftChild != UINT32_MAX) {
+        const auto& left = nodes_[node.LeftChild];
+        const auto& right = nodes_[node.LeftChild + 1];
+        node.Min = glm::min(left.Min, right.Min);
+        node.Max = glm::max(left.Max, right.Max);
+        return;
+    }
+
+    node.Min = glm::vec3(std::numeric_limits<float>::max());
+    node.Max = glm::vec3(std::numeric_limits<float>::lowest());
+    for (std::uint32_t i = node.FirstObject; i < node.FirstObject + node.ObjectCount; ++i) {
+        node.Min = glm::min(node.Min, objectMin_[objectIndices_[i]]);
+        node.Max = glm::max(node.Max, objectMax_[objectIndices_[i]]);
+    }
+}
+
+void BoundingVolumeHierarchy::SetObjectBounds(const std::uint32_t objectIndex,
+                                              const glm::vec3& min,
+                                              const glm::vec3& max)
+{
+    if (objectMin_[objectIndex] == min && objectMax_[objectIndex] == max) {
+        return;
+    }
+    objectMin_[objectIndex] = min;
+    objectMax_[objectIndex] = max;
+
+    // Ancestors of a marked node are already marked
+    for (auto nodeIndex = objectLeaves_[objectIndex]; nodeIndex != UINT32_MAX && dirty_[nodeIndex] == 0;
+         nodeIndex = nodes_[nodeIndex].Parent) {
+        dirty_[nodeIndex] = 1;
+        firstDirty_ = std::min(firstDirty_, nodeIndex);
+        lastDirty_ = std::max(lastDirty_, nodeIndex);
+    }
+}
+
+std::uint32_t BoundingVolumeHierarchy::Refit()
+{
+    if (firstDirty_ > lastDirty_) {
+        return 0;
+    }
+
+    std::uint32_t refitCount = 0;
+    for (auto nodeIndex = lastDirty_ + 1; nodeIndex-- > firstDirty_;) {
+        if (dirty_[nodeIndex] == 0) {
+            continue;
+        }
+
+        UpdateNodeBounds(nodes_[nodeIndex]);
+        dirty_[nodeIndex] = 0;
+        ++refitCount;
+    }
+
+    firstDirty_ = UINT32_MAX;
+    lastDirty_ = 0;
+    return refitCount;
+}
+
+template<typename Function>
+void BoundingVolumeHierarchy::ForEachVisibleRange(const Frustum& frustum, Function&& function) const
+{
+    if (nodes_.empty()) {
+        return;
+    }
+
+    // Classifies a box against the planes of the mask, the planes which fully contain the box are removed from the
+    // mask. Returns false if the box is fully outside of a plane.
+    const auto classify = [&](const glm::vec3& min, const glm::vec3& max, std::uint32_t& planeMask) {
+        const glm::vec3 center = (min + max) * 0.5f;
+        const glm::vec3 extent = (max - min) * 0.5f;
+        for (std::uint32_t plane = 0; plane < frustum.Planes.size(); ++plane) {
+            if ((planeMask & (1u << plane)) == 0) {
+                continue;
+            }
+
+            const glm::vec4& p = frustum.Planes[plane];
+            const float distance = glm::dot(glm::vec3(p), center) + p.w;
+            const float radius = glm::dot(glm::abs(glm::vec3(p)), extent);
+            if (distance + radius < 0.0f) {
+                return false;
+            }
+            if (distance - radius >= 0.0f) {
+                planeMask &= ~(1u << plane);
+            }
+        }
+        return true;
+    };
+
+    // Left child is pushed last, so the ranges are emitted in the increasing order
+    constexpr std::uint32_t allPlanes = (1u << 6) - 1;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> stack{{0, allPlanes}};
+    while (!stack.empty()) {
+        const auto [nodeIndex, parentMask] = stack.back();
+        stack.pop_back();
+
+        const auto& node = nodes_[nodeIndex];
+        std::uint32_t planeMask = parentMask;
+        if (!classify(node.Min, node.Max, planeMask)) {
+            continue;
+        }
+
+        if (planeMask == 0) {
+            function(node.FirstObject, node.ObjectCount);
+        } else if (node.LeftChild != UINT32_MAX) {
+            stack.emplace_back(node.LeftChild + 1, planeMask);
+            stack.emplace_back(node.LeftChild, planeMask);
+        } else {
+            for (std::uint32_t i = node.FirstObject; i < node.FirstObject + node.ObjectCount; ++i) {
+                std::uint32_t objectMask = planeMask;
+                if (classify(objectMin_[objectIndices_[i]], objectMax_[objectIndices_[i]], objectMask)) {
+                    function(i, 1u);
+                }
+            }
+        }
+    }
+}
+
+std::size_t BoundingVolumeHierarchy::CullFrustum(const Frustum& frustum, std::vector<BvhRange>& visibleRanges) const
+{
+    visibleRanges.clear();
+
+    std::size_t visibleCount = 0;
+    ForEachVisibleRange(frustum, [&](const std::uint32_t first, const std::uint32_t count) {
+        if (!visibleRanges.empty() && visibleRanges.back().First + visibleRanges.back().Count == first) {
+            visibleRanges.back().Count += count;
+        } else {
+            visibleRanges.push_back({first, count});
+        }
+        visibleCount += count;
+    });
+
+    return visibleCount;
+}
+
+std::size_t BoundingVolumeHierarchy::CullFrustum(const Frustum& frustum,
+                                                 std::vector<std::uint32_t>& visibleIndices) const
+{
+    visibleIndices.clear();
+    ForEachVisibleRange(frustum, [&](const std::uint32_t first, const std::uint32_t count) {
+        visibleIndices.insert(visibleIndices.end(), objectIndices_.begin() + first,
+                              objectIndices_.begin() + first + count);
+    });
+
+    return visibleIndices.size();
+}
+
+RayHit BoundingVolumeHierarchy::CastRay(const Ray& ray, const float maxDistance) const
+{
+    RayHit hit;
+    hit.Distance = maxDistance;
+    if (nodes_.empty()) {
+        return hit;
+    }
+
+    // Division by zero gives infinities, so the slabs which are parallel to the ray never limit the distances
+    const glm::vec3 inverseDirection = 1.0f / ray.Direction;
+    const auto entryOf = [&](const glm::vec3& min, const glm::vec3& max) {
+        return IntersectBox(ray.Origin, inverseDirection, min, max, hit.Distance);
+    };
+
+    constexpr float miss = std::numeric_limits<float>::max();
+    std::vector<std::pair<std::uint32_t, float>> stack;
+    if (const float entry = entryOf(nodes_[0].Min, nodes_[0].Max); entry != miss) {
+        stack.emplace_back(0, entry);
+    }
+
+    while (!stack.empty()) {
+        const auto [nodeIndex, nodeEntry] = stack.back();
+        stack.pop_back();
+        if (nodeEntry > hit.Distance) {
+            continue;
+        }
+
+        const auto& node = nodes_[nodeIndex];
+        if (node.LeftChild == UINT32_MAX) {
+            for (std::uint32_t i = node.FirstObject; i < node.FirstObject + node.ObjectCount; ++i) {
+                const auto objectIndex = objectIndices_[i];
+                const float entry = entryOf(objectMin_[objectIndex], objectMax_[objectIndex]);
+                if (entry != miss && (hit.ObjectIndex == UINT32_MAX || entry < hit.Distance)) {
+                    hit.ObjectIndex = objectIndex;
+                    hit.Distance = entry;
+                }
+            }
+            continue;
+        }
+
+        // Nearer child is pushed last, so it is visited first
+        const float leftEntry = entryOf(nodes_[node.LeftChild].Min, nodes_[node.LeftChild].Max);
+        const float rightEntry = entryOf(nodes_[node.LeftChild + 1].Min, nodes_[node.LeftChild + 1].Max);
+        const bool isLeftNearer = leftEntry <= rightEntry;
+        const std::pair<std::uint32_t, float> nearChild{isLeftNearer ? node.LeftChild : node.LeftChild + 1,
+                                                        isLeftNearer ? leftEntry : rightEntry};
+        const std::pair<std::uint32_t, float> farChild{isLeftNearer ? node.LeftChild + 1 : node.LeftChild,
+                                                       isLeftNearer ? rightEntry : leftEntry};
+        if (farChild.second != miss) {
+            stack.push_back(farChild);
+        }
+        if (nearChild.second != miss) {
+            stack.push_back(nearChild);
+        }
+    }
+
+    return hit;
+}
+} // namespace common::utility
@@ -0,0 +1,178 @@
+/**
+ * @file    BoundingVolumeHierarchy.h
+ * @brief   This file contains a bounding volume hierarchy over world space boxes (SAH build, incremental refit) with
+ *          frustum traversal and ray casts.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "CoreDefines.h"
+#include "FrustumCulling.h"
+#include "GlfwModelHandler.h"
+
+namespace common::utility
+{
+/**
+ * @brief World space ray, direction doesn't have to be normalized (hit distances are in the units of its length).
+ */
+struct COMMON_API Ray
+{
+    glm::vec3 Origin = glm::vec3(0.0f);
+    glm::vec3 Direction = glm::vec3(0.0f, 0.0f, -1.0f);
+};
+
+/**
+ * @brief Creates the world space ray through a point of the screen (normalized direction).
+ * @param viewProjection Projection * view matrix.
+ * @param ndc Point in normalized device coordinates ([-1, 1], (0, 0) is the center of the screen).
+ * @return Returns the ray which starts on the near plane.
+ */
+COMMON_API Ray CreateScreenRay(const glm::mat4& viewProjection, const glm::vec2& ndc);
+
+/**
+ * @brief Nearest object which is hit by a ray.
+ */
+struct COMMON_API RayHit
+{
+    std::uint32_t ObjectIndex = UINT32_MAX; // UINT32_MAX if nothing is hit
+    float Distance = std::numeric_limits<float>::max();
+};
+
+/**
+ * @brief Range [First, First + Count) of BoundingVolumeHierarchy::GetObjectIndices().
+ */
+struct COMMON_API BvhRange
+{
+    std::uint32_t First;
+    std::uint32_t Count;
+};
+
+/**
+ * @brief Binary bounding volume hierarchy. Build splits the nodes with the surface area heuristic over binned box
+ * centers, objects of every subtree are a contiguous range of GetObjectIndices(), so the frustum traversal emits whole
+ * ranges for the subtrees which are fully inside of the frustum.
+ *
+ * Moving objects update their boxes with SetObjectBounds and Refit recalculates only the nodes on the paths from the
+ * changed leaves to the root. Refit keeps the topology, so the tree should be rebuilt when the objects move far from
+ * their places at build time.
+ */
+class COMMON_API BoundingVolumeHierarchy
+{
+public:
+    static constexpr std::uint32_t MaxLeafObjectCount = 4;
+    static constexpr std::uint32_t BinCount = 16;
+
+    /**
+     * @brief Builds the tree over all boxes, object index of a box is its index in the arrays.
+     * @param bounds World boxes of the objects.
+     */
+    void Build(const BoundsArrays& bounds);
+
+    /**
+     * @brief Builds the tree over the world bounds of the nodes which have a mesh, object index of a node is its index
+     * in the node array.
+     * @param nodes Nodes of a glTF model.
+     */
+    void Build(const std::vector<GltfNode>& nodes);
+
+    /**
+     * @brief Changes the box of an object and marks the path from its leaf to the root for the next Refit. Nothing is
+     * marked if the box is the same.
+     * @param objectIndex Index of the object.
+     * @param min Minimum corner of the new box.
+     * @param max Maximum corner of the new box.
+     */
+    void SetObjectBounds(std::uint32_t objectIndex, const glm::vec3& min, const glm::vec3& max);
+
+    /**
+     * @brief Recalculates bounds of the marked nodes, children before their parents.
+     * @return Returns number of the recalculated nodes.
+     */
+    std::uint32_t Refit();
+
+    /**
+     * @brief Collects the objects whose boxes are not fully outside of any frustum plane. Subtrees which are fully
+     * inside are emitted without visiting their children, adjacent ranges are merged.
+     * @param frustum Frustum planes.
+     * @param visibleRanges Output ranges of GetObjectIndices(), it is cleared first.
+     * @return Returns number of the visible objects.
+     */
+    std::size_t CullFrustum(const Frustum& frustum, std::vector<BvhRange>& visibleRanges) const;
+
+    /**
+     * @brief Same as the range version, but writes the object indices of the visible ranges to a compact list.
+     * @param frustum Frustum planes.
+     * @param visibleIndices Output indices of the visible objects, it is resized to the visible count.
+     * @return Returns number of the visible objects.
+     */
+    std::size_t CullFrustum(const Frustum& frustum, std::vector<std::uint32_t>& visibleIndices) const;
+
+    /**
+     * @brief Finds the nearest object box which is hit by a ray. Children are visited nearest first and the subtrees
+     * which are behind the current hit are skipped.
+     * @param ray World space ray.
+     * @param maxDistance Hits after this distance are ignored.
+     * @return Returns the nearest hit, or an empty hit.
+     */
+    [[nodiscard]] RayHit CastRay(const Ray& ray, float maxDistance = std::numeric_limits<float>::max()) const;
+
+    /**
+     * @return Returns object indices in the leaf order, ranges of the traversals point to this array.
+     */
+    [[nodiscard]] const std::vector<std::uint32_t>& GetObjectIndices() const { return objectIndices_; }
+
+    /**
+     * @return Returns number of the tree nodes.
+     */
+    [[nodiscard]] std::uint32_t GetNodeCount() const { return static_cast<std::uint32_t>(nodes_.size()); }
+
+    /**
+     * @return Returns true if the tree has no objects.
+     */
+    [[nodiscard]] bool IsEmpty() const { return objectIndices_.empty(); }
+
+private:
+    // Objects of a node are [FirstObject, FirstObject + ObjectCount) of objectIndices_, right child is LeftChild + 1
+    struct Node
+    {
+        glm::vec3 Min = glm::vec3(0.0f);
+        glm::vec3 Max = glm::vec3(0.0f);
+        std::uint32_t FirstObject = 0;
+        std::uint32_t ObjectCount = 0;
+        std::uint32_t LeftChild = UINT32_MAX; // UINT32_MAX for leaves
+        std::uint32_t Parent = UINT32_MAX;    // UINT32_MAX for the root
+    };
+
+    void BuildTree();
+
+    void Subdivide(std::uint32_t nodeIndex);
+
+    void UpdateNodeBounds(Node& node) const;
+
+    // Calls function(first, count) for every visible range in the increasing order of first
+    template<typename Function>
+    void ForEachVisibleRange(const Frustum& frustum, Function&& function) const;
+
+    std::vector<Node> nodes_;
+    std::vector<std::uint32_t> objectIndices_;
+    std::vector<glm::vec3> objectMin_; // Indexed with object index
+    std::vector<glm::vec3> objectMax_;
+    std::vector<std::uint32_t> objectLeaves_; // Leaf node of every object, UINT32_MAX if it isn't in the tree
+    std::vector<std::uint8_t> dirty_;         // Indexed with node index
+
+    // Marked nodes are refitted in the decreasing index order, children always have larger indices than their parent
+    std::uint32_t firstDirty_ = UINT32_MAX;
+    std::uint32_t lastDirty_ = 0;
+};
+} // namespace common::utility
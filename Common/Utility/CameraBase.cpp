@@ -20,6 +20,8 @@ CameraBase::CameraBase(glm::vec3 position, float aspect, float nearPlane, float
 
 glm::mat4 CameraBase::GetViewMatrix() const { return glm::lookAt(position_, position_ + cameraFront_, cameraUp_); }
 
+Frustum CameraBase::GetFrustum() const { return ExtractFrustum(GetProjectionMatrix() * GetViewMatrix()); }
+
 void CameraBase::SetPosition(const glm::vec3& position) { position_ = position; }
 
 glm::vec3 CameraBase::GetPosition() const { return position_; }
@@ -13,6 +13,7 @@
 #include <glm/glm.hpp>
 
 #include "CoreDefines.h"
+#include "FrustumCulling.h"
 
 namespace common::utility
 {
@@ -42,6 +43,12 @@ public:
      */
     [[nodiscard]] glm::mat4 GetViewMatrix() const;
 
+    /**
+     * @brief Returns world space frustum planes of the camera (extracted from projection * view matrix).
+     * @return Returns world space frustum planes of the camera.
+     */
+    [[nodiscard]] Frustum GetFrustum() const;
+
     /**
      * @brief Sets position of the camera.
      * @param position New position of the camera.
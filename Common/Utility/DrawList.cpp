@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "DrawList.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <stdexcept>
+
+namespace common::utility
+{
+namespace
+{
+    constexpr std::uint32_t radixBits = 8;
+    constexpr std::uint32_t radixSize = 1u << radixBits;
+    constexpr std::uint32_t radixPassCount = 64 / radixBits;
+
+    constexpr std::uint64_t FieldMask(const std::uint32_t bitCount) { return (std::uint64_t{1} << bitCount) - 1; }
+
+    // Bits of a non-negative float increase with its value, the highest 24 bits below the sign bit keep 16 bits of the
+    // mantissa (relative precision ~2e-5 at any distance)
+    std::uint64_t QuantizeDepth(const float depth)
+    {
+        const auto bits = std::bit_cast<std::uint32_t>(std::max(depth, 0.0f));
+        return (bits >> (31 - DrawList::DepthBits)) & FieldMask(DrawList::DepthBits);
+    }
+} // namespace
+
+std::uint64_t DrawList::MakeKey(const DrawKeyFields& fields)
+{
+    if (fields.Pipeline > FieldMask(PipelineBits) || fields.Material > FieldMask(MaterialBits) ||
+        fields.Mesh > FieldMask(MeshBits)) {
+        throw std::runtime_error("Draw key field is out of range!");
+    }
+
+    const auto pass = static_cast<std::uint64_t>(fields.Pass);
+    const std::uint64_t state = (static_cast<std::uint64_t>(fields.Pipeline) << (MaterialBits + MeshBits)) |
+                                (static_cast<std::uint64_t>(fields.Material) << MeshBits) | fields.Mesh;
+    const std::uint64_t depth = QuantizeDepth(fields.Depth);
+
+    constexpr std::uint32_t stateBits = PipelineBits + MaterialBits + MeshBits;
+    if (fields.Pass == DrawPass::Transparent) {
+        // Back to front: farther draws get smaller keys
+        return (pass << (64 - PassBits)) | ((FieldMask(DepthBits) - depth) << stateBits) | state;
+    }
+
+    return (pass << (64 - PassBits)) | (state << DepthBits) | depth;
+}
+
+void DrawList::Clear()
+{
+    entries_.clear();
+}
+
+void DrawList::Add(const DrawKeyFields& fields, const std::uint32_t drawIndex)
+{
+    entries_.push_back({MakeKey(fields), drawIndex});
+}
+
+void DrawList::Sort()
+{
+    const auto count = static_cast<std::uint32_t>(entries_.size());
+    if (count < 2) {
+        return;
+    }
+
+    // Histograms of all digits are counted with one read of the keys
+    std::array<std::array<std::uint32_t, radixSize>, radixPassCount> histograms{};
+    for (const auto& entry: entries_) {
+        for (std::uint32_t pass = 0; pass < radixPassCount; ++pass) {
+            ++histograms[pass][(entry.Key >> (pass * radixBits)) & (radixSize - 1)];
+        }
+    }
+
+    scratch_.resize(count);
+    for (std::uint32_t pass = 0; pass < radixPassCount; ++pass) {
+        const std::uint32_t shift = pass * radixBits;
+        auto& histogram = histograms[pass];
+
+        // All keys have the same digit (e.g. unused state bits), this pass wouldn't change the order
+        if (histogram[(entries_[0].Key >> shift) & (radixSize - 1)] == count) {
+            continue;
+        }
+
+        std::uint32_t offset = 0;
+        for (auto& bucket: histogram) {
+            const auto bucketCount = bucket;
+            bucket = offset;
+            offset += bucketCount;
+        }
+
+        for (const auto& entry: entries_) {
+            scratch_[histogram[(entry.Key >> shift) & (radixSize - 1)]++] = entry;
+        }
+        entries_.swap(scratch_);
+    }
+}
+
+std::vector<std::uint32_t> DrawList::GetDrawIndices() const
+{
+    std::vector<std::uint32_t> drawIndices(entries_.size());
+    for (std::size_t i = 0; i < entries_.size(); ++i) {
+        drawIndices[i] = entries_[i].DrawIndex;
+    }
+
+    return drawIndices;
+}
+
+DrawList::StateFields DrawList::DecodeState(const std::uint64_t key)
+{
+    const auto pass = static_cast<std::uint32_t>(key >> (64 - PassBits));
+    const std::uint64_t state = pass == static_cast<std::uint32_t>(DrawPass::Transparent) ? key : key >> DepthBits;
+
+    return {pass, static_cast<std::uint32_t>((state >> (MaterialBits + MeshBits)) & FieldMask(PipelineBits)),
+            static_cast<std::uint32_t>((state >> MeshBits) & FieldMask(MaterialBits)),
+            static_cast<std::uint32_t>(state & FieldMask(MeshBits))};
+}
+} // namespace common::utility
@@ -0,0 +1,180 @@
+/**
+ * @file    DrawList.h
+ * @brief   This file contains a draw list which orders draws with packed 64-bit sort keys (radix sort) and reports the
+ *          state changes between the sorted draws, so redundant binds can be skipped while recording.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "CoreDefines.h"
+
+namespace common::utility
+{
+enum class DrawPass
+{
+    Opaque,
+    Transparent
+};
+
+/**
+ * @brief State fields of a draw that are packed into its sort key.
+ */
+struct COMMON_API DrawKeyFields
+{
+    DrawPass Pass = DrawPass::Opaque;
+    std::uint32_t Pipeline = 0;
+    std::uint32_t Material = 0;
+    std::uint32_t Mesh = 0;
+    float Depth = 0.0f; // View space distance, negative values are clamped to 0
+};
+
+/**
+ * @brief States which have to be bound before a draw, the previous draw already bound the other ones.
+ */
+struct COMMON_API DrawStateChanges
+{
+    bool Pipeline = false;
+    bool Material = false;
+    bool Mesh = false;
+};
+
+/**
+ * @brief Counters of the last Emit. Avoided binds are compared with binding every state for every draw.
+ */
+struct COMMON_API DrawListStats
+{
+    std::uint32_t DrawCount = 0;
+    std::uint32_t PipelineBindCount = 0;
+    std::uint32_t MaterialBindCount = 0;
+    std::uint32_t MeshBindCount = 0;
+    std::uint32_t PipelineBindsAvoided = 0;
+    std::uint32_t MaterialBindsAvoided = 0;
+    std::uint32_t MeshBindsAvoided = 0;
+};
+
+/**
+ * @brief Draw list with 64-bit sort keys. Pass is in the highest bits, so all opaque draws come before the
+ * transparent ones. The other fields are placed differently in the two passes:
+ * - Opaque:      pass | pipeline | material | mesh | depth. Draws are grouped by state and the draws with the same
+ *                state are sorted front to back (early depth test rejects more fragments).
+ * - Transparent: pass | inverted depth | pipeline | material | mesh. Draws are sorted back to front for correct
+ *                blending and the state only breaks ties.
+ *
+ * Keys are sorted with a stable LSD radix sort (8 bits per pass), passes whose digit is the same in all keys are
+ * skipped. Emit calls a function for the sorted draws with the states that differ from the previous draw.
+ */
+class COMMON_API DrawList
+{
+public:
+    static constexpr std::uint32_t PassBits = 2;
+    static constexpr std::uint32_t PipelineBits = 10;
+    static constexpr std::uint32_t MaterialBits = 14;
+    static constexpr std::uint32_t MeshBits = 14;
+    static constexpr std::uint32_t DepthBits = 24;
+
+    /**
+     * @brief Packs the fields of a draw into a sort key.
+     * @param fields State and depth of the draw. Pipeline, material and mesh have to fit their bit counts.
+     * @return Returns the sort key.
+     */
+    [[nodiscard]] static std::uint64_t MakeKey(const DrawKeyFields& fields);
+
+    /**
+     * @brief Removes all draws, capacity is kept.
+     */
+    void Clear();
+
+    /**
+     * @brief Adds a draw.
+     * @param fields State and depth of the draw.
+     * @param drawIndex Index which is passed back to the Emit function (e.g. index of the draw item).
+     */
+    void Add(const DrawKeyFields& fields, std::uint32_t drawIndex);
+
+    /**
+     * @brief Sorts the draws in the increasing key order. Draws with the same key keep their adding order.
+     */
+    void Sort();
+
+    /**
+     * @brief Calls function(drawIndex, changes) for every draw in the current order and updates the statistics.
+     * @param function Records the binds of the changed states and the draw.
+     */
+    template<typename Function>
+    void Emit(Function&& function);
+
+    /**
+     * @return Returns draw indices in the current order.
+     */
+    [[nodiscard]] std::vector<std::uint32_t> GetDrawIndices() const;
+
+    /**
+     * @return Returns counters of the last Emit.
+     */
+    [[nodiscard]] const DrawListStats& GetStats() const { return stats_; }
+
+    /**
+     * @return Returns number of the draws.
+     */
+    [[nodiscard]] std::uint32_t Size() const { return static_cast<std::uint32_t>(entries_.size()); }
+
+private:
+    struct Entry
+    {
+        std::uint64_t Key;
+        std::uint32_t DrawIndex;
+    };
+
+    // State part of a key (pass, pipeline, material, mesh) without the depth
+    struct StateFields
+    {
+        std::uint32_t Pass;
+        std::uint32_t Pipeline;
+        std::uint32_t Material;
+        std::uint32_t Mesh;
+    };
+
+    [[nodiscard]] static StateFields DecodeState(std::uint64_t key);
+
+    std::vector<Entry> entries_;
+    std::vector<Entry> scratch_; // Ping-pong buffer of the radix sort
+    DrawListStats stats_;
+};
+
+template<typename Function>
+void DrawList::Emit(Function&& function)
+{
+    stats_ = {};
+    stats_.DrawCount = Size();
+
+    StateFields previous{};
+    for (std::uint32_t i = 0; i < entries_.size(); ++i) {
+        const StateFields current = DecodeState(entries_[i].Key);
+
+        // A new pass can use different render states, so its first draw binds the pipeline again
+        DrawStateChanges changes;
+        changes.Pipeline = i == 0 || current.Pass != previous.Pass || current.Pipeline != previous.Pipeline;
+        changes.Material = i == 0 || current.Material != previous.Material;
+        changes.Mesh = i == 0 || current.Mesh != previous.Mesh;
+        previous = current;
+
+        stats_.PipelineBindCount += changes.Pipeline ? 1 : 0;
+        stats_.MaterialBindCount += changes.Material ? 1 : 0;
+        stats_.MeshBindCount += changes.Mesh ? 1 : 0;
+
+        function(entries_[i].DrawIndex, changes);
+    }
+
+    stats_.PipelineBindsAvoided = stats_.DrawCount - stats_.PipelineBindCount;
+    stats_.MaterialBindsAvoided = stats_.DrawCount - stats_.MaterialBindCount;
+    stats_.MeshBindsAvoided = stats_.DrawCount - stats_.MeshBindCount;
+}
+} // namespace common::utility
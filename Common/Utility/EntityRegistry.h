@@ -0,0 +1,405 @@
+/**
+ * @file    EntityRegistry.h
+ * @brief   Entities with generational handles and sparse set component pools that keep every component type in a
+ *          dense array.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "HandleRegistry.h"
+
+namespace common::utility
+{
+struct EntityTag
+{
+};
+using Entity = Handle<EntityTag>;
+
+/**
+ * @brief Sparse set storage of one component type. Components are kept in a dense array without holes, and a sparse
+ * array maps entity indices to dense indices. Removing swaps the last component into the hole, so iteration is always
+ * over contiguous memory.
+ * @tparam Component Component type.
+ */
+template<typename Component>
+class ComponentPool
+{
+public:
+    static constexpr std::uint32_t NotFound = UINT32_MAX;
+
+    /**
+     * @brief Creates the component of an entity, or replaces it if the entity already has one.
+     * @param entityIndex Index of the entity.
+     * @param args Constructor arguments of the component.
+     * @return Returns the component.
+     */
+    template<typename... Args>
+    Component& Emplace(const std::uint32_t entityIndex, Args&&... args)
+    {
+        if (Contains(entityIndex)) {
+            return components_[sparse_[entityIndex]] = Component{std::forward<Args>(args)...};
+        }
+
+        if (entityIndex >= sparse_.size()) {
+            sparse_.resize(entityIndex + 1, NotFound);
+        }
+        sparse_[entityIndex] = static_cast<std::uint32_t>(entities_.size());
+        entities_.push_back(entityIndex);
+        return components_.emplace_back(Component{std::forward<Args>(args)...});
+    }
+
+    /**
+     * @brief Removes the component of an entity.
+     * @param entityIndex Index of the entity.
+     * @return Returns true if the component is removed, otherwise false.
+     */
+    bool Remove(const std::uint32_t entityIndex)
+    {
+        if (!Contains(entityIndex)) {
+            return false;
+        }
+
+        const std::uint32_t denseIndex = sparse_[entityIndex];
+        const std::uint32_t lastEntity = entities_.back();
+        components_[denseIndex] = std::move(components_.back());
+        entities_[denseIndex] = lastEntity;
+        sparse_[lastEntity] = denseIndex;
+        sparse_[entityIndex] = NotFound;
+        components_.pop_back();
+        entities_.pop_back();
+
+        return true;
+    }
+
+    /**
+     * @param entityIndex Index of the entity.
+     * @return Returns true if the entity has the component, otherwise false.
+     */
+    [[nodiscard]] bool Contains(const std::uint32_t entityIndex) const
+    {
+        return entityIndex < sparse_.size() && sparse_[entityIndex] != NotFound;
+    }
+
+    /**
+     * @param entityIndex Index of the entity.
+     * @return Returns dense index of the component, or NotFound if the entity doesn't have it.
+     */
+    [[nodiscard]] std::uint32_t GetDenseIndex(const std::uint32_t entityIndex) const
+    {
+        return entityIndex < sparse_.size() ? sparse_[entityIndex] : NotFound;
+    }
+
+    /**
+     * @param entityIndex Index of the entity.
+     * @return Returns pointer of the component, if the entity doesn't have it it returns nullptr.
+     */
+    [[nodiscard]] Component* Get(const std::uint32_t entityIndex)
+    {
+        return Contains(entityIndex) ? &components_[sparse_[entityIndex]] : nullptr;
+    }
+
+    /**
+     * @param entityIndex Index of the entity.
+     * @return Returns pointer of the component, if the entity doesn't have it it returns nullptr.
+     */
+    [[nodiscard]] const Component* Get(const std::uint32_t entityIndex) const
+    {
+        return Contains(entityIndex) ? &components_[sparse_[entityIndex]] : nullptr;
+    }
+
+    /**
+     * @brief Moves the components of the given entities to the front of the dense array in the given order. Entities
+     * without the component are skipped. Pools that are ordered with the same entities are iterated together without
+     * sparse lookups.
+     * @param entityOrder Entity indices in the wanted order.
+     */
+    void Reorder(std::span<const std::uint32_t> entityOrder)
+    {
+        std::uint32_t position = 0;
+        for (const auto entityIndex: entityOrder) {
+            if (!Contains(entityIndex)) {
+                continue;
+            }
+
+            const std::uint32_t denseIndex = sparse_[entityIndex];
+            if (denseIndex != position) {
+                std::swap(components_[denseIndex], components_[position]);
+                std::swap(entities_[denseIndex], entities_[position]);
+                sparse_[entities_[denseIndex]] = denseIndex;
+                sparse_[entities_[position]] = position;
+            }
+            ++position;
+        }
+    }
+
+    /**
+     * @brief Removes all components.
+     */
+    void Clear()
+    {
+        sparse_.clear();
+        entities_.clear();
+        components_.clear();
+    }
+
+    /**
+     * @return Returns all components in the dense order.
+     */
+    [[nodiscard]] std::span<Component> GetComponents() { return components_; }
+
+    /**
+     * @return Returns all components in the dense order.
+     */
+    [[nodiscard]] std::span<const Component> GetComponents() const { return components_; }
+
+    /**
+     * @return Returns entity indices of the components in the dense order.
+     */
+    [[nodiscard]] std::span<const std::uint32_t> GetEntities() const { return entities_; }
+
+    /**
+     * @return Returns number of the components.
+     */
+    [[nodiscard]] std::size_t Size() const { return components_.size(); }
+
+private:
+    std::vector<std::uint32_t> sparse_;
+    std::vector<std::uint32_t> entities_;
+    std::vector<Component> components_;
+};
+
+/**
+ * @brief Creates entities and keeps their components in one ComponentPool per component type. Component types are
+ * fixed at compile time, so pools are found without type erasure or hashing.
+ * @tparam Components Component types (every type must be unique).
+ */
+template<typename... Components>
+class EntityRegistry
+{
+public:
+    /**
+     * @brief Creates an entity without components. Indices of destroyed entities are reused with a new generation.
+     * @return Returns the entity.
+     */
+    Entity Create()
+    {
+        std::uint32_t index;
+        if (!freeIndices_.empty()) {
+            index = freeIndices_.back();
+            freeIndices_.pop_back();
+        } else {
+            index = static_cast<std::uint32_t>(generations_.size());
+            generations_.push_back(0);
+            alive_.push_back(0);
+        }
+
+        alive_[index] = 1;
+        ++aliveCount_;
+        return Entity{index, generations_[index]};
+    }
+
+    /**
+     * @brief Removes all components of the entity and makes its handles stale.
+     * @param entity Entity.
+     * @return Returns true if the entity is destroyed, otherwise false.
+     */
+    bool Destroy(const Entity& entity)
+    {
+        if (!IsAlive(entity)) {
+            return false;
+        }
+
+        std::apply([&](auto&... pools) { (pools.Remove(entity.Index), ...); }, pools_);
+        alive_[entity.Index] = 0;
+        ++generations_[entity.Index];
+        freeIndices_.push_back(entity.Index);
+        --aliveCount_;
+
+        return true;
+    }
+
+    /**
+     * @param entity Entity.
+     * @return Returns true if the entity is valid and not stale, otherwise false.
+     */
+    [[nodiscard]] bool IsAlive(const Entity& entity) const
+    {
+        return entity.Index < generations_.size() && alive_[entity.Index] != 0 &&
+               generations_[entity.Index] == entity.Generation;
+    }
+
+    /**
+     * @param index Index of a live entity (e.g. from ComponentPool::GetEntities).
+     * @return Returns the entity handle with its current generation.
+     */
+    [[nodiscard]] Entity GetEntity(const std::uint32_t index) const { return Entity{index, generations_[index]}; }
+
+    /**
+     * @brief Creates the component of the entity, or replaces it if the entity already has one.
+     * @param entity Entity.
+     * @param args Constructor arguments of the component.
+     * @return Returns the component.
+     */
+    template<typename Component, typename... Args>
+    Component& Emplace(const Entity& entity, Args&&... args)
+    {
+        if (!IsAlive(entity)) {
+            throw std::runtime_error("Entity is not alive!");
+        }
+
+        return GetPool<Component>().Emplace(entity.Index, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Removes the component of the entity.
+     * @param entity Entity.
+     * @return Returns true if the component is removed, otherwise false.
+     */
+    template<typename Component>
+    bool Remove(const Entity& entity)
+    {
+        return IsAlive(entity) && GetPool<Component>().Remove(entity.Index);
+    }
+
+    /**
+     * @param entity Entity.
+     * @return Returns pointer of the component, if the entity is stale or doesn't have it it returns nullptr.
+     */
+    template<typename Component>
+    [[nodiscard]] Component* TryGet(const Entity& entity)
+    {
+        return IsAlive(entity) ? GetPool<Component>().Get(entity.Index) : nullptr;
+    }
+
+    /**
+     * @param entity Entity.
+     * @return Returns pointer of the component, if the entity is stale or doesn't have it it returns nullptr.
+     */
+    template<typename Component>
+    [[nodiscard]] const Component* TryGet(const Entity& entity) const
+    {
+        return IsAlive(entity) ? GetPool<Component>().Get(entity.Index) : nullptr;
+    }
+
+    /**
+     * @param entity Entity.
+     * @return Returns true if the entity is alive and has the component, otherwise false.
+     */
+    template<typename Component>
+    [[nodiscard]] bool Has(const Entity& entity) const
+    {
+        return IsAlive(entity) && GetPool<Component>().Contains(entity.Index);
+    }
+
+    /**
+     * @return Returns the pool of the component type (e.g. to stream its dense array).
+     */
+    template<typename Component>
+    [[nodiscard]] ComponentPool<Component>& GetPool()
+    {
+        return std::get<ComponentPool<Component>>(pools_);
+    }
+
+    /**
+     * @return Returns the pool of the component type (e.g. to stream its dense array).
+     */
+    template<typename Component>
+    [[nodiscard]] const ComponentPool<Component>& GetPool() const
+    {
+        return std::get<ComponentPool<Component>>(pools_);
+    }
+
+    /**
+     * @brief Calls the function for every entity that has all given components. The first component type drives the
+     * iteration over its dense array, so the rarest component should be given first. Components of the other types are
+     * read with the same dense index when their pools are in the same order (see Pack), otherwise with a sparse lookup.
+     * Components must not be added or removed in the function.
+     * @param func Function with (Entity, Lead&, Others&...) signature.
+     */
+    template<typename Lead, typename... Others, typename Func>
+    void Each(Func&& func)
+    {
+        auto& leadPool = GetPool<Lead>();
+        const auto entities = leadPool.GetEntities();
+        const auto components = leadPool.GetComponents();
+        for (std::uint32_t i = 0; i < entities.size(); ++i) {
+            const std::uint32_t entityIndex = entities[i];
+            const std::tuple denseIndices{FindDenseIndex<Others>(entityIndex, i)...};
+            if (((std::get<DenseIndex<Others>>(denseIndices).Value == ComponentPool<Others>::NotFound) || ...)) {
+                continue;
+            }
+
+            func(GetEntity(entityIndex), components[i],
+                 GetPool<Others>().GetComponents()[std::get<DenseIndex<Others>>(denseIndices).Value]...);
+        }
+    }
+
+    /**
+     * @brief Orders the pools of the other component types like the pool of the lead type, so Each<Lead, Others...>
+     * reads all components with the same dense index. It should be called after many entities are created or
+     * destroyed.
+     */
+    template<typename Lead, typename... Others>
+    void Pack()
+    {
+        const auto entities = GetPool<Lead>().GetEntities();
+        (GetPool<Others>().Reorder(entities), ...);
+    }
+
+    /**
+     * @brief Destroys all entities and removes all components.
+     */
+    void Clear()
+    {
+        std::apply([](auto&... pools) { (pools.Clear(), ...); }, pools_);
+        generations_.clear();
+        alive_.clear();
+        freeIndices_.clear();
+        aliveCount_ = 0;
+    }
+
+    /**
+     * @return Returns number of the live entities.
+     */
+    [[nodiscard]] std::size_t GetAliveCount() const { return aliveCount_; }
+
+private:
+    // Dense index in the pool of the component type (a distinct type per component, so it can be found in a tuple)
+    template<typename Component>
+    struct DenseIndex
+    {
+        std::uint32_t Value;
+    };
+
+    template<typename Component>
+    [[nodiscard]] DenseIndex<Component> FindDenseIndex(const std::uint32_t entityIndex,
+                                                       const std::uint32_t leadIndex) const
+    {
+        const auto& pool = GetPool<Component>();
+        const auto entities = pool.GetEntities();
+        if (leadIndex < entities.size() && entities[leadIndex] == entityIndex) {
+            return {leadIndex};
+        }
+
+        return {pool.GetDenseIndex(entityIndex)};
+    }
+
+    std::tuple<ComponentPool<Components>...> pools_;
+    std::vector<std::uint32_t> generations_;
+    std::vector<std::uint8_t> alive_;
+    std::vector<std::uint32_t> freeIndices_;
+    std::size_t aliveCount_ = 0;
+};
+} // namespace common::utility
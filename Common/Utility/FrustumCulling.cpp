@@ -0,0 +1,202 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "FrustumCulling.h"
+
+#include <bit>
+#include <cmath>
+
+#include "SimdOps.h"
+
+namespace common::utility
+{
+void BoundsArrays::Resize(const std::size_t count)
+{
+    CenterX.resize(count, 0.0f);
+    CenterY.resize(count, 0.0f);
+    CenterZ.resize(count, 0.0f);
+    ExtentX.resize(count, 0.0f);
+    ExtentY.resize(count, 0.0f);
+    ExtentZ.resize(count, 0.0f);
+}
+
+void BoundsArrays::Set(const std::size_t index, const glm::vec3& min, const glm::vec3& max)
+{
+    const glm::vec3 center = (min + max) * 0.5f;
+    const glm::vec3 extent = (max - min) * 0.5f;
+    CenterX[index] = center.x;
+    CenterY[index] = center.y;
+    CenterZ[index] = center.z;
+    ExtentX[index] = extent.x;
+    ExtentY[index] = extent.y;
+    ExtentZ[index] = extent.z;
+}
+
+void BoundsArrays::SetTransformed(const std::size_t index,
+                                  const glm::vec3& localMin,
+                                  const glm::vec3& localMax,
+                                  const glm::mat4& transform)
+{
+    glm::vec3 worldMin, worldMax;
+    TransformBounds(localMin, localMax, transform, worldMin, worldMax);
+    Set(index, worldMin, worldMax);
+}
+
+Frustum ExtractFrustum(const glm::mat4& viewProjection)
+{
+    // Rows of the matrix (glm matrices are column major)
+    const glm::mat4 rows = glm::transpose(viewProjection);
+
+    Frustum frustum{};
+    frustum.Planes[0] = rows[3] + rows[0]; // Left
+    frustum.Planes[1] = rows[3] - rows[0]; // Right
+    frustum.Planes[2] = rows[3] + rows[1]; // Bottom
+    frustum.Planes[3] = rows[3] - rows[1]; // Top
+    frustum.Planes[4] = rows[3] + rows[2]; // Near
+    frustum.Planes[5] = rows[3] - rows[2]; // Far
+
+    for (auto& plane: frustum.Planes) {
+        const float length = glm::length(glm::vec3(plane));
+        if (length > 0.0f) {
+            plane /= length;
+        }
+    }
+
+    return frustum;
+}
+
+void TransformBounds(const glm::vec3& localMin,
+                     const glm::vec3& localMax,
+                     const glm::mat4& transform,
+                     glm::vec3& worldMin,
+                     glm::vec3& worldMax)
+{
+    const glm::vec3 center = glm::vec3(transform * glm::vec4((localMin + localMax) * 0.5f, 1.0f));
+    const glm::vec3 localExtent = (localMax - localMin) * 0.5f;
+    const glm::vec3 extent = glm::abs(glm::vec3(transform[0])) * localExtent.x +
+                             glm::abs(glm::vec3(transform[1])) * localExtent.y +
+                             glm::abs(glm::vec3(transform[2])) * localExtent.z;
+    worldMin = center - extent;
+    worldMax = center + extent;
+}
+
+namespace
+{
+    // A box is outside of a plane if its center is farther than its projected radius (dot(|normal|, extent)) behind it
+    std::size_t CullScalar(const Frustum& frustum,
+                           const BoundsArrays& bounds,
+                           std::uint32_t* visibleIndices,
+                           const std::size_t begin)
+    {
+        std::size_t visibleCount = 0;
+        for (std::size_t i = begin; i < bounds.Size(); ++i) {
+            bool visible = true;
+            for (const auto& plane: frustum.Planes) {
+                const float distance = plane.x * bounds.CenterX[i] + plane.y * bounds.CenterY[i] +
+                                       plane.z * bounds.CenterZ[i] + plane.w;
+                const float radius = std::abs(plane.x) * bounds.ExtentX[i] + std::abs(plane.y) * bounds.ExtentY[i] +
+                                     std::abs(plane.z) * bounds.ExtentZ[i];
+                if (distance + radius < 0.0f) {
+                    visible = false;
+                    break;
+                }
+            }
+            if (visible) {
+                visibleIndices[visibleCount++] = static_cast<std::uint32_t>(i);
+            }
+        }
+
+        return visibleCount;
+    }
+
+#if defined(COMMON_SIMD_AVX2) || defined(COMMON_SIMD_SSE2)
+    /**
+     * Every lane of a register belongs to another box. Outside masks of all planes are combined without branches and
+     * the lanes of the visible boxes are appended with their bit indices. Sums are in the scalar order, so both
+     * versions give the same results. Returns number of the processed boxes.
+     */
+    std::size_t CullSimd(const Frustum& frustum,
+                         const BoundsArrays& bounds,
+                         std::uint32_t* visibleIndices,
+                         std::size_t& visibleCount)
+    {
+        using Reg = SimdOps::Reg;
+        const std::size_t simdCount = bounds.Size() / SimdOps::Width * SimdOps::Width;
+        constexpr unsigned allLanes = (1u << SimdOps::Width) - 1;
+
+        Reg normals[6][3], absNormals[6][3], distances[6];
+        for (int p = 0; p < 6; ++p) {
+            for (int axis = 0; axis < 3; ++axis) {
+                normals[p][axis] = SimdOps::Set1(frustum.Planes[p][axis]);
+                absNormals[p][axis] = SimdOps::Set1(std::abs(frustum.Planes[p][axis]));
+            }
+            distances[p] = SimdOps::Set1(frustum.Planes[p].w);
+        }
+        const Reg zero = SimdOps::Set1(0.0f);
+
+        for (std::size_t i = 0; i < simdCount; i += SimdOps::Width) {
+            const Reg cx = SimdOps::Load(&bounds.CenterX[i]);
+            const Reg cy = SimdOps::Load(&bounds.CenterY[i]);
+            const Reg cz = SimdOps::Load(&bounds.CenterZ[i]);
+            const Reg ex = SimdOps::Load(&bounds.ExtentX[i]);
+            const Reg ey = SimdOps::Load(&bounds.ExtentY[i]);
+            const Reg ez = SimdOps::Load(&bounds.ExtentZ[i]);
+
+            Reg outside = zero;
+            for (int p = 0; p < 6; ++p) {
+                const Reg distance = SimdOps::Add(SimdOps::Add(SimdOps::Add(SimdOps::Mul(normals[p][0], cx),
+                                                                            SimdOps::Mul(normals[p][1], cy)),
+                                                               SimdOps::Mul(normals[p][2], cz)),
+                                                  distances[p]);
+                const Reg radius = SimdOps::Add(SimdOps::Add(SimdOps::Mul(absNormals[p][0], ex),
+                                                             SimdOps::Mul(absNormals[p][1], ey)),
+                                                SimdOps::Mul(absNormals[p][2], ez));
+                outside = SimdOps::Or(outside, SimdOps::LessThan(SimdOps::Add(distance, radius), zero));
+            }
+
+            unsigned visibleMask = ~SimdOps::MoveMask(outside) & allLanes;
+            while (visibleMask != 0) {
+                visibleIndices[visibleCount++] = static_cast<std::uint32_t>(i + std::countr_zero(visibleMask));
+                visibleMask &= visibleMask - 1;
+            }
+        }
+
+        return simdCount;
+    }
+#endif
+} // namespace
+
+std::size_t CullBounds(const Frustum& frustum, const BoundsArrays& bounds, std::vector<std::uint32_t>& visibleIndices)
+{
+    visibleIndices.resize(bounds.Size());
+
+    std::size_t visibleCount = 0;
+#if defined(COMMON_SIMD_AVX2) || defined(COMMON_SIMD_SSE2)
+    const std::size_t processed = CullSimd(frustum, bounds, visibleIndices.data(), visibleCount);
+#else
+    const std::size_t processed = 0;
+#endif
+    visibleCount += CullScalar(frustum, bounds, visibleIndices.data() + visibleCount, processed);
+
+    visibleIndices.resize(visibleCount);
+    return visibleCount;
+}
+
+std::size_t CullBoundsScalar(const Frustum& frustum,
+                             const BoundsArrays& bounds,
+                             std::vector<std::uint32_t>& visibleIndices)
+{
+    visibleIndices.resize(bounds.Size());
+    const std::size_t visibleCount = CullScalar(frustum, bounds, visibleIndices.data(), 0);
+    visibleIndices.resize(visibleCount);
+    return visibleCount;
+}
+
+const char* GetFrustumCullingBackend()
+{
+    return simdBackendName;
+}
+} // namespace common::utility
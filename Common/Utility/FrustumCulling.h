@@ -0,0 +1,128 @@
+/**
+ * @file    FrustumCulling.h
+ * @brief   This file contains frustum plane extraction and AABB-vs-frustum tests over structure of arrays bounds with
+ *          SSE/AVX2 kernels (scalar fallback on other targets).
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "CoreDefines.h"
+
+namespace common::utility
+{
+/**
+ * @brief Six planes of a view frustum (left, right, bottom, top, near, far). xyz of a plane is its normal which points
+ * into the frustum and w is its distance, so a point p is inside the plane if dot(xyz, p) + w >= 0.
+ */
+struct COMMON_API Frustum
+{
+    std::array<glm::vec4, 6> Planes;
+};
+
+/**
+ * @brief World space axis aligned bounding boxes of N objects in structure of arrays layout (center and half extent).
+ * SIMD kernels load the same component of 4 (SSE) or 8 (AVX2) boxes with one load.
+ */
+struct COMMON_API BoundsArrays
+{
+    std::vector<float> CenterX, CenterY, CenterZ;
+    std::vector<float> ExtentX, ExtentY, ExtentZ;
+
+    /**
+     * @brief Resizes all component arrays. New boxes are empty boxes at the origin.
+     * @param count Number of the boxes.
+     */
+    void Resize(std::size_t count);
+
+    /**
+     * @brief Writes the box of an object.
+     * @param index Index of the object.
+     * @param min Minimum corner of the box.
+     * @param max Maximum corner of the box.
+     */
+    void Set(std::size_t index, const glm::vec3& min, const glm::vec3& max);
+
+    /**
+     * @brief Writes the world box of an object from its local box and transform. The result encloses the transformed
+     * local box (center is transformed, extent is multiplied with the absolute rotation-scale matrix).
+     * @param index Index of the object.
+     * @param localMin Minimum corner of the local box.
+     * @param localMax Maximum corner of the local box.
+     * @param transform Local to world transform of the object.
+     */
+    void SetTransformed(std::size_t index,
+                        const glm::vec3& localMin,
+                        const glm::vec3& localMax,
+                        const glm::mat4& transform);
+
+    /**
+     * @brief Returns number of the boxes.
+     * @return Returns number of the boxes.
+     */
+    [[nodiscard]] std::size_t Size() const { return CenterX.size(); }
+};
+
+/**
+ * @brief Extracts normalized frustum planes from a view-projection matrix (Gribb-Hartmann). Near plane is z >= -w, so
+ * it is exact for [-1, 1] depth and conservative for [0, 1] depth projections.
+ * @param viewProjection Projection * view matrix.
+ * @return Returns frustum planes in world space.
+ */
+COMMON_API Frustum ExtractFrustum(const glm::mat4& viewProjection);
+
+/**
+ * @brief Calculates the world box of a local box like BoundsArrays::SetTransformed.
+ * @param localMin Minimum corner of the local box.
+ * @param localMax Maximum corner of the local box.
+ * @param transform Local to world transform.
+ * @param worldMin Output minimum corner.
+ * @param worldMax Output maximum corner.
+ */
+COMMON_API void TransformBounds(const glm::vec3& localMin,
+                                const glm::vec3& localMax,
+                                const glm::mat4& transform,
+                                glm::vec3& worldMin,
+                                glm::vec3& worldMax);
+
+/**
+ * @brief Tests all boxes against the frustum and writes indices of the boxes which are not fully outside of any plane
+ * to a compact list in the increasing order.
+ * @param frustum Frustum planes.
+ * @param bounds World boxes of the objects.
+ * @param visibleIndices Output indices of the visible boxes, it is resized to the visible count.
+ * @return Returns number of the visible boxes.
+ */
+COMMON_API std::size_t CullBounds(const Frustum& frustum,
+                                  const BoundsArrays& bounds,
+                                  std::vector<std::uint32_t>& visibleIndices);
+
+/**
+ * @brief Scalar version of CullBounds. SIMD kernels use it for the remaining boxes, and it can be used as reference
+ * for comparisons.
+ * @param frustum Frustum planes.
+ * @param bounds World boxes of the objects.
+ * @param visibleIndices Output indices of the visible boxes, it is resized to the visible count.
+ * @return Returns number of the visible boxes.
+ */
+COMMON_API std::size_t CullBoundsScalar(const Frustum& frustum,
+                                        const BoundsArrays& bounds,
+                                        std::vector<std::uint32_t>& visibleIndices);
+
+/**
+ * @brief Returns name of the kernel that is selected at compile time.
+ * @return Returns "AVX2", "SSE2" or "Scalar".
+ */
+COMMON_API const char* GetFrustumCullingBackend();
+} // namespace common::utility
@@ -9,13 +9,16 @@
  * https://opensource.org/licenses/MIT
  */
 #pragma once
+#include <span>
 #include <string>
 #include <vector>
 
 #include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
 
 #include "CoreDefines.h"
 #include "TextureHandler.h"
+#include "TransformHierarchy.h"
 
 namespace common::utility
 {
@@ -25,11 +28,12 @@ struct COMMON_API GltfPrimitiveAttrib
     glm::vec3 Position;
     glm::vec3 Normal;
     std::vector<glm::vec2> TexCoords;
+    // Skin joint indices and weights (JOINTS_0 and WEIGHTS_0), zero weights if the mesh is not skinned
+    glm::uvec4 Joints = glm::uvec4(0);
+    glm::vec4 Weights = glm::vec4(0.0f);
     /// TODO: These values will be added later.
     // TANGENT
     // COLOR_n
-    // JOINTS_n
-    // WEIGHTS_n
 };
 
 struct COMMON_API GltfMaterial
@@ -47,19 +51,31 @@ struct COMMON_API GltfMesh
     std::vector<GltfPrimitiveAttrib> Vertices;
     std::vector<uint16_t> Indices;
     int MaterialIndex = -1;
+    // Local bounding box of the positions (min/max of the POSITION accessor)
+    glm::vec3 BoundsMin = glm::vec3(0.0f);
+    glm::vec3 BoundsMax = glm::vec3(0.0f);
 
     template<typename VertexType>
     std::vector<VertexType> GetVerticesAs();
 
-    [[nodiscard]] std::string GetVertexBufferName() const
+    /**
+     * @brief Sets name of the mesh and caches the resource names which are derived from it.
+     * @param name Name of the mesh.
+     */
+    void SetName(const std::string& name)
     {
-        return Name + "_VertexBuffer";
+        Name = name;
+        vertexBufferName_ = Name + "_VertexBuffer";
+        indexBufferName_ = Name + "_IndexBuffer";
     }
 
-    [[nodiscard]] std::string GetIndexBufferName() const
-    {
-        return Name + "_IndexBuffer";
-    }
+    [[nodiscard]] const std::string& GetVertexBufferName() const { return vertexBufferName_; }
+
+    [[nodiscard]] const std::string& GetIndexBufferName() const { return indexBufferName_; }
+
+private:
+    std::string vertexBufferName_;
+    std::string indexBufferName_;
 };
 
 struct COMMON_API GltfNode
@@ -68,8 +84,57 @@ struct COMMON_API GltfNode
     std::vector<std::uint32_t> ChildIndices;
     std::uint32_t MeshIndex = UINT32_MAX;
     std::uint32_t CameraIndex = UINT32_MAX;
+    std::uint32_t SkinIndex = UINT32_MAX;
     glm::mat4 LocalTransform = glm::mat4(1.0f);
     glm::mat4 WorldTransform = glm::mat4(1.0f);
+    // World bounding box of the node's mesh at load time (empty box at the origin if the node has no mesh)
+    glm::vec3 BoundsMin = glm::vec3(0.0f);
+    glm::vec3 BoundsMax = glm::vec3(0.0f);
+
+    // Components of the local transform (identity if the node is defined with a matrix, which can't be animated)
+    glm::vec3 Translation = glm::vec3(0.0f);
+    glm::quat Rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+    glm::vec3 Scale = glm::vec3(1.0f);
+};
+
+struct COMMON_API GltfSkin
+{
+    std::string Name;
+    std::vector<std::uint32_t> Joints; // Node indices of the joints
+    std::vector<glm::mat4> InverseBindMatrices;
+    std::uint32_t SkeletonRootIndex = UINT32_MAX;
+};
+
+enum class GltfAnimationPath
+{
+    TRANSLATION,
+    ROTATION,
+    SCALE
+};
+
+enum class GltfInterpolation
+{
+    LINEAR,
+    STEP,
+    CUBICSPLINE
+};
+
+struct COMMON_API GltfAnimationChannel
+{
+    std::uint32_t NodeIndex = UINT32_MAX;
+    GltfAnimationPath Path = GltfAnimationPath::TRANSLATION;
+    GltfInterpolation Interpolation = GltfInterpolation::LINEAR;
+    std::vector<float> Times;
+    // Translation and scale use xyz, rotation is a quaternion in xyzw order. CUBICSPLINE channels keep 3 values per
+    // keyframe (in-tangent, value, out-tangent).
+    std::vector<glm::vec4> Values;
+};
+
+struct COMMON_API GltfAnimation
+{
+    std::string Name;
+    float Duration = 0.0f;
+    std::vector<GltfAnimationChannel> Channels;
 };
 
 enum class GltfCameraType
@@ -105,10 +170,29 @@ struct COMMON_API GltfModelHandler
     std::string Name;
     std::uint32_t CurrentSceneIndex = UINT32_MAX;
     std::vector<GltfCamera> Cameras;
+    std::vector<GltfAnimation> Animations;
     std::vector<GltfNode> Nodes;
+    TransformHierarchy NodeHierarchy; // Flat hierarchy of the nodes (use GetFlatIndex with the node index)
+    std::vector<GltfSkin> Skins;
     std::vector<GltfMesh> Meshes;
     std::vector<GltfMaterial> Materials;
     std::vector<TextureHandler> Textures;
+
+    /**
+     * @brief Calculates skinning matrices (joint world transform * inverse bind matrix) of a skin from the current
+     * world transforms of the node hierarchy. Transform of the skinned mesh node is ignored as glTF requires, so
+     * skinned vertices are in the model space.
+     * @param skinIndex Index of the skin.
+     * @param jointMatrices Output matrices, it must have at least joint count elements.
+     */
+    void ComputeJointMatrices(const std::uint32_t skinIndex, std::span<glm::mat4> jointMatrices) const
+    {
+        const auto& skin = Skins[skinIndex];
+        for (std::size_t i = 0; i < skin.Joints.size(); ++i) {
+            jointMatrices[i] = NodeHierarchy.GetWorldTransform(NodeHierarchy.GetFlatIndex(skin.Joints[i])) *
+                               skin.InverseBindMatrices[i];
+        }
+    }
 };
 
 } // namespace common::utility
\ No newline at end of file
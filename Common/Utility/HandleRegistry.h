@@ -0,0 +1,194 @@
+/**
+ * @file    HandleRegistry.h
+ * @brief   Generational handles and a dense slot registry that keeps resources behind these handles.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace common::utility
+{
+/**
+ * @brief Typed generational handle. Index points to a slot of a registry and generation detects stale handles after
+ * the slot is reused.
+ * @tparam Tag Empty tag type that makes handles of different resource types incompatible.
+ */
+template<typename Tag>
+struct Handle
+{
+    static constexpr std::uint32_t InvalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+    std::uint32_t Index = InvalidIndex;
+    std::uint32_t Generation = 0;
+
+    [[nodiscard]] constexpr bool IsValid() const { return Index != InvalidIndex; }
+
+    constexpr bool operator==(const Handle&) const = default;
+};
+
+/**
+ * @brief Keeps resources in dense slot arrays and gives generational handles for them. Name lookup is only used while
+ * creating or debugging resources, so accessing a resource with a handle is an array index and a generation check.
+ * @tparam HandleType Handle type (e.g. Handle<BufferTag>).
+ * @tparam ResourceType Type of the kept resource (e.g. std::unique_ptr<BufferResource>).
+ */
+template<typename HandleType, typename ResourceType>
+class HandleRegistry
+{
+public:
+    /**
+     * @brief Adds a resource to the registry. If there is a resource with the same name, it is removed first and its
+     * old handles become stale. Owners which keep state derived from the handles should remove the old resource through
+     * their own delete path before the replacement.
+     * @param name Name of the resource.
+     * @param resource Resource object.
+     * @return Returns handle of the added resource.
+     */
+    HandleType Add(const std::string& name, ResourceType resource)
+    {
+        Remove(name);
+
+        std::uint32_t index;
+        if (!freeSlots_.empty()) {
+            index = freeSlots_.back();
+            freeSlots_.pop_back();
+        } else {
+            index = static_cast<std::uint32_t>(slots_.size());
+            slots_.emplace_back();
+        }
+
+        auto& slot = slots_[index];
+        slot.Resource = std::move(resource);
+        slot.Name = name;
+        slot.IsAlive = true;
+        nameToIndex_[name] = index;
+
+        return HandleType{index, slot.Generation};
+    }
+
+    /**
+     * @brief Returns the resource of the handle.
+     * @param handle Handle of the resource.
+     * @return Returns pointer of the resource, if the handle is invalid or stale it returns nullptr.
+     */
+    [[nodiscard]] ResourceType* Get(const HandleType& handle)
+    {
+        return Contains(handle) ? &slots_[handle.Index].Resource : nullptr;
+    }
+
+    /**
+     * @brief Returns the resource of the handle.
+     * @param handle Handle of the resource.
+     * @return Returns pointer of the resource, if the handle is invalid or stale it returns nullptr.
+     */
+    [[nodiscard]] const ResourceType* Get(const HandleType& handle) const
+    {
+        return Contains(handle) ? &slots_[handle.Index].Resource : nullptr;
+    }
+
+    /**
+     * @brief Finds handle of the resource with its name.
+     * @param name Name of the resource.
+     * @return Returns handle of the resource, if the resource is not found it returns an invalid handle.
+     */
+    [[nodiscard]] HandleType Find(const std::string& name) const
+    {
+        const auto it = nameToIndex_.find(name);
+        if (it == nameToIndex_.end()) {
+            return HandleType{};
+        }
+
+        return HandleType{it->second, slots_[it->second].Generation};
+    }
+
+    /**
+     * @brief Queries whether the handle refers to a live resource or not.
+     * @param handle Handle of the resource.
+     * @return Returns true if the handle is valid and not stale, otherwise false.
+     */
+    [[nodiscard]] bool Contains(const HandleType& handle) const
+    {
+        return handle.Index < slots_.size() && slots_[handle.Index].IsAlive &&
+               slots_[handle.Index].Generation == handle.Generation;
+    }
+
+    /**
+     * @brief Returns name of the resource (for debugging purposes).
+     * @param handle Handle of the resource.
+     * @return Returns name of the resource, if the handle is stale it returns empty string.
+     */
+    [[nodiscard]] std::string GetName(const HandleType& handle) const
+    {
+        return Contains(handle) ? slots_[handle.Index].Name : std::string{};
+    }
+
+    /**
+     * @brief Removes the resource and makes its handles stale.
+     * @param handle Handle of the resource.
+     * @return Returns true if the resource is removed, otherwise false.
+     */
+    bool Remove(const HandleType& handle)
+    {
+        if (!Contains(handle)) {
+            return false;
+        }
+
+        auto& slot = slots_[handle.Index];
+        nameToIndex_.erase(slot.Name);
+        slot.Resource = ResourceType{};
+        slot.Name.clear();
+        slot.IsAlive = false;
+        ++slot.Generation;
+        freeSlots_.push_back(handle.Index);
+
+        return true;
+    }
+
+    /**
+     * @brief Removes the resource with its name and makes its handles stale.
+     * @param name Name of the resource.
+     * @return Returns true if the resource is removed, otherwise false.
+     */
+    bool Remove(const std::string& name) { return Remove(Find(name)); }
+
+    /**
+     * @brief Removes all resources.
+     */
+    void Clear()
+    {
+        for (std::uint32_t index = 0; index < slots_.size(); ++index) {
+            Remove(HandleType{index, slots_[index].Generation});
+        }
+    }
+
+    /**
+     * @brief Returns number of the live resources.
+     * @return Returns number of the live resources.
+     */
+    [[nodiscard]] std::size_t GetSize() const { return nameToIndex_.size(); }
+
+private:
+    struct Slot
+    {
+        ResourceType Resource{};
+        std::string Name;
+        std::uint32_t Generation = 0;
+        bool IsAlive = false;
+    };
+
+    std::vector<Slot> slots_;
+    std::vector<std::uint32_t> freeSlots_;
+    std::unordered_map<std::string, std::uint32_t> nameToIndex_;
+};
+} // namespace common::utility
@@ -6,14 +6,18 @@
 
 #include "ModelLoader.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <filesystem>
 #include <iostream>
+#include <limits>
 
 #include <utility>
 #include <glm/ext/matrix_transform.hpp>
 #include <glm/gtc/quaternion.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+#include "FrustumCulling.h"
 #include "TextureHandler.h"
 #include "TextureLoader.h"
 
@@ -58,16 +62,108 @@ namespace
         return mat;
     }
 
-    void ComputeWorldTransform(std::vector<GltfNode>& nodes,
-                               const std::uint32_t nodeIndex,
-                               const glm::mat4& parentWorldMatrix)
+    // Reads a float accessor, normalized integer components are converted to [0, 1] or [-1, 1]
+    bool ReadFloatAccessor(const tinygltf::Model& model, const int accessorIndex, std::vector<float>& data)
     {
-        auto& node = nodes[nodeIndex];
-        node.WorldTransform = parentWorldMatrix * node.LocalTransform;
+        if (accessorIndex < 0 || accessorIndex >= static_cast<int>(model.accessors.size())) {
+            return false;
+        }
+
+        const auto& accessor = model.accessors[accessorIndex];
+        if (accessor.bufferView < 0 ||
+            (accessor.componentType != TINYGLTF_COMPONENT_TYPE_FLOAT && !accessor.normalized)) {
+            return false;
+        }
+
+        const auto& bufferView = model.bufferViews[accessor.bufferView];
+        const auto& buffer = model.buffers[bufferView.buffer];
+        const auto componentCount = static_cast<size_t>(tinygltf::GetNumComponentsInType(accessor.type));
+        const auto componentSize = static_cast<size_t>(tinygltf::GetComponentSizeInBytes(accessor.componentType));
+        const auto stride = static_cast<size_t>(accessor.ByteStride(bufferView));
+
+        data.resize(accessor.count * componentCount);
+        const size_t start = bufferView.byteOffset + accessor.byteOffset;
+        for (size_t i = 0; i < accessor.count; ++i) {
+            const unsigned char* element = &buffer.data[start + i * stride];
+            for (size_t c = 0; c < componentCount; ++c) {
+                const unsigned char* component = element + c * componentSize;
+                float& value = data[i * componentCount + c];
+                switch (accessor.componentType) {
+                    case TINYGLTF_COMPONENT_TYPE_FLOAT:
+                        std::memcpy(&value, component, sizeof(float));
+                        break;
+                    case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+                        value = static_cast<float>(*component) / 255.0f;
+                        break;
+                    case TINYGLTF_COMPONENT_TYPE_BYTE:
+                        value = std::max(static_cast<float>(static_cast<std::int8_t>(*component)) / 127.0f, -1.0f);
+                        break;
+                    case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT: {
+                        std::uint16_t raw;
+                        std::memcpy(&raw, component, sizeof(raw));
+                        value = static_cast<float>(raw) / 65535.0f;
+                        break;
+                    }
+                    case TINYGLTF_COMPONENT_TYPE_SHORT: {
+                        std::int16_t raw;
+                        std::memcpy(&raw, component, sizeof(raw));
+                        value = std::max(static_cast<float>(raw) / 32767.0f, -1.0f);
+                        break;
+                    }
+                    default:
+                        return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    // Reads an accessor with unsigned integer components (e.g. JOINTS_0) and widens them to 32 bits
+    bool ReadUIntAccessor(const tinygltf::Model& model, const int accessorIndex, std::vector<std::uint32_t>& data)
+    {
+        if (accessorIndex < 0 || accessorIndex >= static_cast<int>(model.accessors.size())) {
+            return false;
+        }
+
+        const auto& accessor = model.accessors[accessorIndex];
+        if (accessor.bufferView < 0) {
+            return false;
+        }
 
-        for (const auto childIndex: node.ChildIndices) {
-            ComputeWorldTransform(nodes, childIndex, node.WorldTransform);
+        const auto& bufferView = model.bufferViews[accessor.bufferView];
+        const auto& buffer = model.buffers[bufferView.buffer];
+        const auto componentCount = static_cast<size_t>(tinygltf::GetNumComponentsInType(accessor.type));
+        const auto componentSize = static_cast<size_t>(tinygltf::GetComponentSizeInBytes(accessor.componentType));
+        const auto stride = static_cast<size_t>(accessor.ByteStride(bufferView));
+
+        data.resize(accessor.count * componentCount);
+        const size_t start = bufferView.byteOffset + accessor.byteOffset;
+        for (size_t i = 0; i < accessor.count; ++i) {
+            const unsigned char* element = &buffer.data[start + i * stride];
+            for (size_t c = 0; c < componentCount; ++c) {
+                const unsigned char* component = element + c * componentSize;
+                std::uint32_t& value = data[i * componentCount + c];
+                switch (accessor.componentType) {
+                    case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+                        value = *component;
+                        break;
+                    case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT: {
+                        std::uint16_t raw;
+                        std::memcpy(&raw, component, sizeof(raw));
+                        value = raw;
+                        break;
+                    }
+                    case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
+                        std::memcpy(&value, component, sizeof(value));
+                        break;
+                    default:
+                        return false;
+                }
+            }
         }
+
+        return true;
     }
 } // namespace
 
@@ -146,11 +242,21 @@ std::shared_ptr<GltfModelHandler> ModelLoader::ProcessGltfModel(const std::strin
         return nullptr;
     }
 
+    if (!ProcessSkins(gltfModelHandler)) {
+        std::cerr << "GLTF processing skins error!" << std::endl;
+        return nullptr;
+    }
+
     if (!ProcessCameras(gltfModelHandler)) {
         std::cerr << "GLTF processing cameras error!" << std::endl;
         return nullptr;
     }
 
+    if (!ProcessAnimations(gltfModelHandler)) {
+        std::cerr << "GLTF processing animations error!" << std::endl;
+        return nullptr;
+    }
+
     return gltfModelHandler;
 }
 
@@ -206,7 +312,7 @@ bool ModelLoader::ProcessMeshes(const std::shared_ptr<GltfModelHandler>& handler
         for (const auto& primitive: mesh.primitives) {
             GltfMesh gltfMesh;
             std::string meshName = mesh.name.empty() ? "mesh" + std::to_string(meshCount++) : mesh.name;
-            gltfMesh.Name = handler->Name + "_" + meshName;
+            gltfMesh.SetName(handler->Name + "_" + meshName);
 
             // Vertex Positions
             std::vector<float> posData;
@@ -220,6 +326,22 @@ bool ModelLoader::ProcessMeshes(const std::shared_ptr<GltfModelHandler>& handler
 
                 posData.resize(length);
                 std::memcpy(posData.data(), &posBuffer.data[start], length * sizeof(float));
+
+                // glTF requires min and max for POSITION, they are calculated from the positions if a file omits them
+                if (posAccessor.minValues.size() == 3 && posAccessor.maxValues.size() == 3) {
+                    gltfMesh.BoundsMin = glm::vec3(posAccessor.minValues[0], posAccessor.minValues[1],
+                                                   posAccessor.minValues[2]);
+                    gltfMesh.BoundsMax = glm::vec3(posAccessor.maxValues[0], posAccessor.maxValues[1],
+                                                   posAccessor.maxValues[2]);
+                } else if (posAccessor.count > 0) {
+                    gltfMesh.BoundsMin = glm::vec3(std::numeric_limits<float>::max());
+                    gltfMesh.BoundsMax = glm::vec3(std::numeric_limits<float>::lowest());
+                    for (size_t i = 0; i < posAccessor.count; ++i) {
+                        const glm::vec3 position = glm::make_vec3(&posData[i * 3]);
+                        gltfMesh.BoundsMin = glm::min(gltfMesh.BoundsMin, position);
+                        gltfMesh.BoundsMax = glm::max(gltfMesh.BoundsMax, position);
+                    }
+                }
             } else {
                 std::cerr << "GLTF primitive should contain POSITION attribute!" << std::endl;
                 return false;
@@ -253,8 +375,24 @@ bool ModelLoader::ProcessMeshes(const std::shared_ptr<GltfModelHandler>& handler
                 std::memcpy(texData.data(), &texBuffer.data[start], length * sizeof(float));
             }
 
+            // Skinning attributes (only the first set, so 4 influences per vertex)
+            std::vector<std::uint32_t> jointData;
+            std::vector<float> weightData;
+            if (primitive.attributes.contains("JOINTS_0") && primitive.attributes.contains("WEIGHTS_0")) {
+                if (!ReadUIntAccessor(gltfModel_, primitive.attributes.at("JOINTS_0"), jointData) ||
+                    !ReadFloatAccessor(gltfModel_, primitive.attributes.at("WEIGHTS_0"), weightData)) {
+                    std::cerr << "GLTF unsupported JOINTS_0 or WEIGHTS_0 type!" << std::endl;
+                    return false;
+                }
+            }
+
             // Process vertices
             const auto& posAccessor = gltfModel_.accessors[primitive.attributes.at("POSITION")];
+            if (jointData.size() != weightData.size() ||
+                (!jointData.empty() && jointData.size() != posAccessor.count * 4)) {
+                std::cerr << "GLTF JOINTS_0 and WEIGHTS_0 counts don't match the vertex count!" << std::endl;
+                return false;
+            }
             for (size_t i = 0; i < posAccessor.count; ++i) {
                 GltfPrimitiveAttrib attribute;
                 attribute.Position = glm::vec3(posData[i * 3 + 0], posData[i * 3 + 1], posData[i * 3 + 2]);
@@ -264,6 +402,11 @@ bool ModelLoader::ProcessMeshes(const std::shared_ptr<GltfModelHandler>& handler
                 if (!texData.empty()) {
                     attribute.TexCoords.emplace_back(texData[i * 2 + 0], texData[i * 2 + 1]);
                 }
+                if (!jointData.empty()) {
+                    attribute.Joints = glm::uvec4(jointData[i * 4 + 0], jointData[i * 4 + 1], jointData[i * 4 + 2],
+                                                  jointData[i * 4 + 3]);
+                    attribute.Weights = glm::make_vec4(&weightData[i * 4]);
+                }
                 gltfMesh.Vertices.push_back(attribute);
             }
 
@@ -304,7 +447,21 @@ bool ModelLoader::ProcessNodes(const std::shared_ptr<GltfModelHandler>& handler)
             gltfNodes[i].ChildIndices.emplace_back(static_cast<uint32_t>(child));
         }
         gltfNodes[i].CameraIndex = gltfModel_.nodes[i].camera != -1 ? gltfModel_.nodes[i].camera : UINT32_MAX;
+        gltfNodes[i].SkinIndex = gltfModel_.nodes[i].skin != -1 ? gltfModel_.nodes[i].skin : UINT32_MAX;
         gltfNodes[i].LocalTransform = GetLocalTransform(gltfModel_.nodes[i]);
+
+        const auto& node = gltfModel_.nodes[i];
+        if (node.matrix.empty()) {
+            if (node.translation.size() == 3) {
+                gltfNodes[i].Translation = glm::make_vec3(node.translation.data());
+            }
+            if (node.rotation.size() == 4) {
+                gltfNodes[i].Rotation = glm::make_quat(node.rotation.data());
+            }
+            if (node.scale.size() == 3) {
+                gltfNodes[i].Scale = glm::make_vec3(node.scale.data());
+            }
+        }
     }
 
     // Set parents
@@ -314,11 +471,30 @@ bool ModelLoader::ProcessNodes(const std::shared_ptr<GltfModelHandler>& handler)
         }
     }
 
-    // Calculate world transforms
+    // Calculate world transforms with a single pass over the depth first sorted hierarchy
     handler->CurrentSceneIndex = gltfModel_.defaultScene > -1 ? gltfModel_.defaultScene : 0;
-    const auto& scene = gltfModel_.scenes[handler->CurrentSceneIndex];
-    for (const auto rootNode: scene.nodes) {
-        ComputeWorldTransform(gltfNodes, static_cast<std::uint32_t>(rootNode), glm::mat4(1.0f));
+    std::vector<std::uint32_t> parentIndices(gltfNodes.size());
+    std::vector<glm::mat4> localTransforms(gltfNodes.size());
+    for (size_t i = 0; i < gltfNodes.size(); ++i) {
+        parentIndices[i] = gltfNodes[i].ParentIndex;
+        localTransforms[i] = gltfNodes[i].LocalTransform;
+    }
+
+    try {
+        handler->NodeHierarchy.Build(parentIndices, localTransforms);
+    } catch (const std::exception& e) {
+        std::cerr << "GLTF node hierarchy error: " << e.what() << std::endl;
+        return false;
+    }
+
+    for (size_t i = 0; i < gltfNodes.size(); ++i) {
+        const auto flatIndex = handler->NodeHierarchy.GetFlatIndex(static_cast<std::uint32_t>(i));
+        gltfNodes[i].WorldTransform = handler->NodeHierarchy.GetWorldTransform(flatIndex);
+        if (gltfNodes[i].MeshIndex < handler->Meshes.size()) {
+            const auto& mesh = handler->Meshes[gltfNodes[i].MeshIndex];
+            TransformBounds(mesh.BoundsMin, mesh.BoundsMax, gltfNodes[i].WorldTransform, gltfNodes[i].BoundsMin,
+                            gltfNodes[i].BoundsMax);
+        }
     }
 
     handler->Nodes = gltfNodes;
@@ -353,4 +529,116 @@ bool ModelLoader::ProcessCameras(const std::shared_ptr<GltfModelHandler>& handle
     return true;
 }
 
+bool ModelLoader::ProcessSkins(const std::shared_ptr<GltfModelHandler>& handler) const
+{
+    for (const auto& skin: gltfModel_.skins) {
+        GltfSkin gltfSkin;
+        gltfSkin.Name = skin.name;
+
+        for (const auto joint: skin.joints) {
+            if (joint < 0 || joint >= static_cast<int>(handler->Nodes.size())) {
+                std::cerr << "GLTF skin joint index is wrong!" << std::endl;
+                return false;
+            }
+            gltfSkin.Joints.push_back(static_cast<std::uint32_t>(joint));
+        }
+        if (skin.skeleton >= 0 && skin.skeleton < static_cast<int>(handler->Nodes.size())) {
+            gltfSkin.SkeletonRootIndex = static_cast<std::uint32_t>(skin.skeleton);
+        }
+
+        // Inverse bind matrices are optional, missing ones are identity
+        gltfSkin.InverseBindMatrices.resize(gltfSkin.Joints.size(), glm::mat4(1.0f));
+        if (skin.inverseBindMatrices >= 0) {
+            std::vector<float> matrixData;
+            if (!ReadFloatAccessor(gltfModel_, skin.inverseBindMatrices, matrixData) ||
+                matrixData.size() != gltfSkin.Joints.size() * 16) {
+                std::cerr << "GLTF skin inverse bind matrices don't match the joints!" << std::endl;
+                return false;
+            }
+            for (size_t i = 0; i < gltfSkin.Joints.size(); ++i) {
+                gltfSkin.InverseBindMatrices[i] = glm::make_mat4(&matrixData[i * 16]);
+            }
+        }
+
+        handler->Skins.push_back(std::move(gltfSkin));
+    }
+
+    for (const auto& node: handler->Nodes) {
+        if (node.SkinIndex != UINT32_MAX && node.SkinIndex >= handler->Skins.size()) {
+            std::cerr << "GLTF node skin index is wrong!" << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool ModelLoader::ProcessAnimations(const std::shared_ptr<GltfModelHandler>& handler) const
+{
+    for (const auto& animation: gltfModel_.animations) {
+        GltfAnimation gltfAnimation;
+        gltfAnimation.Name = animation.name;
+
+        for (const auto& channel: animation.channels) {
+            GltfAnimationChannel gltfChannel;
+            if (channel.target_path == "translation") {
+                gltfChannel.Path = GltfAnimationPath::TRANSLATION;
+            } else if (channel.target_path == "rotation") {
+                gltfChannel.Path = GltfAnimationPath::ROTATION;
+            } else if (channel.target_path == "scale") {
+                gltfChannel.Path = GltfAnimationPath::SCALE;
+            } else {
+                // Morph target weights are not supported yet
+                std::cout << "GLTF animation channel path is skipped: " << channel.target_path << std::endl;
+                continue;
+            }
+
+            if (channel.target_node < 0 || channel.target_node >= static_cast<int>(handler->Nodes.size()) ||
+                channel.sampler < 0 || channel.sampler >= static_cast<int>(animation.samplers.size())) {
+                std::cerr << "GLTF animation channel target or sampler is wrong!" << std::endl;
+                return false;
+            }
+            gltfChannel.NodeIndex = static_cast<std::uint32_t>(channel.target_node);
+
+            const auto& sampler = animation.samplers[channel.sampler];
+            if (sampler.interpolation == "STEP") {
+                gltfChannel.Interpolation = GltfInterpolation::STEP;
+            } else if (sampler.interpolation == "CUBICSPLINE") {
+                gltfChannel.Interpolation = GltfInterpolation::CUBICSPLINE;
+            } else {
+                gltfChannel.Interpolation = GltfInterpolation::LINEAR;
+            }
+
+            // Float and normalized integer outputs are supported (normalized integers are allowed for rotations)
+            std::vector<float> outputs;
+            if (!ReadFloatAccessor(gltfModel_, sampler.input, gltfChannel.Times) ||
+                !ReadFloatAccessor(gltfModel_, sampler.output, outputs)) {
+                std::cerr << "GLTF animation sampler accessors should contain float or normalized data!" << std::endl;
+                return false;
+            }
+
+            const size_t componentCount = gltfChannel.Path == GltfAnimationPath::ROTATION ? 4 : 3;
+            const size_t valuesPerKey = gltfChannel.Interpolation == GltfInterpolation::CUBICSPLINE ? 3 : 1;
+            if (gltfChannel.Times.empty() ||
+                outputs.size() != gltfChannel.Times.size() * valuesPerKey * componentCount) {
+                std::cerr << "GLTF animation sampler input and output counts don't match!" << std::endl;
+                return false;
+            }
+
+            gltfChannel.Values.resize(outputs.size() / componentCount);
+            for (size_t i = 0; i < gltfChannel.Values.size(); ++i) {
+                const float* value = &outputs[i * componentCount];
+                gltfChannel.Values[i] = glm::vec4(value[0], value[1], value[2], componentCount == 4 ? value[3] : 0.0f);
+            }
+
+            gltfAnimation.Duration = std::max(gltfAnimation.Duration, gltfChannel.Times.back());
+            gltfAnimation.Channels.push_back(std::move(gltfChannel));
+        }
+
+        handler->Animations.push_back(std::move(gltfAnimation));
+    }
+
+    return true;
+}
+
 } // namespace common::utility
@@ -56,8 +56,12 @@ private:
 
     [[nodiscard]] bool ProcessNodes(const std::shared_ptr<GltfModelHandler>& handler) const;
 
+    [[nodiscard]] bool ProcessSkins(const std::shared_ptr<GltfModelHandler>& handler) const;
+
     [[nodiscard]] bool ProcessCameras(const std::shared_ptr<GltfModelHandler>& handler) const;
 
+    [[nodiscard]] bool ProcessAnimations(const std::shared_ptr<GltfModelHandler>& handler) const;
+
     std::string basePath_;
     tinygltf::TinyGLTF gltfLoader_;
     tinygltf::Model gltfModel_;
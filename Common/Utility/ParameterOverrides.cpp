@@ -0,0 +1,450 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "ParameterOverrides.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace common::utility
+{
+namespace
+{
+    constexpr auto kConfigArgument = "--config=";
+    constexpr auto kSweepPrefix = "sweep.";
+    constexpr auto kSweepSection = "Sweep";
+    constexpr char kSweepSeparator = '|';
+
+    std::string JoinKey(const std::string& prefix, const std::string& key)
+    {
+        return prefix.empty() ? key : prefix + "." + key;
+    }
+
+    std::string Unquote(const std::string& text)
+    {
+        if (text.size() >= 2 && text.front() == '"' && text.back() == '"') {
+            return text.substr(1, text.size() - 2);
+        }
+        return text;
+    }
+
+    /**
+     * Minimal JSON reader which flattens nested objects into "Parent.Child" keys. Arrays of scalars are converted to
+     * comma separated texts, so they can be parsed as std::vector or struct parameters.
+     */
+    class JsonFlattener
+    {
+    public:
+        explicit JsonFlattener(const std::string& content) : content_{content} {}
+
+        bool Parse(std::vector<std::pair<std::string, std::string>>& values,
+                   std::vector<ParameterOverrides::SweepAxis>& sweepAxes)
+        {
+            SkipWhitespace();
+            if (!ParseObject("", values, sweepAxes)) {
+                return false;
+            }
+            SkipWhitespace();
+            return pos_ == content_.size();
+        }
+
+    private:
+        bool ParseObject(const std::string& prefix, std::vector<std::pair<std::string, std::string>>& values,
+                         std::vector<ParameterOverrides::SweepAxis>& sweepAxes)
+        {
+            if (!Consume('{')) {
+                return false;
+            }
+
+            SkipWhitespace();
+            if (Consume('}')) {
+                return true;
+            }
+
+            do {
+                SkipWhitespace();
+                std::string key;
+                if (!ParseString(key)) {
+                    return false;
+                }
+
+                SkipWhitespace();
+                if (!Consume(':')) {
+                    return false;
+                }
+                SkipWhitespace();
+
+                const bool isSweep = prefix.empty() && key == kSweepSection;
+                if (Peek() == '{' && isSweep) {
+                    if (!ParseSweepObject("", sweepAxes)) {
+                        return false;
+                    }
+                } else if (Peek() == '{') {
+                    if (!ParseObject(JoinKey(prefix, key), values, sweepAxes)) {
+                        return false;
+                    }
+                } else {
+                    std::string value;
+                    if (!ParseValue(value)) {
+                        return false;
+                    }
+                    values.emplace_back(JoinKey(prefix, key), value);
+                }
+                SkipWhitespace();
+            } while (Consume(','));
+
+            return Consume('}');
+        }
+
+        bool ParseSweepObject(const std::string& prefix, std::vector<ParameterOverrides::SweepAxis>& sweepAxes)
+        {
+            if (!Consume('{')) {
+                return false;
+            }
+
+            SkipWhitespace();
+            if (Consume('}')) {
+                return true;
+            }
+
+            do {
+                SkipWhitespace();
+                std::string key;
+                if (!ParseString(key)) {
+                    return false;
+                }
+
+                SkipWhitespace();
+                if (!Consume(':')) {
+                    return false;
+                }
+                SkipWhitespace();
+
+                if (Peek() == '{') {
+                    if (!ParseSweepObject(JoinKey(prefix, key), sweepAxes)) {
+                        return false;
+                    }
+                } else if (Consume('[')) {
+                    ParameterOverrides::SweepAxis axis{JoinKey(prefix, key), {}};
+                    SkipWhitespace();
+                    if (!Consume(']')) {
+                        do {
+                            SkipWhitespace();
+                            std::string value;
+                            if (!ParseValue(value)) {
+                                return false;
+                            }
+                            axis.Values.push_back(value);
+                            SkipWhitespace();
+                        } while (Consume(','));
+
+                        if (!Consume(']')) {
+                            return false;
+                        }
+                    }
+                    sweepAxes.push_back(std::move(axis));
+                } else {
+                    return false;
+                }
+                SkipWhitespace();
+            } while (Consume(','));
+
+            return Consume('}');
+        }
+
+        bool ParseValue(std::string& value)
+        {
+            if (Peek() == '"') {
+                return ParseString(value);
+            }
+
+            if (Consume('[')) {
+                std::vector<std::string> elements;
+                SkipWhitespace();
+                if (!Consume(']')) {
+                    do {
+                        SkipWhitespace();
+                        std::string element;
+                        if (!ParseValue(element)) {
+                            return false;
+                        }
+                        elements.push_back(element);
+                        SkipWhitespace();
+                    } while (Consume(','));
+
+                    if (!Consume(']')) {
+                        return false;
+                    }
+                }
+
+                value.clear();
+                for (std::size_t i = 0; i < elements.size(); ++i) {
+                    value += (i == 0 ? "" : ",") + elements[i];
+                }
+                return true;
+            }
+
+            // Numbers, booleans and null are kept as they are written
+            const auto begin = pos_;
+            while (pos_ < content_.size() && content_[pos_] != ',' && content_[pos_] != '}' &&
+                   content_[pos_] != ']' && !std::isspace(static_cast<unsigned char>(content_[pos_]))) {
+                ++pos_;
+            }
+            value = content_.substr(begin, pos_ - begin);
+            return !value.empty();
+        }
+
+        bool ParseString(std::string& value)
+        {
+            if (!Consume('"')) {
+                return false;
+            }
+
+            value.clear();
+            while (pos_ < content_.size() && content_[pos_] != '"') {
+                if (content_[pos_] == '\\' && pos_ + 1 < content_.size()) {
+                    ++pos_;
+                }
+                value += content_[pos_++];
+            }
+
+            return Consume('"');
+        }
+
+        void SkipWhitespace()
+        {
+            while (pos_ < content_.size() && std::isspace(static_cast<unsigned char>(content_[pos_]))) {
+                ++pos_;
+            }
+        }
+
+        [[nodiscard]] char Peek() const { return pos_ < content_.size() ? content_[pos_] : '\0'; }
+
+        bool Consume(const char expected)
+        {
+            if (Peek() != expected) {
+                return false;
+            }
+            ++pos_;
+            return true;
+        }
+
+        const std::string& content_;
+        std::size_t pos_ = 0;
+    };
+} // namespace
+
+bool ParameterOverrides::ParseCommandLine(const int argc, const char* const* argv)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string argument{argv[i]};
+
+        if (argument.starts_with(kConfigArgument)) {
+            if (!LoadFile(argument.substr(std::char_traits<char>::length(kConfigArgument)))) {
+                return false;
+            }
+            continue;
+        }
+
+        if (!argument.starts_with("--")) {
+            continue;
+        }
+
+        const auto separatorPos = argument.find('=');
+        if (separatorPos == std::string::npos || separatorPos == 2) {
+            std::cerr << "Invalid command line override (expected --key=value): " << argument << std::endl;
+            return false;
+        }
+
+        const std::string key = argument.substr(2, separatorPos - 2);
+        const std::string value = argument.substr(separatorPos + 1);
+
+        if (key.starts_with(kSweepPrefix)) {
+            AddSweepAxis(key.substr(std::char_traits<char>::length(kSweepPrefix)),
+                         SplitParameterText(value, kSweepSeparator));
+        } else {
+            AddOverride(key, value);
+        }
+    }
+
+    return true;
+}
+
+bool ParameterOverrides::LoadFile(const std::string& filePath)
+{
+    std::ifstream file(filePath);
+    if (!file.is_open()) {
+        std::cerr << "Parameter profile couldn't be opened: " << filePath << std::endl;
+        return false;
+    }
+
+    std::stringstream stream;
+    stream << file.rdbuf();
+
+    if (std::filesystem::path{filePath}.extension() == ".json") {
+        return LoadJson(stream.str(), filePath);
+    }
+
+    return LoadIni(stream.str(), filePath);
+}
+
+void ParameterOverrides::AddOverride(const std::string& key, const std::string& value)
+{
+    for (auto& [existingKey, existingValue]: overrides_) {
+        if (existingKey == key) {
+            existingValue = value;
+            return;
+        }
+    }
+
+    overrides_.emplace_back(key, value);
+}
+
+void ParameterOverrides::AddSweepAxis(const std::string& key, std::vector<std::string> values)
+{
+    if (values.empty()) {
+        std::cerr << "Sweep axis has no value, it is ignored: " << key << std::endl;
+        return;
+    }
+
+    for (auto& axis: sweepAxes_) {
+        if (axis.Key == key) {
+            axis.Values = std::move(values);
+            return;
+        }
+    }
+
+    sweepAxes_.push_back({key, std::move(values)});
+}
+
+std::uint32_t ParameterOverrides::GetConfigurationCount() const
+{
+    std::uint32_t count = 1;
+    for (const auto& axis: sweepAxes_) {
+        count *= static_cast<std::uint32_t>(axis.Values.size());
+    }
+    return count;
+}
+
+std::string ParameterOverrides::GetConfigurationName(const std::uint32_t configIndex) const
+{
+    const auto values = GetConfigurationValues(configIndex);
+
+    std::string name;
+    for (std::size_t i = 0; i < sweepAxes_.size(); ++i) {
+        name += (i == 0 ? "" : ",") + sweepAxes_[i].Key + "=" + values[i];
+    }
+    return name;
+}
+
+void ParameterOverrides::Apply(ParameterServer& params, const std::uint32_t configIndex) const
+{
+    for (const auto& [key, value]: overrides_) {
+        params.SetFromString(key, value);
+    }
+
+    const auto values = GetConfigurationValues(configIndex);
+    for (std::size_t i = 0; i < sweepAxes_.size(); ++i) {
+        params.SetFromString(sweepAxes_[i].Key, values[i]);
+    }
+}
+
+bool ParameterOverrides::LoadIni(const std::string& content, const std::string& filePath)
+{
+    std::istringstream stream{content};
+    std::string line;
+    std::string section;
+    std::uint32_t lineNumber = 0;
+
+    while (std::getline(stream, line)) {
+        ++lineNumber;
+        const std::string trimmed{detail::TrimText(line)};
+
+        if (trimmed.empty() || trimmed.front() == ';' || trimmed.front() == '#') {
+            continue;
+        }
+
+        if (trimmed.front() == '[') {
+            if (trimmed.back() != ']') {
+                std::cerr << filePath << ":" << lineNumber << ": Invalid section header!" << std::endl;
+                return false;
+            }
+            section = std::string{detail::TrimText(std::string_view{trimmed}.substr(1, trimmed.size() - 2))};
+            continue;
+        }
+
+        const auto separatorPos = trimmed.find('=');
+        if (separatorPos == std::string::npos) {
+            std::cerr << filePath << ":" << lineNumber << ": Expected key = value!" << std::endl;
+            return false;
+        }
+
+        const std::string_view trimmedView{trimmed};
+        const std::string key{detail::TrimText(trimmedView.substr(0, separatorPos))};
+        const std::string value = Unquote(std::string{detail::TrimText(trimmedView.substr(separatorPos + 1))});
+
+        const std::string sweepSectionPrefix = std::string{kSweepSection} + ".";
+        if (section == kSweepSection || section.starts_with(sweepSectionPrefix)) {
+            const std::string prefix = section == kSweepSection ? "" : section.substr(sweepSectionPrefix.size());
+            std::vector<std::string> values;
+            for (const auto& part: SplitParameterText(value, kSweepSeparator)) {
+                values.push_back(Unquote(part));
+            }
+            AddSweepAxis(JoinKey(prefix, key), std::move(values));
+        } else {
+            AddOverride(JoinKey(section, key), value);
+        }
+    }
+
+    return true;
+}
+
+bool ParameterOverrides::LoadJson(const std::string& content, const std::string& filePath)
+{
+    std::vector<std::pair<std::string, std::string>> values;
+    std::vector<SweepAxis> sweepAxes;
+
+    if (JsonFlattener flattener{content}; !flattener.Parse(values, sweepAxes)) {
+        std::cerr << "Parameter profile is not a valid JSON object: " << filePath << std::endl;
+        return false;
+    }
+
+    for (const auto& [key, value]: values) {
+        AddOverride(key, value);
+    }
+
+    for (auto& axis: sweepAxes) {
+        AddSweepAxis(axis.Key, std::move(axis.Values));
+    }
+
+    return true;
+}
+
+std::vector<std::string> ParameterOverrides::GetConfigurationValues(std::uint32_t configIndex) const
+{
+    if (configIndex >= GetConfigurationCount()) {
+        throw std::runtime_error("Sweep configuration index is out of range!");
+    }
+
+    std::vector<std::string> values;
+    values.reserve(sweepAxes_.size());
+
+    // The last axis changes fastest
+    std::vector<std::size_t> indices(sweepAxes_.size());
+    for (std::size_t i = sweepAxes_.size(); i-- > 0;) {
+        indices[i] = configIndex % sweepAxes_[i].Values.size();
+        configIndex /= static_cast<std::uint32_t>(sweepAxes_[i].Values.size());
+    }
+
+    for (std::size_t i = 0; i < sweepAxes_.size(); ++i) {
+        values.push_back(sweepAxes_[i].Values[indices[i]]);
+    }
+
+    return values;
+}
+} // namespace common::utility
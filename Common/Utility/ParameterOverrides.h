@@ -0,0 +1,110 @@
+/**
+ * @file    ParameterOverrides.h
+ * @brief   Loads parameter overrides from config files (INI/JSON) and command line, and enumerates sweep
+ *          configurations for benchmark runs.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "CoreDefines.h"
+#include "ParameterServer.h"
+
+namespace common::utility
+{
+/**
+ * @brief Keeps text overrides of the parameters and sweep axes. Values are validated against the registered parameter
+ * types while they are applied to a parameter server.
+ *
+ * Command line syntax:
+ *  --config=<path>              Loads an INI (default) or JSON (.json extension) profile.
+ *  --<key>=<value>              Overrides a parameter (e.g. --Window.Width=1280).
+ *  --sweep.<key>=<v0>|<v1>|...  Adds a sweep axis. Every combination of the axes becomes one configuration.
+ *
+ * INI profiles use "[Section]" headers as key prefixes ("[AppSettings]" + "ClearColor" = "AppSettings.ClearColor"),
+ * sections named "Sweep" or "Sweep.<Prefix>" define sweep axes. JSON profiles use nested objects as key prefixes and
+ * the top-level "Sweep" object keeps the axes as arrays.
+ */
+class COMMON_API ParameterOverrides
+{
+public:
+    struct SweepAxis
+    {
+        std::string Key;
+        std::vector<std::string> Values;
+    };
+
+    /**
+     * @brief Parses command line arguments. Unknown arguments (which don't start with "--") are ignored.
+     * @param argc Argument count.
+     * @param argv Argument values.
+     * @return Returns true if all arguments are parsed successfully, otherwise false.
+     */
+    bool ParseCommandLine(int argc, const char* const* argv);
+
+    /**
+     * @brief Loads a profile file. Files with ".json" extension are parsed as JSON, others are parsed as INI.
+     * @param filePath Path of the profile file.
+     * @return Returns true if the file is loaded successfully, otherwise false.
+     */
+    bool LoadFile(const std::string& filePath);
+
+    /**
+     * @brief Adds or replaces a single parameter override.
+     * @param key Key name of the parameter.
+     * @param value Text representation of the value.
+     */
+    void AddOverride(const std::string& key, const std::string& value);
+
+    /**
+     * @brief Adds or replaces a sweep axis.
+     * @param key Key name of the parameter.
+     * @param values Text representations of the values in the sweep order.
+     */
+    void AddSweepAxis(const std::string& key, std::vector<std::string> values);
+
+    /**
+     * @brief Returns number of the sweep configurations (multiplication of all axis sizes, at least 1).
+     * @return Returns number of the sweep configurations.
+     */
+    [[nodiscard]] std::uint32_t GetConfigurationCount() const;
+
+    /**
+     * @brief Returns a readable name of the configuration (e.g. "Window.Width=800,Window.SampleCount=4").
+     * @param configIndex Index of the sweep configuration.
+     * @return Returns name of the configuration, if there is no sweep axis it returns empty string.
+     */
+    [[nodiscard]] std::string GetConfigurationName(std::uint32_t configIndex) const;
+
+    /**
+     * @brief Applies overrides and values of the given sweep configuration to the parameter server. Sweep values are
+     * applied after the plain overrides. It throws an exception if a key or a value doesn't match the schema.
+     * @param params Parameter server which will be modified.
+     * @param configIndex Index of the sweep configuration.
+     */
+    void Apply(ParameterServer& params, std::uint32_t configIndex = 0) const;
+
+    [[nodiscard]] const std::vector<std::pair<std::string, std::string>>& GetOverrides() const { return overrides_; }
+
+    [[nodiscard]] const std::vector<SweepAxis>& GetSweepAxes() const { return sweepAxes_; }
+
+private:
+    bool LoadIni(const std::string& content, const std::string& filePath);
+
+    bool LoadJson(const std::string& content, const std::string& filePath);
+
+    [[nodiscard]] std::vector<std::string> GetConfigurationValues(std::uint32_t configIndex) const;
+
+    std::vector<std::pair<std::string, std::string>> overrides_;
+    std::vector<SweepAxis> sweepAxes_;
+};
+} // namespace common::utility
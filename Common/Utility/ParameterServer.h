@@ -11,18 +11,75 @@
 #pragma once
 
 #include <any>
+#include <cstdint>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <memory>
 #include <ostream>
 #include <stdexcept>
 #include <string>
 #include <typeindex>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "CoreDefines.h"
+#include "ParameterValueParser.h"
 
 namespace common::utility
 {
+/**
+ * @brief Typed parameter key. It is declared with a parameter name and resolved once into a dense slot index, so the
+ * hot-path reads don't need to hash strings or check types.
+ * @tparam ParamType Type of the parameter.
+ */
+template<typename ParamType>
+class ParamKey
+{
+public:
+    using Type = ParamType;
+
+    static constexpr std::uint32_t InvalidSlot = std::numeric_limits<std::uint32_t>::max();
+
+    constexpr ParamKey() = default;
+
+    /**
+     * @param name Name of the parameter.
+     */
+    constexpr explicit ParamKey(const char* name) : name_{name} {}
+
+    /**
+     * @brief Returns name of the parameter.
+     * @return Returns name of the parameter.
+     */
+    [[nodiscard]] constexpr const char* GetName() const { return name_; }
+
+    /**
+     * @brief Returns name of the parameter for messages, a default constructed key has no name.
+     * @return Returns name of the parameter or "<unnamed>".
+     */
+    [[nodiscard]] constexpr const char* GetDisplayName() const { return name_ ? name_ : "<unnamed>"; }
+
+    /**
+     * @brief Returns resolved slot index of the parameter.
+     * @return Returns slot index of the parameter, if the key is not resolved it returns InvalidSlot.
+     */
+    [[nodiscard]] constexpr std::uint32_t GetSlot() const { return slot_; }
+
+    /**
+     * @brief Queries whether the key is resolved or not.
+     * @return If the key has a valid slot index, it returns true, otherwise it returns false.
+     */
+    [[nodiscard]] constexpr bool IsResolved() const { return slot_ != InvalidSlot; }
+
+private:
+    friend class ParameterSchema;
+
+    const char* name_ = nullptr;
+    std::uint32_t slot_ = InvalidSlot;
+};
+
 class COMMON_API ParameterSchema
 {
 public:
@@ -32,6 +89,9 @@ public:
         std::any DefaultValue;
         bool HasDefaultValue;
         bool IsImmutable;
+        std::uint32_t Slot;
+        const void* (*AddressOf)(const std::any&);
+        bool (*FromString)(const std::string&, std::any&);
     };
 
     /**
@@ -43,12 +103,7 @@ public:
     template<typename ParamType>
     void RegisterParam(const std::string& name, ParamType defaultValue)
     {
-        if (params_.contains(name)) {
-            std::cerr << "Parameter has already registered: " << name << std::endl;
-            return;
-        }
-
-        params_.emplace(name, ParameterInfo{typeid(ParamType), defaultValue, true, false});
+        AddParam<ParamType>(name, std::move(defaultValue), true, false);
     }
 
     /**
@@ -59,12 +114,7 @@ public:
     template<typename ParamType>
     void RegisterParam(const std::string& name)
     {
-        if (params_.contains(name)) {
-            std::cerr << "Parameter has already registered: " << name << std::endl;
-            return;
-        }
-
-        params_.emplace(name, ParameterInfo{typeid(ParamType), std::any{}, false, false});
+        AddParam<ParamType>(name, std::any{}, false, false);
     }
 
     /**
@@ -76,12 +126,7 @@ public:
     template<typename ParamType>
     void RegisterImmutableParam(const std::string& name, ParamType defaultValue)
     {
-        if (params_.contains(name)) {
-            std::cerr << "Parameter has already registered: " << name << std::endl;
-            return;
-        }
-
-        params_.emplace(name, ParameterInfo{typeid(ParamType), defaultValue, true, true});
+        AddParam<ParamType>(name, std::move(defaultValue), true, true);
     }
 
     /**
@@ -91,29 +136,184 @@ public:
      */
     [[nodiscard]] const ParameterInfo& GetInfo(const std::string& name) const
     {
-        const auto it = params_.find(name);
-        if (it == params_.end()) {
+        const auto it = slots_.find(name);
+        if (it == slots_.end()) {
             throw std::runtime_error("Parameter not registered: " + name);
         }
 
-        return it->second;
+        return params_[it->second];
     }
 
+    /**
+     * @brief Gets info about the parameter in a specific slot.
+     * @param slot Slot index of the parameter.
+     * @return Returns the parameter information (name, type, default value etc.)
+     */
+    [[nodiscard]] const ParameterInfo& GetInfo(const std::uint32_t slot) const { return params_.at(slot); }
+
     /**
      * @brief Queries whether the parameter exists in the schema.
      * @param name Name of the parameter.
      * @return If the parameter is in the schema, it returns true, otherwise it returns false.
      */
-    [[nodiscard]] bool HasParam(const std::string& name) const { return params_.contains(name); }
+    [[nodiscard]] bool HasParam(const std::string& name) const { return slots_.contains(name); }
+
+    /**
+     * @brief Returns number of the registered parameters (it is also the number of slots).
+     * @return Returns number of the registered parameters.
+     */
+    [[nodiscard]] std::uint32_t GetParamCount() const { return static_cast<std::uint32_t>(params_.size()); }
+
+    /**
+     * @brief Resolves a typed key into the dense slot index of the parameter and validates its type.
+     * @tparam ParamType Type of the parameter.
+     * @param key Key that will be resolved.
+     * @return Returns the resolved key.
+     */
+    template<typename ParamType>
+    [[nodiscard]] ParamKey<ParamType> Resolve(ParamKey<ParamType> key) const
+    {
+        const std::string name = key.GetName() ? key.GetName() : "";
+        const auto& info = GetInfo(name);
+
+        if (info.Type != std::type_index(typeid(ParamType))) {
+            throw std::runtime_error("Type mismatch for parameter: " + name);
+        }
+
+        key.slot_ = info.Slot;
+        return key;
+    }
+
+    /**
+     * @brief Registers a text parser for a parameter type which is not supported by ParseParameterValue (e.g. structs).
+     * @tparam ParamType Type of the parameter.
+     * @param parser Parser function. It returns true if the text is parsed successfully.
+     */
+    template<typename ParamType>
+    void RegisterParser(std::function<bool(const std::string&, ParamType&)> parser)
+    {
+        parsers_[typeid(ParamType)] = [parser = std::move(parser)](const std::string& text, std::any& value) {
+            ParamType parsedValue{};
+            if (!parser(text, parsedValue)) {
+                return false;
+            }
+            value = parsedValue;
+            return true;
+        };
+    }
+
+    /**
+     * @brief Converts a text into the registered type of the parameter.
+     * @param name Name of the parameter.
+     * @param text Text representation of the value.
+     * @return Returns the typed value of the parameter.
+     */
+    [[nodiscard]] std::any ParseValue(const std::string& name, const std::string& text) const
+    {
+        const auto& info = GetInfo(name);
+
+        std::any value;
+        const auto parserIt = parsers_.find(info.Type);
+        const bool isParsed = parserIt != parsers_.end() ? parserIt->second(text, value) : info.FromString(text, value);
+        if (!isParsed) {
+            throw std::runtime_error("Invalid value for parameter " + name + ": " + text);
+        }
+
+        return value;
+    }
+
+private:
+    template<typename ParamType>
+    static const void* AddressOf(const std::any& value)
+    {
+        return std::any_cast<ParamType>(&value);
+    }
+
+    template<typename ParamType>
+    static bool FromString(const std::string& text, std::any& value)
+    {
+        ParamType parsedValue{};
+        if (!ParseParameterValue(text, parsedValue)) {
+            return false;
+        }
+        value = std::move(parsedValue);
+        return true;
+    }
+
+    template<typename ParamType>
+    void AddParam(const std::string& name, std::any defaultValue, const bool hasDefaultValue, const bool isImmutable)
+    {
+        if (slots_.contains(name)) {
+            std::cerr << "Parameter has already registered: " << name << std::endl;
+            return;
+        }
+
+        const auto slot = static_cast<std::uint32_t>(params_.size());
+        params_.push_back(ParameterInfo{typeid(ParamType), std::move(defaultValue), hasDefaultValue, isImmutable, slot,
+                                        &AddressOf<ParamType>, &FromString<ParamType>});
+        slots_.emplace(name, slot);
+    }
+
+    std::vector<ParameterInfo> params_;
+    std::unordered_map<std::string, std::uint32_t> slots_;
+    std::unordered_map<std::type_index, std::function<bool(const std::string&, std::any&)>> parsers_;
+};
+
+/**
+ * @brief Frozen and flat copy of the parameter values. Every slot keeps a pointer to its typed value, so reads with
+ * resolved keys are O(1), allocation-free and return references.
+ */
+class COMMON_API ParameterSnapshot
+{
+public:
+    ParameterSnapshot() = default;
+
+    /**
+     * @brief Gets a parameter with a resolved key.
+     * @tparam ParamType Type of the parameter.
+     * @param key Resolved key of the parameter (type is validated while resolving).
+     * @return Reference of the parameter value.
+     */
+    template<typename ParamType>
+    [[nodiscard]] const ParamType& Get(const ParamKey<ParamType>& key) const
+    {
+        if (!key.IsResolved() || key.GetSlot() >= slots_.size()) {
+            throw std::runtime_error("Parameter key is not resolved: " + std::string{key.GetDisplayName()});
+        }
+
+        const void* value = slots_[key.GetSlot()];
+        if (!value) {
+            throw std::runtime_error("Parameter not set and no default value: " + std::string{key.GetDisplayName()});
+        }
+
+        return *static_cast<const ParamType*>(value);
+    }
+
+    /**
+     * @brief Queries whether the snapshot is taken or not.
+     * @return If the snapshot contains any value, it returns true, otherwise it returns false.
+     */
+    [[nodiscard]] bool IsValid() const { return storage_ != nullptr; }
 
 private:
-    std::unordered_map<std::string, ParameterInfo> params_;
+    friend class ParameterServer;
+
+    std::shared_ptr<const std::vector<std::any>> storage_;
+    std::vector<const void*> slots_;
 };
 
 class COMMON_API ParameterServer
 {
 public:
-    explicit ParameterServer(ParameterSchema schema) : schema_{std::move(schema)} {}
+    explicit ParameterServer(ParameterSchema schema) :
+        schema_{std::move(schema)}, params_(schema_.GetParamCount()), isSet_(schema_.GetParamCount(), false)
+    {
+        for (std::uint32_t slot = 0; slot < schema_.GetParamCount(); ++slot) {
+            if (const auto& info = schema_.GetInfo(slot); info.HasDefaultValue) {
+                params_[slot] = info.DefaultValue;
+            }
+        }
+    }
 
     /**
      * @brief Sets a parameter with a value of a specified type.
@@ -134,11 +334,22 @@ public:
             throw std::runtime_error("Type mismatch for parameter: " + key);
         }
 
-        if (info.IsImmutable && params_.contains(key)) {
-            throw std::runtime_error("Parameter is immutable after first set: " + key);
+        SetValue(key, info, value);
+    }
+
+    /**
+     * @brief Sets a parameter from its text representation. The text is converted to the registered type of the
+     * parameter (e.g. values which come from config files or command line).
+     * @param key Key name of the parameter.
+     * @param text Text representation of the value.
+     */
+    void SetFromString(const std::string& key, const std::string& text)
+    {
+        if (!schema_.HasParam(key)) {
+            throw std::runtime_error("Parameter not registered: " + key);
         }
 
-        params_[key] = value;
+        SetValue(key, schema_.GetInfo(key), schema_.ParseValue(key, text));
     }
 
     /**
@@ -150,29 +361,89 @@ public:
     template<typename ParamType>
     ParamType Get(const std::string& key) const
     {
-        if (!schema_.HasParam(key)) {
-            throw std::runtime_error("Parameter not registered: " + key);
-        }
-
         const auto& info = schema_.GetInfo(key);
 
         if (info.Type != std::type_index(typeid(ParamType))) {
             throw std::runtime_error("Type mismatch for parameter: " + key);
         }
 
-        if (const auto it = params_.find(key); it != params_.end()) {
-            return std::any_cast<ParamType>(it->second);
+        if (!params_[info.Slot].has_value()) {
+            throw std::runtime_error("Parameter not set and no default value: " + key);
+        }
+
+        return std::any_cast<ParamType>(params_[info.Slot]);
+    }
+
+    /**
+     * @brief Gets a parameter with a resolved key.
+     * @tparam ParamType Type of the parameter.
+     * @param key Resolved key of the parameter.
+     * @return Reference of the parameter value.
+     */
+    template<typename ParamType>
+    [[nodiscard]] const ParamType& Get(const ParamKey<ParamType>& key) const
+    {
+        if (!key.IsResolved()) {
+            throw std::runtime_error("Parameter key is not resolved: " + std::string{key.GetDisplayName()});
         }
 
-        if (info.HasDefaultValue) {
-            return std::any_cast<ParamType>(info.DefaultValue);
+        const auto* value = std::any_cast<ParamType>(&params_[key.GetSlot()]);
+        if (!value) {
+            throw std::runtime_error("Parameter not set and no default value: " + std::string{key.GetDisplayName()});
         }
 
-        throw std::runtime_error("Parameter not set and no default value: " + key);
+        return *value;
+    }
+
+    /**
+     * @brief Resolves a typed key into the dense slot index of the parameter.
+     * @tparam ParamType Type of the parameter.
+     * @param key Key that will be resolved.
+     * @return Returns the resolved key.
+     */
+    template<typename ParamType>
+    [[nodiscard]] ParamKey<ParamType> Resolve(const ParamKey<ParamType>& key) const
+    {
+        return schema_.Resolve(key);
+    }
+
+    /**
+     * @brief Takes a frozen and flat snapshot of the current parameter values. Later sets don't affect the snapshot.
+     * @return Returns the parameter snapshot.
+     */
+    [[nodiscard]] ParameterSnapshot CreateSnapshot() const
+    {
+        ParameterSnapshot snapshot;
+        const auto storage = std::make_shared<const std::vector<std::any>>(params_);
+        snapshot.slots_.resize(storage->size(), nullptr);
+        for (std::uint32_t slot = 0; slot < storage->size(); ++slot) {
+            if ((*storage)[slot].has_value()) {
+                snapshot.slots_[slot] = schema_.GetInfo(slot).AddressOf((*storage)[slot]);
+            }
+        }
+        snapshot.storage_ = storage;
+        return snapshot;
     }
 
+    /**
+     * @brief Returns the parameter schema which is used by the server.
+     * @return Returns the parameter schema.
+     */
+    [[nodiscard]] const ParameterSchema& GetSchema() const { return schema_; }
+
 private:
+    void SetValue(const std::string& key, const ParameterSchema::ParameterInfo& info, std::any value)
+    {
+        if (info.IsImmutable && isSet_[info.Slot]) {
+            throw std::runtime_error("Parameter is immutable after first set: " + key);
+        }
+
+        params_[info.Slot] = std::move(value);
+        isSet_[info.Slot] = true;
+    }
+
     ParameterSchema schema_;
-    std::unordered_map<std::string, std::any> params_;
+    std::vector<std::any> params_;
+    std::vector<bool> isSet_;
 };
 } // namespace common::utility
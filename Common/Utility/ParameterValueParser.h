@@ -0,0 +1,142 @@
+/**
+ * @file    ParameterValueParser.h
+ * @brief   Text to typed value conversions which are used by parameter overrides (config files and command line).
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace common::utility
+{
+namespace detail
+{
+    template<typename ValueType>
+    struct IsStdVector : std::false_type
+    {
+    };
+
+    template<typename ElementType, typename Allocator>
+    struct IsStdVector<std::vector<ElementType, Allocator>> : std::true_type
+    {
+    };
+
+    inline std::string_view TrimText(std::string_view text)
+    {
+        while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front()))) {
+            text.remove_prefix(1);
+        }
+        while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back()))) {
+            text.remove_suffix(1);
+        }
+        return text;
+    }
+} // namespace detail
+
+/**
+ * @brief Splits a text with a separator and trims the parts.
+ * @param text Text that will be split.
+ * @param separator Separator character.
+ * @return Returns trimmed parts of the text.
+ */
+inline std::vector<std::string> SplitParameterText(const std::string_view text, const char separator)
+{
+    std::vector<std::string> parts;
+    std::size_t begin = 0;
+    while (begin <= text.size()) {
+        const auto end = std::min(text.find(separator, begin), text.size());
+        parts.emplace_back(detail::TrimText(text.substr(begin, end - begin)));
+        begin = end + 1;
+    }
+    return parts;
+}
+
+/**
+ * @brief Converts a text into a typed parameter value. Strings, booleans, arithmetic types, enumerations (as their
+ * underlying integer values) and std::vector of these types (comma separated) are supported.
+ * @tparam ValueType Type of the parameter value.
+ * @param text Text representation of the value.
+ * @param value Parsed value. It is only changed if parsing succeeds.
+ * @return Returns true if the text is parsed successfully, otherwise false.
+ */
+template<typename ValueType>
+bool ParseParameterValue(const std::string& text, ValueType& value)
+{
+    const auto trimmed = detail::TrimText(text);
+
+    if constexpr (std::is_same_v<ValueType, std::string>) {
+        value = std::string{trimmed};
+        return true;
+    } else if constexpr (std::is_same_v<ValueType, bool>) {
+        std::string lower{trimmed};
+        std::ranges::transform(lower, lower.begin(), [](const unsigned char c) { return std::tolower(c); });
+        if (lower == "true" || lower == "1" || lower == "on" || lower == "yes") {
+            value = true;
+            return true;
+        }
+        if (lower == "false" || lower == "0" || lower == "off" || lower == "no") {
+            value = false;
+            return true;
+        }
+        return false;
+    } else if constexpr (std::is_enum_v<ValueType>) {
+        std::underlying_type_t<ValueType> rawValue{};
+        if (!ParseParameterValue(std::string{trimmed}, rawValue)) {
+            return false;
+        }
+        value = static_cast<ValueType>(rawValue);
+        return true;
+    } else if constexpr (std::is_integral_v<ValueType>) {
+        auto digits = trimmed;
+        int base = 10;
+        if (digits.size() > 2 && digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X')) {
+            digits.remove_prefix(2);
+            base = 16;
+        }
+        ValueType parsedValue{};
+        const auto [ptr, ec] = std::from_chars(digits.data(), digits.data() + digits.size(), parsedValue, base);
+        if (ec != std::errc{} || ptr != digits.data() + digits.size()) {
+            return false;
+        }
+        value = parsedValue;
+        return true;
+    } else if constexpr (std::is_floating_point_v<ValueType>) {
+        ValueType parsedValue{};
+        const auto [ptr, ec] = std::from_chars(trimmed.data(), trimmed.data() + trimmed.size(), parsedValue);
+        if (ec != std::errc{} || ptr != trimmed.data() + trimmed.size()) {
+            return false;
+        }
+        value = parsedValue;
+        return true;
+    } else if constexpr (detail::IsStdVector<ValueType>::value) {
+        ValueType parsedValues;
+        if (trimmed.empty()) {
+            value = parsedValues;
+            return true;
+        }
+        for (const auto& part: SplitParameterText(trimmed, ',')) {
+            typename ValueType::value_type element{};
+            if (!ParseParameterValue(part, element)) {
+                return false;
+            }
+            parsedValues.push_back(element);
+        }
+        value = std::move(parsedValues);
+        return true;
+    } else {
+        // Custom types need a parser which is registered with ParameterSchema::RegisterParser
+        return false;
+    }
+}
+} // namespace common::utility
@@ -0,0 +1,47 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "SceneComponents.h"
+
+namespace common::utility
+{
+std::vector<Entity> CreateModelEntities(SceneRegistry& registry, const GltfModelHandler& model)
+{
+    std::vector<Entity> entities;
+    for (std::uint32_t i = 0; i < model.Nodes.size(); ++i) {
+        const auto& node = model.Nodes[i];
+        if (node.MeshIndex == UINT32_MAX) {
+            continue;
+        }
+
+        const auto& mesh = model.Meshes[node.MeshIndex];
+        const auto entity = registry.Create();
+        registry.Emplace<TransformComponent>(entity,
+                                             model.NodeHierarchy.GetWorldTransform(model.NodeHierarchy.GetFlatIndex(i)),
+                                             i);
+        registry.Emplace<MeshComponent>(entity, node.MeshIndex, static_cast<std::uint32_t>(mesh.Indices.size()));
+        registry.Emplace<BoundsComponent>(entity, mesh.BoundsMin, mesh.BoundsMax);
+        if (mesh.MaterialIndex >= 0) {
+            registry.Emplace<MaterialComponent>(entity, static_cast<std::uint32_t>(mesh.MaterialIndex));
+        }
+        entities.push_back(entity);
+    }
+
+    registry.Pack<TransformComponent, MeshComponent, MaterialComponent, BoundsComponent>();
+
+    return entities;
+}
+
+void SyncModelTransforms(SceneRegistry& registry, const GltfModelHandler& model)
+{
+    const auto& hierarchy = model.NodeHierarchy;
+    for (auto& transform: registry.GetPool<TransformComponent>().GetComponents()) {
+        if (transform.NodeIndex != UINT32_MAX) {
+            transform.World = hierarchy.GetWorldTransform(hierarchy.GetFlatIndex(transform.NodeIndex));
+        }
+    }
+}
+} // namespace common::utility
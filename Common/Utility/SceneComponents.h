@@ -0,0 +1,66 @@
+/**
+ * @file    SceneComponents.h
+ * @brief   Components of renderable scene objects and the registry type that keeps them in dense arrays.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "CoreDefines.h"
+#include "EntityRegistry.h"
+#include "GlfwModelHandler.h"
+
+namespace common::utility
+{
+struct COMMON_API TransformComponent
+{
+    glm::mat4 World = glm::mat4(1.0f);
+    std::uint32_t NodeIndex = UINT32_MAX; // Source node in the model, UINT32_MAX if the entity has no node
+};
+
+struct COMMON_API MeshComponent
+{
+    std::uint32_t MeshIndex = UINT32_MAX;
+    std::uint32_t IndexCount = 0;
+};
+
+struct COMMON_API MaterialComponent
+{
+    std::uint32_t MaterialIndex = UINT32_MAX;
+};
+
+// Axis aligned bounding box in the local space of the mesh
+struct COMMON_API BoundsComponent
+{
+    glm::vec3 Min = glm::vec3(0.0f);
+    glm::vec3 Max = glm::vec3(0.0f);
+};
+
+using SceneRegistry = EntityRegistry<TransformComponent, MeshComponent, MaterialComponent, BoundsComponent>;
+
+/**
+ * @brief Creates one entity for every mesh node of the model, with its world transform (from the node hierarchy),
+ * mesh, material (if the mesh has one) and local bounds. Pools are packed in the transform order, so iterating them
+ * together doesn't need sparse lookups.
+ * @param registry Registry which the entities are created in.
+ * @param model Loaded model.
+ * @return Returns created entities in the node order.
+ */
+COMMON_API std::vector<Entity> CreateModelEntities(SceneRegistry& registry, const GltfModelHandler& model);
+
+/**
+ * @brief Copies current world transforms of the model's node hierarchy to the transform components.
+ * @param registry Registry which keeps the entities of the model.
+ * @param model Model whose node hierarchy is updated.
+ */
+COMMON_API void SyncModelTransforms(SceneRegistry& registry, const GltfModelHandler& model);
+} // namespace common::utility
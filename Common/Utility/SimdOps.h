@@ -0,0 +1,113 @@
+/**
+ * @file    SimdOps.h
+ * @brief   This file contains the SSE/AVX2 register wrappers which are shared by the SIMD kernels of the common library.
+ *          It is only included from the source files of the library. Wrappers are in an anonymous namespace, so they
+ *          aren't exported from the shared library.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+// Instruction set is selected at compile time: AVX2 with ENABLE_AVX2, SSE2 on every x86-64 target, scalar otherwise
+#if defined(__AVX2__)
+  #include <immintrin.h>
+  #define COMMON_SIMD_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #include <emmintrin.h>
+  #define COMMON_SIMD_SSE2
+#endif
+
+namespace common::utility
+{
+namespace
+{
+#if defined(COMMON_SIMD_AVX2)
+    constexpr const char* simdBackendName = "AVX2";
+
+    struct SimdOps
+    {
+        using Reg = __m256;
+        static constexpr std::uint32_t Width = 8;
+
+        static Reg Load(const float* data) { return _mm256_loadu_ps(data); }
+        static void Store(float* data, const Reg a) { _mm256_storeu_ps(data, a); }
+        static Reg Set1(const float value) { return _mm256_set1_ps(value); }
+        static Reg LaneOffsets() { return _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f); }
+        static Reg Add(const Reg a, const Reg b) { return _mm256_add_ps(a, b); }
+        static Reg Sub(const Reg a, const Reg b) { return _mm256_sub_ps(a, b); }
+        static Reg Mul(const Reg a, const Reg b) { return _mm256_mul_ps(a, b); }
+        static Reg Div(const Reg a, const Reg b) { return _mm256_div_ps(a, b); }
+        static Reg Sqrt(const Reg a) { return _mm256_sqrt_ps(a); }
+        static Reg Min(const Reg a, const Reg b) { return _mm256_min_ps(a, b); }
+        static Reg And(const Reg a, const Reg b) { return _mm256_and_ps(a, b); }
+        static Reg Or(const Reg a, const Reg b) { return _mm256_or_ps(a, b); }
+        static Reg Xor(const Reg a, const Reg b) { return _mm256_xor_ps(a, b); }
+        static Reg LessThan(const Reg a, const Reg b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+        static Reg GreaterEqual(const Reg a, const Reg b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+        static Reg Select(const Reg mask, const Reg a, const Reg b) { return _mm256_blendv_ps(b, a, mask); }
+        static unsigned MoveMask(const Reg a) { return static_cast<unsigned>(_mm256_movemask_ps(a)); }
+    };
+#elif defined(COMMON_SIMD_SSE2)
+    constexpr const char* simdBackendName = "SSE2";
+
+    struct SimdOps
+    {
+        using Reg = __m128;
+        static constexpr std::uint32_t Width = 4;
+
+        static Reg Load(const float* data) { return _mm_loadu_ps(data); }
+        static void Store(float* data, const Reg a) { _mm_storeu_ps(data, a); }
+        static Reg Set1(const float value) { return _mm_set1_ps(value); }
+        static Reg LaneOffsets() { return _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f); }
+        static Reg Add(const Reg a, const Reg b) { return _mm_add_ps(a, b); }
+        static Reg Sub(const Reg a, const Reg b) { return _mm_sub_ps(a, b); }
+        static Reg Mul(const Reg a, const Reg b) { return _mm_mul_ps(a, b); }
+        static Reg Div(const Reg a, const Reg b) { return _mm_div_ps(a, b); }
+        static Reg Sqrt(const Reg a) { return _mm_sqrt_ps(a); }
+        static Reg Min(const Reg a, const Reg b) { return _mm_min_ps(a, b); }
+        static Reg And(const Reg a, const Reg b) { return _mm_and_ps(a, b); }
+        static Reg Or(const Reg a, const Reg b) { return _mm_or_ps(a, b); }
+        static Reg Xor(const Reg a, const Reg b) { return _mm_xor_ps(a, b); }
+        static Reg LessThan(const Reg a, const Reg b) { return _mm_cmplt_ps(a, b); }
+        static Reg GreaterEqual(const Reg a, const Reg b) { return _mm_cmpge_ps(a, b); }
+        static Reg Select(const Reg mask, const Reg a, const Reg b)
+        {
+            return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+        }
+        static unsigned MoveMask(const Reg a) { return static_cast<unsigned>(_mm_movemask_ps(a)); }
+    };
+#else
+    constexpr const char* simdBackendName = "Scalar";
+
+    // One lane per step, masks are 1.0 (true) and 0.0 (false). Kernels which need the bit operations on values (e.g.
+    // sign flips with Xor) are only compiled with COMMON_SIMD_AVX2 or COMMON_SIMD_SSE2.
+    struct SimdOps
+    {
+        using Reg = float;
+        static constexpr std::uint32_t Width = 1;
+
+        static Reg Load(const float* data) { return *data; }
+        static void Store(float* data, const Reg a) { *data = a; }
+        static Reg Set1(const float value) { return value; }
+        static Reg LaneOffsets() { return 0.0f; }
+        static Reg Add(const Reg a, const Reg b) { return a + b; }
+        static Reg Sub(const Reg a, const Reg b) { return a - b; }
+        static Reg Mul(const Reg a, const Reg b) { return a * b; }
+        static Reg Min(const Reg a, const Reg b) { return std::min(a, b); }
+        static Reg And(const Reg a, const Reg b) { return a * b; }
+        static Reg Or(const Reg a, const Reg b) { return std::max(a, b); }
+        static Reg LessThan(const Reg a, const Reg b) { return a < b ? 1.0f : 0.0f; }
+        static Reg GreaterEqual(const Reg a, const Reg b) { return a >= b ? 1.0f : 0.0f; }
+        static Reg Select(const Reg mask, const Reg a, const Reg b) { return mask != 0.0f ? a : b; }
+        static unsigned MoveMask(const Reg a) { return a != 0.0f ? 1u : 0u; }
+    };
+#endif
+} // namespace
+} // namespace common::utility
@@ -0,0 +1,391 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "SoftwareOcclusion.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "SimdOps.h"
+
+namespace common::utility
+{
+namespace
+{
+    // Depth of the pixels which aren't covered by any occluder, every box is in front of it
+    constexpr float clearDepth = std::numeric_limits<float>::max();
+
+    // Clip space w of the points which are treated as on or behind the camera plane
+    constexpr float minClipW = 1e-5f;
+
+    static_assert(SoftwareOcclusionCuller::TileWidth % SimdOps::Width == 0,
+                  "Tile width must be a multiple of the SIMD width!");
+} // namespace
+
+OccluderMesh CreateBoxOccluder(const glm::vec3& min, const glm::vec3& max)
+{
+    OccluderMesh mesh;
+    for (int i = 0; i < 8; ++i) {
+        mesh.Positions.emplace_back((i & 1) != 0 ? max.x : min.x, (i & 2) != 0 ? max.y : min.y,
+                                    (i & 4) != 0 ? max.z : min.z);
+    }
+
+    // Two triangles per face (-X, +X, -Y, +Y, -Z, +Z), winding doesn't matter because both sides are rasterized
+    mesh.Indices = {0, 4, 6, 0, 6, 2, 1, 3, 7, 1, 7, 5, 0, 1, 5, 0, 5, 4,
+                    2, 6, 7, 2, 7, 3, 0, 2, 3, 0, 3, 1, 4, 5, 7, 4, 7, 6};
+    return mesh;
+}
+
+SoftwareOcclusionCuller::SoftwareOcclusionCuller(const std::uint32_t width,
+                                                 const std::uint32_t height,
+                                                 const std::uint32_t workerCount)
+    : width_(std::max(width, 1u)), height_(std::max(height, 1u))
+{
+    tileCountX_ = (width_ + TileWidth - 1) / TileWidth;
+    tileCountY_ = (height_ + TileHeight - 1) / TileHeight;
+    stride_ = tileCountX_ * TileWidth;
+    depth_.assign(static_cast<std::size_t>(stride_) * height_, clearDepth);
+    tileMaxDepth_.assign(static_cast<std::size_t>(tileCountX_) * tileCountY_, clearDepth);
+    tileBins_.resize(tileMaxDepth_.size());
+
+    const std::uint32_t threadCount =
+            workerCount == UINT32_MAX ? std::max(std::thread::hardware_concurrency(), 1u) - 1 : workerCount;
+    for (std::uint32_t i = 0; i < threadCount; ++i) {
+        workers_.emplace_back([this]() { WorkerLoop(); });
+    }
+}
+
+SoftwareOcclusionCuller::~SoftwareOcclusionCuller()
+{
+    {
+        std::lock_guard lock(mutex_);
+        isStopping_ = true;
+    }
+    wakeCondition_.notify_all();
+
+    for (auto& worker: workers_) {
+        worker.join();
+    }
+}
+
+void SoftwareOcclusionCuller::BeginFrame(const glm::mat4& viewProjection)
+{
+    viewProjection_ = viewProjection;
+    triangles_.clear();
+    for (auto& bin: tileBins_) {
+        bin.clear();
+    }
+    stats_ = {};
+}
+
+void SoftwareOcclusionCuller::AddOccluder(const OccluderMesh& mesh, const glm::mat4& model)
+{
+    const glm::mat4 modelViewProjection = viewProjection_ * model;
+    clipPositions_.resize(mesh.Positions.size());
+    for (std::size_t i = 0; i < mesh.Positions.size(); ++i) {
+        clipPositions_[i] = modelViewProjection * glm::vec4(mesh.Positions[i], 1.0f);
+    }
+
+    const float halfWidth = 0.5f * static_cast<float>(width_);
+    const float halfHeight = 0.5f * static_cast<float>(height_);
+    for (std::size_t i = 0; i + 2 < mesh.Indices.size(); i += 3) {
+        glm::vec3 screen[3];
+        bool isRejected = false;
+        for (int v = 0; v < 3; ++v) {
+            const glm::vec4& clip = clipPositions_[mesh.Indices[i + v]];
+
+            // Triangles which are not fully in front of the near plane (of [0, 1] and [-1, 1] depth projections) are
+            // skipped instead of clipped, an occluder can only be missing
+            if (clip.w <= minClipW || clip.z < 0.0f) {
+                isRejected = true;
+                break;
+            }
+            const float inverseW = 1.0f / clip.w;
+            screen[v] = glm::vec3((clip.x * inverseW + 1.0f) * halfWidth, (clip.y * inverseW + 1.0f) * halfHeight,
+                                  clip.z * inverseW);
+        }
+        if (isRejected) {
+            continue;
+        }
+
+        // Both sides are rasterized, clockwise triangles are converted to counter-clockwise ones
+        float area = (screen[1].x - screen[0].x) * (screen[2].y - screen[0].y) -
+                     (screen[2].x - screen[0].x) * (screen[1].y - screen[0].y);
+        if (area == 0.0f) {
+            continue;
+        }
+        if (area < 0.0f) {
+            std::swap(screen[1], screen[2]);
+            area = -area;
+        }
+
+        // Pixels whose centers are inside of the bounding rectangle
+        const float minX = std::min({screen[0].x, screen[1].x, screen[2].x});
+        const float maxX = std::max({screen[0].x, screen[1].x, screen[2].x});
+        const float minY = std::min({screen[0].y, screen[1].y, screen[2].y});
+        const float maxY = std::max({screen[0].y, screen[1].y, screen[2].y});
+        TriangleSetup triangle{};
+        triangle.MinX = std::max(static_cast<std::int32_t>(std::ceil(minX - 0.5f)), 0);
+        triangle.MaxX = std::min(static_cast<std::int32_t>(std::floor(maxX - 0.5f)),
+                                 static_cast<std::int32_t>(width_) - 1);
+        triangle.MinY = std::max(static_cast<std::int32_t>(std::ceil(minY - 0.5f)), 0);
+        triangle.MaxY = std::min(static_cast<std::int32_t>(std::floor(maxY - 0.5f)),
+                                 static_cast<std::int32_t>(height_) - 1);
+        if (triangle.MinX > triangle.MaxX || triangle.MinY > triangle.MaxY) {
+            continue;
+        }
+
+        // Edge from vertex a to vertex b is positive on the inner side of a counter-clockwise triangle
+        for (int e = 0; e < 3; ++e) {
+            const glm::vec3& a = screen[e];
+            const glm::vec3& b = screen[(e + 1) % 3];
+            triangle.EdgeA[e] = a.y - b.y;
+            triangle.EdgeB[e] = b.x - a.x;
+            triangle.EdgeC[e] = a.x * b.y - a.y * b.x;
+        }
+
+        // Depth plane through the three vertices
+        const glm::vec3 delta1 = screen[1] - screen[0];
+        const glm::vec3 delta2 = screen[2] - screen[0];
+        triangle.DepthA = (delta1.z * delta2.y - delta2.z * delta1.y) / area;
+        triangle.DepthB = (delta2.z * delta1.x - delta1.z * delta2.x) / area;
+        triangle.DepthC = screen[0].z - triangle.DepthA * screen[0].x - triangle.DepthB * screen[0].y;
+
+        const auto triangleIndex = static_cast<std::uint32_t>(triangles_.size());
+        triangles_.push_back(triangle);
+        ++stats_.OccluderTriangleCount;
+
+        for (auto tileY = triangle.MinY / TileHeight; tileY <= triangle.MaxY / TileHeight; ++tileY) {
+            for (auto tileX = triangle.MinX / TileWidth; tileX <= triangle.MaxX / TileWidth; ++tileX) {
+                tileBins_[tileY * tileCountX_ + tileX].push_back(triangleIndex);
+                ++stats_.BinnedTriangleCount;
+            }
+        }
+    }
+}
+
+void SoftwareOcclusionCuller::Rasterize()
+{
+    {
+        std::lock_guard lock(mutex_);
+        nextTile_.store(0, std::memory_order_relaxed);
+        pendingWorkerCount_ = static_cast<std::uint32_t>(workers_.size());
+        ++generation_;
+    }
+    wakeCondition_.notify_all();
+
+    // Calling thread takes tiles as well
+    RasterizeTiles();
+
+    std::unique_lock lock(mutex_);
+    doneCondition_.wait(lock, [this]() { return pendingWorkerCount_ == 0; });
+}
+
+void SoftwareOcclusionCuller::WorkerLoop()
+{
+    std::uint64_t finishedGeneration = 0;
+    while (true) {
+        {
+            std::unique_lock lock(mutex_);
+            wakeCondition_.wait(lock, [&]() { return isStopping_ || generation_ != finishedGeneration; });
+            if (isStopping_) {
+                return;
+            }
+            finishedGeneration = generation_;
+        }
+
+        RasterizeTiles();
+
+        {
+            std::lock_guard lock(mutex_);
+            if (--pendingWorkerCount_ == 0) {
+                doneCondition_.notify_one();
+            }
+        }
+    }
+}
+
+void SoftwareOcclusionCuller::RasterizeTiles()
+{
+    const auto tileCount = static_cast<std::uint32_t>(tileBins_.size());
+    for (std::uint32_t tile = nextTile_.fetch_add(1, std::memory_order_relaxed); tile < tileCount;
+         tile = nextTile_.fetch_add(1, std::memory_order_relaxed)) {
+        RasterizeTile(tile);
+    }
+}
+
+void SoftwareOcclusionCuller::RasterizeTile(const std::uint32_t tileIndex)
+{
+    using Reg = SimdOps::Reg;
+
+    // Tiles are independent, every tile clears and writes only its own pixels
+    const auto tileX0 = static_cast<std::int32_t>((tileIndex % tileCountX_) * TileWidth);
+    const auto tileY0 = static_cast<std::int32_t>((tileIndex / tileCountX_) * TileHeight);
+    const auto tileX1 = tileX0 + static_cast<std::int32_t>(TileWidth) - 1;
+    const auto tileYEnd = std::min(tileY0 + static_cast<std::int32_t>(TileHeight), static_cast<std::int32_t>(height_));
+    const auto tileY1 = tileYEnd - 1;
+    for (auto y = tileY0; y <= tileY1; ++y) {
+        std::fill_n(depth_.begin() + static_cast<std::ptrdiff_t>(y) * stride_ + tileX0, TileWidth, clearDepth);
+    }
+
+    const auto& bin = tileBins_[tileIndex];
+    if (bin.empty()) {
+        tileMaxDepth_[tileIndex] = clearDepth;
+        return;
+    }
+
+    const Reg zero = SimdOps::Set1(0.0f);
+    const Reg laneOffsets = SimdOps::LaneOffsets();
+    constexpr auto width = static_cast<std::int32_t>(SimdOps::Width);
+    for (const auto triangleIndex: bin) {
+        const auto& triangle = triangles_[triangleIndex];
+        const auto minX = std::max(triangle.MinX, tileX0) / width * width;
+        const auto maxX = std::min(triangle.MaxX, tileX1);
+        const auto minY = std::max(triangle.MinY, tileY0);
+        const auto maxY = std::min(triangle.MaxY, tileY1);
+
+        const Reg edgeA0 = SimdOps::Set1(triangle.EdgeA[0]);
+        const Reg edgeA1 = SimdOps::Set1(triangle.EdgeA[1]);
+        const Reg edgeA2 = SimdOps::Set1(triangle.EdgeA[2]);
+        const Reg depthA = SimdOps::Set1(triangle.DepthA);
+
+        for (auto y = minY; y <= maxY; ++y) {
+            // Edge functions and depth of the row are evaluated once, pixel centers are at +0.5
+            const float centerY = static_cast<float>(y) + 0.5f;
+            const Reg rowEdge0 = SimdOps::Set1(triangle.EdgeB[0] * centerY + triangle.EdgeC[0]);
+            const Reg rowEdge1 = SimdOps::Set1(triangle.EdgeB[1] * centerY + triangle.EdgeC[1]);
+            const Reg rowEdge2 = SimdOps::Set1(triangle.EdgeB[2] * centerY + triangle.EdgeC[2]);
+            const Reg rowDepth = SimdOps::Set1(triangle.DepthB * centerY + triangle.DepthC);
+            float* row = depth_.data() + static_cast<std::ptrdiff_t>(y) * stride_;
+
+            for (auto x = minX; x <= maxX; x += width) {
+                const Reg centerX = SimdOps::Add(SimdOps::Set1(static_cast<float>(x) + 0.5f), laneOffsets);
+                const Reg edge0 = SimdOps::Add(SimdOps::Mul(edgeA0, centerX), rowEdge0);
+                const Reg edge1 = SimdOps::Add(SimdOps::Mul(edgeA1, centerX), rowEdge1);
+                const Reg edge2 = SimdOps::Add(SimdOps::Mul(edgeA2, centerX), rowEdge2);
+                const Reg inside = SimdOps::And(SimdOps::And(SimdOps::GreaterEqual(edge0, zero),
+                                                             SimdOps::GreaterEqual(edge1, zero)),
+                                                SimdOps::GreaterEqual(edge2, zero));
+                if (SimdOps::MoveMask(inside) == 0) {
+                    continue;
+                }
+
+                const Reg depth = SimdOps::Add(SimdOps::Mul(depthA, centerX), rowDepth);
+                const Reg current = SimdOps::Load(row + x);
+                SimdOps::Store(row + x, SimdOps::Select(inside, SimdOps::Min(current, depth), current));
+            }
+        }
+    }
+
+    // Padding columns on the right side of the last tile column are never tested
+    const auto lastX = std::min(tileX1, static_cast<std::int32_t>(width_) - 1);
+    float maxDepth = 0.0f;
+    for (auto y = tileY0; y <= tileY1; ++y) {
+        const float* row = depth_.data() + static_cast<std::ptrdiff_t>(y) * stride_;
+        maxDepth = std::max(maxDepth, *std::max_element(row + tileX0, row + lastX + 1));
+    }
+    tileMaxDepth_[tileIndex] = maxDepth;
+}
+
+bool SoftwareOcclusionCuller::IsVisible(const glm::vec3& min, const glm::vec3& max) const
+{
+    using Reg = SimdOps::Reg;
+
+    float nearestDepth = std::numeric_limits<float>::max();
+    glm::vec2 screenMin{std::numeric_limits<float>::max()};
+    glm::vec2 screenMax{std::numeric_limits<float>::lowest()};
+    for (int i = 0; i < 8; ++i) {
+        const glm::vec3 corner{(i & 1) != 0 ? max.x : min.x, (i & 2) != 0 ? max.y : min.y,
+                               (i & 4) != 0 ? max.z : min.z};
+        const glm::vec4 clip = viewProjection_ * glm::vec4(corner, 1.0f);
+
+        // Projection of a box which crosses the camera plane isn't bounded
+        if (clip.w <= minClipW) {
+            return true;
+        }
+
+        const float inverseW = 1.0f / clip.w;
+        const glm::vec2 screen{(clip.x * inverseW + 1.0f) * 0.5f * static_cast<float>(width_),
+                               (clip.y * inverseW + 1.0f) * 0.5f * static_cast<float>(height_)};
+        screenMin = glm::min(screenMin, screen);
+        screenMax = glm::max(screenMax, screen);
+        nearestDepth = std::min(nearestDepth, clip.z * inverseW);
+    }
+
+    // All pixels which are touched by the screen rectangle
+    if (screenMax.x < 0.0f || screenMax.y < 0.0f || screenMin.x >= static_cast<float>(width_) ||
+        screenMin.y >= static_cast<float>(height_)) {
+        return false;
+    }
+    const auto lastPixelX = static_cast<std::int32_t>(width_) - 1;
+    const auto lastPixelY = static_cast<std::int32_t>(height_) - 1;
+    const auto x0 = std::max(static_cast<std::int32_t>(std::floor(screenMin.x)), 0);
+    const auto y0 = std::max(static_cast<std::int32_t>(std::floor(screenMin.y)), 0);
+    const auto x1 = std::min(static_cast<std::int32_t>(std::floor(screenMax.x)), lastPixelX);
+    const auto y1 = std::min(static_cast<std::int32_t>(std::floor(screenMax.y)), lastPixelY);
+
+    // Box is visible if any pixel of the rectangle isn't nearer than the nearest depth of the box. Tiles which are
+    // completely nearer are skipped with their farthest depth.
+    const Reg nearest = SimdOps::Set1(nearestDepth);
+    constexpr auto width = static_cast<std::int32_t>(SimdOps::Width);
+    constexpr unsigned allLanes = (1u << SimdOps::Width) - 1;
+    for (auto tileY = y0 / static_cast<std::int32_t>(TileHeight); tileY <= y1 / static_cast<std::int32_t>(TileHeight);
+         ++tileY) {
+        for (auto tileX = x0 / static_cast<std::int32_t>(TileWidth); tileX <= x1 / static_cast<std::int32_t>(TileWidth);
+             ++tileX) {
+            if (tileMaxDepth_[tileY * tileCountX_ + tileX] < nearestDepth) {
+                continue;
+            }
+
+            const auto minX = std::max(x0, tileX * static_cast<std::int32_t>(TileWidth));
+            const auto maxX = std::min(x1, (tileX + 1) * static_cast<std::int32_t>(TileWidth) - 1);
+            const auto minY = std::max(y0, tileY * static_cast<std::int32_t>(TileHeight));
+            const auto maxY = std::min(y1, (tileY + 1) * static_cast<std::int32_t>(TileHeight) - 1);
+            for (auto y = minY; y <= maxY; ++y) {
+                const float* row = depth_.data() + static_cast<std::ptrdiff_t>(y) * stride_;
+                for (auto x = minX / width * width; x <= maxX; x += width) {
+                    // Lanes outside of [minX, maxX] are masked
+                    const auto firstLane = static_cast<unsigned>(std::max(minX - x, 0));
+                    const auto lastLane = static_cast<unsigned>(std::min(maxX - x, width - 1));
+                    const unsigned laneMask = allLanes >> (SimdOps::Width - 1 - lastLane) & ~((1u << firstLane) - 1);
+                    if ((SimdOps::MoveMask(SimdOps::GreaterEqual(SimdOps::Load(row + x), nearest)) & laneMask) != 0) {
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+std::size_t SoftwareOcclusionCuller::CullOccluded(const BoundsArrays& bounds,
+                                                  const std::span<const std::uint32_t> candidateIndices,
+                                                  std::vector<std::uint32_t>& visibleIndices)
+{
+    visibleIndices.resize(candidateIndices.size());
+
+    std::size_t visibleCount = 0;
+    for (const auto index: candidateIndices) {
+        const glm::vec3 center{bounds.CenterX[index], bounds.CenterY[index], bounds.CenterZ[index]};
+        const glm::vec3 extent{bounds.ExtentX[index], bounds.ExtentY[index], bounds.ExtentZ[index]};
+        if (IsVisible(center - extent, center + extent)) {
+            visibleIndices[visibleCount++] = index;
+        }
+    }
+
+    stats_.TestedCount += static_cast<std::uint32_t>(candidateIndices.size());
+    stats_.OccludedCount += static_cast<std::uint32_t>(candidateIndices.size() - visibleCount);
+    visibleIndices.resize(visibleCount);
+    return visibleCount;
+}
+
+const char* GetSoftwareOcclusionBackend()
+{
+    return simdBackendName;
+}
+} // namespace common::utility
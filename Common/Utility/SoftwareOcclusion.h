@@ -0,0 +1,196 @@
+/**
+ * @file    SoftwareOcclusion.h
+ * @brief   This file contains a CPU occlusion culler which rasterizes occluder triangles into a low resolution depth
+ *          buffer (tile binned, SSE/AVX2 kernels, multiple threads) and tests bounding boxes against it.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "CoreDefines.h"
+#include "FrustumCulling.h"
+
+namespace common::utility
+{
+/**
+ * @brief Triangle list of an occluder in its local space. It should be a simplified version of the rendered mesh which
+ * is fully inside of it (or the mesh itself), otherwise the culler can hide visible objects.
+ */
+struct COMMON_API OccluderMesh
+{
+    std::vector<glm::vec3> Positions;
+    std::vector<std::uint32_t> Indices;
+};
+
+/**
+ * @brief Creates a closed box occluder (12 triangles).
+ * @param min Minimum corner of the box.
+ * @param max Maximum corner of the box.
+ * @return Returns the box occluder.
+ */
+COMMON_API OccluderMesh CreateBoxOccluder(const glm::vec3& min, const glm::vec3& max);
+
+/**
+ * @brief Counters of the last frame of a SoftwareOcclusionCuller.
+ */
+struct COMMON_API SoftwareOcclusionStats
+{
+    std::uint32_t OccluderTriangleCount = 0; // Triangles which were added (after near plane rejection)
+    std::uint32_t BinnedTriangleCount = 0;   // Sum of the triangle counts of all tile bins
+    std::uint32_t TestedCount = 0;
+    std::uint32_t OccludedCount = 0;
+};
+
+/**
+ * @brief CPU occlusion culler. A frame is:
+ * 1. BeginFrame: clears the depth buffer and the tile bins for a view-projection matrix.
+ * 2. AddOccluder: transforms the triangles of an occluder to the screen and adds them to the bins of the tiles which
+ *    are overlapped by their bounding rectangles. Triangles crossing the near plane are skipped (conservative).
+ * 3. Rasterize: tiles are distributed to the worker threads and the calling thread, every tile rasterizes its bin
+ *    with SIMD kernels (4 or 8 pixels of a row at once) and keeps the nearest depth of every pixel.
+ * 4. CullOccluded / IsVisible: bounding boxes are projected to the screen and an object is occluded if its nearest
+ *    depth is behind the depth buffer in all pixels of its screen rectangle.
+ *
+ * Depth is the NDC depth of the projection, smaller is nearer. Depth of a triangle is evaluated at the pixel centers.
+ * Rows of the depth buffer are padded to a multiple of the tile width.
+ */
+class COMMON_API SoftwareOcclusionCuller
+{
+public:
+    static constexpr std::uint32_t TileWidth = 32;
+    static constexpr std::uint32_t TileHeight = 16;
+
+    /**
+     * @brief Creates the depth buffer and the worker threads.
+     * @param width Width of the depth buffer in pixels.
+     * @param height Height of the depth buffer in pixels.
+     * @param workerCount Number of the worker threads which rasterize the tiles with the calling thread (UINT32_MAX:
+     * hardware concurrency - 1, 0: only the calling thread).
+     */
+    SoftwareOcclusionCuller(std::uint32_t width, std::uint32_t height, std::uint32_t workerCount = UINT32_MAX);
+
+    ~SoftwareOcclusionCuller();
+
+    SoftwareOcclusionCuller(const SoftwareOcclusionCuller&) = delete;
+    SoftwareOcclusionCuller& operator=(const SoftwareOcclusionCuller&) = delete;
+
+    /**
+     * @brief Clears the depth buffer and the bins of the previous frame.
+     * @param viewProjection Projection * view matrix of the frame.
+     */
+    void BeginFrame(const glm::mat4& viewProjection);
+
+    /**
+     * @brief Transforms the triangles of an occluder and bins them.
+     * @param mesh Occluder triangles in local space.
+     * @param model Local to world transform of the occluder.
+     */
+    void AddOccluder(const OccluderMesh& mesh, const glm::mat4& model);
+
+    /**
+     * @brief Rasterizes all binned triangles. Returns after all tiles are finished.
+     */
+    void Rasterize();
+
+    /**
+     * @brief Tests a world bounding box against the depth buffer. Boxes crossing the near plane are visible.
+     * @param min Minimum corner of the box.
+     * @param max Maximum corner of the box.
+     * @return Returns false if the box is occluded (or outside of the screen).
+     */
+    [[nodiscard]] bool IsVisible(const glm::vec3& min, const glm::vec3& max) const;
+
+    /**
+     * @brief Tests the candidate boxes (usually the result of CullBounds) and writes the visible ones to a compact
+     * list in the same order.
+     * @param bounds World boxes of the objects.
+     * @param candidateIndices Indices of the boxes which will be tested.
+     * @param visibleIndices Output indices of the visible boxes, it is resized to the visible count.
+     * @return Returns number of the visible boxes.
+     */
+    std::size_t CullOccluded(const BoundsArrays& bounds,
+                             std::span<const std::uint32_t> candidateIndices,
+                             std::vector<std::uint32_t>& visibleIndices);
+
+    /**
+     * @brief Returns counters of the current frame.
+     * @return Returns counters of the current frame.
+     */
+    [[nodiscard]] const SoftwareOcclusionStats& GetStats() const { return stats_; }
+
+    /**
+     * @brief Returns the depth buffer (row major, GetStride() x GetHeight()).
+     * @return Returns the depth buffer.
+     */
+    [[nodiscard]] const std::vector<float>& GetDepthBuffer() const { return depth_; }
+
+    [[nodiscard]] std::uint32_t GetWidth() const { return width_; }
+
+    [[nodiscard]] std::uint32_t GetStride() const { return stride_; }
+
+    [[nodiscard]] std::uint32_t GetHeight() const { return height_; }
+
+    [[nodiscard]] std::uint32_t GetWorkerCount() const { return static_cast<std::uint32_t>(workers_.size()); }
+
+private:
+    // Edge functions and depth plane of a screen triangle, all of them are in the form a * x + b * y + c
+    struct TriangleSetup
+    {
+        float EdgeA[3], EdgeB[3], EdgeC[3];
+        float DepthA, DepthB, DepthC;
+        std::int32_t MinX, MinY, MaxX, MaxY; // Pixel bounds, inclusive
+    };
+
+    void RasterizeTiles();
+
+    void RasterizeTile(std::uint32_t tileIndex);
+
+    void WorkerLoop();
+
+    std::uint32_t width_;
+    std::uint32_t height_;
+    std::uint32_t stride_;
+    std::uint32_t tileCountX_;
+    std::uint32_t tileCountY_;
+    glm::mat4 viewProjection_{1.0f};
+
+    std::vector<float> depth_;
+    std::vector<float> tileMaxDepth_; // Farthest depth of every tile, a box nearer than it can't be hidden by the tile
+    std::vector<TriangleSetup> triangles_;
+    std::vector<std::vector<std::uint32_t>> tileBins_;
+    std::vector<glm::vec4> clipPositions_; // Scratch buffer of AddOccluder
+
+    SoftwareOcclusionStats stats_;
+
+    // Worker threads wait for a new generation, take tiles with an atomic counter and report when they are finished
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable wakeCondition_;
+    std::condition_variable doneCondition_;
+    std::uint64_t generation_ = 0;
+    std::uint32_t pendingWorkerCount_ = 0;
+    bool isStopping_ = false;
+    std::atomic<std::uint32_t> nextTile_{0};
+};
+
+/**
+ * @brief Returns name of the rasterization kernel that is selected at compile time.
+ * @return Returns "AVX2", "SSE2" or "Scalar".
+ */
+COMMON_API const char* GetSoftwareOcclusionBackend();
+} // namespace common::utility
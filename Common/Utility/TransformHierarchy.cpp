@@ -0,0 +1,141 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "TransformHierarchy.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace common::utility
+{
+void TransformHierarchy::Build(const std::span<const std::uint32_t> parentIndices,
+                               const std::span<const glm::mat4> localTransforms)
+{
+    if (parentIndices.size() != localTransforms.size()) {
+        throw std::runtime_error("Parent and local transform counts of the hierarchy are different!");
+    }
+
+    const auto count = static_cast<std::uint32_t>(parentIndices.size());
+
+    // Children of every node in one array (counting sort by parent), children keep their source order
+    std::vector<std::uint32_t> childOffsets(count + 1, 0);
+    std::vector<std::uint32_t> roots;
+    for (std::uint32_t i = 0; i < count; ++i) {
+        if (parentIndices[i] == NoParent) {
+            roots.push_back(i);
+        } else if (parentIndices[i] >= count) {
+            throw std::runtime_error("Parent index of the hierarchy node is out of range!");
+        } else {
+            ++childOffsets[parentIndices[i] + 1];
+        }
+    }
+    for (std::uint32_t i = 0; i < count; ++i) {
+        childOffsets[i + 1] += childOffsets[i];
+    }
+    std::vector<std::uint32_t> children(childOffsets[count]);
+    std::vector<std::uint32_t> childCursors(childOffsets.begin(), childOffsets.end() - 1);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        if (parentIndices[i] != NoParent) {
+            children[childCursors[parentIndices[i]]++] = i;
+        }
+    }
+
+    // Depth first order with an explicit stack (deep hierarchies don't overflow the call stack)
+    sourceIndices_.clear();
+    sourceIndices_.reserve(count);
+    flatIndices_.assign(count, NoParent);
+    std::vector<std::uint32_t> stack{roots.rbegin(), roots.rend()};
+    while (!stack.empty()) {
+        const auto node = stack.back();
+        stack.pop_back();
+
+        flatIndices_[node] = static_cast<std::uint32_t>(sourceIndices_.size());
+        sourceIndices_.push_back(node);
+        for (auto child = childOffsets[node + 1]; child > childOffsets[node]; --child) {
+            stack.push_back(children[child - 1]);
+        }
+    }
+
+    // Nodes that aren't reachable from a root are part of a cycle
+    if (sourceIndices_.size() != count) {
+        throw std::runtime_error("Transform hierarchy contains a cycle!");
+    }
+
+    parents_.resize(count);
+    localTransforms_.resize(count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        const auto source = sourceIndices_[i];
+        parents_[i] = parentIndices[source] == NoParent ? NoParent : flatIndices_[parentIndices[source]];
+        localTransforms_[i] = localTransforms[source];
+    }
+
+    // Subtree sizes are accumulated from the leaves, children always come after their parents
+    subtreeEnds_.assign(count, 1);
+    for (auto i = count; i > 0; --i) {
+        if (parents_[i - 1] != NoParent) {
+            subtreeEnds_[parents_[i - 1]] += subtreeEnds_[i - 1];
+        }
+    }
+    for (std::uint32_t i = 0; i < count; ++i) {
+        subtreeEnds_[i] += i;
+    }
+
+    worldTransforms_.resize(count);
+    dirty_.assign(count, 0);
+    MarkAllDirty();
+    Update();
+}
+
+void TransformHierarchy::SetLocalTransform(const std::uint32_t index, const glm::mat4& localTransform)
+{
+    localTransforms_[index] = localTransform;
+    dirty_[index] = 1;
+    firstDirty_ = std::min(firstDirty_, index);
+    lastDirty_ = std::max(lastDirty_, index);
+}
+
+void TransformHierarchy::MarkAllDirty()
+{
+    if (parents_.empty()) {
+        return;
+    }
+
+    // Roots cover the whole array, marking them is enough
+    for (std::uint32_t i = 0; i < Size(); i = subtreeEnds_[i]) {
+        dirty_[i] = 1;
+    }
+    firstDirty_ = 0;
+    lastDirty_ = Size() - 1;
+}
+
+std::uint32_t TransformHierarchy::Update()
+{
+    std::uint32_t updatedCount = 0;
+
+    std::uint32_t i = firstDirty_;
+    while (i <= lastDirty_ && i < Size()) {
+        if (!dirty_[i]) {
+            ++i;
+            continue;
+        }
+
+        // Whole subtree is recalculated, parent world transforms are always ready before their children
+        const auto subtreeEnd = subtreeEnds_[i];
+        updatedCount += subtreeEnd - i;
+        for (; i < subtreeEnd; ++i) {
+            const auto parent = parents_[i];
+            worldTransforms_[i] =
+                    parent == NoParent ? localTransforms_[i] : worldTransforms_[parent] * localTransforms_[i];
+            dirty_[i] = 0;
+        }
+    }
+
+    firstDirty_ = UINT32_MAX;
+    lastDirty_ = 0;
+
+    return updatedCount;
+}
+} // namespace common::utility
@@ -0,0 +1,128 @@
+/**
+ * @file    TransformHierarchy.h
+ * @brief   This file contains a flat transform hierarchy that keeps nodes in parent-before-child (depth first) order
+ *          and updates world transforms of the changed subtrees in a single linear pass.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "CoreDefines.h"
+
+namespace common::utility
+{
+/**
+ * @brief Transform hierarchy in structure of arrays layout. Nodes are sorted in depth first order, so every parent is
+ * placed before its children and every subtree is a contiguous range [index, GetSubtreeEnd(index)). All methods except
+ * Build, GetFlatIndex and GetSourceIndex use flat (sorted) indices.
+ */
+class COMMON_API TransformHierarchy
+{
+public:
+    static constexpr std::uint32_t NoParent = UINT32_MAX;
+
+    /**
+     * @brief Sorts the nodes and calculates all world transforms.
+     * @param parentIndices Parent index of every node in source order (NoParent for roots).
+     * @param localTransforms Local transform of every node in source order.
+     */
+    void Build(std::span<const std::uint32_t> parentIndices, std::span<const glm::mat4> localTransforms);
+
+    /**
+     * @brief Sets local transform of a node and marks its subtree as dirty.
+     * @param index Flat index of the node.
+     * @param localTransform New local transform.
+     */
+    void SetLocalTransform(std::uint32_t index, const glm::mat4& localTransform);
+
+    /**
+     * @brief Marks all nodes as dirty.
+     */
+    void MarkAllDirty();
+
+    /**
+     * @brief Recalculates world transforms of the dirty subtrees. Only the range between the first and the last dirty
+     * node is visited, clean subtrees in this range are skipped by checking one flag per node.
+     * @return Returns number of the recalculated world transforms.
+     */
+    std::uint32_t Update();
+
+    /**
+     * @param sourceIndex Index of the node in the arrays that are passed to Build.
+     * @return Returns flat index of the node.
+     */
+    [[nodiscard]] std::uint32_t GetFlatIndex(const std::uint32_t sourceIndex) const
+    {
+        return flatIndices_[sourceIndex];
+    }
+
+    /**
+     * @param index Flat index of the node.
+     * @return Returns index of the node in the arrays that are passed to Build.
+     */
+    [[nodiscard]] std::uint32_t GetSourceIndex(const std::uint32_t index) const { return sourceIndices_[index]; }
+
+    /**
+     * @param index Flat index of the node.
+     * @return Returns flat index of the parent, or NoParent for roots.
+     */
+    [[nodiscard]] std::uint32_t GetParent(const std::uint32_t index) const { return parents_[index]; }
+
+    /**
+     * @param index Flat index of the node.
+     * @return Returns the flat index after the last node of the subtree.
+     */
+    [[nodiscard]] std::uint32_t GetSubtreeEnd(const std::uint32_t index) const { return subtreeEnds_[index]; }
+
+    /**
+     * @param index Flat index of the node.
+     * @return Returns local transform of the node.
+     */
+    [[nodiscard]] const glm::mat4& GetLocalTransform(const std::uint32_t index) const
+    {
+        return localTransforms_[index];
+    }
+
+    /**
+     * @param index Flat index of the node.
+     * @return Returns world transform of the node that is calculated in the last Update call.
+     */
+    [[nodiscard]] const glm::mat4& GetWorldTransform(const std::uint32_t index) const
+    {
+        return worldTransforms_[index];
+    }
+
+    /**
+     * @return Returns world transforms of all nodes in flat order.
+     */
+    [[nodiscard]] std::span<const glm::mat4> GetWorldTransforms() const { return worldTransforms_; }
+
+    /**
+     * @return Returns number of the nodes.
+     */
+    [[nodiscard]] std::uint32_t Size() const { return static_cast<std::uint32_t>(parents_.size()); }
+
+private:
+    std::vector<std::uint32_t> parents_;
+    std::vector<std::uint32_t> subtreeEnds_;
+    std::vector<std::uint32_t> sourceIndices_;
+    std::vector<std::uint32_t> flatIndices_;
+    std::vector<glm::mat4> localTransforms_;
+    std::vector<glm::mat4> worldTransforms_;
+    std::vector<std::uint8_t> dirty_;
+
+    // Range of the dirty nodes (firstDirty_ > lastDirty_ when nothing is dirty)
+    std::uint32_t firstDirty_ = UINT32_MAX;
+    std::uint32_t lastDirty_ = 0;
+};
+} // namespace common::utility
@@ -10,6 +10,9 @@
  */
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include <vulkan/vulkan_core.h>
 
 #include "ParameterServer.h"
@@ -38,6 +41,13 @@ namespace VulkanParams
     constexpr auto InstanceExtensions = "Vulkan.InstanceExtensions";
 } // namespace VulkanParams
 
+namespace BenchmarkParams
+{
+    constexpr auto FrameCount = "Benchmark.FrameCount";
+    constexpr auto ResultsFile = "Benchmark.ResultsFile";
+    constexpr auto ConfigurationName = "Benchmark.ConfigurationName";
+} // namespace BenchmarkParams
+
 inline void SetCommonParamSchema(utility::ParameterSchema& schema)
 {
     schema.RegisterParam<std::uint32_t>(WindowParams::Width, 800);
@@ -53,6 +63,21 @@ inline void SetCommonParamSchema(utility::ParameterSchema& schema)
     schema.RegisterParam<std::uint32_t>(VulkanParams::EngineVersion, VK_MAKE_VERSION(1, 0, 0));
     schema.RegisterParam<std::vector<std::string>>(VulkanParams::InstanceLayers);
     schema.RegisterParam<std::vector<std::string>>(VulkanParams::InstanceExtensions);
+
+    // Zero frame count means the application runs until the window is closed
+    schema.RegisterParam<std::uint32_t>(BenchmarkParams::FrameCount, 0);
+    schema.RegisterParam<std::string>(BenchmarkParams::ResultsFile, "");
+    schema.RegisterParam<std::string>(BenchmarkParams::ConfigurationName, "");
+
+    // Text parsers of the common Vulkan types (for config file and command line overrides)
+    schema.RegisterParser<VkClearColorValue>([](const std::string& text, VkClearColorValue& value) {
+        std::vector<float> components;
+        if (!utility::ParseParameterValue(text, components) || components.size() != 4) {
+            return false;
+        }
+        value = VkClearColorValue{{components[0], components[1], components[2], components[3]}};
+        return true;
+    });
 }
 
 } // namespace common::vulkan_framework
@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "BindlessTextureTable.h"
+
+#include <stdexcept>
+
+namespace common::vulkan_framework
+{
+BindlessTextureTable::BindlessTextureTable(const std::shared_ptr<vulkan_wrapper::VulkanDevice>& device,
+                                           const std::uint32_t maxTextureCount,
+                                           const VkShaderStageFlags stageFlags)
+    : device_{device}, maxTextureCount_{maxTextureCount}
+{
+    if (maxTextureCount_ == 0) {
+        throw std::runtime_error("Bindless texture table must have at least one texture slot!");
+    }
+
+    pool_ = device_->CreateDescriptorPool(1, {{VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, maxTextureCount_}},
+                                          VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT);
+    if (!pool_) {
+        throw std::runtime_error("Failed to create bindless descriptor pool!");
+    }
+
+    // Array size is the upper bound, the real size of the set is given with variable descriptor count
+    const VkDescriptorSetLayoutBinding binding{0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, maxTextureCount_,
+                                               stageFlags, nullptr};
+    constexpr VkDescriptorBindingFlags bindingFlags =
+            VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT |
+            VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT | VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT;
+
+    layout_ = device_->CreateDescriptorSetLayout({binding}, VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT,
+                                                 {bindingFlags});
+    if (!layout_) {
+        throw std::runtime_error("Failed to create bindless descriptor set layout!");
+    }
+
+    set_ = pool_->CreateDescriptorSets({layout_}, {maxTextureCount_}).front();
+
+    isIndexUsed_.resize(maxTextureCount_, false);
+}
+
+std::uint32_t BindlessTextureTable::AddTexture(const VkDescriptorImageInfo& imageInfo)
+{
+    std::uint32_t index;
+    if (!freeIndices_.empty()) {
+        // Reuse released indices first to keep the used part of the array compact
+        index = freeIndices_.back();
+        freeIndices_.pop_back();
+    } else if (textureCount_ < maxTextureCount_) {
+        index = textureCount_;
+    } else {
+        throw std::runtime_error("Bindless texture table is full!");
+    }
+
+    WriteDescriptor(index, imageInfo);
+    isIndexUsed_[index] = true;
+    ++textureCount_;
+
+    return index;
+}
+
+void BindlessTextureTable::UpdateTexture(const std::uint32_t index, const VkDescriptorImageInfo& imageInfo) const
+{
+    if (index >= maxTextureCount_ || !isIndexUsed_[index]) {
+        throw std::runtime_error("Invalid bindless texture index!");
+    }
+
+    WriteDescriptor(index, imageInfo);
+}
+
+void BindlessTextureTable::RemoveTexture(const std::uint32_t index)
+{
+    if (index >= maxTextureCount_ || !isIndexUsed_[index]) {
+        return;
+    }
+
+    isIndexUsed_[index] = false;
+    freeIndices_.push_back(index);
+    --textureCount_;
+}
+
+void BindlessTextureTable::WriteDescriptor(const std::uint32_t index, const VkDescriptorImageInfo& imageInfo) const
+{
+    VkWriteDescriptorSet writeDescriptorSet{};
+    writeDescriptorSet.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    writeDescriptorSet.dstSet = set_->GetHandle();
+    writeDescriptorSet.dstBinding = 0;
+    writeDescriptorSet.dstArrayElement = index;
+    writeDescriptorSet.descriptorCount = 1;
+    writeDescriptorSet.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    writeDescriptorSet.pImageInfo = &imageInfo;
+
+    device_->UpdateDescriptorSets({writeDescriptorSet});
+}
+} // namespace common::vulkan_framework
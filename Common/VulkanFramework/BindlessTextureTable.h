@@ -0,0 +1,112 @@
+/**
+ * @file    BindlessTextureTable.h
+ * @brief   This file contains a bindless texture table that keeps all textures in one large descriptor array.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <vulkan/vulkan_core.h>
+
+#include "CoreDefines.h"
+#include "VulkanDescriptorPool.h"
+#include "VulkanDescriptorSet.h"
+#include "VulkanDescriptorSetLayout.h"
+#include "VulkanDevice.h"
+
+namespace common::vulkan_framework
+{
+/**
+ * @brief Keeps a large combined image sampler array (binding 0 of its own set) that uses descriptor indexing. Textures
+ * take a stable index when they are added and shaders select them with this index (push constant or per-instance
+ * data), so the set is bound once and never changes between draws.
+ *
+ * The device must be created with descriptorBindingPartiallyBound, descriptorBindingVariableDescriptorCount,
+ * descriptorBindingSampledImageUpdateAfterBind, descriptorBindingUpdateUnusedWhilePending and runtimeDescriptorArray
+ * features (Vulkan 1.2 or VK_EXT_descriptor_indexing). Shaders that index the array with a non-uniform value need
+ * nonuniformEXT (GLSL) or NonUniformResourceIndex (HLSL) qualifier and shaderSampledImageArrayNonUniformIndexing.
+ */
+class COMMON_API BindlessTextureTable
+{
+public:
+    /**
+     * @param device Refers VulkanDevice object.
+     * @param maxTextureCount Size of the texture array (should be lower than
+     * maxDescriptorSetUpdateAfterBindSampledImages limit of the device).
+     * @param stageFlags Shader stages that access to the texture array.
+     */
+    BindlessTextureTable(const std::shared_ptr<vulkan_wrapper::VulkanDevice>& device,
+                         std::uint32_t maxTextureCount,
+                         VkShaderStageFlags stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT);
+
+    /**
+     * @brief Adds a texture to the table and writes its descriptor. Because the set is created with update after bind
+     * flags, it can be called while the set is bound to pending command buffers.
+     * @param imageInfo Sampler, image view and layout of the texture.
+     * @return Returns stable index of the texture in the array. It throws an exception if the table is full.
+     */
+    std::uint32_t AddTexture(const VkDescriptorImageInfo& imageInfo);
+
+    /**
+     * @brief Replaces the texture in the given index (e.g. after a texture is streamed in again).
+     * @param index Index of the texture.
+     * @param imageInfo Sampler, image view and layout of the new texture.
+     */
+    void UpdateTexture(std::uint32_t index, const VkDescriptorImageInfo& imageInfo) const;
+
+    /**
+     * @brief Releases the index of the texture. The index can be given to another texture later, so shaders must not
+     * use it after this call. Descriptor is left as it is because partially bound arrays allow stale entries that are
+     * not accessed.
+     * @param index Index of the texture.
+     */
+    void RemoveTexture(std::uint32_t index);
+
+    /**
+     * @brief Returns descriptor set layout of the table.
+     * @return Returns descriptor set layout of the table.
+     */
+    [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout> GetDescriptorLayout() const
+    {
+        return layout_;
+    }
+
+    /**
+     * @brief Returns descriptor set of the table.
+     * @return Returns descriptor set of the table.
+     */
+    [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet> GetDescriptorSet() const { return set_; }
+
+    /**
+     * @brief Returns size of the texture array.
+     * @return Returns size of the texture array.
+     */
+    [[nodiscard]] std::uint32_t GetMaxTextureCount() const { return maxTextureCount_; }
+
+    /**
+     * @brief Returns number of the textures in the table.
+     * @return Returns number of the textures in the table.
+     */
+    [[nodiscard]] std::uint32_t GetTextureCount() const { return textureCount_; }
+
+private:
+    void WriteDescriptor(std::uint32_t index, const VkDescriptorImageInfo& imageInfo) const;
+
+    std::shared_ptr<vulkan_wrapper::VulkanDevice> device_;
+    std::shared_ptr<vulkan_wrapper::VulkanDescriptorPool> pool_;
+    std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout> layout_;
+    std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet> set_;
+    std::uint32_t maxTextureCount_ = 0;
+    std::uint32_t textureCount_ = 0;
+    std::vector<std::uint32_t> freeIndices_;
+    std::vector<bool> isIndexUsed_;
+};
+} // namespace common::vulkan_framework
@@ -6,6 +6,12 @@
 
 #include "BufferResource.h"
 
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "VulkanHelpers.h"
+
 namespace common::vulkan_framework
 {
 
@@ -55,18 +61,30 @@ void BufferResource::AllocateBufferMemory()
     const uint32_t memoryTypeIndex =
             physicalDevicePtr->FindMemoryType(memoryReq.memoryTypeBits, createInfo_.MemoryProperties);
 
-    deviceMemory_ = devicePtr->AllocateMemory(memoryReq.size, memoryTypeIndex);
+    deviceMemory_ = devicePtr->AllocateMemory(memoryReq.size, memoryTypeIndex, createInfo_.AllocateFlags);
 
     if (!deviceMemory_) {
         throw std::runtime_error("Failed to allocate buffer memory!");
     }
 
     buffer_->BindBufferMemory(deviceMemory_, 0);
+
+    // Blocks are multiples of the atom size, so flushed ranges of non-coherent memory are always valid
+    const VkDeviceSize atomSize =
+            std::max<VkDeviceSize>(physicalDevicePtr->GetProperties().limits.nonCoherentAtomSize, 1);
+    dirtyBlockSize_ = AlignUp(std::max<VkDeviceSize>(createInfo_.DirtyBlockSize, 1), atomSize);
+    dirtyBlockCount_ = (createInfo_.BufferSizeInBytes + dirtyBlockSize_ - 1) / dirtyBlockSize_;
+    dirtyBlocks_.assign((dirtyBlockCount_ + 63) / 64, 0);
+    uploadStats_ = {.BufferSize = createInfo_.BufferSizeInBytes};
 }
 
 void BufferResource::MapMemory(const VkDeviceSize mapSize, const VkDeviceSize mapOffset)
 {
     mappedData_ = deviceMemory_->MapMemory(mapSize, mapOffset);
+    mapOffset_ = mapOffset;
+    mapSize_ = mapSize == VK_WHOLE_SIZE
+                       ? createInfo_.BufferSizeInBytes - std::min(mapOffset, createInfo_.BufferSizeInBytes)
+                       : mapSize;
 }
 
 void BufferResource::FlushData(const void* data,
@@ -78,5 +96,106 @@ void BufferResource::FlushData(const void* data,
     deviceMemory_->FlushMappedMemoryRanges(mappedMemoryRanges);
 }
 
+void BufferResource::FlushMappedRanges(
+        const std::vector<std::pair<VkDeviceSize, VkDeviceSize>>& mappedMemoryRanges) const
+{
+    deviceMemory_->FlushMappedMemoryRanges(mappedMemoryRanges);
+}
+
 void BufferResource::UnmapMemory() const { deviceMemory_->UnmapMemory(); }
+
+void BufferResource::WriteData(const void* data, const VkDeviceSize dataSize, const VkDeviceSize offset)
+{
+    if (!mappedData_) {
+        throw std::runtime_error("Buffer memory is not mapped!");
+    }
+    if (offset < mapOffset_ || offset + dataSize > mapOffset_ + mapSize_ ||
+        offset + dataSize > createInfo_.BufferSizeInBytes) {
+        throw std::runtime_error("Buffer write is out of the mapped range!");
+    }
+
+    std::memcpy(static_cast<std::uint8_t*>(mappedData_) + (offset - mapOffset_), data, dataSize);
+    MarkDirty(offset, dataSize);
+    uploadStats_.WrittenBytes += dataSize;
+}
+
+void BufferResource::MarkDirty(const VkDeviceSize offset, const VkDeviceSize size)
+{
+    if (size == 0 || offset >= createInfo_.BufferSizeInBytes) {
+        return;
+    }
+
+    const VkDeviceSize end = std::min<VkDeviceSize>(offset + size, createInfo_.BufferSizeInBytes);
+    for (VkDeviceSize block = offset / dirtyBlockSize_; block <= (end - 1) / dirtyBlockSize_; ++block) {
+        dirtyBlocks_[block / 64] |= 1ull << (block % 64);
+    }
+}
+
+std::vector<std::pair<VkDeviceSize, VkDeviceSize>> BufferResource::GetDirtyRanges() const
+{
+    const auto isDirty = [&](const VkDeviceSize block) { return (dirtyBlocks_[block / 64] >> (block % 64)) & 1ull; };
+
+    std::vector<std::pair<VkDeviceSize, VkDeviceSize>> ranges;
+    VkDeviceSize block = 0;
+    while (block < dirtyBlockCount_) {
+        // Skip 64 clean blocks at once
+        if (block % 64 == 0 && dirtyBlocks_[block / 64] == 0) {
+            block += 64;
+            continue;
+        }
+        if (!isDirty(block)) {
+            ++block;
+            continue;
+        }
+
+        const VkDeviceSize firstBlock = block;
+        while (block < dirtyBlockCount_ && isDirty(block)) {
+            ++block;
+        }
+
+        const VkDeviceSize offset = firstBlock * dirtyBlockSize_;
+        const VkDeviceSize end = std::min<VkDeviceSize>(block * dirtyBlockSize_, createInfo_.BufferSizeInBytes);
+        ranges.emplace_back(end - offset, offset);
+    }
+
+    return ranges;
+}
+
+std::vector<VkBufferCopy> BufferResource::GetDirtyCopyRegions(const VkDeviceSize dstOffset) const
+{
+    std::vector<VkBufferCopy> regions;
+    for (const auto& [size, offset]: GetDirtyRanges()) {
+        regions.push_back({.srcOffset = offset, .dstOffset = dstOffset + offset, .size = size});
+    }
+
+    return regions;
+}
+
+void BufferResource::FlushDirtyRanges()
+{
+    auto ranges = GetDirtyRanges();
+    if (ranges.empty()) {
+        return;
+    }
+
+    for (const auto& [size, offset]: ranges) {
+        uploadStats_.FlushedBytes += size;
+    }
+    uploadStats_.FlushedRangeCount += static_cast<std::uint32_t>(ranges.size());
+
+    if (!(createInfo_.MemoryProperties & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)) {
+        // Buffer size may not be a multiple of the atom size, so the last range is flushed until the end of mapping
+        auto& [lastSize, lastOffset] = ranges.back();
+        if (lastOffset + lastSize == createInfo_.BufferSizeInBytes) {
+            lastSize = VK_WHOLE_SIZE;
+        }
+        deviceMemory_->FlushMappedMemoryRanges(ranges);
+    }
+
+    ClearDirtyRanges();
+}
+
+void BufferResource::ClearDirtyRanges() { std::fill(dirtyBlocks_.begin(), dirtyBlocks_.end(), 0); }
+
+void BufferResource::ResetUploadStats() { uploadStats_ = {.BufferSize = createInfo_.BufferSizeInBytes}; }
 } // namespace common::vulkan_framework
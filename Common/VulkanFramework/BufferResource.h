@@ -11,7 +11,9 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "CoreDefines.h"
 #include "VulkanBuffer.h"
@@ -25,9 +27,22 @@ namespace common::vulkan_framework
 struct COMMON_API BufferResourceCreateInfo
 {
     std::string Name;
-    std::uint32_t BufferSizeInBytes;
+    VkDeviceSize BufferSizeInBytes;
     VkBufferUsageFlags UsageFlags;
     VkMemoryPropertyFlags MemoryProperties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+    VkMemoryAllocateFlags AllocateFlags = 0; // DEVICE_ADDRESS flag is needed for SHADER_DEVICE_ADDRESS usage
+    VkDeviceSize DirtyBlockSize = 256;       // Granularity of the dirty range tracking (rounded to nonCoherentAtomSize)
+};
+
+/**
+ * @brief Upload counters of a buffer resource since the last ResetUploadStats() call (e.g. per frame).
+ */
+struct COMMON_API BufferUploadStats
+{
+    VkDeviceSize WrittenBytes = 0;       // Bytes copied with WriteData
+    VkDeviceSize FlushedBytes = 0;       // Bytes of the flushed dirty ranges (block granularity)
+    std::uint32_t FlushedRangeCount = 0; // Number of the coalesced ranges
+    VkDeviceSize BufferSize = 0;
 };
 
 class COMMON_API BufferResource
@@ -66,16 +81,79 @@ public:
                    const std::vector<std::pair<VkDeviceSize, VkDeviceSize>>& mappedMemoryRanges = {
                        {VK_WHOLE_SIZE, 0}}) const;
 
+    /**
+     * @brief Flushes host writes of the mapped memory ranges without copying data (e.g. after writing through the
+     * pointer of GetMappedData). It is only needed for memory without HOST_COHERENT property.
+     * @param mappedMemoryRanges (size, offset) pair of the mapped memory ranges.
+     */
+    void FlushMappedRanges(const std::vector<std::pair<VkDeviceSize, VkDeviceSize>>& mappedMemoryRanges) const;
+
     /**
      * @brief Unmaps memory region.
      */
     void UnmapMemory() const;
 
+    /**
+     * @brief Copies data into the mapped memory and marks the written blocks as dirty. Nothing is flushed until
+     * FlushDirtyRanges is called, so many small writes are uploaded with a few coalesced ranges.
+     * @param data The data that will be copied.
+     * @param dataSize Size of the data in bytes.
+     * @param offset Offset of the data in the buffer.
+     */
+    void WriteData(const void* data, VkDeviceSize dataSize, VkDeviceSize offset = 0);
+
+    /**
+     * @brief Marks a byte range as dirty (e.g. after writing through the pointer of GetMappedData).
+     * @param offset Offset of the range in the buffer.
+     * @param size Size of the range in bytes.
+     */
+    void MarkDirty(VkDeviceSize offset, VkDeviceSize size);
+
+    /**
+     * @brief Returns the dirty blocks as the minimal set of ranges, neighbour blocks are merged.
+     * @return Returns (size, offset) pairs of the ranges, the last range is clamped to the buffer size.
+     */
+    [[nodiscard]] std::vector<std::pair<VkDeviceSize, VkDeviceSize>> GetDirtyRanges() const;
+
+    /**
+     * @brief Returns the dirty ranges as copy regions, it is used when this buffer is the staging buffer of a device
+     * local buffer with the same layout.
+     * @param dstOffset Offset that is added to the destination offsets of the regions.
+     * @return Returns copy regions of the dirty ranges.
+     */
+    [[nodiscard]] std::vector<VkBufferCopy> GetDirtyCopyRegions(VkDeviceSize dstOffset = 0) const;
+
+    /**
+     * @brief Flushes the dirty ranges with one call (skipped for host coherent memory), updates upload counters and
+     * clears the dirty state. Memory must be mapped as a whole.
+     */
+    void FlushDirtyRanges();
+
+    /**
+     * @brief Clears the dirty state without flushing (e.g. after the dirty regions are copied).
+     */
+    void ClearDirtyRanges();
+
+    /**
+     * @return Returns upload counters since the last ResetUploadStats() call.
+     */
+    [[nodiscard]] const BufferUploadStats& GetUploadStats() const { return uploadStats_; }
+
+    /**
+     * @brief Resets upload counters, it is usually called once per frame.
+     */
+    void ResetUploadStats();
+
     /**
      * @return Returns VulkanBuffer object that held from this class.
      */
     [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanBuffer> GetBuffer() const { return buffer_; }
 
+    /**
+     * @return Returns pointer of the mapped memory area, nullptr if the memory is not mapped.
+     */
+    [[nodiscard]] void* GetMappedData() const { return mappedData_; }
+
 private:
     /**
      * @brief Allocates appropriate memory for the buffer.
@@ -89,5 +167,13 @@ private:
     std::shared_ptr<vulkan_wrapper::VulkanBuffer> buffer_ = nullptr;
     std::shared_ptr<vulkan_wrapper::VulkanDeviceMemory> deviceMemory_ = nullptr;
     void* mappedData_ = nullptr;
+    VkDeviceSize mapOffset_ = 0;
+    VkDeviceSize mapSize_ = 0; // VK_WHOLE_SIZE is resolved to the remaining size of the buffer
+
+    // One bit per block, blocks are aligned to nonCoherentAtomSize so they can be flushed directly
+    std::vector<std::uint64_t> dirtyBlocks_;
+    VkDeviceSize dirtyBlockSize_ = 1;
+    VkDeviceSize dirtyBlockCount_ = 0;
+    BufferUploadStats uploadStats_{};
 };
 } // namespace common::vulkan_framework
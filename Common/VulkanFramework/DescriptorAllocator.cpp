@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "DescriptorAllocator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace common::vulkan_framework
+{
+DescriptorAllocator::DescriptorAllocator(const std::shared_ptr<vulkan_wrapper::VulkanDevice>& device,
+                                         const std::uint32_t initialSetsPerPool,
+                                         std::vector<DescriptorPoolSizeRatio> poolSizeRatios,
+                                         const VkDescriptorPoolCreateFlags poolFlags,
+                                         const std::uint32_t maxSetsPerPool)
+    : device_{device}, poolSizeRatios_{std::move(poolSizeRatios)}, poolFlags_{poolFlags},
+      setsPerPool_{std::max(initialSetsPerPool, 1u)}, maxSetsPerPool_{std::max(maxSetsPerPool, setsPerPool_)}
+{
+    currentPool_ = CreatePool();
+}
+
+std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet>
+DescriptorAllocator::Allocate(const std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout>& layout,
+                              const std::uint32_t variableDescriptorCount)
+{
+    std::vector<std::uint32_t> variableDescriptorCounts;
+    if (variableDescriptorCount > 0) {
+        variableDescriptorCounts.push_back(variableDescriptorCount);
+    }
+
+    std::vector<std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet>> descriptorSets;
+    auto result = currentPool_->AllocateDescriptorSets({layout}, descriptorSets, variableDescriptorCounts);
+
+    if (result == VK_ERROR_OUT_OF_POOL_MEMORY || result == VK_ERROR_FRAGMENTED_POOL) {
+        // Current pool is exhausted, keep it until the next reset and continue with another one
+        fullPools_.push_back(currentPool_);
+        currentPool_ = GetNextPool();
+        result = currentPool_->AllocateDescriptorSets({layout}, descriptorSets, variableDescriptorCounts);
+    }
+
+    if (result != VK_SUCCESS || descriptorSets.empty()) {
+        throw std::runtime_error("Failed to allocate descriptor set from descriptor allocator!");
+    }
+
+    return descriptorSets.front();
+}
+
+void DescriptorAllocator::ResetPools()
+{
+    // Wrappers of the sets from pools with free flag free their sets when they are destroyed, a reset would make them
+    // free the sets twice
+    if (poolFlags_ & VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT) {
+        throw std::runtime_error("Descriptor pools with free descriptor set flag can't be reset!");
+    }
+
+    currentPool_->ResetDescriptorPool();
+    for (const auto& pool: fullPools_) {
+        pool->ResetDescriptorPool();
+        readyPools_.push_back(pool);
+    }
+    fullPools_.clear();
+}
+
+std::shared_ptr<vulkan_wrapper::VulkanDescriptorPool> DescriptorAllocator::CreatePool()
+{
+    std::vector<VkDescriptorPoolSize> poolSizes;
+    poolSizes.reserve(poolSizeRatios_.size());
+    for (const auto& [type, ratio]: poolSizeRatios_) {
+        const auto descriptorCount = static_cast<std::uint32_t>(std::ceil(ratio * static_cast<float>(setsPerPool_)));
+        poolSizes.push_back({type, std::max(descriptorCount, 1u)});
+    }
+
+    auto pool = device_->CreateDescriptorPool(setsPerPool_, poolSizes, poolFlags_);
+    if (!pool) {
+        throw std::runtime_error("Failed to create descriptor pool!");
+    }
+
+    // Next pools are bigger, so the chain stays short when the usage is much higher than the first guess
+    setsPerPool_ = std::min(setsPerPool_ * 2, maxSetsPerPool_);
+
+    return pool;
+}
+
+std::shared_ptr<vulkan_wrapper::VulkanDescriptorPool> DescriptorAllocator::GetNextPool()
+{
+    if (!readyPools_.empty()) {
+        auto pool = readyPools_.back();
+        readyPools_.pop_back();
+        return pool;
+    }
+
+    return CreatePool();
+}
+
+FrameDescriptorAllocator::FrameDescriptorAllocator(const std::shared_ptr<vulkan_wrapper::VulkanDevice>& device,
+                                                   const std::uint32_t frameCount,
+                                                   const std::uint32_t initialSetsPerPool,
+                                                   const std::vector<DescriptorPoolSizeRatio>& poolSizeRatios)
+{
+    // Transient pools don't have free flag, sets are only released with pool resets
+    frameAllocators_.reserve(frameCount);
+    for (std::uint32_t i = 0; i < std::max(frameCount, 1u); ++i) {
+        frameAllocators_.emplace_back(device, initialSetsPerPool, poolSizeRatios);
+    }
+}
+
+void FrameDescriptorAllocator::BeginFrame(const std::uint32_t frameIndex)
+{
+    currentFrame_ = frameIndex % static_cast<std::uint32_t>(frameAllocators_.size());
+    frameAllocators_[currentFrame_].ResetPools();
+}
+
+std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet>
+FrameDescriptorAllocator::Allocate(const std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout>& layout,
+                                   const std::uint32_t variableDescriptorCount)
+{
+    return frameAllocators_[currentFrame_].Allocate(layout, variableDescriptorCount);
+}
+} // namespace common::vulkan_framework
@@ -0,0 +1,134 @@
+/**
+ * @file    DescriptorAllocator.h
+ * @brief   This file contains growable descriptor set allocators. DescriptorAllocator chains new pools when the current
+ *          one is exhausted and FrameDescriptorAllocator recycles transient sets of every frame with pool resets.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <vulkan/vulkan_core.h>
+
+#include "CoreDefines.h"
+#include "VulkanDescriptorPool.h"
+#include "VulkanDescriptorSet.h"
+#include "VulkanDescriptorSetLayout.h"
+#include "VulkanDevice.h"
+
+namespace common::vulkan_framework
+{
+/**
+ * @brief Number of descriptors of a type per descriptor set in a pool (e.g. {UNIFORM_BUFFER, 2.0f} means a pool with
+ * 64 sets keeps 128 uniform buffer descriptors).
+ */
+struct COMMON_API DescriptorPoolSizeRatio
+{
+    VkDescriptorType Type;
+    float Ratio;
+};
+
+class COMMON_API DescriptorAllocator
+{
+public:
+    /**
+     * @param device Refers VulkanDevice object.
+     * @param initialSetsPerPool Maximum set count of the first pool. Every new pool doubles it until maxSetsPerPool.
+     * @param poolSizeRatios Descriptor counts per set of every descriptor type.
+     * @param poolFlags Creation flags of the pools. Without FREE_DESCRIPTOR_SET flag, sets are only released with
+     * ResetPools or pool destruction.
+     * @param maxSetsPerPool Upper limit of the set count of a pool.
+     */
+    DescriptorAllocator(const std::shared_ptr<vulkan_wrapper::VulkanDevice>& device,
+                        std::uint32_t initialSetsPerPool,
+                        std::vector<DescriptorPoolSizeRatio> poolSizeRatios,
+                        VkDescriptorPoolCreateFlags poolFlags = 0,
+                        std::uint32_t maxSetsPerPool = 4096);
+
+    /**
+     * @brief Allocates a descriptor set. If the current pool is out of memory (or fragmented), it continues with a
+     * recycled pool or creates a new bigger pool.
+     * @param layout Layout of the descriptor set.
+     * @param variableDescriptorCount Descriptor count of the variable sized binding (0 if the layout doesn't have it).
+     * @return Returns the allocated descriptor set. It throws an exception if the set can't fit into an empty pool.
+     */
+    std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet>
+    Allocate(const std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout>& layout,
+             std::uint32_t variableDescriptorCount = 0);
+
+    /**
+     * @brief Resets all pools with vkResetDescriptorPool. All sets that are allocated from this allocator become
+     * invalid, so it must be called after the GPU finishes using them. Allocators whose pools have the
+     * FREE_DESCRIPTOR_SET flag can't be reset (it throws), their sets are freed one by one by their wrappers.
+     */
+    void ResetPools();
+
+    /**
+     * @brief Returns number of the pools that are created by the allocator.
+     * @return Returns number of the pools.
+     */
+    [[nodiscard]] std::size_t GetPoolCount() const { return fullPools_.size() + readyPools_.size() + 1; }
+
+private:
+    [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanDescriptorPool> CreatePool();
+
+    [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanDescriptorPool> GetNextPool();
+
+    std::shared_ptr<vulkan_wrapper::VulkanDevice> device_;
+    std::vector<DescriptorPoolSizeRatio> poolSizeRatios_;
+    VkDescriptorPoolCreateFlags poolFlags_ = 0;
+    std::uint32_t setsPerPool_ = 0;
+    std::uint32_t maxSetsPerPool_ = 0;
+
+    std::shared_ptr<vulkan_wrapper::VulkanDescriptorPool> currentPool_;
+    std::vector<std::shared_ptr<vulkan_wrapper::VulkanDescriptorPool>> fullPools_;
+    std::vector<std::shared_ptr<vulkan_wrapper::VulkanDescriptorPool>> readyPools_;
+};
+
+/**
+ * @brief Linear allocator for transient descriptor sets that are written and used in one frame. Every frame in flight
+ * has its own pools, BeginFrame resets pools of the frame at once instead of freeing sets one by one.
+ */
+class COMMON_API FrameDescriptorAllocator
+{
+public:
+    /**
+     * @param device Refers VulkanDevice object.
+     * @param frameCount Number of frames in flight.
+     * @param initialSetsPerPool Maximum set count of the first pool of every frame.
+     * @param poolSizeRatios Descriptor counts per set of every descriptor type.
+     */
+    FrameDescriptorAllocator(const std::shared_ptr<vulkan_wrapper::VulkanDevice>& device,
+                             std::uint32_t frameCount,
+                             std::uint32_t initialSetsPerPool,
+                             const std::vector<DescriptorPoolSizeRatio>& poolSizeRatios);
+
+    /**
+     * @brief Starts a new frame and recycles the sets that were allocated when the same frame index was used last
+     * time. It must be called after the fence of the frame is waited.
+     * @param frameIndex Index of the frame in flight.
+     */
+    void BeginFrame(std::uint32_t frameIndex);
+
+    /**
+     * @brief Allocates a transient descriptor set for the current frame.
+     * @param layout Layout of the descriptor set.
+     * @param variableDescriptorCount Descriptor count of the variable sized binding (0 if the layout doesn't have it).
+     * @return Returns the allocated descriptor set which is valid until the same frame index begins again.
+     */
+    std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet>
+    Allocate(const std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout>& layout,
+             std::uint32_t variableDescriptorCount = 0);
+
+private:
+    std::vector<DescriptorAllocator> frameAllocators_;
+    std::uint32_t currentFrame_ = 0;
+};
+} // namespace common::vulkan_framework
@@ -0,0 +1,195 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "DescriptorBuffer.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "VulkanHelpers.h"
+
+namespace common::vulkan_framework
+{
+DescriptorBuffer::DescriptorBuffer(const std::shared_ptr<vulkan_wrapper::VulkanPhysicalDevice>& physicalDevice,
+                                   const std::shared_ptr<vulkan_wrapper::VulkanDevice>& device,
+                                   const VkDeviceSize sizePerFrame,
+                                   const std::uint32_t frameCount,
+                                   const VkBufferUsageFlags usageFlags)
+    : device_{device}, usageFlags_{usageFlags}, frameCount_{std::max(frameCount, 1u)}
+{
+    if (!device_->IsDescriptorBufferEnabled()) {
+        throw std::runtime_error("VK_EXT_descriptor_buffer is not enabled on the device!");
+    }
+
+    properties_.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT;
+    physicalDevice->GetExtendedProperties(&properties_);
+
+    // Every frame region starts from an aligned offset, so set offsets in the regions stay aligned
+    sizePerFrame_ = AlignUp(sizePerFrame, properties_.descriptorBufferOffsetAlignment);
+
+    const BufferResourceCreateInfo createInfo{
+            .Name = "descriptorBuffer",
+            .BufferSizeInBytes = sizePerFrame_ * frameCount_,
+            .UsageFlags = usageFlags_ | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+            .MemoryProperties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+            .AllocateFlags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT};
+
+    buffer_ = std::make_unique<BufferResource>(physicalDevice, device_);
+    buffer_->CreateBuffer(createInfo);
+    buffer_->MapMemory(); // Stays mapped, descriptors are written directly
+
+    bufferAddress_ = buffer_->GetBuffer()->GetDeviceAddress();
+}
+
+void DescriptorBuffer::BeginFrame(const std::uint32_t frameIndex)
+{
+    frameIndex_ = frameIndex % frameCount_;
+    frameHead_ = frameIndex_ * sizePerFrame_;
+}
+
+VkDeviceSize DescriptorBuffer::AllocateSet(const std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout>& layout)
+{
+    const auto setOffset = AlignUp(frameHead_, properties_.descriptorBufferOffsetAlignment);
+    const auto setSize = layout->GetLayoutSizeInBytes();
+
+    if (setOffset + setSize > (frameIndex_ + 1) * sizePerFrame_) {
+        throw std::runtime_error("Descriptor buffer is full!");
+    }
+
+    frameHead_ = setOffset + setSize;
+    return setOffset;
+}
+
+void DescriptorBuffer::WriteBufferDescriptor(const VkDeviceSize setOffset,
+                                             const std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout>& layout,
+                                             const std::uint32_t binding,
+                                             const VkDescriptorType type,
+                                             const VkDeviceAddress address,
+                                             const VkDeviceSize range,
+                                             const std::uint32_t arrayElement) const
+{
+    VkDescriptorAddressInfoEXT addressInfo{};
+    addressInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+    addressInfo.pNext = nullptr;
+    addressInfo.address = address;
+    addressInfo.range = range;
+    addressInfo.format = VK_FORMAT_UNDEFINED;
+
+    VkDescriptorGetInfoEXT getInfo{};
+    getInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+    getInfo.pNext = nullptr;
+    getInfo.type = type;
+    switch (type) {
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            getInfo.data.pUniformBuffer = &addressInfo;
+            break;
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            getInfo.data.pStorageBuffer = &addressInfo;
+            break;
+        default:
+            throw std::runtime_error("Unsupported buffer descriptor type for descriptor buffer!");
+    }
+
+    WriteDescriptor(setOffset, layout, binding, arrayElement, getInfo);
+}
+
+void DescriptorBuffer::WriteImageDescriptor(const VkDeviceSize setOffset,
+                                            const std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout>& layout,
+                                            const std::uint32_t binding,
+                                            const VkDescriptorType type,
+                                            const VkDescriptorImageInfo& imageInfo,
+                                            const std::uint32_t arrayElement) const
+{
+    VkDescriptorGetInfoEXT getInfo{};
+    getInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+    getInfo.pNext = nullptr;
+    getInfo.type = type;
+    switch (type) {
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            getInfo.data.pCombinedImageSampler = &imageInfo;
+            break;
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            getInfo.data.pSampledImage = &imageInfo;
+            break;
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            getInfo.data.pStorageImage = &imageInfo;
+            break;
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            getInfo.data.pInputAttachmentImage = &imageInfo;
+            break;
+        default:
+            throw std::runtime_error("Unsupported image descriptor type for descriptor buffer!");
+    }
+
+    WriteDescriptor(setOffset, layout, binding, arrayElement, getInfo);
+}
+
+void DescriptorBuffer::Bind(const std::shared_ptr<vulkan_wrapper::VulkanCommandBuffer>& cmdBuffer) const
+{
+    VkDescriptorBufferBindingInfoEXT bindingInfo{};
+    bindingInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT;
+    bindingInfo.pNext = nullptr;
+    bindingInfo.address = bufferAddress_;
+    bindingInfo.usage = usageFlags_;
+
+    if (!cmdBuffer->BindDescriptorBuffers({bindingInfo})) {
+        throw std::runtime_error("Failed to bind descriptor buffer!");
+    }
+}
+
+void DescriptorBuffer::BindSet(const std::shared_ptr<vulkan_wrapper::VulkanCommandBuffer>& cmdBuffer,
+                               const VkPipelineBindPoint pipelineBindPoint,
+                               const std::shared_ptr<vulkan_wrapper::VulkanPipelineLayout>& pipelineLayout,
+                               const std::uint32_t setIndex,
+                               const VkDeviceSize setOffset) const
+{
+    if (!cmdBuffer->SetDescriptorBufferOffsets(pipelineBindPoint, pipelineLayout, setIndex, {0}, {setOffset})) {
+        throw std::runtime_error("Failed to set descriptor buffer offset!");
+    }
+}
+
+std::size_t DescriptorBuffer::GetDescriptorSize(const VkDescriptorType type) const
+{
+    switch (type) {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+            return properties_.samplerDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            return properties_.combinedImageSamplerDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            return properties_.sampledImageDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            return properties_.storageImageDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            return properties_.uniformTexelBufferDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            return properties_.storageTexelBufferDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            return properties_.uniformBufferDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            return properties_.storageBufferDescriptorSize;
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            return properties_.inputAttachmentDescriptorSize;
+        default:
+            return 0;
+    }
+}
+
+void DescriptorBuffer::WriteDescriptor(const VkDeviceSize setOffset,
+                                       const std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout>& layout,
+                                       const std::uint32_t binding,
+                                       const std::uint32_t arrayElement,
+                                       const VkDescriptorGetInfoEXT& getInfo) const
+{
+    const auto descriptorSize = GetDescriptorSize(getInfo.type);
+    const auto descriptorOffset = setOffset + layout->GetBindingOffset(binding) + arrayElement * descriptorSize;
+
+    // Driver writes the opaque descriptor data straight into the mapped buffer memory
+    auto* descriptor = static_cast<std::uint8_t*>(buffer_->GetMappedData()) + descriptorOffset;
+    if (!device_->GetDescriptor(getInfo, descriptorSize, descriptor)) {
+        throw std::runtime_error("Failed to get descriptor data!");
+    }
+}
+} // namespace common::vulkan_framework
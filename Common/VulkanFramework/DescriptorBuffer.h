@@ -0,0 +1,155 @@
+/**
+ * @file    DescriptorBuffer.h
+ * @brief   This file contains a descriptor buffer that keeps descriptors in host visible buffer memory instead of
+ *          descriptor pools and sets (VK_EXT_descriptor_buffer).
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <vulkan/vulkan_core.h>
+
+#include "BufferResource.h"
+#include "CoreDefines.h"
+#include "VulkanCommandBuffer.h"
+#include "VulkanDescriptorSetLayout.h"
+#include "VulkanDevice.h"
+#include "VulkanPhysicalDevice.h"
+#include "VulkanPipelineLayout.h"
+
+namespace common::vulkan_framework
+{
+/**
+ * @brief Places descriptors of set layouts into a persistently mapped buffer. A "set" is only a byte offset in the
+ * buffer, descriptors are written with vkGetDescriptorEXT straight into the mapped memory and bound with
+ * vkCmdBindDescriptorBuffersEXT and vkCmdSetDescriptorBufferOffsetsEXT.
+ *
+ * The buffer is split into one region per frame in flight. Sets are allocated linearly in the region of the current
+ * frame and BeginFrame releases all of them at once, so writing new sets every frame costs only a few memory writes.
+ *
+ * The device must enable VK_EXT_descriptor_buffer with descriptorBuffer and bufferDeviceAddress features. Layouts
+ * must be created with DESCRIPTOR_BUFFER flag and pipelines that use them with DESCRIPTOR_BUFFER pipeline flag.
+ */
+class COMMON_API DescriptorBuffer
+{
+public:
+    /**
+     * @param physicalDevice Refers VulkanPhysicalDevice object.
+     * @param device Refers VulkanDevice object.
+     * @param sizePerFrame Size of the region of every frame in bytes.
+     * @param frameCount Number of frames in flight (1 for sets that live until the buffer is destroyed).
+     * @param usageFlags Descriptor buffer usage. SAMPLER_DESCRIPTOR_BUFFER usage is needed for layouts with samplers.
+     */
+    DescriptorBuffer(const std::shared_ptr<vulkan_wrapper::VulkanPhysicalDevice>& physicalDevice,
+                     const std::shared_ptr<vulkan_wrapper::VulkanDevice>& device,
+                     VkDeviceSize sizePerFrame,
+                     std::uint32_t frameCount = 1,
+                     VkBufferUsageFlags usageFlags = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT);
+
+    /**
+     * @brief Starts a new frame and releases the sets that were allocated when the same frame index was used last
+     * time. It must be called after the fence of the frame is waited.
+     * @param frameIndex Index of the frame in flight.
+     */
+    void BeginFrame(std::uint32_t frameIndex);
+
+    /**
+     * @brief Reserves space for a set of the layout in the region of the current frame.
+     * @param layout Layout of the set that is created with DESCRIPTOR_BUFFER flag.
+     * @return Returns offset of the set in the buffer. It throws an exception if the region is full.
+     */
+    VkDeviceSize AllocateSet(const std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout>& layout);
+
+    /**
+     * @brief Writes a buffer descriptor (uniform or storage buffer) of a set.
+     * @param setOffset Offset of the set that is returned from AllocateSet.
+     * @param layout Layout of the set.
+     * @param binding Binding index of the descriptor.
+     * @param type Descriptor type of the binding.
+     * @param address Device address of the buffer (with offset).
+     * @param range Size of the buffer range.
+     * @param arrayElement Array element of the binding.
+     */
+    void WriteBufferDescriptor(VkDeviceSize setOffset,
+                               const std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout>& layout,
+                               std::uint32_t binding,
+                               VkDescriptorType type,
+                               VkDeviceAddress address,
+                               VkDeviceSize range,
+                               std::uint32_t arrayElement = 0) const;
+
+    /**
+     * @brief Writes an image descriptor (combined image sampler, sampled image, storage image or input attachment).
+     * @param setOffset Offset of the set that is returned from AllocateSet.
+     * @param layout Layout of the set.
+     * @param binding Binding index of the descriptor.
+     * @param type Descriptor type of the binding.
+     * @param imageInfo Sampler, image view and layout of the image.
+     * @param arrayElement Array element of the binding.
+     */
+    void WriteImageDescriptor(VkDeviceSize setOffset,
+                              const std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout>& layout,
+                              std::uint32_t binding,
+                              VkDescriptorType type,
+                              const VkDescriptorImageInfo& imageInfo,
+                              std::uint32_t arrayElement = 0) const;
+
+    /**
+     * @brief Binds the buffer to the command buffer as descriptor buffer 0. It must be called before BindSet.
+     * @param cmdBuffer Command buffer that is being recorded.
+     */
+    void Bind(const std::shared_ptr<vulkan_wrapper::VulkanCommandBuffer>& cmdBuffer) const;
+
+    /**
+     * @brief Points a set number of the pipeline layout to a set in the buffer.
+     * @param cmdBuffer Command buffer that is being recorded.
+     * @param pipelineBindPoint Bind point of the pipeline.
+     * @param pipelineLayout Pipeline layout of the pipeline.
+     * @param setIndex Set number in the pipeline layout.
+     * @param setOffset Offset of the set that is returned from AllocateSet.
+     */
+    void BindSet(const std::shared_ptr<vulkan_wrapper::VulkanCommandBuffer>& cmdBuffer,
+                 VkPipelineBindPoint pipelineBindPoint,
+                 const std::shared_ptr<vulkan_wrapper::VulkanPipelineLayout>& pipelineLayout,
+                 std::uint32_t setIndex,
+                 VkDeviceSize setOffset) const;
+
+    /**
+     * @brief Returns size of a descriptor of the type in the buffer.
+     * @param type Descriptor type.
+     * @return Returns descriptor size in bytes.
+     */
+    [[nodiscard]] std::size_t GetDescriptorSize(VkDescriptorType type) const;
+
+    /**
+     * @brief Returns used bytes in the region of the current frame.
+     * @return Returns used bytes in the region of the current frame.
+     */
+    [[nodiscard]] VkDeviceSize GetUsedSize() const { return frameHead_ - frameIndex_ * sizePerFrame_; }
+
+private:
+    void WriteDescriptor(VkDeviceSize setOffset,
+                         const std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout>& layout,
+                         std::uint32_t binding,
+                         std::uint32_t arrayElement,
+                         const VkDescriptorGetInfoEXT& getInfo) const;
+
+    std::shared_ptr<vulkan_wrapper::VulkanDevice> device_;
+    std::unique_ptr<BufferResource> buffer_;
+    VkPhysicalDeviceDescriptorBufferPropertiesEXT properties_{};
+    VkDeviceAddress bufferAddress_ = 0;
+    VkBufferUsageFlags usageFlags_ = 0;
+    VkDeviceSize sizePerFrame_ = 0;
+    std::uint32_t frameCount_ = 1;
+    std::uint32_t frameIndex_ = 0;
+    VkDeviceSize frameHead_ = 0;
+};
+} // namespace common::vulkan_framework
@@ -6,6 +6,8 @@
 
 #include "DescriptorRegistry.h"
 
+#include <algorithm>
+
 namespace common::vulkan_framework
 {
 DescriptorRegistry::DescriptorRegistry(const std::shared_ptr<vulkan_wrapper::VulkanDevice>& device) : device_{device} {}
@@ -14,8 +16,8 @@ void DescriptorRegistry::CreateDescriptors(const DescriptorResourceCreateInfo& c
 {
     CreatePool(createInfo.MaxSets, createInfo.PoolSizes);
 
-    for (const auto& [name, bindings]: createInfo.Layouts) {
-        CreateLayout(name, bindings);
+    for (const auto& [name, bindings, flags]: createInfo.Layouts) {
+        CreateLayout(name, bindings, flags);
     }
 
     for (const auto& [name, layoutName] : createInfo.DescriptorSets) {
@@ -27,47 +29,315 @@ void DescriptorRegistry::CreatePool(const std::uint32_t maxSets,
                                     const std::vector<VkDescriptorPoolSize>& poolSizes,
                                     const VkDescriptorPoolCreateFlags& flags)
 {
-    descPool_ = device_->CreateDescriptorPool(maxSets, poolSizes, flags);
+    // Pool sizes are converted to per-set ratios, so chained pools keep the same type distribution
+    const auto setCount = static_cast<float>(std::max(maxSets, 1u));
+    std::vector<DescriptorPoolSizeRatio> poolSizeRatios;
+    poolSizeRatios.reserve(poolSizes.size());
+    for (const auto& [type, descriptorCount]: poolSizes) {
+        poolSizeRatios.push_back({type, static_cast<float>(descriptorCount) / setCount});
+    }
+
+    descAllocator_ = std::make_unique<DescriptorAllocator>(device_, maxSets, std::move(poolSizeRatios), flags);
+}
+
+void DescriptorRegistry::CreateFrameAllocator(const std::uint32_t frameCount,
+                                              const std::uint32_t initialSetsPerPool,
+                                              const std::vector<DescriptorPoolSizeRatio>& poolSizeRatios)
+{
+    frameAllocator_ =
+            std::make_unique<FrameDescriptorAllocator>(device_, frameCount, initialSetsPerPool, poolSizeRatios);
+}
+
+void DescriptorRegistry::BeginFrame(const std::uint32_t frameIndex) const
+{
+    if (frameAllocator_) {
+        frameAllocator_->BeginFrame(frameIndex);
+    }
+}
 
-    if (!descPool_) {
-        throw std::runtime_error("Failed to create descriptor pool!");
+std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet>
+DescriptorRegistry::AllocateTransientSet(const std::string& layoutName) const
+{
+    if (!frameAllocator_) {
+        throw std::runtime_error("Frame descriptor allocator is not created!");
     }
+
+    return frameAllocator_->Allocate(GetDescriptorLayout(layoutName));
+}
+
+std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet>
+DescriptorRegistry::AllocateTransientSet(const DescriptorLayoutHandle& layoutHandle) const
+{
+    const auto layout = GetDescriptorLayout(layoutHandle);
+    if (!frameAllocator_ || !layout) {
+        throw std::runtime_error("Failed to allocate transient descriptor set!");
+    }
+
+    return frameAllocator_->Allocate(layout);
 }
 
 DescriptorRegistry& DescriptorRegistry::CreateLayout(const std::string& layoutName,
-                                                  const std::vector<VkDescriptorSetLayoutBinding>& bindings)
+                                                  const std::vector<VkDescriptorSetLayoutBinding>& bindings,
+                                                  VkDescriptorSetLayoutCreateFlags flags)
 {
-    descriptorSetLayouts_[layoutName] = device_->CreateDescriptorSetLayout(bindings);
-    if (!descriptorSetLayouts_[layoutName]) {
+    // Without the extension the layout is a regular one, sets of it are allocated by the fallback path
+    if (!IsPushDescriptorSupported()) {
+        flags &= ~VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
+    }
+    if (!IsDescriptorBufferSupported()) {
+        flags &= ~VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+    }
+
+    const auto layout = device_->CreateDescriptorSetLayout(bindings, flags);
+    if (!layout) {
         throw std::runtime_error("Failed to add new descriptor set layout!");
     }
+    descriptorSetLayouts_.Add(layoutName, layout);
 
     return *this;
 }
 
+bool DescriptorRegistry::IsPushDescriptorSupported() const { return device_->GetPushDescriptorSetFunc() != nullptr; }
+
+bool DescriptorRegistry::IsDescriptorBufferSupported() const { return device_->IsDescriptorBufferEnabled(); }
+
+void DescriptorRegistry::PushDescriptorSet(const std::shared_ptr<vulkan_wrapper::VulkanCommandBuffer>& cmdBuffer,
+                                           const VkPipelineBindPoint pipelineBindPoint,
+                                           const std::shared_ptr<vulkan_wrapper::VulkanPipelineLayout>& pipelineLayout,
+                                           const std::uint32_t setIndex,
+                                           const DescriptorLayoutHandle& layoutHandle,
+                                           std::vector<VkWriteDescriptorSet> descriptorWrites) const
+{
+    if (cmdBuffer->PushDescriptorSet(pipelineBindPoint, pipelineLayout, setIndex, descriptorWrites)) {
+        return;
+    }
+
+    // Fallback: transient set of the current frame
+    const auto descriptorSet = AllocateTransientSet(layoutHandle);
+    for (auto& write: descriptorWrites) {
+        write.dstSet = descriptorSet->GetHandle();
+    }
+    device_->UpdateDescriptorSets(descriptorWrites);
+    cmdBuffer->BindDescriptorSets(pipelineBindPoint, pipelineLayout, setIndex, {descriptorSet});
+}
+
 DescriptorRegistry& DescriptorRegistry::CreateSet(const std::string& descriptorSetName, const std::string& layoutName)
 {
-    const auto descSets = descPool_->CreateDescriptorSets({descriptorSetLayouts_[layoutName]});
-    if (descSets.empty()) {
-        throw std::runtime_error("Failed to create descriptor sets!");
+    if (!descAllocator_) {
+        throw std::runtime_error("Descriptor pool is not created!");
     }
-    descriptorSets_[descriptorSetName] = descSets.front();
+    descriptorSets_.Add(descriptorSetName, descAllocator_->Allocate(GetDescriptorLayout(layoutName)));
 
     return *this;
 }
 
+std::shared_ptr<vulkan_wrapper::VulkanDescriptorUpdateTemplate>
+DescriptorRegistry::CreateUpdateTemplate(const DescriptorLayoutHandle& layoutHandle,
+                                         const std::vector<DescriptorTemplateEntry>& entries)
+{
+    const auto layout = GetDescriptorLayout(layoutHandle);
+    if (!layout) {
+        throw std::runtime_error("Descriptor set layout of the update template not found!");
+    }
+
+    if (const auto existingTemplate = GetUpdateTemplate(layoutHandle)) {
+        if (updateTemplates_[layoutHandle.Index].Entries != entries) {
+            throw std::runtime_error("Descriptor update template of the layout is already created with other entries!");
+        }
+        return existingTemplate;
+    }
+
+    std::vector<VkDescriptorUpdateTemplateEntry> templateEntries;
+    templateEntries.reserve(entries.size());
+    for (const auto& entry: entries) {
+        std::size_t stride = entry.Stride;
+        if (stride == 0) {
+            switch (entry.Type) {
+                case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                    stride = sizeof(VkBufferView);
+                    break;
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                    stride = sizeof(VkDescriptorBufferInfo);
+                    break;
+                default:
+                    stride = sizeof(VkDescriptorImageInfo);
+                    break;
+            }
+        }
+
+        VkDescriptorUpdateTemplateEntry templateEntry;
+        templateEntry.dstBinding = entry.BindingIndex;
+        templateEntry.dstArrayElement = entry.ArrayElement;
+        templateEntry.descriptorCount = entry.Count;
+        templateEntry.descriptorType = entry.Type;
+        templateEntry.offset = entry.Offset;
+        templateEntry.stride = stride;
+        templateEntries.push_back(templateEntry);
+    }
+
+    auto updateTemplate = device_->CreateDescriptorUpdateTemplate(layout, templateEntries);
+    if (!updateTemplate) {
+        throw std::runtime_error("Failed to create descriptor update template!");
+    }
+
+    if (updateTemplates_.size() <= layoutHandle.Index) {
+        updateTemplates_.resize(layoutHandle.Index + 1);
+    }
+    updateTemplates_[layoutHandle.Index] = {layoutHandle.Generation, entries, updateTemplate};
+
+    return updateTemplate;
+}
+
+std::shared_ptr<vulkan_wrapper::VulkanDescriptorUpdateTemplate>
+DescriptorRegistry::CreateUpdateTemplate(const std::string& layoutName,
+                                         const std::vector<DescriptorTemplateEntry>& entries)
+{
+    const auto layoutHandle = GetDescriptorLayoutHandle(layoutName);
+    if (!layoutHandle.IsValid()) {
+        throw std::runtime_error("Descriptor set layout not found: " + layoutName);
+    }
+
+    return CreateUpdateTemplate(layoutHandle, entries);
+}
+
+std::shared_ptr<vulkan_wrapper::VulkanDescriptorUpdateTemplate>
+DescriptorRegistry::GetUpdateTemplate(const DescriptorLayoutHandle& layoutHandle) const
+{
+    if (!descriptorSetLayouts_.Contains(layoutHandle) || layoutHandle.Index >= updateTemplates_.size()) {
+        return nullptr;
+    }
+
+    const auto& slot = updateTemplates_[layoutHandle.Index];
+    return slot.Generation == layoutHandle.Generation ? slot.Template : nullptr;
+}
+
+BindlessTextureTable& DescriptorRegistry::CreateBindlessTextureTable(const std::string& tableName,
+                                                                   const std::uint32_t maxTextureCount,
+                                                                   const VkShaderStageFlags stageFlags)
+{
+    auto table = std::make_unique<BindlessTextureTable>(device_, maxTextureCount, stageFlags);
+    descriptorSetLayouts_.Add(tableName, table->GetDescriptorLayout());
+    descriptorSets_.Add(tableName, table->GetDescriptorSet());
+
+    auto& tableRef = *table;
+    bindlessTables_.Add(tableName, std::move(table));
+
+    return tableRef;
+}
+
+DescriptorBuffer& DescriptorRegistry::CreateDescriptorBuffer(const std::string& bufferName,
+                                                             const VkDeviceSize sizePerFrame,
+                                                             const std::uint32_t frameCount,
+                                                             const VkBufferUsageFlags usageFlags)
+{
+    auto descriptorBuffer =
+            std::make_unique<DescriptorBuffer>(device_->GetParent(), device_, sizePerFrame, frameCount, usageFlags);
+
+    auto& descriptorBufferRef = *descriptorBuffer;
+    descriptorBuffers_.Add(bufferName, std::move(descriptorBuffer));
+
+    return descriptorBufferRef;
+}
+
+DescriptorBuffer& DescriptorRegistry::GetDescriptorBuffer(const std::string& bufferName) const
+{
+    auto* descriptorBuffer = GetDescriptorBuffer(descriptorBuffers_.Find(bufferName));
+    if (!descriptorBuffer) {
+        throw std::runtime_error("Descriptor buffer not found: " + bufferName);
+    }
+
+    return *descriptorBuffer;
+}
+
+DescriptorBuffer* DescriptorRegistry::GetDescriptorBuffer(const DescriptorBufferHandle& handle) const
+{
+    const auto* descriptorBuffer = descriptorBuffers_.Get(handle);
+    return descriptorBuffer ? descriptorBuffer->get() : nullptr;
+}
+
+BindlessTextureTable& DescriptorRegistry::GetBindlessTextureTable(const std::string& tableName) const
+{
+    auto* table = GetBindlessTextureTable(bindlessTables_.Find(tableName));
+    if (!table) {
+        throw std::runtime_error("Bindless texture table not found: " + tableName);
+    }
+
+    return *table;
+}
+
+BindlessTextureTable* DescriptorRegistry::GetBindlessTextureTable(const BindlessTableHandle& handle) const
+{
+    const auto* table = bindlessTables_.Get(handle);
+    return table ? table->get() : nullptr;
+}
+
+DescriptorBufferHandle DescriptorRegistry::GetDescriptorBufferHandle(const std::string& bufferName) const
+{
+    return descriptorBuffers_.Find(bufferName);
+}
+
+BindlessTableHandle DescriptorRegistry::GetBindlessTextureTableHandle(const std::string& tableName) const
+{
+    return bindlessTables_.Find(tableName);
+}
+
 std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout>
-DescriptorRegistry::GetDescriptorLayout(const std::string& layoutName)
+DescriptorRegistry::GetDescriptorLayout(const std::string& layoutName) const
+{
+    const auto* layout = descriptorSetLayouts_.Get(descriptorSetLayouts_.Find(layoutName));
+    if (!layout) {
+        throw std::runtime_error("Descriptor set layout not found: " + layoutName);
+    }
+
+    return *layout;
+}
+
+std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout>
+DescriptorRegistry::GetDescriptorLayout(const DescriptorLayoutHandle& handle) const
+{
+    const auto* layout = descriptorSetLayouts_.Get(handle);
+    return layout ? *layout : nullptr;
+}
+
+std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet>
+DescriptorRegistry::GetDescriptorSet(const std::string& setName) const
+{
+    const auto* descriptorSet = descriptorSets_.Get(descriptorSets_.Find(setName));
+    if (!descriptorSet) {
+        throw std::runtime_error("Descriptor set not found: " + setName);
+    }
+
+    return *descriptorSet;
+}
+
+std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet>
+DescriptorRegistry::GetDescriptorSet(const DescriptorSetHandle& handle) const
 {
-    return descriptorSetLayouts_.at(layoutName);
+    const auto* descriptorSet = descriptorSets_.Get(handle);
+    return descriptorSet ? *descriptorSet : nullptr;
 }
 
-std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet> DescriptorRegistry::GetDescriptorSet(const std::string& setName)
+DescriptorLayoutHandle DescriptorRegistry::GetDescriptorLayoutHandle(const std::string& layoutName) const
 {
-    return descriptorSets_.at(setName);
+    return descriptorSetLayouts_.Find(layoutName);
 }
 
-void DescriptorRegistry::DeleteDescriptorLayout(const std::string& layoutName) { descriptorSetLayouts_.erase(layoutName); }
+DescriptorSetHandle DescriptorRegistry::GetDescriptorSetHandle(const std::string& setName) const
+{
+    return descriptorSets_.Find(setName);
+}
+
+void DescriptorRegistry::DeleteDescriptorLayout(const std::string& layoutName)
+{
+    if (const auto layoutHandle = GetDescriptorLayoutHandle(layoutName); layoutHandle.Index < updateTemplates_.size()) {
+        updateTemplates_[layoutHandle.Index] = {};
+    }
+    descriptorSetLayouts_.Remove(layoutName);
+}
 
-void DescriptorRegistry::DeleteDescriptorSet(const std::string& setName) { descriptorSets_.erase(setName); }
+void DescriptorRegistry::DeleteDescriptorSet(const std::string& setName) { descriptorSets_.Remove(setName); }
 } // namespace common::vulkan_framework
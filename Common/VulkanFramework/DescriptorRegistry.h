@@ -10,12 +10,18 @@
  */
 #pragma once
 
-#include <map>
-
+#include "BindlessTextureTable.h"
 #include "CoreDefines.h"
+#include "DescriptorAllocator.h"
+#include "DescriptorBuffer.h"
+#include "HandleRegistry.h"
+#include "ResourceHandles.h"
+#include "VulkanCommandBuffer.h"
 #include "VulkanDescriptorPool.h"
 #include "VulkanDescriptorSet.h"
+#include "VulkanDescriptorUpdateTemplate.h"
 #include "VulkanDevice.h"
+#include "VulkanPipelineLayout.h"
 
 namespace common::vulkan_framework
 {
@@ -26,6 +32,7 @@ struct COMMON_API DescriptorResourceCreateInfo
     {
         std::string Name;
         std::vector<VkDescriptorSetLayoutBinding> Bindings;
+        VkDescriptorSetLayoutCreateFlags Flags = 0;
     };
 
     struct DescriptorSet
@@ -40,6 +47,22 @@ struct COMMON_API DescriptorResourceCreateInfo
     std::vector<DescriptorSet> DescriptorSets;
 };
 
+/**
+ * @brief One entry of a descriptor update template. Offset is the byte offset of the first descriptor info in the
+ * packed data struct (e.g. offsetof(MaterialDescriptors, AlbedoTexture)).
+ */
+struct COMMON_API DescriptorTemplateEntry
+{
+    std::uint32_t BindingIndex;
+    VkDescriptorType Type;
+    std::size_t Offset;
+    std::uint32_t Count = 1;
+    std::uint32_t ArrayElement = 0;
+    std::size_t Stride = 0; // 0 means tightly packed infos of the descriptor type
+
+    bool operator==(const DescriptorTemplateEntry&) const = default;
+};
+
 class COMMON_API DescriptorRegistry
 {
 public:
@@ -55,23 +78,90 @@ public:
     void CreateDescriptors(const DescriptorResourceCreateInfo& createInfo);
 
     /**
-     * @brief Creates a descriptor pool with the specified settings.
-     * @param maxSets Specifies the maximum number of descriptor sets that can be taken from the pool.
+     * @brief Creates a growable descriptor allocator with the specified settings. Given values are used for the first
+     * pool, when it is exhausted new pools are chained with the same descriptor ratios.
+     * @param maxSets Specifies the maximum number of descriptor sets that can be taken from the first pool.
      * @param poolSizes It is a vector that specifies how many of each type of descriptor set can be created.
-     * @param flags Specifies the creation flags of the descriptor pool.
+     * @param flags Specifies the creation flags of the descriptor pools.
      */
     void CreatePool(std::uint32_t maxSets,
                     const std::vector<VkDescriptorPoolSize>& poolSizes,
                     const VkDescriptorPoolCreateFlags& flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT);
 
+    /**
+     * @brief Creates a per-frame linear allocator for transient descriptor sets.
+     * @param frameCount Number of frames in flight.
+     * @param initialSetsPerPool Maximum set count of the first pool of every frame.
+     * @param poolSizeRatios Descriptor counts per set of every descriptor type.
+     */
+    void CreateFrameAllocator(std::uint32_t frameCount,
+                              std::uint32_t initialSetsPerPool,
+                              const std::vector<DescriptorPoolSizeRatio>& poolSizeRatios);
+
+    /**
+     * @brief Recycles transient descriptor sets of the frame. It must be called after the fence of the frame is waited.
+     * @param frameIndex Index of the frame in flight.
+     */
+    void BeginFrame(std::uint32_t frameIndex) const;
+
+    /**
+     * @brief Allocates a transient descriptor set that is valid until the same frame index begins again. Transient
+     * sets are not added to the registry.
+     * @param layoutName Name of the layout that associated with the descriptor set.
+     * @return Returns the allocated descriptor set.
+     */
+    std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet> AllocateTransientSet(const std::string& layoutName) const;
+
+    /**
+     * @brief Allocates a transient descriptor set that is valid until the same frame index begins again.
+     * @param layoutHandle Handle of the layout that associated with the descriptor set.
+     * @return Returns the allocated descriptor set.
+     */
+    std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet>
+    AllocateTransientSet(const DescriptorLayoutHandle& layoutHandle) const;
+
     /**
      * @brief Creates a descriptor set layout and add to registry map.
      * @param layoutName Specifies the layout name that will be used as the key name later.
      * @param bindings Specifies descriptor set layout bindings.
+     * @param flags Specifies the creation flags of the layout. PUSH_DESCRIPTOR flag is dropped if the device doesn't
+     * enable VK_KHR_push_descriptor, so the same layout can be used with the fallback path of PushDescriptorSet.
+     * DESCRIPTOR_BUFFER flag is dropped in the same way without VK_EXT_descriptor_buffer.
      * @return Returns a reference to this object so that the function can be called repeatedly.
      */
     DescriptorRegistry& CreateLayout(const std::string& layoutName,
-                                     const std::vector<VkDescriptorSetLayoutBinding>& bindings);
+                                     const std::vector<VkDescriptorSetLayoutBinding>& bindings,
+                                     VkDescriptorSetLayoutCreateFlags flags = 0);
+
+    /**
+     * @brief Returns whether descriptors can be pushed directly into command buffers.
+     * @return Returns true if VK_KHR_push_descriptor is enabled on the device.
+     */
+    [[nodiscard]] bool IsPushDescriptorSupported() const;
+
+    /**
+     * @brief Returns whether descriptors can be placed into descriptor buffers.
+     * @return Returns true if VK_EXT_descriptor_buffer is enabled on the device.
+     */
+    [[nodiscard]] bool IsDescriptorBufferSupported() const;
+
+    /**
+     * @brief Binds per-draw descriptors without a persistent descriptor set. With VK_KHR_push_descriptor the writes
+     * are recorded into the command buffer, otherwise a transient set is allocated from the frame allocator, written
+     * and bound. dstSet members of the writes are ignored.
+     * @param cmdBuffer Command buffer that is being recorded.
+     * @param pipelineBindPoint Bind point of the pipeline.
+     * @param pipelineLayout Pipeline layout that is created with the push descriptor layout.
+     * @param setIndex Set number of the layout in the pipeline layout.
+     * @param layoutHandle Handle of the layout that is created with PUSH_DESCRIPTOR flag.
+     * @param descriptorWrites Descriptor writes of the bindings.
+     */
+    void PushDescriptorSet(const std::shared_ptr<vulkan_wrapper::VulkanCommandBuffer>& cmdBuffer,
+                           VkPipelineBindPoint pipelineBindPoint,
+                           const std::shared_ptr<vulkan_wrapper::VulkanPipelineLayout>& pipelineLayout,
+                           std::uint32_t setIndex,
+                           const DescriptorLayoutHandle& layoutHandle,
+                           std::vector<VkWriteDescriptorSet> descriptorWrites) const;
 
     /**
      * @brief Creates a descriptor set and add to registry map.
@@ -81,19 +171,146 @@ public:
      */
     DescriptorRegistry& CreateSet(const std::string& descriptorSetName, const std::string& layoutName);
 
+    /**
+     * @brief Creates a descriptor update template for the layout. The template is built once per layout, later calls
+     * with the same entries return the existing template and calls with different entries throw an exception.
+     * @param layoutHandle Handle of the descriptor set layout.
+     * @param entries Bindings that are written by the template and their places in the packed data struct.
+     * @return Returns the descriptor update template.
+     */
+    std::shared_ptr<vulkan_wrapper::VulkanDescriptorUpdateTemplate>
+    CreateUpdateTemplate(const DescriptorLayoutHandle& layoutHandle,
+                         const std::vector<DescriptorTemplateEntry>& entries);
+
+    /**
+     * @brief Creates a descriptor update template for the layout (name is only resolved once here).
+     * @param layoutName Name of the descriptor set layout.
+     * @param entries Bindings that are written by the template and their places in the packed data struct.
+     * @return Returns the descriptor update template.
+     */
+    std::shared_ptr<vulkan_wrapper::VulkanDescriptorUpdateTemplate>
+    CreateUpdateTemplate(const std::string& layoutName, const std::vector<DescriptorTemplateEntry>& entries);
+
+    /**
+     * @brief Gets the descriptor update template of the layout.
+     * @param layoutHandle Handle of the descriptor set layout.
+     * @return Returns the descriptor update template, if the handle is stale or the layout has no template it returns
+     * nullptr.
+     */
+    std::shared_ptr<vulkan_wrapper::VulkanDescriptorUpdateTemplate>
+    GetUpdateTemplate(const DescriptorLayoutHandle& layoutHandle) const;
+
+    /**
+     * @brief Creates a bindless texture table with its own update after bind pool. Layout and set of the table are also
+     * added to registry with the table name, so they can be taken with GetDescriptorLayout and GetDescriptorSet.
+     * @param tableName Name of the table.
+     * @param maxTextureCount Size of the texture array.
+     * @param stageFlags Shader stages that access to the texture array.
+     * @return Returns the created table.
+     */
+    BindlessTextureTable& CreateBindlessTextureTable(const std::string& tableName,
+                                                     std::uint32_t maxTextureCount,
+                                                     VkShaderStageFlags stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT);
+
+    /**
+     * @brief Creates a descriptor buffer backend. It coexists with the pool path, layouts that are created with
+     * DESCRIPTOR_BUFFER flag are used with the descriptor buffer and the others with descriptor sets.
+     * @param bufferName Name of the descriptor buffer.
+     * @param sizePerFrame Size of the region of every frame in bytes.
+     * @param frameCount Number of frames in flight (1 for persistent sets).
+     * @param usageFlags Descriptor buffer usage flags.
+     * @return Returns the created descriptor buffer.
+     */
+    DescriptorBuffer& CreateDescriptorBuffer(
+            const std::string& bufferName,
+            VkDeviceSize sizePerFrame,
+            std::uint32_t frameCount = 1,
+            VkBufferUsageFlags usageFlags = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT);
+
+    /**
+     * @brief Gets specified descriptor buffer.
+     * @param bufferName Name of the descriptor buffer.
+     * @return Returns the descriptor buffer.
+     */
+    DescriptorBuffer& GetDescriptorBuffer(const std::string& bufferName) const;
+
+    /**
+     * @brief Gets descriptor buffer of the handle.
+     * @param handle Handle of the descriptor buffer.
+     * @return Returns the descriptor buffer, if the handle is stale it returns nullptr.
+     */
+    [[nodiscard]] DescriptorBuffer* GetDescriptorBuffer(const DescriptorBufferHandle& handle) const;
+
+    /**
+     * @brief Gets specified bindless texture table.
+     * @param tableName Name of the table.
+     * @return Returns the bindless texture table.
+     */
+    BindlessTextureTable& GetBindlessTextureTable(const std::string& tableName) const;
+
+    /**
+     * @brief Gets bindless texture table of the handle.
+     * @param handle Handle of the table.
+     * @return Returns the bindless texture table, if the handle is stale it returns nullptr.
+     */
+    [[nodiscard]] BindlessTextureTable* GetBindlessTextureTable(const BindlessTableHandle& handle) const;
+
+    /**
+     * @brief Returns handle of the descriptor buffer.
+     * @param bufferName Name of the descriptor buffer.
+     * @return Returns handle of the descriptor buffer, if the buffer is not found it returns an invalid handle.
+     */
+    [[nodiscard]] DescriptorBufferHandle GetDescriptorBufferHandle(const std::string& bufferName) const;
+
+    /**
+     * @brief Returns handle of the bindless texture table.
+     * @param tableName Name of the table.
+     * @return Returns handle of the table, if the table is not found it returns an invalid handle.
+     */
+    [[nodiscard]] BindlessTableHandle GetBindlessTextureTableHandle(const std::string& tableName) const;
+
     /**
      * @brief Gets specified descriptor set layout.
      * @param layoutName Specifies the layout name to be taken.
      * @return Returns descriptor set layout.
      */
-    std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout> GetDescriptorLayout(const std::string& layoutName);
+    std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout> GetDescriptorLayout(const std::string& layoutName) const;
+
+    /**
+     * @brief Gets specified descriptor set layout.
+     * @param handle Handle of the layout.
+     * @return Returns descriptor set layout, if the handle is stale it returns nullptr.
+     */
+    std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout>
+    GetDescriptorLayout(const DescriptorLayoutHandle& handle) const;
 
     /**
      * @brief Gets specified descriptor set.
      * @param setName Specifies the descriptor set name to be taken.
      * @return Returns descriptor set.
      */
-    std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet> GetDescriptorSet(const std::string& setName);
+    std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet> GetDescriptorSet(const std::string& setName) const;
+
+    /**
+     * @brief Gets specified descriptor set.
+     * @param handle Handle of the descriptor set.
+     * @return Returns descriptor set, if the handle is stale it returns nullptr.
+     */
+    std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet> GetDescriptorSet(const DescriptorSetHandle& handle) const;
+
+    /**
+     * @brief Gets handle of the descriptor set layout.
+     * @param layoutName Name of the descriptor set layout.
+     * @return Returns handle of the layout, if it is not found it returns an invalid handle.
+     */
+    [[nodiscard]] DescriptorLayoutHandle GetDescriptorLayoutHandle(const std::string& layoutName) const;
+
+    /**
+     * @brief Gets handle of the descriptor set.
+     * @param setName Name of the descriptor set.
+     * @return Returns handle of the descriptor set, if it is not found it returns an invalid handle.
+     */
+    [[nodiscard]] DescriptorSetHandle GetDescriptorSetHandle(const std::string& setName) const;
 
     /**
      * @brief Deletes a descriptor set layout.
@@ -110,8 +327,21 @@ public:
 
 private:
     std::shared_ptr<vulkan_wrapper::VulkanDevice> device_;
-    std::shared_ptr<vulkan_wrapper::VulkanDescriptorPool> descPool_;
-    std::map<std::string, std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout>> descriptorSetLayouts_;
-    std::map<std::string, std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet>> descriptorSets_;
+    std::unique_ptr<DescriptorAllocator> descAllocator_;
+    std::unique_ptr<FrameDescriptorAllocator> frameAllocator_;
+    utility::HandleRegistry<DescriptorLayoutHandle, std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout>>
+            descriptorSetLayouts_;
+    utility::HandleRegistry<DescriptorSetHandle, std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet>> descriptorSets_;
+    utility::HandleRegistry<BindlessTableHandle, std::unique_ptr<BindlessTextureTable>> bindlessTables_;
+    utility::HandleRegistry<DescriptorBufferHandle, std::unique_ptr<DescriptorBuffer>> descriptorBuffers_;
+
+    // Update templates are indexed with the layout handle index, generation detects templates of deleted layouts
+    struct UpdateTemplateSlot
+    {
+        std::uint32_t Generation = 0;
+        std::vector<DescriptorTemplateEntry> Entries;
+        std::shared_ptr<vulkan_wrapper::VulkanDescriptorUpdateTemplate> Template;
+    };
+    std::vector<UpdateTemplateSlot> updateTemplates_;
 };
 } // namespace common::vulkan_framework
@@ -0,0 +1,236 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "DescriptorSetCache.h"
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+namespace common::vulkan_framework
+{
+namespace
+{
+    template<typename T>
+    void HashCombine(std::size_t& seed, const T& value)
+    {
+        seed ^= std::hash<T>{}(value) + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+    }
+
+    bool IsSameBinding(const DescriptorSetBinding& lhs, const DescriptorSetBinding& rhs)
+    {
+        if (lhs.BindingIndex != rhs.BindingIndex || lhs.Type != rhs.Type || lhs.Buffers.size() != rhs.Buffers.size() ||
+            lhs.Images.size() != rhs.Images.size() || lhs.TexelBufferViews != rhs.TexelBufferViews) {
+            return false;
+        }
+
+        const auto isSameBuffer = [](const VkDescriptorBufferInfo& a, const VkDescriptorBufferInfo& b) {
+            return a.buffer == b.buffer && a.offset == b.offset && a.range == b.range;
+        };
+        const auto isSameImage = [](const VkDescriptorImageInfo& a, const VkDescriptorImageInfo& b) {
+            return a.sampler == b.sampler && a.imageView == b.imageView && a.imageLayout == b.imageLayout;
+        };
+
+        return std::equal(lhs.Buffers.begin(), lhs.Buffers.end(), rhs.Buffers.begin(), isSameBuffer) &&
+               std::equal(lhs.Images.begin(), lhs.Images.end(), rhs.Images.begin(), isSameImage);
+    }
+} // namespace
+
+bool DescriptorSetKey::operator==(const DescriptorSetKey& other) const
+{
+    return Layout == other.Layout && Bindings.size() == other.Bindings.size() &&
+           std::equal(Bindings.begin(), Bindings.end(), other.Bindings.begin(), IsSameBinding);
+}
+
+std::size_t DescriptorSetKeyHash::operator()(const DescriptorSetKey& key) const
+{
+    std::size_t seed = 0;
+    HashCombine(seed, key.Layout);
+    for (const auto& binding: key.Bindings) {
+        HashCombine(seed, binding.BindingIndex);
+        HashCombine(seed, static_cast<std::uint32_t>(binding.Type));
+        for (const auto& bufferInfo: binding.Buffers) {
+            HashCombine(seed, bufferInfo.buffer);
+            HashCombine(seed, bufferInfo.offset);
+            HashCombine(seed, bufferInfo.range);
+        }
+        for (const auto& imageInfo: binding.Images) {
+            HashCombine(seed, imageInfo.sampler);
+            HashCombine(seed, imageInfo.imageView);
+            HashCombine(seed, static_cast<std::uint32_t>(imageInfo.imageLayout));
+        }
+        for (const auto& bufferView: binding.TexelBufferViews) {
+            HashCombine(seed, bufferView);
+        }
+    }
+
+    return seed;
+}
+
+DescriptorSetCache::DescriptorSetCache(const std::shared_ptr<vulkan_wrapper::VulkanDevice>& device,
+                                       const std::uint32_t maxCachedSets,
+                                       const std::uint32_t framesInFlight,
+                                       const std::vector<DescriptorPoolSizeRatio>& poolSizeRatios)
+    : device_{device}, allocator_{device, std::max(maxCachedSets, 1u), poolSizeRatios},
+      maxCachedSets_{std::max(maxCachedSets, 1u)}, framesInFlight_{framesInFlight}
+{
+}
+
+std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet>
+DescriptorSetCache::GetOrCreate(const std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout>& layout,
+                                const std::vector<DescriptorSetBinding>& bindings)
+{
+    DescriptorSetKey key{layout->GetHandle(), bindings};
+
+    if (const auto it = entries_.find(key); it != entries_.end()) {
+        ++hitCount_;
+        it->second->LastUsedFrame = currentFrame_;
+        lruList_.splice(lruList_.begin(), lruList_, it->second);
+        return it->second->DescriptorSet;
+    }
+
+    ++missCount_;
+    for (const auto& binding: key.Bindings) {
+        if (binding.Buffers.empty() && binding.Images.empty() && binding.TexelBufferViews.empty()) {
+            throw std::runtime_error("Descriptor set binding without any resource can't be cached!");
+        }
+    }
+
+    if (entries_.size() >= maxCachedSets_) {
+        Evict(std::prev(lruList_.end()));
+    }
+
+    // Recycled sets are preferred, new sets are only allocated when there isn't any safe set of the layout
+    std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet> descriptorSet;
+    if (auto& freeSets = freeSets_[key.Layout]; !freeSets.empty()) {
+        descriptorSet = freeSets.back();
+        freeSets.pop_back();
+    } else {
+        descriptorSet = allocator_.Allocate(layout);
+    }
+
+    lruList_.push_front({std::move(key), descriptorSet, currentFrame_});
+    entries_.emplace(lruList_.front().Key, lruList_.begin());
+    WriteDescriptorSet(lruList_.front());
+
+    return descriptorSet;
+}
+
+void DescriptorSetCache::BeginFrame()
+{
+    ++currentFrame_;
+
+    const auto isSafe = [this](const RetiredSet& retiredSet) {
+        return retiredSet.LastUsedFrame + framesInFlight_ <= currentFrame_;
+    };
+    for (const auto& retiredSet: retiredSets_) {
+        if (isSafe(retiredSet)) {
+            freeSets_[retiredSet.Layout].push_back(retiredSet.DescriptorSet);
+        }
+    }
+    std::erase_if(retiredSets_, isSafe);
+}
+
+void DescriptorSetCache::Clear()
+{
+    while (!lruList_.empty()) {
+        Evict(std::prev(lruList_.end()));
+    }
+}
+
+template<typename Predicate>
+void DescriptorSetCache::EvictIf(Predicate predicate)
+{
+    for (auto it = lruList_.begin(); it != lruList_.end();) {
+        const auto entryIt = it++;
+        if (std::ranges::any_of(entryIt->Key.Bindings, predicate)) {
+            Evict(entryIt);
+        }
+    }
+}
+
+void DescriptorSetCache::InvalidateBuffer(const VkBuffer buffer)
+{
+    EvictIf([buffer](const DescriptorSetBinding& binding) {
+        return std::ranges::any_of(binding.Buffers,
+                                   [buffer](const VkDescriptorBufferInfo& info) { return info.buffer == buffer; });
+    });
+}
+
+void DescriptorSetCache::InvalidateImageView(const VkImageView imageView)
+{
+    EvictIf([imageView](const DescriptorSetBinding& binding) {
+        return std::ranges::any_of(binding.Images, [imageView](const VkDescriptorImageInfo& info) {
+            return info.imageView == imageView;
+        });
+    });
+}
+
+void DescriptorSetCache::InvalidateSampler(const VkSampler sampler)
+{
+    EvictIf([sampler](const DescriptorSetBinding& binding) {
+        return std::ranges::any_of(binding.Images,
+                                   [sampler](const VkDescriptorImageInfo& info) { return info.sampler == sampler; });
+    });
+}
+
+void DescriptorSetCache::InvalidateLayout(const VkDescriptorSetLayout layout)
+{
+    for (auto it = lruList_.begin(); it != lruList_.end();) {
+        const auto entryIt = it++;
+        if (entryIt->Key.Layout == layout) {
+            Evict(entryIt);
+        }
+    }
+
+    // Sets of the layout are never requested again, so they are not recycled
+    std::erase_if(retiredSets_, [layout](const RetiredSet& retiredSet) { return retiredSet.Layout == layout; });
+    freeSets_.erase(layout);
+}
+
+void DescriptorSetCache::ResetStatistics()
+{
+    hitCount_ = 0;
+    missCount_ = 0;
+    evictionCount_ = 0;
+}
+
+void DescriptorSetCache::Evict(const std::list<CacheEntry>::iterator entryIt)
+{
+    // The set may still be used by a frame in flight, so it is only rewritten after that frame is finished
+    retiredSets_.push_back({entryIt->Key.Layout, entryIt->DescriptorSet, entryIt->LastUsedFrame});
+    entries_.erase(entryIt->Key);
+    lruList_.erase(entryIt);
+    ++evictionCount_;
+}
+
+void DescriptorSetCache::WriteDescriptorSet(const CacheEntry& entry) const
+{
+    std::vector<VkWriteDescriptorSet> writes;
+    writes.reserve(entry.Key.Bindings.size());
+    for (const auto& binding: entry.Key.Bindings) {
+        VkWriteDescriptorSet write{};
+        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstSet = entry.DescriptorSet->GetHandle();
+        write.dstBinding = binding.BindingIndex;
+        write.dstArrayElement = 0;
+        write.descriptorType = binding.Type;
+        if (!binding.Buffers.empty()) {
+            write.descriptorCount = static_cast<std::uint32_t>(binding.Buffers.size());
+            write.pBufferInfo = binding.Buffers.data();
+        } else if (!binding.Images.empty()) {
+            write.descriptorCount = static_cast<std::uint32_t>(binding.Images.size());
+            write.pImageInfo = binding.Images.data();
+        } else {
+            write.descriptorCount = static_cast<std::uint32_t>(binding.TexelBufferViews.size());
+            write.pTexelBufferView = binding.TexelBufferViews.data();
+        }
+        writes.push_back(write);
+    }
+
+    device_->UpdateDescriptorSets(writes);
+}
+} // namespace common::vulkan_framework
@@ -0,0 +1,193 @@
+/**
+ * @file    DescriptorSetCache.h
+ * @brief   This file contains a descriptor set cache that returns the same descriptor set for the same layout and bound
+ *          resources. Least recently used sets are evicted and recycled after the frames in flight finish using them.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <vulkan/vulkan_core.h>
+
+#include "CoreDefines.h"
+#include "DescriptorAllocator.h"
+#include "VulkanDescriptorSet.h"
+#include "VulkanDescriptorSetLayout.h"
+#include "VulkanDevice.h"
+
+namespace common::vulkan_framework
+{
+/**
+ * @brief Resources that are bound to one binding of a descriptor set. Only the info vector that matches the descriptor
+ * type is used.
+ */
+struct COMMON_API DescriptorSetBinding
+{
+    std::uint32_t BindingIndex;
+    VkDescriptorType Type;
+    std::vector<VkDescriptorBufferInfo> Buffers;
+    std::vector<VkDescriptorImageInfo> Images;
+    std::vector<VkBufferView> TexelBufferViews;
+};
+
+/**
+ * @brief Identity of a cached descriptor set: layout and all bound buffers (with ranges), image views, samplers and
+ * texel buffer views.
+ */
+struct COMMON_API DescriptorSetKey
+{
+    VkDescriptorSetLayout Layout = VK_NULL_HANDLE;
+    std::vector<DescriptorSetBinding> Bindings;
+
+    bool operator==(const DescriptorSetKey& other) const;
+};
+
+struct COMMON_API DescriptorSetKeyHash
+{
+    std::size_t operator()(const DescriptorSetKey& key) const;
+};
+
+class COMMON_API DescriptorSetCache
+{
+public:
+    /**
+     * @param device Refers VulkanDevice object.
+     * @param maxCachedSets Maximum number of sets that are kept in the cache before least recently used ones are
+     * evicted.
+     * @param framesInFlight Number of frames that GPU can use a set after it is returned. Evicted sets are not
+     * rewritten before these frames are finished.
+     * @param poolSizeRatios Descriptor counts per set of every descriptor type.
+     */
+    DescriptorSetCache(const std::shared_ptr<vulkan_wrapper::VulkanDevice>& device,
+                       std::uint32_t maxCachedSets,
+                       std::uint32_t framesInFlight,
+                       const std::vector<DescriptorPoolSizeRatio>& poolSizeRatios);
+
+    /**
+     * @brief Returns the descriptor set that binds given resources. On a miss, a recycled or a new set is written with
+     * the resources. Returned set is only guaranteed to stay same until the next BeginFrame call, so it should be
+     * requested again every frame (which is a cheap hit).
+     * @param layout Layout of the descriptor set.
+     * @param bindings Bound resources of every binding.
+     * @return Returns the descriptor set.
+     */
+    std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet>
+    GetOrCreate(const std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout>& layout,
+                const std::vector<DescriptorSetBinding>& bindings);
+
+    /**
+     * @brief Starts a new frame. Evicted sets that are not used by the frames in flight anymore become available for
+     * recycling. It must be called after the fence of the frame is waited.
+     */
+    void BeginFrame();
+
+    /**
+     * @brief Removes all entries. Sets are recycled with the same frame-safe rule of evicted sets.
+     */
+    void Clear();
+
+    /**
+     * @brief Evicts the sets that bind the buffer. Keys hold raw handles, so it must be called before the buffer is
+     * destroyed, otherwise a new buffer with the same handle value would hit a stale set.
+     * @param buffer Buffer that is going to be destroyed.
+     */
+    void InvalidateBuffer(VkBuffer buffer);
+
+    /**
+     * @brief Evicts the sets that bind the image view. It must be called before the image view is destroyed.
+     * @param imageView Image view that is going to be destroyed.
+     */
+    void InvalidateImageView(VkImageView imageView);
+
+    /**
+     * @brief Evicts the sets that bind the sampler. It must be called before the sampler is destroyed.
+     * @param sampler Sampler that is going to be destroyed.
+     */
+    void InvalidateSampler(VkSampler sampler);
+
+    /**
+     * @brief Evicts the sets of the layout and drops its recycled sets. It must be called before the layout is
+     * destroyed, so a new layout with the same handle value never gets a set of the old layout.
+     * @param layout Descriptor set layout that is going to be destroyed.
+     */
+    void InvalidateLayout(VkDescriptorSetLayout layout);
+
+    /**
+     * @brief Returns number of the requests that found an existing set.
+     * @return Returns hit count.
+     */
+    [[nodiscard]] std::uint64_t GetHitCount() const { return hitCount_; }
+
+    /**
+     * @brief Returns number of the requests that wrote a set.
+     * @return Returns miss count.
+     */
+    [[nodiscard]] std::uint64_t GetMissCount() const { return missCount_; }
+
+    /**
+     * @brief Returns number of the evicted entries.
+     * @return Returns eviction count.
+     */
+    [[nodiscard]] std::uint64_t GetEvictionCount() const { return evictionCount_; }
+
+    /**
+     * @brief Returns number of the sets that are currently in the cache.
+     * @return Returns cached set count.
+     */
+    [[nodiscard]] std::size_t GetCachedSetCount() const { return entries_.size(); }
+
+    /**
+     * @brief Sets hit, miss and eviction counters to zero.
+     */
+    void ResetStatistics();
+
+private:
+    struct CacheEntry
+    {
+        DescriptorSetKey Key;
+        std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet> DescriptorSet;
+        std::uint64_t LastUsedFrame = 0;
+    };
+
+    struct RetiredSet
+    {
+        VkDescriptorSetLayout Layout = VK_NULL_HANDLE;
+        std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet> DescriptorSet;
+        std::uint64_t LastUsedFrame = 0;
+    };
+
+    void Evict(std::list<CacheEntry>::iterator entryIt);
+
+    template<typename Predicate>
+    void EvictIf(Predicate predicate);
+
+    void WriteDescriptorSet(const CacheEntry& entry) const;
+
+    std::shared_ptr<vulkan_wrapper::VulkanDevice> device_;
+    DescriptorAllocator allocator_;
+    std::uint32_t maxCachedSets_ = 0;
+    std::uint32_t framesInFlight_ = 0;
+    std::uint64_t currentFrame_ = 0;
+
+    // Front of the list is the most recently used entry
+    std::list<CacheEntry> lruList_;
+    std::unordered_map<DescriptorSetKey, std::list<CacheEntry>::iterator, DescriptorSetKeyHash> entries_;
+    std::vector<RetiredSet> retiredSets_;
+    std::unordered_map<VkDescriptorSetLayout, std::vector<std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet>>>
+            freeSets_;
+
+    std::uint64_t hitCount_ = 0;
+    std::uint64_t missCount_ = 0;
+    std::uint64_t evictionCount_ = 0;
+};
+} // namespace common::vulkan_framework
@@ -10,6 +10,9 @@
  */
 #pragma once
 
+#include <stdexcept>
+#include <type_traits>
+
 #include "CoreDefines.h"
 #include "DescriptorRegistry.h"
 
@@ -95,6 +98,44 @@ public:
      */
     void ApplyUpdates();
 
+    /**
+     * @brief Writes the descriptor set from a packed descriptor info struct with the update template of the layout.
+     * Unlike the queued requests, it is applied immediately with a single call.
+     * @tparam T Type of the packed struct that matches the template entries.
+     * @param setHandle Handle of the descriptor set.
+     * @param layoutHandle Handle of the layout that the update template is created for.
+     * @param data Packed descriptor infos.
+     */
+    template<typename T>
+    void ApplyTemplateUpdate(const DescriptorSetHandle& setHandle,
+                             const DescriptorLayoutHandle& layoutHandle,
+                             const T& data) const
+    {
+        const auto descriptorSet = registry_.GetDescriptorSet(setHandle);
+        const auto updateTemplate = registry_.GetUpdateTemplate(layoutHandle);
+        if (!descriptorSet || !updateTemplate) {
+            throw std::runtime_error("Failed to find descriptor set or update template of the template update!");
+        }
+        ApplyTemplateUpdate(descriptorSet, updateTemplate, data);
+    }
+
+    /**
+     * @brief Writes the descriptor set from a packed descriptor info struct without any registry lookup. It is the
+     * preferred version for sets that are refreshed frequently.
+     * @tparam T Type of the packed struct that matches the template entries.
+     * @param descriptorSet Descriptor set that is created with the layout of the template.
+     * @param updateTemplate Update template of the layout.
+     * @param data Packed descriptor infos.
+     */
+    template<typename T>
+    void ApplyTemplateUpdate(const std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet>& descriptorSet,
+                             const std::shared_ptr<vulkan_wrapper::VulkanDescriptorUpdateTemplate>& updateTemplate,
+                             const T& data) const
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Template data must be a trivially copyable struct!");
+        updateTemplate->UpdateDescriptorSet(descriptorSet, &data);
+    }
+
 private:
     std::shared_ptr<vulkan_wrapper::VulkanDevice> device_;
     DescriptorRegistry& registry_;
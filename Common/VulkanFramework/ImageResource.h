@@ -114,6 +114,16 @@ public:
      */
     [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanImageView> GetImageView(const std::string& viewName) const;
 
+    /**
+     * @brief Returns all image views of the image with their names.
+     * @return Returns image views.
+     */
+    [[nodiscard]] const std::unordered_map<std::string, std::shared_ptr<vulkan_wrapper::VulkanImageView>>&
+    GetImageViews() const
+    {
+        return imageViews_;
+    }
+
 private:
     void AllocateImageMemory();
 
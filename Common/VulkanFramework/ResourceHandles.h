@@ -0,0 +1,34 @@
+/**
+ * @file    ResourceHandles.h
+ * @brief   Typed generational handles of the framework resources.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include "HandleRegistry.h"
+
+namespace common::vulkan_framework
+{
+struct BufferHandleTag;
+struct ImageHandleTag;
+struct SamplerHandleTag;
+struct ShaderModuleHandleTag;
+struct DescriptorLayoutHandleTag;
+struct DescriptorSetHandleTag;
+struct BindlessTableHandleTag;
+struct DescriptorBufferHandleTag;
+
+using BufferHandle = utility::Handle<BufferHandleTag>;
+using ImageHandle = utility::Handle<ImageHandleTag>;
+using SamplerHandle = utility::Handle<SamplerHandleTag>;
+using ShaderModuleHandle = utility::Handle<ShaderModuleHandleTag>;
+using DescriptorLayoutHandle = utility::Handle<DescriptorLayoutHandleTag>;
+using DescriptorSetHandle = utility::Handle<DescriptorSetHandleTag>;
+using BindlessTableHandle = utility::Handle<BindlessTableHandleTag>;
+using DescriptorBufferHandle = utility::Handle<DescriptorBufferHandleTag>;
+} // namespace common::vulkan_framework
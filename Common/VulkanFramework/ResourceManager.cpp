@@ -6,50 +6,195 @@
 
 #include "ResourceManager.h"
 
+#include <ranges>
+
 namespace common::vulkan_framework
 {
+namespace
+{
+    template<typename HandleType, typename ResourceType>
+    ResourceType& GetResourceByName(const utility::HandleRegistry<HandleType, std::unique_ptr<ResourceType>>& registry,
+                                    const std::string& name,
+                                    const std::string& resourceTypeName)
+    {
+        const auto* resource = registry.Get(registry.Find(name));
+        if (!resource) {
+            throw std::runtime_error(resourceTypeName + " resource not found: " + name);
+        }
+
+        return **resource;
+    }
+
+    template<typename HandleType, typename ResourceType>
+    ResourceType*
+    GetResourceByHandle(const utility::HandleRegistry<HandleType, std::unique_ptr<ResourceType>>& registry,
+                        const HandleType& handle)
+    {
+        const auto* resource = registry.Get(handle);
+        return resource ? resource->get() : nullptr;
+    }
+} // namespace
+
 ResourceManager::ResourceManager(const std::shared_ptr<vulkan_wrapper::VulkanPhysicalDevice>& physicalDevice,
                                  const std::shared_ptr<vulkan_wrapper::VulkanDevice>& device)
     : physicalDevice_{physicalDevice}, device_{device}
 {
 }
 
-void ResourceManager::CreateBuffers(const std::vector<BufferResourceCreateInfo>& bufferCreateInfos)
+std::vector<BufferHandle> ResourceManager::CreateBuffers(const std::vector<BufferResourceCreateInfo>& bufferCreateInfos)
 {
+    std::vector<BufferHandle> handles;
+    handles.reserve(bufferCreateInfos.size());
+
     for (const auto& createInfo: bufferCreateInfos) {
-        buffers_[createInfo.Name] = std::make_unique<BufferResource>(physicalDevice_, device_);
-        buffers_[createInfo.Name]->CreateBuffer(createInfo);
+        auto buffer = std::make_unique<BufferResource>(physicalDevice_, device_);
+        buffer->CreateBuffer(createInfo);
+        // Replaced resources go through the delete path, so descriptor sets cached with their handles are invalidated
+        if (buffers_.Find(createInfo.Name).IsValid()) {
+            DeleteBuffer(createInfo.Name);
+        }
+        handles.push_back(buffers_.Add(createInfo.Name, std::move(buffer)));
     }
+
+    return handles;
 }
 
-void ResourceManager::CreateImages(const std::vector<ImageResourceCreateInfo>& imageCreateInfos)
+std::vector<ImageHandle> ResourceManager::CreateImages(const std::vector<ImageResourceCreateInfo>& imageCreateInfos)
 {
+    std::vector<ImageHandle> handles;
+    handles.reserve(imageCreateInfos.size());
+
     for (const auto& createInfo: imageCreateInfos) {
-        images_[createInfo.Name] = std::make_unique<ImageResource>(physicalDevice_, device_);
-        images_[createInfo.Name]->CreateImage(createInfo);
+        auto image = std::make_unique<ImageResource>(physicalDevice_, device_);
+        image->CreateImage(createInfo);
+        if (images_.Find(createInfo.Name).IsValid()) {
+            DeleteImage(createInfo.Name);
+        }
+        handles.push_back(images_.Add(createInfo.Name, std::move(image)));
     }
+
+    return handles;
 }
 
-void ResourceManager::CreateSamplers(const std::vector<SamplerResourceCreateInfo>& samplerCreateInfos)
+std::vector<SamplerHandle>
+ResourceManager::CreateSamplers(const std::vector<SamplerResourceCreateInfo>& samplerCreateInfos)
 {
+    std::vector<SamplerHandle> handles;
+    handles.reserve(samplerCreateInfos.size());
+
     for (const auto& createInfo: samplerCreateInfos) {
-        samplers_[createInfo.Name] = std::make_unique<SamplerResource>(device_);
-        samplers_[createInfo.Name]->CreateSampler(createInfo);
+        auto sampler = std::make_unique<SamplerResource>(device_);
+        sampler->CreateSampler(createInfo);
+        if (samplers_.Find(createInfo.Name).IsValid()) {
+            DeleteSampler(createInfo.Name);
+        }
+        handles.push_back(samplers_.Add(createInfo.Name, std::move(sampler)));
     }
+
+    return handles;
 }
 
-void ResourceManager::CreateShaderModules(const ShaderModulesCreateInfo& modulesInfo)
+std::vector<ShaderModuleHandle> ResourceManager::CreateShaderModules(const ShaderModulesCreateInfo& modulesInfo)
 {
     shaderResources_ = std::make_unique<ShaderResource>(device_);
-    shaderResources_->CreateShaders(modulesInfo);
+    return shaderResources_->CreateShaders(modulesInfo);
 }
 
 void ResourceManager::CreateDescriptorSets(const DescriptorResourceCreateInfo& descriptorSetInfo)
 {
-    descriptorRegistry_ = std::make_unique<DescriptorRegistry>(device_);
+    CreateDescriptorRegistry();
     descriptorRegistry_->CreateDescriptors(descriptorSetInfo);
+}
 
-    descriptorUpdater_ = std::make_unique<DescriptorUpdater>(device_, *descriptorRegistry_);
+BindlessTextureTable& ResourceManager::CreateBindlessTextureTable(const std::string& tableName,
+                                                                const std::uint32_t maxTextureCount,
+                                                                const VkShaderStageFlags stageFlags)
+{
+    CreateDescriptorRegistry();
+    return descriptorRegistry_->CreateBindlessTextureTable(tableName, maxTextureCount, stageFlags);
+}
+
+std::uint32_t ResourceManager::AddBindlessTexture(const std::string& tableName,
+                                                  const ImageHandle& image,
+                                                  const std::string& viewName,
+                                                  const SamplerHandle& sampler) const
+{
+    const auto imageView = GetImageView(image, viewName);
+    const auto vulkanSampler = GetSampler(sampler);
+    if (!imageView || !vulkanSampler) {
+        throw std::runtime_error("Invalid image or sampler for bindless texture!");
+    }
+
+    const VkDescriptorImageInfo imageInfo{vulkanSampler->GetHandle(), imageView->GetHandle(),
+                                          VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL};
+    return descriptorRegistry_->GetBindlessTextureTable(tableName).AddTexture(imageInfo);
+}
+
+void ResourceManager::RemoveBindlessTexture(const std::string& tableName, const std::uint32_t index) const
+{
+    descriptorRegistry_->GetBindlessTextureTable(tableName).RemoveTexture(index);
+}
+
+DescriptorSetCache&
+ResourceManager::CreateDescriptorSetCache(const std::uint32_t maxCachedSets,
+                                          const std::uint32_t framesInFlight,
+                                          const std::vector<DescriptorPoolSizeRatio>& poolSizeRatios)
+{
+    descriptorSetCache_ = std::make_unique<DescriptorSetCache>(device_, maxCachedSets, framesInFlight, poolSizeRatios);
+    return *descriptorSetCache_;
+}
+
+DescriptorSetCache& ResourceManager::GetDescriptorSetCache() const
+{
+    if (!descriptorSetCache_) {
+        throw std::runtime_error("Descriptor set cache is not created!");
+    }
+
+    return *descriptorSetCache_;
+}
+
+std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet>
+ResourceManager::GetCachedDescriptorSet(const DescriptorLayoutHandle& layoutHandle,
+                                        const std::vector<DescriptorSetBinding>& bindings) const
+{
+    const auto layout = GetDescriptorLayout(layoutHandle);
+    if (!layout) {
+        throw std::runtime_error("Invalid descriptor set layout for cached descriptor set!");
+    }
+
+    return GetDescriptorSetCache().GetOrCreate(layout, bindings);
+}
+
+DescriptorSetBinding ResourceManager::MakeBufferBinding(const std::uint32_t bindingIndex,
+                                                        const VkDescriptorType type,
+                                                        const BufferHandle& buffer,
+                                                        const VkDeviceSize offset,
+                                                        const VkDeviceSize range) const
+{
+    const auto vulkanBuffer = GetBuffer(buffer);
+    if (!vulkanBuffer) {
+        throw std::runtime_error("Invalid buffer for descriptor set binding!");
+    }
+
+    return {bindingIndex, type, {{vulkanBuffer->GetHandle(), offset, range}}, {}, {}};
+}
+
+DescriptorSetBinding ResourceManager::MakeImageSamplerBinding(const std::uint32_t bindingIndex,
+                                                              const ImageHandle& image,
+                                                              const std::string& viewName,
+                                                              const SamplerHandle& sampler) const
+{
+    const auto imageView = GetImageView(image, viewName);
+    const auto vulkanSampler = GetSampler(sampler);
+    if (!imageView || !vulkanSampler) {
+        throw std::runtime_error("Invalid image or sampler for descriptor set binding!");
+    }
+
+    return {bindingIndex,
+            VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+            {},
+            {{vulkanSampler->GetHandle(), imageView->GetHandle(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL}},
+            {}};
 }
 
 void ResourceManager::UpdateDescriptorSet(const DescriptorUpdateInfo& descriptorSetUpdateInfo) const
@@ -75,23 +220,53 @@ void ResourceManager::UpdateDescriptorSet(const DescriptorUpdateInfo& descriptor
 
 std::shared_ptr<vulkan_wrapper::VulkanBuffer> ResourceManager::GetBuffer(const std::string& bufferName) const
 {
-    return buffers_.at(bufferName)->GetBuffer();
+    return GetResourceByName(buffers_, bufferName, "Buffer").GetBuffer();
+}
+
+std::shared_ptr<vulkan_wrapper::VulkanBuffer> ResourceManager::GetBuffer(const BufferHandle& handle) const
+{
+    const auto* buffer = GetResourceByHandle(buffers_, handle);
+    return buffer ? buffer->GetBuffer() : nullptr;
+}
+
+BufferResource* ResourceManager::GetBufferResource(const BufferHandle& handle) const
+{
+    return GetResourceByHandle(buffers_, handle);
 }
 
 std::shared_ptr<vulkan_wrapper::VulkanImage> ResourceManager::GetImage(const std::string& imageName) const
 {
-    return images_.at(imageName)->GetImage();
+    return GetResourceByName(images_, imageName, "Image").GetImage();
+}
+
+std::shared_ptr<vulkan_wrapper::VulkanImage> ResourceManager::GetImage(const ImageHandle& handle) const
+{
+    const auto* image = GetResourceByHandle(images_, handle);
+    return image ? image->GetImage() : nullptr;
 }
 
 std::shared_ptr<vulkan_wrapper::VulkanImageView> ResourceManager::GetImageView(const std::string& imageName,
                                                                                const std::string& viewName) const
 {
-    return images_.at(imageName)->GetImageView(viewName);
+    return GetResourceByName(images_, imageName, "Image").GetImageView(viewName);
+}
+
+std::shared_ptr<vulkan_wrapper::VulkanImageView> ResourceManager::GetImageView(const ImageHandle& handle,
+                                                                               const std::string& viewName) const
+{
+    const auto* image = GetResourceByHandle(images_, handle);
+    return image ? image->GetImageView(viewName) : nullptr;
 }
 
 std::shared_ptr<vulkan_wrapper::VulkanSampler> ResourceManager::GetSampler(const std::string& samplerName) const
 {
-    return samplers_.at(samplerName)->GetSampler();
+    return GetResourceByName(samplers_, samplerName, "Sampler").GetSampler();
+}
+
+std::shared_ptr<vulkan_wrapper::VulkanSampler> ResourceManager::GetSampler(const SamplerHandle& handle) const
+{
+    const auto* sampler = GetResourceByHandle(samplers_, handle);
+    return sampler ? sampler->GetSampler() : nullptr;
 }
 
 std::shared_ptr<vulkan_wrapper::VulkanShaderModule>
@@ -100,39 +275,116 @@ ResourceManager::GetShaderModule(const std::string& shaderModuleName) const
     return shaderResources_->GetShaderModule(shaderModuleName);
 }
 
+std::shared_ptr<vulkan_wrapper::VulkanShaderModule>
+ResourceManager::GetShaderModule(const ShaderModuleHandle& handle) const
+{
+    return shaderResources_->GetShaderModule(handle);
+}
+
 std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout>
 ResourceManager::GetDescriptorLayout(const std::string& layoutName) const
 {
     return descriptorRegistry_->GetDescriptorLayout(layoutName);
 }
 
+std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout>
+ResourceManager::GetDescriptorLayout(const DescriptorLayoutHandle& handle) const
+{
+    return descriptorRegistry_->GetDescriptorLayout(handle);
+}
+
 std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet> ResourceManager::GetDescriptorSet(const std::string& setName) const
 {
     return descriptorRegistry_->GetDescriptorSet(setName);
 }
 
+std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet>
+ResourceManager::GetDescriptorSet(const DescriptorSetHandle& handle) const
+{
+    return descriptorRegistry_->GetDescriptorSet(handle);
+}
+
+BufferHandle ResourceManager::GetBufferHandle(const std::string& bufferName) const { return buffers_.Find(bufferName); }
+
+ImageHandle ResourceManager::GetImageHandle(const std::string& imageName) const { return images_.Find(imageName); }
+
+SamplerHandle ResourceManager::GetSamplerHandle(const std::string& samplerName) const
+{
+    return samplers_.Find(samplerName);
+}
+
+ShaderModuleHandle ResourceManager::GetShaderModuleHandle(const std::string& shaderModuleName) const
+{
+    return shaderResources_->GetShaderModuleHandle(shaderModuleName);
+}
+
+DescriptorLayoutHandle ResourceManager::GetDescriptorLayoutHandle(const std::string& layoutName) const
+{
+    return descriptorRegistry_->GetDescriptorLayoutHandle(layoutName);
+}
+
+DescriptorSetHandle ResourceManager::GetDescriptorSetHandle(const std::string& setName) const
+{
+    return descriptorRegistry_->GetDescriptorSetHandle(setName);
+}
+
 void ResourceManager::SetBuffer(const std::string& name, const void* data, const std::uint64_t dataSize)
 {
-    buffers_[name]->MapMemory();
-    buffers_[name]->FlushData(data, dataSize);
-    buffers_[name]->UnmapMemory();
+    SetBuffer(buffers_.Find(name), data, dataSize);
+}
+
+void ResourceManager::SetBuffer(const BufferHandle& handle, const void* data, const std::uint64_t dataSize)
+{
+    auto* buffer = GetResourceByHandle(buffers_, handle);
+    if (!buffer) {
+        throw std::runtime_error("Buffer resource not found!");
+    }
+
+    buffer->MapMemory();
+    buffer->WriteData(data, dataSize);
+    buffer->FlushDirtyRanges();
+    buffer->UnmapMemory();
+}
+
+void ResourceManager::UpdateBuffer(const std::string& name,
+                                   const void* data,
+                                   const std::uint64_t dataSize,
+                                   const std::uint64_t offset)
+{
+    UpdateBuffer(buffers_.Find(name), data, dataSize, offset);
+}
+
+void ResourceManager::UpdateBuffer(const BufferHandle& handle,
+                                   const void* data,
+                                   const std::uint64_t dataSize,
+                                   const std::uint64_t offset)
+{
+    auto* buffer = GetResourceByHandle(buffers_, handle);
+    if (!buffer) {
+        throw std::runtime_error("Buffer resource not found!");
+    }
+
+    // Only the blocks touched by this write are flushed
+    buffer->MapMemory();
+    buffer->WriteData(data, dataSize, offset);
+    buffer->FlushDirtyRanges();
+    buffer->UnmapMemory();
 }
+
 void ResourceManager::SetImageFromTexture(const std::shared_ptr<vulkan_wrapper::VulkanCommandPool>& cmdPool,
                                           const std::shared_ptr<vulkan_wrapper::VulkanQueue>& queue,
                                           const std::string& imageName,
                                           const utility::TextureHandler& textureHandler)
 {
-    images_[imageName]->ChangeImageLayout(cmdPool, queue, VK_IMAGE_LAYOUT_UNDEFINED,
-                                          VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    auto& image = GetResourceByName(images_, imageName, "Image");
+    image.ChangeImageLayout(cmdPool, queue, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 
     const BufferResourceCreateInfo stagingBufferCreateInfo{
         imageName + "_tempStagingBuffer", static_cast<std::uint32_t>(textureHandler.Data.size()),
         VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT};
 
-    buffers_[stagingBufferCreateInfo.Name] = std::make_unique<BufferResource>(physicalDevice_, device_);
-    buffers_[stagingBufferCreateInfo.Name]->CreateBuffer(stagingBufferCreateInfo);
-
-    SetBuffer(stagingBufferCreateInfo.Name, textureHandler.Data.data(), textureHandler.Data.size());
+    const auto stagingBuffer = CreateBuffers({stagingBufferCreateInfo}).front();
+    SetBuffer(stagingBuffer, textureHandler.Data.data(), textureHandler.Data.size());
 
     const VkBufferImageCopy copyRegion = {.bufferOffset = 0,
                                           .bufferRowLength = 0,
@@ -146,16 +398,43 @@ void ResourceManager::SetImageFromTexture(const std::shared_ptr<vulkan_wrapper::
                                                   },
                                           .imageOffset = {0, 0, 0},
                                           .imageExtent = {textureHandler.Width, textureHandler.Height, 1}};
-    images_[imageName]->CopyDataFromBuffer(cmdPool, queue, buffers_[stagingBufferCreateInfo.Name]->GetBuffer(),
-                                           copyRegion);
-    images_[imageName]->ChangeImageLayout(cmdPool, queue, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                                          VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    image.CopyDataFromBuffer(cmdPool, queue, GetBuffer(stagingBuffer), copyRegion);
+    image.ChangeImageLayout(cmdPool, queue, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
 }
-void ResourceManager::DeleteBuffer(const std::string& bufferName) { buffers_.erase(bufferName); }
 
-void ResourceManager::DeleteImage(const std::string& imageName) { images_.erase(imageName); }
+void ResourceManager::DeleteBuffer(const std::string& bufferName) { DeleteBuffer(buffers_.Find(bufferName)); }
+
+void ResourceManager::DeleteBuffer(const BufferHandle& handle)
+{
+    // Cached descriptor sets are keyed with raw handles, a new buffer can get the same handle value after the deletion
+    if (const auto* bufferResource = buffers_.Get(handle); bufferResource && descriptorSetCache_) {
+        descriptorSetCache_->InvalidateBuffer((*bufferResource)->GetBuffer()->GetHandle());
+    }
+    buffers_.Remove(handle);
+}
 
-void ResourceManager::DeleteSampler(const std::string& samplerName) { samplers_.erase(samplerName); }
+void ResourceManager::DeleteImage(const std::string& imageName) { DeleteImage(images_.Find(imageName)); }
+
+void ResourceManager::DeleteImage(const ImageHandle& handle)
+{
+    if (const auto* imageResource = images_.Get(handle); imageResource && descriptorSetCache_) {
+        for (const auto& imageView: (*imageResource)->GetImageViews() | std::views::values) {
+            descriptorSetCache_->InvalidateImageView(imageView->GetHandle());
+        }
+    }
+    images_.Remove(handle);
+}
+
+void ResourceManager::DeleteSampler(const std::string& samplerName) { DeleteSampler(samplers_.Find(samplerName)); }
+
+void ResourceManager::DeleteSampler(const SamplerHandle& handle)
+{
+    if (const auto* samplerResource = samplers_.Get(handle); samplerResource && descriptorSetCache_) {
+        descriptorSetCache_->InvalidateSampler((*samplerResource)->GetSampler()->GetHandle());
+    }
+    samplers_.Remove(handle);
+}
 
 void ResourceManager::DeleteShaderModule(const std::string& shaderModule) const
 {
@@ -164,6 +443,9 @@ void ResourceManager::DeleteShaderModule(const std::string& shaderModule) const
 
 void ResourceManager::DeleteDescriptorLayout(const std::string& layoutName) const
 {
+    if (const auto layout = GetDescriptorLayout(GetDescriptorLayoutHandle(layoutName)); layout && descriptorSetCache_) {
+        descriptorSetCache_->InvalidateLayout(layout->GetHandle());
+    }
     descriptorRegistry_->DeleteDescriptorLayout(layoutName);
 }
 
@@ -172,4 +454,14 @@ void ResourceManager::DeleteDescriptorSet(const std::string& setName) const
     descriptorRegistry_->DeleteDescriptorSet(setName);
 }
 
+void ResourceManager::CreateDescriptorRegistry()
+{
+    if (descriptorRegistry_) {
+        return;
+    }
+
+    descriptorRegistry_ = std::make_unique<DescriptorRegistry>(device_);
+    descriptorUpdater_ = std::make_unique<DescriptorUpdater>(device_, *descriptorRegistry_);
+}
+
 } // namespace common::vulkan_framework
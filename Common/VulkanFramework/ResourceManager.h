@@ -14,8 +14,11 @@
 #include "BufferResource.h"
 #include "CoreDefines.h"
 #include "DescriptorRegistry.h"
+#include "DescriptorSetCache.h"
 #include "DescriptorUpdater.h"
+#include "HandleRegistry.h"
 #include "ImageResource.h"
+#include "ResourceHandles.h"
 #include "SamplerResource.h"
 #include "ShaderResource.h"
 #include "TextureHandler.h"
@@ -46,26 +49,30 @@ public:
     /**
      * @brief Creates buffers.
      * @param bufferCreateInfos Create information for buffers.
+     * @return Returns handles of the created buffers (in the same order with create information).
      */
-    void CreateBuffers(const std::vector<BufferResourceCreateInfo>& bufferCreateInfos);
+    std::vector<BufferHandle> CreateBuffers(const std::vector<BufferResourceCreateInfo>& bufferCreateInfos);
 
     /**
      * @brief Creates images.
      * @param imageCreateInfos Create information for images.
+     * @return Returns handles of the created images (in the same order with create information).
      */
-    void CreateImages(const std::vector<ImageResourceCreateInfo>& imageCreateInfos);
+    std::vector<ImageHandle> CreateImages(const std::vector<ImageResourceCreateInfo>& imageCreateInfos);
 
     /**
      * @brief Creates samplers.
      * @param samplerCreateInfos Create information for samplers.
+     * @return Returns handles of the created samplers (in the same order with create information).
      */
-    void CreateSamplers(const std::vector<SamplerResourceCreateInfo>& samplerCreateInfos);
+    std::vector<SamplerHandle> CreateSamplers(const std::vector<SamplerResourceCreateInfo>& samplerCreateInfos);
 
     /**
      * @brief Creates shader modules.
      * @param modulesInfo Create information for shader modules.
+     * @return Returns handles of the created shader modules (in the same order with create information).
      */
-    void CreateShaderModules(const ShaderModulesCreateInfo& modulesInfo);
+    std::vector<ShaderModuleHandle> CreateShaderModules(const ShaderModulesCreateInfo& modulesInfo);
 
     /**
      * @brief Creates descriptor sets.
@@ -73,6 +80,94 @@ public:
      */
     void CreateDescriptorSets(const DescriptorResourceCreateInfo& descriptorSetInfo);
 
+    /**
+     * @brief Creates a bindless texture table. Its layout and set can be taken with the table name like other
+     * descriptor set layouts and sets.
+     * @param tableName Name of the table.
+     * @param maxTextureCount Size of the texture array.
+     * @param stageFlags Shader stages that access to the texture array.
+     * @return Returns the created table.
+     */
+    BindlessTextureTable& CreateBindlessTextureTable(const std::string& tableName,
+                                                     std::uint32_t maxTextureCount,
+                                                     VkShaderStageFlags stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT);
+
+    /**
+     * @brief Adds an uploaded image to the bindless texture table. Image must be in shader read only layout.
+     * @param tableName Name of the table.
+     * @param image Handle of the image resource.
+     * @param viewName Name of the image view.
+     * @param sampler Handle of the sampler resource.
+     * @return Returns stable index of the texture that shaders use to select it.
+     */
+    std::uint32_t AddBindlessTexture(const std::string& tableName,
+                                     const ImageHandle& image,
+                                     const std::string& viewName,
+                                     const SamplerHandle& sampler) const;
+
+    /**
+     * @brief Releases index of the texture in the bindless texture table.
+     * @param tableName Name of the table.
+     * @param index Index of the texture.
+     */
+    void RemoveBindlessTexture(const std::string& tableName, std::uint32_t index) const;
+
+    /**
+     * @brief Creates the descriptor set cache that shares descriptor sets between the draws which bind the same
+     * resources.
+     * @param maxCachedSets Maximum number of sets in the cache before least recently used ones are evicted.
+     * @param framesInFlight Number of frames in flight.
+     * @param poolSizeRatios Descriptor counts per set of every descriptor type.
+     * @return Returns the created cache.
+     */
+    DescriptorSetCache& CreateDescriptorSetCache(std::uint32_t maxCachedSets,
+                                                 std::uint32_t framesInFlight,
+                                                 const std::vector<DescriptorPoolSizeRatio>& poolSizeRatios);
+
+    /**
+     * @brief Returns the descriptor set cache.
+     * @return Returns the descriptor set cache.
+     */
+    [[nodiscard]] DescriptorSetCache& GetDescriptorSetCache() const;
+
+    /**
+     * @brief Returns a cached descriptor set of the layout for given resources.
+     * @param layoutHandle Handle of the descriptor set layout.
+     * @param bindings Bound resources of every binding.
+     * @return Returns the descriptor set.
+     */
+    [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet>
+    GetCachedDescriptorSet(const DescriptorLayoutHandle& layoutHandle,
+                           const std::vector<DescriptorSetBinding>& bindings) const;
+
+    /**
+     * @brief Creates a buffer binding from a buffer handle for cached descriptor sets.
+     * @param bindingIndex Binding index in the layout.
+     * @param type Descriptor type of the binding.
+     * @param buffer Handle of the buffer.
+     * @param offset Offset of the bound range.
+     * @param range Size of the bound range.
+     * @return Returns the binding.
+     */
+    [[nodiscard]] DescriptorSetBinding MakeBufferBinding(std::uint32_t bindingIndex,
+                                                         VkDescriptorType type,
+                                                         const BufferHandle& buffer,
+                                                         VkDeviceSize offset = 0,
+                                                         VkDeviceSize range = VK_WHOLE_SIZE) const;
+
+    /**
+     * @brief Creates a combined image sampler binding from image and sampler handles for cached descriptor sets.
+     * @param bindingIndex Binding index in the layout.
+     * @param image Handle of the image.
+     * @param viewName Name of the image view.
+     * @param sampler Handle of the sampler.
+     * @return Returns the binding.
+     */
+    [[nodiscard]] DescriptorSetBinding MakeImageSamplerBinding(std::uint32_t bindingIndex,
+                                                               const ImageHandle& image,
+                                                               const std::string& viewName,
+                                                               const SamplerHandle& sampler) const;
+
     /**
      * @brief Updates existing descriptor sets.
      * @param descriptorSetUpdateInfo Update information for descriptor sets.
@@ -86,6 +181,20 @@ public:
      */
     [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanBuffer> GetBuffer(const std::string& bufferName) const;
 
+    /**
+     * @brief Returns the buffer resource.
+     * @param handle Handle of the buffer resource.
+     * @return Returns the buffer resource, if the handle is stale it returns nullptr.
+     */
+    [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanBuffer> GetBuffer(const BufferHandle& handle) const;
+
+    /**
+     * @brief Returns the buffer resource object which keeps the buffer, its memory and mapping state.
+     * @param handle Handle of the buffer resource.
+     * @return Returns pointer of the buffer resource object, if the handle is stale it returns nullptr.
+     */
+    [[nodiscard]] BufferResource* GetBufferResource(const BufferHandle& handle) const;
+
     /**
      * @brief Returns the image resource.
      * @param imageName Name of the image resource.
@@ -93,6 +202,13 @@ public:
      */
     [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanImage> GetImage(const std::string& imageName) const;
 
+    /**
+     * @brief Returns the image resource.
+     * @param handle Handle of the image resource.
+     * @return Returns the image resource, if the handle is stale it returns nullptr.
+     */
+    [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanImage> GetImage(const ImageHandle& handle) const;
+
     /**
      * @brief Returns the image view resource.
      * @param imageName Name of the image resource.
@@ -102,6 +218,15 @@ public:
     [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanImageView> GetImageView(const std::string& imageName,
                                                                                 const std::string& viewName) const;
 
+    /**
+     * @brief Returns the image view resource.
+     * @param handle Handle of the image resource.
+     * @param viewName Name of the image view resource.
+     * @return Returns the image view resource, if the handle is stale it returns nullptr.
+     */
+    [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanImageView> GetImageView(const ImageHandle& handle,
+                                                                                const std::string& viewName) const;
+
     /**
      * @brief Returns the sampler resource.
      * @param samplerName Name of the sampler resource.
@@ -109,6 +234,13 @@ public:
      */
     [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanSampler> GetSampler(const std::string& samplerName) const;
 
+    /**
+     * @brief Returns the sampler resource.
+     * @param handle Handle of the sampler resource.
+     * @return Returns the sampler resource, if the handle is stale it returns nullptr.
+     */
+    [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanSampler> GetSampler(const SamplerHandle& handle) const;
+
     /**
      * @brief Returns the shader module resource.
      * @param shaderModuleName Name of the shader module resource.
@@ -117,6 +249,14 @@ public:
     [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanShaderModule>
     GetShaderModule(const std::string& shaderModuleName) const;
 
+    /**
+     * @brief Returns the shader module resource.
+     * @param handle Handle of the shader module resource.
+     * @return Returns the shader module resource, if the handle is stale it returns nullptr.
+     */
+    [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanShaderModule>
+    GetShaderModule(const ShaderModuleHandle& handle) const;
+
     /**
      * @brief Returns the descriptor set layout resource.
      * @param layoutName Name of the descriptor set layout resource.
@@ -125,6 +265,14 @@ public:
     [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout>
     GetDescriptorLayout(const std::string& layoutName) const;
 
+    /**
+     * @brief Returns the descriptor set layout resource.
+     * @param handle Handle of the descriptor set layout resource.
+     * @return Returns the descriptor set layout resource, if the handle is stale it returns nullptr.
+     */
+    [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanDescriptorSetLayout>
+    GetDescriptorLayout(const DescriptorLayoutHandle& handle) const;
+
     /**
      * @brief Returns the descriptor set resource.
      * @param setName Name of the descriptor set resource.
@@ -133,6 +281,57 @@ public:
     [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet>
     GetDescriptorSet(const std::string& setName) const;
 
+    /**
+     * @brief Returns the descriptor set resource.
+     * @param handle Handle of the descriptor set resource.
+     * @return Returns the descriptor set resource, if the handle is stale it returns nullptr.
+     */
+    [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanDescriptorSet>
+    GetDescriptorSet(const DescriptorSetHandle& handle) const;
+
+    /**
+     * @brief Returns handle of the buffer resource. Handles should be taken once (e.g. after creation) and used in
+     * the per-frame code instead of names.
+     * @param bufferName Name of the buffer resource.
+     * @return Returns handle of the buffer resource, if it is not found it returns an invalid handle.
+     */
+    [[nodiscard]] BufferHandle GetBufferHandle(const std::string& bufferName) const;
+
+    /**
+     * @brief Returns handle of the image resource.
+     * @param imageName Name of the image resource.
+     * @return Returns handle of the image resource, if it is not found it returns an invalid handle.
+     */
+    [[nodiscard]] ImageHandle GetImageHandle(const std::string& imageName) const;
+
+    /**
+     * @brief Returns handle of the sampler resource.
+     * @param samplerName Name of the sampler resource.
+     * @return Returns handle of the sampler resource, if it is not found it returns an invalid handle.
+     */
+    [[nodiscard]] SamplerHandle GetSamplerHandle(const std::string& samplerName) const;
+
+    /**
+     * @brief Returns handle of the shader module resource.
+     * @param shaderModuleName Name of the shader module resource.
+     * @return Returns handle of the shader module resource, if it is not found it returns an invalid handle.
+     */
+    [[nodiscard]] ShaderModuleHandle GetShaderModuleHandle(const std::string& shaderModuleName) const;
+
+    /**
+     * @brief Returns handle of the descriptor set layout resource.
+     * @param layoutName Name of the descriptor set layout resource.
+     * @return Returns handle of the layout resource, if it is not found it returns an invalid handle.
+     */
+    [[nodiscard]] DescriptorLayoutHandle GetDescriptorLayoutHandle(const std::string& layoutName) const;
+
+    /**
+     * @brief Returns handle of the descriptor set resource.
+     * @param setName Name of the descriptor set resource.
+     * @return Returns handle of the descriptor set resource, if it is not found it returns an invalid handle.
+     */
+    [[nodiscard]] DescriptorSetHandle GetDescriptorSetHandle(const std::string& setName) const;
+
     /**
      * @brief Sets a buffer resource with raw data.
      * @param name Name of the buffer resource.
@@ -141,6 +340,32 @@ public:
      */
     void SetBuffer(const std::string& name, const void* data, std::uint64_t dataSize);
 
+    /**
+     * @brief Sets a buffer resource with raw data.
+     * @param handle Handle of the buffer resource.
+     * @param data Data to be copied to buffer.
+     * @param dataSize Size of the data to be copied to buffer.
+     */
+    void SetBuffer(const BufferHandle& handle, const void* data, std::uint64_t dataSize);
+
+    /**
+     * @brief Updates a part of a buffer resource, only the dirty blocks of the written range are flushed.
+     * @param name Name of the buffer resource.
+     * @param data Data to be copied to buffer.
+     * @param dataSize Size of the data to be copied to buffer.
+     * @param offset Offset of the data in the buffer.
+     */
+    void UpdateBuffer(const std::string& name, const void* data, std::uint64_t dataSize, std::uint64_t offset);
+
+    /**
+     * @brief Updates a part of a buffer resource, only the dirty blocks of the written range are flushed.
+     * @param handle Handle of the buffer resource.
+     * @param data Data to be copied to buffer.
+     * @param dataSize Size of the data to be copied to buffer.
+     * @param offset Offset of the data in the buffer.
+     */
+    void UpdateBuffer(const BufferHandle& handle, const void* data, std::uint64_t dataSize, std::uint64_t offset);
+
     /**
      * @brief Sets an image resource with texture data.
      * @param cmdPool Command pool that the command buffer will be created.
@@ -159,18 +384,36 @@ public:
      */
     void DeleteBuffer(const std::string& bufferName);
 
+    /**
+     * @brief Deletes buffer resource from resource manager. Handle becomes stale after the deletion.
+     * @param handle Handle of the buffer resource.
+     */
+    void DeleteBuffer(const BufferHandle& handle);
+
     /**
      * @brief Deletes image resource from resource manager.
      * @param imageName Name of the image resource.
      */
     void DeleteImage(const std::string& imageName);
 
+    /**
+     * @brief Deletes image resource from resource manager. Handle becomes stale after the deletion.
+     * @param handle Handle of the image resource.
+     */
+    void DeleteImage(const ImageHandle& handle);
+
     /**
      * @brief Deletes sampler resource from resource manager.
      * @param samplerName Name of the sampler resource.
      */
     void DeleteSampler(const std::string& samplerName);
 
+    /**
+     * @brief Deletes sampler resource from resource manager. Handle becomes stale after the deletion.
+     * @param handle Handle of the sampler resource.
+     */
+    void DeleteSampler(const SamplerHandle& handle);
+
     /**
      * @brief Deletes shader module resource from resource manager.
      * @param shaderModule Name of the shader module resource.
@@ -190,14 +433,17 @@ public:
     void DeleteDescriptorSet(const std::string& setName) const;
 
 private:
+    void CreateDescriptorRegistry();
+
     std::shared_ptr<vulkan_wrapper::VulkanPhysicalDevice> physicalDevice_;
     std::shared_ptr<vulkan_wrapper::VulkanDevice> device_;
 
-    std::unordered_map<std::string, std::unique_ptr<BufferResource>> buffers_;
-    std::unordered_map<std::string, std::unique_ptr<ImageResource>> images_;
-    std::unordered_map<std::string, std::unique_ptr<SamplerResource>> samplers_;
+    utility::HandleRegistry<BufferHandle, std::unique_ptr<BufferResource>> buffers_;
+    utility::HandleRegistry<ImageHandle, std::unique_ptr<ImageResource>> images_;
+    utility::HandleRegistry<SamplerHandle, std::unique_ptr<SamplerResource>> samplers_;
     std::unique_ptr<ShaderResource> shaderResources_;
     std::unique_ptr<DescriptorRegistry> descriptorRegistry_;
     std::unique_ptr<DescriptorUpdater> descriptorUpdater_;
+    std::unique_ptr<DescriptorSetCache> descriptorSetCache_;
 };
 } // namespace common::vulkan_framework
@@ -29,6 +29,7 @@ void SamplerResource::CreateSampler(const SamplerResourceCreateInfo& createInfo)
         builder.SetMipmapMode(createInfo.FilteringBehavior.MipmapMode);
         builder.EnableAnisotropy(createInfo.FilteringBehavior.AnisotropyEnable);
         builder.SetMaxAnisotropy(createInfo.FilteringBehavior.MaxAnisotropy);
+        builder.SetReductionMode(createInfo.FilteringBehavior.ReductionMode);
 
         builder.SetAddressModes(createInfo.AddressModes.U, createInfo.AddressModes.V, createInfo.AddressModes.W);
         builder.SetBorderColor(createInfo.AddressModes.BorderColor);
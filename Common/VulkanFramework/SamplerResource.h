@@ -29,6 +29,8 @@ struct COMMON_API SamplerResourceCreateInfo
         VkSamplerMipmapMode MipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
         VkBool32 AnisotropyEnable = VK_FALSE;
         float MaxAnisotropy = 1.0f;
+        // MIN/MAX modes require VK_EXT_sampler_filter_minmax and VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_MINMAX_BIT_EXT
+        VkSamplerReductionModeEXT ReductionMode = VK_SAMPLER_REDUCTION_MODE_WEIGHTED_AVERAGE_EXT;
     };
 
     struct AddressModes
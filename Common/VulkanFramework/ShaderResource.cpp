@@ -10,7 +10,7 @@ namespace common::vulkan_framework
 {
 ShaderResource::ShaderResource(const std::shared_ptr<vulkan_wrapper::VulkanDevice>& device) : device_{device} {}
 
-void ShaderResource::CreateShaders(const ShaderModulesCreateInfo& createInfo)
+std::vector<ShaderModuleHandle> ShaderResource::CreateShaders(const ShaderModulesCreateInfo& createInfo)
 {
     const auto devicePtr = device_.lock();
     if (!devicePtr) {
@@ -20,6 +20,9 @@ void ShaderResource::CreateShaders(const ShaderModulesCreateInfo& createInfo)
     const std::string basePath = createInfo.BasePath;
     const utility::ShaderBaseType shaderType = createInfo.ShaderType;
 
+    std::vector<ShaderModuleHandle> handles;
+    handles.reserve(createInfo.Modules.size());
+
     for (const auto& [name, fileName]: createInfo.Modules) {
         const utility::ShaderLoader shaderLoader{basePath, shaderType};
         const auto shaderCode = shaderLoader.LoadSpirV(fileName);
@@ -27,9 +30,13 @@ void ShaderResource::CreateShaders(const ShaderModulesCreateInfo& createInfo)
         if (!shaderModule) {
             throw std::runtime_error("Failed to create vertex shader module!");
         }
-        shaderModules_[name] = shaderModule;
+        handles.push_back(shaderModules_.Add(name, shaderModule));
     }
+
+    return handles;
 }
 
-void ShaderResource::DeleteShaderModule(const std::string& moduleName) { shaderModules_.erase(moduleName); }
+void ShaderResource::DeleteShaderModule(const std::string& moduleName) { shaderModules_.Remove(moduleName); }
+
+void ShaderResource::DeleteShaderModule(const ShaderModuleHandle& handle) { shaderModules_.Remove(handle); }
 } // namespace common::vulkan_framework
@@ -9,10 +9,11 @@
  * https://opensource.org/licenses/MIT
  */
 #pragma once
-#include <map>
 #include <string>
 
 #include "CoreDefines.h"
+#include "HandleRegistry.h"
+#include "ResourceHandles.h"
 #include "ShaderLoader.h"
 #include "VulkanDevice.h"
 
@@ -42,17 +43,40 @@ public:
     /**
      * @brief Creates a shader module resource from given information.
      * @param createInfo Shader module create information.
+     * @return Returns handles of the created shader modules (in the same order with create information).
      */
-    void CreateShaders(const ShaderModulesCreateInfo& createInfo);
+    std::vector<ShaderModuleHandle> CreateShaders(const ShaderModulesCreateInfo& createInfo);
 
     /**
      * @brief Returns the shader module resource.
      * @param name Name of the shader module resource.
-     * @return Returns the shader module resource.
+     * @return Returns the shader module resource, if it is not found it returns nullptr.
      */
-    [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanShaderModule> GetShaderModule(const std::string& name)
+    [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanShaderModule> GetShaderModule(const std::string& name) const
     {
-        return shaderModules_[name];
+        return GetShaderModule(shaderModules_.Find(name));
+    }
+
+    /**
+     * @brief Returns the shader module resource.
+     * @param handle Handle of the shader module resource.
+     * @return Returns the shader module resource, if the handle is stale it returns nullptr.
+     */
+    [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanShaderModule>
+    GetShaderModule(const ShaderModuleHandle& handle) const
+    {
+        const auto* shaderModule = shaderModules_.Get(handle);
+        return shaderModule ? *shaderModule : nullptr;
+    }
+
+    /**
+     * @brief Returns handle of the shader module resource.
+     * @param name Name of the shader module resource.
+     * @return Returns handle of the shader module, if it is not found it returns an invalid handle.
+     */
+    [[nodiscard]] ShaderModuleHandle GetShaderModuleHandle(const std::string& name) const
+    {
+        return shaderModules_.Find(name);
     }
 
     /**
@@ -61,9 +85,15 @@ public:
      */
     void DeleteShaderModule(const std::string& moduleName);
 
+    /**
+     * @brief Deletes shader module from the resource.
+     * @param handle Handle of the shader module.
+     */
+    void DeleteShaderModule(const ShaderModuleHandle& handle);
+
 private:
     std::weak_ptr<vulkan_wrapper::VulkanDevice> device_;
 
-    std::map<std::string, std::shared_ptr<vulkan_wrapper::VulkanShaderModule>> shaderModules_;
+    utility::HandleRegistry<ShaderModuleHandle, std::shared_ptr<vulkan_wrapper::VulkanShaderModule>> shaderModules_;
 };
 } // namespace common::vulkan_framework
@@ -0,0 +1,68 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "UniformRingBuffer.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "VulkanHelpers.h"
+
+namespace common::vulkan_framework
+{
+UniformRingBuffer::UniformRingBuffer(const std::shared_ptr<vulkan_wrapper::VulkanPhysicalDevice>& physicalDevice,
+                                     const std::shared_ptr<vulkan_wrapper::VulkanDevice>& device,
+                                     const VkDeviceSize sizePerFrame,
+                                     const std::uint32_t frameCount)
+    : frameCount_{std::max(frameCount, 1u)}
+{
+    const auto limits = physicalDevice->GetProperties().limits;
+    alignment_ = std::max<VkDeviceSize>(limits.minUniformBufferOffsetAlignment, 1);
+    nonCoherentAtomSize_ = std::max<VkDeviceSize>(limits.nonCoherentAtomSize, 1);
+
+    // Both limits are powers of two, so regions that are aligned to the bigger one can be flushed separately
+    sizePerFrame_ = AlignUp(sizePerFrame, std::max(alignment_, nonCoherentAtomSize_));
+
+    const BufferResourceCreateInfo createInfo{
+            .Name = "uniformRingBuffer",
+            .BufferSizeInBytes = sizePerFrame_ * frameCount_,
+            .UsageFlags = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+            .MemoryProperties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT};
+
+    buffer_ = std::make_unique<BufferResource>(physicalDevice, device);
+    buffer_->CreateBuffer(createInfo);
+    buffer_->MapMemory(); // Stays mapped for the lifetime of the ring buffer
+    mappedData_ = static_cast<std::uint8_t*>(buffer_->GetMappedData());
+}
+
+void UniformRingBuffer::BeginFrame(const std::uint32_t frameIndex)
+{
+    frameIndex_ = frameIndex % frameCount_;
+    frameHead_ = frameIndex_ * sizePerFrame_;
+}
+
+UniformAllocation UniformRingBuffer::Allocate(const VkDeviceSize size)
+{
+    const auto offset = AlignUp(frameHead_, alignment_);
+    if (offset + size > (frameIndex_ + 1) * sizePerFrame_) {
+        throw std::runtime_error("Uniform ring buffer is full!");
+    }
+
+    frameHead_ = offset + size;
+    return {mappedData_ + offset, static_cast<std::uint32_t>(offset)};
+}
+
+void UniformRingBuffer::Flush() const
+{
+    const auto usedSize = GetUsedSize();
+    if (usedSize == 0) {
+        return;
+    }
+
+    const auto flushSize = std::min(AlignUp(usedSize, nonCoherentAtomSize_), sizePerFrame_);
+    buffer_->FlushMappedRanges({{flushSize, frameIndex_ * sizePerFrame_}});
+}
+} // namespace common::vulkan_framework
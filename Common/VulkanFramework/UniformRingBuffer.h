@@ -0,0 +1,121 @@
+/**
+ * @file    UniformRingBuffer.h
+ * @brief   This file contains a uniform ring buffer that sub-allocates per-object uniform data of every frame from one
+ *          persistently mapped buffer. Allocations are bound with UNIFORM_BUFFER_DYNAMIC descriptors and offsets.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+#include <vulkan/vulkan_core.h>
+
+#include "BufferResource.h"
+#include "CoreDefines.h"
+#include "VulkanBuffer.h"
+#include "VulkanDevice.h"
+#include "VulkanPhysicalDevice.h"
+
+namespace common::vulkan_framework
+{
+/**
+ * @brief Place of an allocation in the ring buffer. Offset is used as the dynamic offset of the descriptor.
+ */
+struct COMMON_API UniformAllocation
+{
+    void* Data = nullptr;
+    std::uint32_t Offset = 0;
+};
+
+/**
+ * @brief Linear allocator for uniform data that changes every frame. The buffer is split into one region per frame in
+ * flight, allocations are aligned to minUniformBufferOffsetAlignment and BeginFrame releases all allocations of the
+ * frame at once. Because all objects share one buffer, a single descriptor set with a UNIFORM_BUFFER_DYNAMIC binding
+ * (range is the size of one object's data) and one flush per frame are enough for any number of objects.
+ */
+class COMMON_API UniformRingBuffer
+{
+public:
+    /**
+     * @param physicalDevice Refers VulkanPhysicalDevice object.
+     * @param device Refers VulkanDevice object.
+     * @param sizePerFrame Size of the region of every frame in bytes.
+     * @param frameCount Number of frames in flight.
+     */
+    UniformRingBuffer(const std::shared_ptr<vulkan_wrapper::VulkanPhysicalDevice>& physicalDevice,
+                      const std::shared_ptr<vulkan_wrapper::VulkanDevice>& device,
+                      VkDeviceSize sizePerFrame,
+                      std::uint32_t frameCount);
+
+    /**
+     * @brief Starts a new frame and releases allocations that were made when the same frame index was used last time.
+     * It must be called after the fence of the frame is waited.
+     * @param frameIndex Index of the frame in flight.
+     */
+    void BeginFrame(std::uint32_t frameIndex);
+
+    /**
+     * @brief Allocates aligned memory in the region of the current frame.
+     * @param size Size of the data in bytes.
+     * @return Returns mapped pointer and dynamic offset of the allocation. It throws an exception if the region is
+     * full.
+     */
+    UniformAllocation Allocate(VkDeviceSize size);
+
+    /**
+     * @brief Copies the data into a new allocation.
+     * @param data Uniform data of an object.
+     * @return Returns dynamic offset of the data.
+     */
+    template <typename T>
+    std::uint32_t Push(const T& data)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Uniform data must be trivially copyable!");
+        const auto allocation = Allocate(sizeof(T));
+        std::memcpy(allocation.Data, &data, sizeof(T));
+        return allocation.Offset;
+    }
+
+    /**
+     * @brief Flushes the written range of the current frame with one call. It must be called before the submit of the
+     * frame (memory may not be host coherent).
+     */
+    void Flush() const;
+
+    /**
+     * @brief Returns the buffer that is bound with dynamic uniform buffer descriptors.
+     * @return Returns VulkanBuffer object.
+     */
+    [[nodiscard]] std::shared_ptr<vulkan_wrapper::VulkanBuffer> GetBuffer() const { return buffer_->GetBuffer(); }
+
+    /**
+     * @brief Returns alignment of the allocations.
+     * @return Returns alignment in bytes.
+     */
+    [[nodiscard]] VkDeviceSize GetAlignment() const { return alignment_; }
+
+    /**
+     * @brief Returns used bytes in the region of the current frame.
+     * @return Returns used bytes in the region of the current frame.
+     */
+    [[nodiscard]] VkDeviceSize GetUsedSize() const { return frameHead_ - frameIndex_ * sizePerFrame_; }
+
+private:
+    std::unique_ptr<BufferResource> buffer_;
+    std::uint8_t* mappedData_ = nullptr;
+    VkDeviceSize alignment_ = 1;
+    VkDeviceSize nonCoherentAtomSize_ = 1;
+    VkDeviceSize sizePerFrame_ = 0;
+    std::uint32_t frameCount_ = 1;
+    std::uint32_t frameIndex_ = 0;
+    VkDeviceSize frameHead_ = 0;
+};
+} // namespace common::vulkan_framework
@@ -6,6 +6,9 @@
 
 #include "VulkanApplicationBase.h"
 
+#include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <utility>
 
 #include "AppCommonConfig.h"
@@ -16,6 +19,8 @@ VulkanApplicationBase::VulkanApplicationBase(utility::ParameterServer params) :
 
 bool VulkanApplicationBase::Run()
 {
+    paramSnapshot_ = params_.CreateSnapshot();
+
     if (!CreateInstance()) {
         std::cerr << "Failed to create Vulkan instance!" << std::endl;
         return false;
@@ -26,11 +31,16 @@ bool VulkanApplicationBase::Run()
         return false;
     }
 
+    const auto frameLimit = params_.Get<std::uint32_t>(BenchmarkParams::FrameCount);
+    std::uint64_t frameCount = 0;
+    const auto loopStart = std::chrono::steady_clock::now();
+
     try {
-        while (!ShouldClose()) {
+        while (!ShouldClose() && (frameLimit == 0 || frameCount < frameLimit)) {
             PreUpdate();
             DrawFrame();
             PostUpdate();
+            ++frameCount;
         }
     } catch (const std::exception& e) {
         std::cerr << e.what() << '\n';
@@ -38,6 +48,9 @@ bool VulkanApplicationBase::Run()
         return false;
     }
 
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - loopStart;
+    ReportFrameStatistics(frameCount, elapsed.count());
+
     Cleanup();
 
     return true;
@@ -72,4 +85,36 @@ bool VulkanApplicationBase::CreateInstance()
 
     return true;
 }
+
+void VulkanApplicationBase::ReportFrameStatistics(const std::uint64_t frameCount, const double elapsedSeconds) const
+{
+    if (frameCount == 0) {
+        return;
+    }
+
+    const double averageFrameMs = elapsedSeconds * 1000.0 / static_cast<double>(frameCount);
+    const auto configName = GetParamStr(BenchmarkParams::ConfigurationName);
+
+    std::cout << "[" << GetParamStr(VulkanParams::ApplicationName) << "]" << (configName.empty() ? "" : " ")
+              << configName << " frames: " << frameCount << ", average frame time: " << averageFrameMs << " ms"
+              << std::endl;
+
+    const auto resultsFile = GetParamStr(BenchmarkParams::ResultsFile);
+    if (resultsFile.empty()) {
+        return;
+    }
+
+    const bool writeHeader = !std::filesystem::exists(resultsFile);
+    std::ofstream file(resultsFile, std::ios::app);
+    if (!file.is_open()) {
+        std::cerr << "Benchmark results file couldn't be opened: " << resultsFile << std::endl;
+        return;
+    }
+
+    if (writeHeader) {
+        file << "application,configuration,frames,total_seconds,average_frame_ms\n";
+    }
+    file << GetParamStr(VulkanParams::ApplicationName) << ",\"" << configName << "\"," << frameCount << ","
+         << elapsedSeconds << "," << averageFrameMs << "\n";
+}
 } // namespace common::vulkan_framework
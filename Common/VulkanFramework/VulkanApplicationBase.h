@@ -82,10 +82,42 @@ protected:
      */
     [[nodiscard]] float GetParamFloat(const std::string& key) const;
 
+    /**
+     * @brief Resolves a typed parameter key into its slot index. It should be called once (e.g. in Init()).
+     * @tparam ParamType Type of the parameter.
+     * @param key Key name of the parameter.
+     * @return Returns the resolved parameter key.
+     */
+    template<typename ParamType>
+    [[nodiscard]] utility::ParamKey<ParamType> ResolveParam(const char* key) const
+    {
+        return params_.Resolve(utility::ParamKey<ParamType>{key});
+    }
+
+    /**
+     * @brief Returns parameter from the frozen parameter snapshot which is taken at the beginning of Run().
+     * @tparam ParamType Type of the parameter.
+     * @param key Resolved key of the parameter.
+     * @return Returns reference of the parameter value.
+     */
+    template<typename ParamType>
+    [[nodiscard]] const ParamType& GetParam(const utility::ParamKey<ParamType>& key) const
+    {
+        return paramSnapshot_.Get(key);
+    }
+
     utility::ParameterServer params_;
+    utility::ParameterSnapshot paramSnapshot_;
     std::shared_ptr<vulkan_wrapper::VulkanInstance> instance_;
 
 private:
     bool CreateInstance();
+
+    /**
+     * @brief Prints the frame timing results and appends them to the results file (CSV) if it is set.
+     * @param frameCount Number of the rendered frames.
+     * @param elapsedSeconds Total duration of the render loop in seconds.
+     */
+    void ReportFrameStatistics(std::uint64_t frameCount, double elapsedSeconds) const;
 };
 } // namespace common::vulkan_framework
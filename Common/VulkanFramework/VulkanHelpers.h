@@ -36,6 +36,12 @@ constexpr VkFormat GetVkFormat<float>()
     return VK_FORMAT_R32_SFLOAT;
 }
 
+template<>
+constexpr VkFormat GetVkFormat<std::uint32_t>()
+{
+    return VK_FORMAT_R32_UINT;
+}
+
 template<>
 constexpr VkFormat GetVkFormat<utility::Vec2>()
 {
@@ -48,6 +54,12 @@ constexpr VkFormat GetVkFormat<utility::Vec3>()
     return VK_FORMAT_R32G32B32_SFLOAT;
 }
 
+template<>
+constexpr VkFormat GetVkFormat<utility::Vec4>()
+{
+    return VK_FORMAT_R32G32B32A32_SFLOAT;
+}
+
 template<>
 constexpr VkFormat GetVkFormat<utility::Color3>()
 {
@@ -70,7 +82,7 @@ constexpr VkFormat GetVkFormat<float[4]>()
  * @brief Generates and returns input binding description that usable in Vulkan.
  * @tparam Vertex Type of the vertex.
  * @param bindingIndex Binding index of the binding description.
- * @param inputRate Input rate value.
+ * @param inputRate Input rate value (VK_VERTEX_INPUT_RATE_INSTANCE for per-instance data streams).
  * @return Returns vertex input binding description that usable in Vulkan.
  */
 template<typename Vertex>
@@ -114,6 +126,17 @@ VkVertexInputAttributeDescription GenerateAttributeDescriptionInternal(const uin
     GenerateAttributeDescriptionInternal<decltype(VertexStruct::Attribute)>(BindingIndex,                              \
                                                                             offsetof(VertexStruct, Attribute))
 
+/**
+ * @brief Rounds the value up to a multiple of the alignment (e.g. offset and size alignments of the device limits).
+ * @param value Value to be aligned.
+ * @param alignment Alignment value, 0 means no alignment.
+ * @return Returns the aligned value.
+ */
+constexpr VkDeviceSize AlignUp(const VkDeviceSize value, const VkDeviceSize alignment)
+{
+    return alignment > 0 ? (value + alignment - 1) / alignment * alignment : value;
+}
+
 /**
  * @brief Returns the specific position and size values of the region on the atlas image.
  * @param rect 2D rectangle position and size values.
@@ -50,6 +50,20 @@ VkMemoryRequirements VulkanBuffer::GetBufferMemoryRequirements() const
     return memoryReq;
 }
 
+VkDeviceAddress VulkanBuffer::GetDeviceAddress() const
+{
+    // Requires SHADER_DEVICE_ADDRESS usage and memory that is allocated with DEVICE_ADDRESS flag
+    VkBufferDeviceAddressInfo addressInfo{};
+    addressInfo.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
+    addressInfo.pNext = nullptr;
+    addressInfo.buffer = handle_;
+
+    if (const auto device = GetParent()) {
+        return vkGetBufferDeviceAddress(device->GetHandle(), &addressInfo);
+    }
+    return 0;
+}
+
 void VulkanBuffer::BindBufferMemory(const std::shared_ptr<VulkanDeviceMemory>& deviceMemory,
                                     const VkDeviceSize memoryOffset) const
 {
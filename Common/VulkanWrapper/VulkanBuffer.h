@@ -32,6 +32,8 @@ public:
 
     [[nodiscard]] COMMON_API VkMemoryRequirements GetBufferMemoryRequirements() const;
 
+    [[nodiscard]] COMMON_API VkDeviceAddress GetDeviceAddress() const;
+
     COMMON_API void BindBufferMemory(const std::shared_ptr<VulkanDeviceMemory>& deviceMemory, VkDeviceSize memoryOffset) const;
 };
 
@@ -102,6 +102,56 @@ void VulkanCommandBuffer::BindDescriptorSets(const VkPipelineBindPoint& pipeline
                             dynamicOffsets.empty() ? nullptr : dynamicOffsets.data());
 }
 
+bool VulkanCommandBuffer::PushDescriptorSet(const VkPipelineBindPoint& pipelineBindPoint,
+                                            const std::shared_ptr<VulkanPipelineLayout>& pipelineLayout,
+                                            const std::uint32_t set,
+                                            const std::vector<VkWriteDescriptorSet>& descriptorWrites) const
+{
+    const auto pool = GetParent();
+    const auto device = pool ? pool->GetParent() : nullptr;
+    if (!device || !device->GetPushDescriptorSetFunc()) {
+        return false;
+    }
+
+    device->GetPushDescriptorSetFunc()(handle_, pipelineBindPoint, pipelineLayout->GetHandle(), set,
+                                       descriptorWrites.size(),
+                                       descriptorWrites.empty() ? nullptr : descriptorWrites.data());
+    return true;
+}
+
+bool VulkanCommandBuffer::BindDescriptorBuffers(
+        const std::vector<VkDescriptorBufferBindingInfoEXT>& bindingInfos) const
+{
+    const auto pool = GetParent();
+    const auto device = pool ? pool->GetParent() : nullptr;
+    if (!device || !device->GetDescriptorBufferFuncs().CmdBindDescriptorBuffers) {
+        return false;
+    }
+
+    device->GetDescriptorBufferFuncs().CmdBindDescriptorBuffers(handle_, bindingInfos.size(), bindingInfos.data());
+    return true;
+}
+
+bool VulkanCommandBuffer::SetDescriptorBufferOffsets(const VkPipelineBindPoint& pipelineBindPoint,
+                                                     const std::shared_ptr<VulkanPipelineLayout>& pipelineLayout,
+                                                     const std::uint32_t firstSet,
+                                                     const std::vector<std::uint32_t>& bufferIndices,
+                                                     const std::vector<VkDeviceSize>& offsets) const
+{
+    const auto pool = GetParent();
+    const auto device = pool ? pool->GetParent() : nullptr;
+    if (!device || !device->GetDescriptorBufferFuncs().CmdSetDescriptorBufferOffsets ||
+        bufferIndices.size() != offsets.size()) {
+        return false;
+    }
+
+    device->GetDescriptorBufferFuncs().CmdSetDescriptorBufferOffsets(handle_, pipelineBindPoint,
+                                                                     pipelineLayout->GetHandle(), firstSet,
+                                                                     bufferIndices.size(), bufferIndices.data(),
+                                                                     offsets.data());
+    return true;
+}
+
 void VulkanCommandBuffer::BindIndexBuffer(const std::shared_ptr<VulkanBuffer>& indexBuffer,
                                           const VkDeviceSize& offset,
                                           const VkIndexType& indexType) const
@@ -144,6 +194,15 @@ void VulkanCommandBuffer::CopyBufferToImage(const std::shared_ptr<VulkanBuffer>&
                            regions.empty() ? nullptr : regions.data());
 }
 
+void VulkanCommandBuffer::CopyImageToBuffer(const std::shared_ptr<VulkanImage>& srcImage,
+                                            const VkImageLayout& imageLayout,
+                                            const std::shared_ptr<VulkanBuffer>& dstBuffer,
+                                            const std::vector<VkBufferImageCopy>& regions) const
+{
+    vkCmdCopyImageToBuffer(handle_, srcImage->GetHandle(), imageLayout, dstBuffer->GetHandle(), regions.size(),
+                           regions.empty() ? nullptr : regions.data());
+}
+
 void VulkanCommandBuffer::Draw(const std::uint32_t vertexCount,
                                const std::uint32_t instanceCount,
                                const std::uint32_t firstVertex,
@@ -161,6 +220,55 @@ void VulkanCommandBuffer::DrawIndexed(const std::uint32_t indexCount,
     vkCmdDrawIndexed(handle_, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
 }
 
+void VulkanCommandBuffer::DrawIndirect(const std::shared_ptr<VulkanBuffer>& buffer,
+                                       const VkDeviceSize& offset,
+                                       const std::uint32_t drawCount,
+                                       const std::uint32_t stride) const
+{
+    vkCmdDrawIndirect(handle_, buffer->GetHandle(), offset, drawCount, stride);
+}
+
+void VulkanCommandBuffer::DrawIndexedIndirect(const std::shared_ptr<VulkanBuffer>& buffer,
+                                              const VkDeviceSize& offset,
+                                              const std::uint32_t drawCount,
+                                              const std::uint32_t stride) const
+{
+    vkCmdDrawIndexedIndirect(handle_, buffer->GetHandle(), offset, drawCount, stride);
+}
+
+bool VulkanCommandBuffer::DrawIndexedIndirectCount(const std::shared_ptr<VulkanBuffer>& buffer,
+                                                   const VkDeviceSize& offset,
+                                                   const std::shared_ptr<VulkanBuffer>& countBuffer,
+                                                   const VkDeviceSize& countBufferOffset,
+                                                   const std::uint32_t maxDrawCount,
+                                                   const std::uint32_t stride) const
+{
+    const auto pool = GetParent();
+    const auto device = pool ? pool->GetParent() : nullptr;
+    if (!device || !device->GetDrawIndexedIndirectCountFunc()) {
+        return false;
+    }
+
+    device->GetDrawIndexedIndirectCountFunc()(handle_, buffer->GetHandle(), offset, countBuffer->GetHandle(),
+                                              countBufferOffset, maxDrawCount, stride);
+    return true;
+}
+
+void VulkanCommandBuffer::Dispatch(const std::uint32_t groupCountX,
+                                   const std::uint32_t groupCountY,
+                                   const std::uint32_t groupCountZ) const
+{
+    vkCmdDispatch(handle_, groupCountX, groupCountY, groupCountZ);
+}
+
+void VulkanCommandBuffer::FillBuffer(const std::shared_ptr<VulkanBuffer>& buffer,
+                                     const VkDeviceSize& offset,
+                                     const VkDeviceSize& size,
+                                     const std::uint32_t data) const
+{
+    vkCmdFillBuffer(handle_, buffer->GetHandle(), offset, size, data);
+}
+
 void VulkanCommandBuffer::PipelineBarrier(const VkPipelineStageFlags& srcStage,
                                           const VkPipelineStageFlags& dstStage,
                                           const std::vector<VkImageMemoryBarrier>& imageMemoryBarrier,
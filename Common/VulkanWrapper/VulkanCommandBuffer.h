@@ -53,6 +53,21 @@ public:
                             const std::vector<std::shared_ptr<VulkanDescriptorSet>>& descriptorSets = {},
                             const std::vector<std::uint32_t>& dynamicOffsets = {}) const;
 
+    [[nodiscard]] COMMON_API bool PushDescriptorSet(const VkPipelineBindPoint& pipelineBindPoint,
+                                                    const std::shared_ptr<VulkanPipelineLayout>& pipelineLayout,
+                                                    std::uint32_t set,
+                                                    const std::vector<VkWriteDescriptorSet>& descriptorWrites) const;
+
+    [[nodiscard]] COMMON_API bool
+    BindDescriptorBuffers(const std::vector<VkDescriptorBufferBindingInfoEXT>& bindingInfos) const;
+
+    [[nodiscard]] COMMON_API bool
+    SetDescriptorBufferOffsets(const VkPipelineBindPoint& pipelineBindPoint,
+                               const std::shared_ptr<VulkanPipelineLayout>& pipelineLayout,
+                               std::uint32_t firstSet,
+                               const std::vector<std::uint32_t>& bufferIndices,
+                               const std::vector<VkDeviceSize>& offsets) const;
+
     COMMON_API void BindIndexBuffer(const std::shared_ptr<VulkanBuffer>& indexBuffer,
                          const VkDeviceSize& offset = 0,
                          const VkIndexType& indexType = VK_INDEX_TYPE_UINT16) const;
@@ -73,6 +88,11 @@ public:
                            const VkImageLayout& imageLayout,
                            const std::vector<VkBufferImageCopy>& regions) const;
 
+    COMMON_API void CopyImageToBuffer(const std::shared_ptr<VulkanImage>& srcImage,
+                                      const VkImageLayout& imageLayout,
+                                      const std::shared_ptr<VulkanBuffer>& dstBuffer,
+                                      const std::vector<VkBufferImageCopy>& regions) const;
+
     COMMON_API void Draw(std::uint32_t vertexCount,
               std::uint32_t instanceCount,
               std::uint32_t firstVertex,
@@ -84,6 +104,30 @@ public:
                      std::int32_t vertexOffset,
                      std::uint32_t firstInstance) const;
 
+    COMMON_API void DrawIndirect(const std::shared_ptr<VulkanBuffer>& buffer,
+                                 const VkDeviceSize& offset,
+                                 std::uint32_t drawCount,
+                                 std::uint32_t stride) const;
+
+    COMMON_API void DrawIndexedIndirect(const std::shared_ptr<VulkanBuffer>& buffer,
+                                        const VkDeviceSize& offset,
+                                        std::uint32_t drawCount,
+                                        std::uint32_t stride) const;
+
+    [[nodiscard]] COMMON_API bool DrawIndexedIndirectCount(const std::shared_ptr<VulkanBuffer>& buffer,
+                                                           const VkDeviceSize& offset,
+                                                           const std::shared_ptr<VulkanBuffer>& countBuffer,
+                                                           const VkDeviceSize& countBufferOffset,
+                                                           std::uint32_t maxDrawCount,
+                                                           std::uint32_t stride) const;
+
+    COMMON_API void Dispatch(std::uint32_t groupCountX, std::uint32_t groupCountY, std::uint32_t groupCountZ) const;
+
+    COMMON_API void FillBuffer(const std::shared_ptr<VulkanBuffer>& buffer,
+                               const VkDeviceSize& offset,
+                               const VkDeviceSize& size,
+                               std::uint32_t data) const;
+
     COMMON_API void PipelineBarrier(const VkPipelineStageFlags& srcStage,
                          const VkPipelineStageFlags& dstStage,
                          const std::vector<VkImageMemoryBarrier>& imageMemoryBarrier,
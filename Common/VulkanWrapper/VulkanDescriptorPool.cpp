@@ -12,17 +12,40 @@
 
 namespace common::vulkan_wrapper
 {
-VulkanDescriptorPool::VulkanDescriptorPool(std::shared_ptr<VulkanDevice> device, VkDescriptorPool descriptorPool)
-    : VulkanObject(std::move(device), descriptorPool)
+VulkanDescriptorPool::VulkanDescriptorPool(std::shared_ptr<VulkanDevice> device,
+                                           VkDescriptorPool descriptorPool,
+                                           const VkDescriptorPoolCreateFlags& createFlags)
+    : VulkanObject(std::move(device), descriptorPool), createFlags_{createFlags}
 {
 }
 
 std::vector<std::shared_ptr<VulkanDescriptorSet>> VulkanDescriptorPool::CreateDescriptorSets(
-        const std::vector<std::shared_ptr<VulkanDescriptorSetLayout>>& descriptorSetLayouts)
+        const std::vector<std::shared_ptr<VulkanDescriptorSetLayout>>& descriptorSetLayouts,
+        const std::vector<std::uint32_t>& variableDescriptorCounts)
 {
+    std::vector<std::shared_ptr<VulkanDescriptorSet>> descriptorSets;
+    if (AllocateDescriptorSets(descriptorSetLayouts, descriptorSets, variableDescriptorCounts) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to allocate descriptor sets!");
+    }
+
+    return descriptorSets;
+}
+
+VkResult VulkanDescriptorPool::AllocateDescriptorSets(
+        const std::vector<std::shared_ptr<VulkanDescriptorSetLayout>>& descriptorSetLayouts,
+        std::vector<std::shared_ptr<VulkanDescriptorSet>>& descriptorSets,
+        const std::vector<std::uint32_t>& variableDescriptorCounts)
+{
+    // Variable descriptor counts (descriptor indexing) are only chained if they are given
+    VkDescriptorSetVariableDescriptorCountAllocateInfo variableCountInfo{};
+    variableCountInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO;
+    variableCountInfo.pNext = nullptr;
+    variableCountInfo.descriptorSetCount = variableDescriptorCounts.size();
+    variableCountInfo.pDescriptorCounts = variableDescriptorCounts.empty() ? nullptr : variableDescriptorCounts.data();
+
     VkDescriptorSetAllocateInfo allocateInfo{};
     allocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-    allocateInfo.pNext = nullptr;
+    allocateInfo.pNext = variableDescriptorCounts.empty() ? nullptr : &variableCountInfo;
     allocateInfo.descriptorPool = handle_;
     allocateInfo.descriptorSetCount = descriptorSetLayouts.size();
 
@@ -34,17 +57,23 @@ std::vector<std::shared_ptr<VulkanDescriptorSet>> VulkanDescriptorPool::CreateDe
 
     std::vector<VkDescriptorSet> vkDescSets(descriptorSetLayouts.size());
     const auto device = GetParent();
-    if (!device || vkAllocateDescriptorSets(device->GetHandle(), &allocateInfo, vkDescSets.data()) != VK_SUCCESS) {
-        throw std::runtime_error("Failed to allocate descriptor sets!");
+    if (!device) {
+        return VK_ERROR_DEVICE_LOST;
     }
 
-    std::vector<std::shared_ptr<VulkanDescriptorSet>> descriptorSets;
+    // Out of pool memory and fragmented pool errors are returned, so callers can continue with another pool
+    const auto result = vkAllocateDescriptorSets(device->GetHandle(), &allocateInfo, vkDescSets.data());
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+
+    descriptorSets.clear();
     for (auto& descSet: vkDescSets) {
         auto vulkanDescSet = std::make_shared<VulkanDescriptorSet>(shared_from_this(), descSet);
         descriptorSets.push_back(vulkanDescSet);
     }
 
-    return descriptorSets;
+    return VK_SUCCESS;
 }
 
 void VulkanDescriptorPool::ResetDescriptorPool(const VkDescriptorPoolResetFlags& resetFlags) const
@@ -10,6 +10,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -28,13 +29,29 @@ class VulkanDescriptorPool final : public VulkanObject<VulkanDevice, VkDescripto
                                    public std::enable_shared_from_this<VulkanDescriptorPool>
 {
 public:
-    COMMON_API explicit VulkanDescriptorPool(std::shared_ptr<VulkanDevice> device, VkDescriptorPool descriptorPool);
+    COMMON_API explicit VulkanDescriptorPool(std::shared_ptr<VulkanDevice> device,
+                                             VkDescriptorPool descriptorPool,
+                                             const VkDescriptorPoolCreateFlags& createFlags = 0);
 
     COMMON_API std::vector<std::shared_ptr<VulkanDescriptorSet>>
-    CreateDescriptorSets(const std::vector<std::shared_ptr<VulkanDescriptorSetLayout>>& descriptorSetLayouts);
+    CreateDescriptorSets(const std::vector<std::shared_ptr<VulkanDescriptorSetLayout>>& descriptorSetLayouts,
+                         const std::vector<std::uint32_t>& variableDescriptorCounts = {});
+
+    COMMON_API VkResult
+    AllocateDescriptorSets(const std::vector<std::shared_ptr<VulkanDescriptorSetLayout>>& descriptorSetLayouts,
+                           std::vector<std::shared_ptr<VulkanDescriptorSet>>& descriptorSets,
+                           const std::vector<std::uint32_t>& variableDescriptorCounts = {});
+
+    [[nodiscard]] COMMON_API bool CanFreeDescriptorSets() const
+    {
+        return (createFlags_ & VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT) != 0;
+    }
 
     COMMON_API void ResetDescriptorPool(const VkDescriptorPoolResetFlags& resetFlags = 0) const;
 
     COMMON_API ~VulkanDescriptorPool() override;
+
+private:
+    VkDescriptorPoolCreateFlags createFlags_ = 0;
 };
 } // namespace common::vulkan_wrapper
@@ -43,7 +43,9 @@ VulkanDescriptorSet::CreateWriteDescriptorSet(const std::uint32_t dstBinding,
 VulkanDescriptorSet::~VulkanDescriptorSet()
 {
     if (handle_ != VK_NULL_HANDLE) {
-        if (const auto pool = GetParent()) {
+        // Sets of the pools without free flag are released with pool reset or pool destruction
+        const auto pool = GetParent();
+        if (pool && pool->CanFreeDescriptorSets()) {
             if (const auto device = pool->GetParent()) {
                 vkDeviceWaitIdle(device->GetHandle());
                 vkFreeDescriptorSets(device->GetHandle(), pool->GetHandle(), 1, &handle_);
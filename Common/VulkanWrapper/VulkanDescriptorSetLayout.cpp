@@ -25,4 +25,24 @@ VulkanDescriptorSetLayout::~VulkanDescriptorSetLayout()
         }
     }
 }
+
+VkDeviceSize VulkanDescriptorSetLayout::GetLayoutSizeInBytes() const
+{
+    VkDeviceSize layoutSize = 0;
+    if (const auto device = GetParent(); device && device->GetDescriptorBufferFuncs().GetDescriptorSetLayoutSize) {
+        device->GetDescriptorBufferFuncs().GetDescriptorSetLayoutSize(device->GetHandle(), handle_, &layoutSize);
+    }
+    return layoutSize;
+}
+
+VkDeviceSize VulkanDescriptorSetLayout::GetBindingOffset(const std::uint32_t binding) const
+{
+    VkDeviceSize bindingOffset = 0;
+    if (const auto device = GetParent();
+        device && device->GetDescriptorBufferFuncs().GetDescriptorSetLayoutBindingOffset) {
+        device->GetDescriptorBufferFuncs().GetDescriptorSetLayoutBindingOffset(device->GetHandle(), handle_, binding,
+                                                                               &bindingOffset);
+    }
+    return bindingOffset;
+}
 } // namespace common::vulkan_wrapper
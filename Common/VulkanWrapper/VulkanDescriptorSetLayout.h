@@ -10,6 +10,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
 #include <vulkan/vulkan_core.h>
@@ -27,5 +28,9 @@ public:
     COMMON_API explicit VulkanDescriptorSetLayout(std::shared_ptr<VulkanDevice> device, VkDescriptorSetLayout descriptorSetLayout);
 
     COMMON_API ~VulkanDescriptorSetLayout() override;
+
+    [[nodiscard]] COMMON_API VkDeviceSize GetLayoutSizeInBytes() const;
+
+    [[nodiscard]] COMMON_API VkDeviceSize GetBindingOffset(std::uint32_t binding) const;
 };
 } // namespace common::vulkan_wrapper
@@ -0,0 +1,37 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "VulkanDescriptorUpdateTemplate.h"
+
+#include "VulkanDescriptorSet.h"
+#include "VulkanDevice.h"
+
+namespace common::vulkan_wrapper
+{
+VulkanDescriptorUpdateTemplate::VulkanDescriptorUpdateTemplate(std::shared_ptr<VulkanDevice> device,
+                                                               VkDescriptorUpdateTemplate updateTemplate)
+    : VulkanObject(std::move(device), updateTemplate)
+{
+}
+
+void VulkanDescriptorUpdateTemplate::UpdateDescriptorSet(const std::shared_ptr<VulkanDescriptorSet>& descriptorSet,
+                                                         const void* data) const
+{
+    if (const auto device = GetParent()) {
+        vkUpdateDescriptorSetWithTemplate(device->GetHandle(), descriptorSet->GetHandle(), handle_, data);
+    }
+}
+
+VulkanDescriptorUpdateTemplate::~VulkanDescriptorUpdateTemplate()
+{
+    if (handle_ != VK_NULL_HANDLE) {
+        if (const auto device = GetParent()) {
+            vkDestroyDescriptorUpdateTemplate(device->GetHandle(), handle_, nullptr);
+            handle_ = VK_NULL_HANDLE;
+        }
+    }
+}
+} // namespace common::vulkan_wrapper
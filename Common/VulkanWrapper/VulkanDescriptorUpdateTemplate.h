@@ -0,0 +1,42 @@
+/**
+ * @file    VulkanDescriptorUpdateTemplate.h
+ * @brief   This file contains wrapper class implementation for VkDescriptorUpdateTemplate.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <memory>
+
+#include <vulkan/vulkan_core.h>
+
+#include "CoreDefines.h"
+#include "VulkanObject.h"
+
+namespace common::vulkan_wrapper
+{
+class VulkanDevice;
+class VulkanDescriptorSet;
+
+class VulkanDescriptorUpdateTemplate final : public VulkanObject<VulkanDevice, VkDescriptorUpdateTemplate>
+{
+public:
+    COMMON_API explicit VulkanDescriptorUpdateTemplate(std::shared_ptr<VulkanDevice> device,
+                                                       VkDescriptorUpdateTemplate updateTemplate);
+
+    /**
+     * @brief Writes all descriptors of the template to the set with one vkUpdateDescriptorSetWithTemplate call.
+     * @param descriptorSet Descriptor set that is created with the layout of the template.
+     * @param data Pointer to the packed descriptor infos. Offsets and strides of the template entries are relative to
+     * this pointer.
+     */
+    COMMON_API void UpdateDescriptorSet(const std::shared_ptr<VulkanDescriptorSet>& descriptorSet,
+                                        const void* data) const;
+
+    COMMON_API ~VulkanDescriptorUpdateTemplate() override;
+};
+} // namespace common::vulkan_wrapper
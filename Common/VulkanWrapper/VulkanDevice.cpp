@@ -12,6 +12,7 @@
 #include "VulkanCommandPool.h"
 #include "VulkanDescriptorPool.h"
 #include "VulkanDescriptorSetLayout.h"
+#include "VulkanDescriptorUpdateTemplate.h"
 #include "VulkanDeviceMemory.h"
 #include "VulkanFence.h"
 #include "VulkanFramebuffer.h"
@@ -57,9 +58,36 @@ inline VkDeviceQueueCreateInfo GetDefaultQueueCreateInfo()
     return createInfo;
 }
 
-VulkanDevice::VulkanDevice(std::shared_ptr<VulkanPhysicalDevice> physicalDevice, VkDevice device)
-    : VulkanObject(std::move(physicalDevice), device)
+VulkanDevice::VulkanDevice(std::shared_ptr<VulkanPhysicalDevice> physicalDevice,
+                           VkDevice device,
+                           std::vector<std::string> enabledExtensions)
+    : VulkanObject(std::move(physicalDevice), device), enabledExtensions_{std::move(enabledExtensions)}
 {
+    // Extension commands are loaded once, so command buffers don't query them on every call
+    if (IsExtensionEnabled(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME)) {
+        pushDescriptorSetFunc_ =
+                reinterpret_cast<PFN_vkCmdPushDescriptorSetKHR>(GetDeviceProcAddr("vkCmdPushDescriptorSetKHR"));
+    }
+
+    if (IsExtensionEnabled(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME)) {
+        drawIndexedIndirectCountFunc_ = reinterpret_cast<PFN_vkCmdDrawIndexedIndirectCountKHR>(
+                GetDeviceProcAddr("vkCmdDrawIndexedIndirectCountKHR"));
+    }
+
+    if (IsExtensionEnabled(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME)) {
+        descriptorBufferFuncs_.GetDescriptorSetLayoutSize = reinterpret_cast<PFN_vkGetDescriptorSetLayoutSizeEXT>(
+                GetDeviceProcAddr("vkGetDescriptorSetLayoutSizeEXT"));
+        descriptorBufferFuncs_.GetDescriptorSetLayoutBindingOffset =
+                reinterpret_cast<PFN_vkGetDescriptorSetLayoutBindingOffsetEXT>(
+                        GetDeviceProcAddr("vkGetDescriptorSetLayoutBindingOffsetEXT"));
+        descriptorBufferFuncs_.GetDescriptor =
+                reinterpret_cast<PFN_vkGetDescriptorEXT>(GetDeviceProcAddr("vkGetDescriptorEXT"));
+        descriptorBufferFuncs_.CmdBindDescriptorBuffers = reinterpret_cast<PFN_vkCmdBindDescriptorBuffersEXT>(
+                GetDeviceProcAddr("vkCmdBindDescriptorBuffersEXT"));
+        descriptorBufferFuncs_.CmdSetDescriptorBufferOffsets =
+                reinterpret_cast<PFN_vkCmdSetDescriptorBufferOffsetsEXT>(
+                        GetDeviceProcAddr("vkCmdSetDescriptorBufferOffsetsEXT"));
+    }
 }
 
 VulkanDevice::~VulkanDevice()
@@ -154,18 +182,26 @@ VulkanDevice::CreateDescriptorPool(const std::uint32_t maxSets,
         return nullptr;
     }
 
-    return std::make_shared<VulkanDescriptorPool>(device, descriptorPool);
+    return std::make_shared<VulkanDescriptorPool>(device, descriptorPool, flags);
 }
 
 std::shared_ptr<VulkanDescriptorSetLayout>
 VulkanDevice::CreateDescriptorSetLayout(const std::vector<VkDescriptorSetLayoutBinding>& bindings,
-                                        const VkDescriptorSetLayoutCreateFlags& flags)
+                                        const VkDescriptorSetLayoutCreateFlags& flags,
+                                        const std::vector<VkDescriptorBindingFlags>& bindingFlags)
 {
     auto device = shared_from_this();
 
+    // Binding flags (descriptor indexing) are only chained if they are given
+    VkDescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsCreateInfo{};
+    bindingFlagsCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+    bindingFlagsCreateInfo.pNext = nullptr;
+    bindingFlagsCreateInfo.bindingCount = bindingFlags.size();
+    bindingFlagsCreateInfo.pBindingFlags = bindingFlags.empty() ? nullptr : bindingFlags.data();
+
     VkDescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo;
     descriptorSetLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-    descriptorSetLayoutCreateInfo.pNext = nullptr;
+    descriptorSetLayoutCreateInfo.pNext = bindingFlags.empty() ? nullptr : &bindingFlagsCreateInfo;
     descriptorSetLayoutCreateInfo.flags = flags;
     descriptorSetLayoutCreateInfo.bindingCount = bindings.size();
     descriptorSetLayoutCreateInfo.pBindings = bindings.empty() ? nullptr : bindings.data();
@@ -180,6 +216,35 @@ VulkanDevice::CreateDescriptorSetLayout(const std::vector<VkDescriptorSetLayoutB
     return std::make_shared<VulkanDescriptorSetLayout>(device, descriptorSetLayout);
 }
 
+std::shared_ptr<VulkanDescriptorUpdateTemplate>
+VulkanDevice::CreateDescriptorUpdateTemplate(const std::shared_ptr<VulkanDescriptorSetLayout>& descSetLayout,
+                                             const std::vector<VkDescriptorUpdateTemplateEntry>& entries)
+{
+    auto device = shared_from_this();
+
+    VkDescriptorUpdateTemplateCreateInfo updateTemplateCreateInfo;
+    updateTemplateCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+    updateTemplateCreateInfo.pNext = nullptr;
+    updateTemplateCreateInfo.flags = 0;
+    updateTemplateCreateInfo.descriptorUpdateEntryCount = entries.size();
+    updateTemplateCreateInfo.pDescriptorUpdateEntries = entries.empty() ? nullptr : entries.data();
+    updateTemplateCreateInfo.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    updateTemplateCreateInfo.descriptorSetLayout = descSetLayout->GetHandle();
+    // Bind point, pipeline layout and set index are only used by push descriptor templates
+    updateTemplateCreateInfo.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    updateTemplateCreateInfo.pipelineLayout = VK_NULL_HANDLE;
+    updateTemplateCreateInfo.set = 0;
+
+    VkDescriptorUpdateTemplate updateTemplate = VK_NULL_HANDLE;
+    if (vkCreateDescriptorUpdateTemplate(device->GetHandle(), &updateTemplateCreateInfo, nullptr, &updateTemplate) !=
+        VK_SUCCESS) {
+        std::cout << "Failed to create descriptor update template!" << std::endl;
+        return nullptr;
+    }
+
+    return std::make_shared<VulkanDescriptorUpdateTemplate>(device, updateTemplate);
+}
+
 std::shared_ptr<VulkanSwapChain>
 VulkanDevice::CreateSwapChain(const std::shared_ptr<VulkanSurface>& surface,
                               const std::function<void(VulkanSwapChainBuilder&)>& builderFunc)
@@ -303,6 +368,18 @@ VulkanDevice::CreateGraphicsPipeline(const std::shared_ptr<VulkanPipelineLayout>
     return graphicsPipelineBuilder.Build(device, layout, renderPass);
 }
 
+std::shared_ptr<VulkanPipeline>
+VulkanDevice::CreateComputePipeline(const std::shared_ptr<VulkanPipelineLayout>& layout,
+                                    const std::function<void(VulkanComputePipelineBuilder&)>& builderFunc)
+{
+    const auto device = shared_from_this();
+
+    VulkanComputePipelineBuilder computePipelineBuilder;
+    builderFunc(computePipelineBuilder);
+
+    return computePipelineBuilder.Build(device, layout);
+}
+
 std::shared_ptr<VulkanBuffer> VulkanDevice::CreateBuffer(const std::function<void(VulkanBufferBuilder&)>& builderFunc)
 {
     const auto device = shared_from_this();
@@ -314,13 +391,21 @@ std::shared_ptr<VulkanBuffer> VulkanDevice::CreateBuffer(const std::function<voi
 }
 
 std::shared_ptr<VulkanDeviceMemory> VulkanDevice::AllocateMemory(const VkDeviceSize& size,
-                                                                 const std::uint32_t memoryTypeIndex)
+                                                                 const std::uint32_t memoryTypeIndex,
+                                                                 const VkMemoryAllocateFlags allocateFlags)
 {
     auto device = shared_from_this();
 
+    // Needed for memory of the buffers that are accessed with device addresses (e.g. descriptor buffers)
+    VkMemoryAllocateFlagsInfo allocateFlagsInfo{};
+    allocateFlagsInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+    allocateFlagsInfo.pNext = nullptr;
+    allocateFlagsInfo.flags = allocateFlags;
+    allocateFlagsInfo.deviceMask = 0;
+
     VkMemoryAllocateInfo allocateInfo{};
     allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocateInfo.pNext = nullptr;
+    allocateInfo.pNext = allocateFlags != 0 ? &allocateFlagsInfo : nullptr;
     allocateInfo.allocationSize = size;
     allocateInfo.memoryTypeIndex = memoryTypeIndex;
 
@@ -358,6 +443,28 @@ void VulkanDevice::WaitIdle() const
     }
 }
 
+PFN_vkVoidFunction VulkanDevice::GetDeviceProcAddr(const std::string& name) const
+{
+    return vkGetDeviceProcAddr(handle_, name.c_str());
+}
+
+bool VulkanDevice::GetDescriptor(const VkDescriptorGetInfoEXT& getInfo,
+                                 const std::size_t dataSize,
+                                 void* descriptor) const
+{
+    if (!descriptorBufferFuncs_.GetDescriptor) {
+        return false;
+    }
+
+    descriptorBufferFuncs_.GetDescriptor(handle_, &getInfo, dataSize, descriptor);
+    return true;
+}
+
+bool VulkanDevice::IsExtensionEnabled(const std::string& extensionName) const
+{
+    return std::ranges::find(enabledExtensions_, extensionName) != enabledExtensions_.end();
+}
+
 VulkanDeviceBuilder::VulkanDeviceBuilder() : createInfo(GetDefaultDeviceCreateInfo()) {}
 
 VulkanDeviceBuilder& VulkanDeviceBuilder::AddQueueInfo(const std::function<void(VkDeviceQueueCreateInfo&)>& setterFunc)
@@ -398,6 +505,12 @@ VulkanDeviceBuilder& VulkanDeviceBuilder::SetDeviceFeatures(const VkPhysicalDevi
     return *this;
 }
 
+VulkanDeviceBuilder& VulkanDeviceBuilder::SetNext(const void* next)
+{
+    createInfo.pNext = next;
+    return *this;
+}
+
 std::shared_ptr<VulkanDevice> VulkanDeviceBuilder::Build(const std::shared_ptr<VulkanPhysicalDevice>& physicalDevice)
 {
     if (!queueCreateInfos_.empty()) {
@@ -428,6 +541,6 @@ std::shared_ptr<VulkanDevice> VulkanDeviceBuilder::Build(const std::shared_ptr<V
         return nullptr;
     }
 
-    return std::make_shared<VulkanDevice>(physicalDevice, device);
+    return std::make_shared<VulkanDevice>(physicalDevice, device, extensions_);
 }
 } // namespace common::vulkan_wrapper
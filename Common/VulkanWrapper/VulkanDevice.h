@@ -12,6 +12,8 @@
 
 #include <functional>
 #include <optional>
+#include <string>
+#include <vector>
 
 #include <vulkan/vulkan_core.h>
 
@@ -25,6 +27,8 @@ class VulkanBufferBuilder;
 class VulkanCommandPool;
 class VulkanDescriptorPool;
 class VulkanDescriptorSetLayout;
+class VulkanDescriptorUpdateTemplate;
+class VulkanComputePipelineBuilder;
 class VulkanDeviceMemory;
 class VulkanFence;
 class VulkanFramebuffer;
@@ -48,11 +52,22 @@ class VulkanSurface;
 class VulkanSwapChain;
 class VulkanSwapChainBuilder;
 
+struct DescriptorBufferFunctions
+{
+    PFN_vkGetDescriptorSetLayoutSizeEXT GetDescriptorSetLayoutSize = nullptr;
+    PFN_vkGetDescriptorSetLayoutBindingOffsetEXT GetDescriptorSetLayoutBindingOffset = nullptr;
+    PFN_vkGetDescriptorEXT GetDescriptor = nullptr;
+    PFN_vkCmdBindDescriptorBuffersEXT CmdBindDescriptorBuffers = nullptr;
+    PFN_vkCmdSetDescriptorBufferOffsetsEXT CmdSetDescriptorBufferOffsets = nullptr;
+};
+
 class VulkanDevice final : public VulkanObject<VulkanPhysicalDevice, VkDevice>,
                            public std::enable_shared_from_this<VulkanDevice>
 {
 public:
-    COMMON_API VulkanDevice(std::shared_ptr<VulkanPhysicalDevice> physicalDevice, VkDevice device);
+    COMMON_API VulkanDevice(std::shared_ptr<VulkanPhysicalDevice> physicalDevice,
+                            VkDevice device,
+                            std::vector<std::string> enabledExtensions = {});
 
     COMMON_API ~VulkanDevice() override;
 
@@ -71,7 +86,12 @@ public:
 
     COMMON_API std::shared_ptr<VulkanDescriptorSetLayout>
     CreateDescriptorSetLayout(const std::vector<VkDescriptorSetLayoutBinding>& bindings,
-                              const VkDescriptorSetLayoutCreateFlags& flags = 0);
+                              const VkDescriptorSetLayoutCreateFlags& flags = 0,
+                              const std::vector<VkDescriptorBindingFlags>& bindingFlags = {});
+
+    COMMON_API std::shared_ptr<VulkanDescriptorUpdateTemplate>
+    CreateDescriptorUpdateTemplate(const std::shared_ptr<VulkanDescriptorSetLayout>& descSetLayout,
+                                   const std::vector<VkDescriptorUpdateTemplateEntry>& entries);
 
     COMMON_API std::shared_ptr<VulkanSwapChain> CreateSwapChain(const std::shared_ptr<VulkanSurface>& surface,
                                                      const std::function<void(VulkanSwapChainBuilder&)>& builderFunc);
@@ -101,9 +121,15 @@ public:
                            const std::shared_ptr<VulkanRenderPass>& renderPass,
                            const std::function<void(VulkanGraphicsPipelineBuilder&)>& builderFunc);
 
+    COMMON_API std::shared_ptr<VulkanPipeline>
+    CreateComputePipeline(const std::shared_ptr<VulkanPipelineLayout>& layout,
+                          const std::function<void(VulkanComputePipelineBuilder&)>& builderFunc);
+
     COMMON_API std::shared_ptr<VulkanBuffer> CreateBuffer(const std::function<void(VulkanBufferBuilder&)>& builderFunc);
 
-    COMMON_API std::shared_ptr<VulkanDeviceMemory> AllocateMemory(const VkDeviceSize& size, std::uint32_t memoryTypeIndex);
+    COMMON_API std::shared_ptr<VulkanDeviceMemory> AllocateMemory(const VkDeviceSize& size,
+                                                                  std::uint32_t memoryTypeIndex,
+                                                                  VkMemoryAllocateFlags allocateFlags = 0);
 
     COMMON_API void UpdateDescriptorSets(const std::vector<VkWriteDescriptorSet>& writeDescriptorSets,
                               const std::vector<VkCopyDescriptorSet>& copyDescriptorSets = {}) const;
@@ -111,6 +137,39 @@ public:
     COMMON_API std::shared_ptr<VulkanSampler> CreateSampler(const std::function<void(VulkanSamplerBuilder&)>& builderFunc);
 
     COMMON_API void WaitIdle() const;
+
+    [[nodiscard]] COMMON_API PFN_vkVoidFunction GetDeviceProcAddr(const std::string& name) const;
+
+    [[nodiscard]] COMMON_API bool IsExtensionEnabled(const std::string& extensionName) const;
+
+    [[nodiscard]] COMMON_API PFN_vkCmdPushDescriptorSetKHR GetPushDescriptorSetFunc() const
+    {
+        return pushDescriptorSetFunc_;
+    }
+
+    [[nodiscard]] COMMON_API PFN_vkCmdDrawIndexedIndirectCountKHR GetDrawIndexedIndirectCountFunc() const
+    {
+        return drawIndexedIndirectCountFunc_;
+    }
+
+    [[nodiscard]] COMMON_API const DescriptorBufferFunctions& GetDescriptorBufferFuncs() const
+    {
+        return descriptorBufferFuncs_;
+    }
+
+    [[nodiscard]] COMMON_API bool IsDescriptorBufferEnabled() const
+    {
+        return descriptorBufferFuncs_.GetDescriptor != nullptr;
+    }
+
+    [[nodiscard]] COMMON_API bool
+    GetDescriptor(const VkDescriptorGetInfoEXT& getInfo, std::size_t dataSize, void* descriptor) const;
+
+private:
+    std::vector<std::string> enabledExtensions_;
+    PFN_vkCmdPushDescriptorSetKHR pushDescriptorSetFunc_ = nullptr;
+    PFN_vkCmdDrawIndexedIndirectCountKHR drawIndexedIndirectCountFunc_ = nullptr;
+    DescriptorBufferFunctions descriptorBufferFuncs_;
 };
 
 class COMMON_API VulkanDeviceBuilder
@@ -130,6 +189,8 @@ public:
 
     VulkanDeviceBuilder& SetDeviceFeatures(const VkPhysicalDeviceFeatures& features);
 
+    VulkanDeviceBuilder& SetNext(const void* next);
+
     std::shared_ptr<VulkanDevice> Build(const std::shared_ptr<VulkanPhysicalDevice>& physicalDevice);
 
 private:
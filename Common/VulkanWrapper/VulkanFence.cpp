@@ -42,4 +42,19 @@ void VulkanFence::ResetFence() const
         throw std::runtime_error("Failed to reset fences!");
     }
 }
+
+bool VulkanFence::IsSignaled() const
+{
+    const auto device = GetParent();
+    if (!device) {
+        throw std::runtime_error("Failed to get fence status!");
+    }
+
+    const VkResult result = vkGetFenceStatus(device->GetHandle(), handle_);
+    if (result != VK_SUCCESS && result != VK_NOT_READY) {
+        throw std::runtime_error("Failed to get fence status!");
+    }
+
+    return result == VK_SUCCESS;
+}
 } // namespace common::vulkan_wrapper
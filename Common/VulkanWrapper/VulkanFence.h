@@ -32,5 +32,7 @@ public:
     COMMON_API void WaitForFence(bool waitAll, uint64_t timeout) const;
 
     COMMON_API void ResetFence() const;
+
+    [[nodiscard]] COMMON_API bool IsSignaled() const;
 };
 } // namespace common::vulkan_wrapper
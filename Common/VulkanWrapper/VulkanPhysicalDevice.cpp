@@ -6,6 +6,7 @@
 
 #include "VulkanPhysicalDevice.h"
 
+#include <algorithm>
 #include <iostream>
 #include <utility>
 
@@ -116,6 +117,44 @@ VkPhysicalDeviceFeatures VulkanPhysicalDevice::GetSupportedFeatures() const
     return supportedFeatures;
 }
 
+void VulkanPhysicalDevice::GetExtendedFeatures(void* featureChain) const
+{
+    // Requires Vulkan 1.1 instance, given chain is filled by the driver
+    VkPhysicalDeviceFeatures2 features2{};
+    features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    features2.pNext = featureChain;
+    vkGetPhysicalDeviceFeatures2(handle_, &features2);
+}
+
+void VulkanPhysicalDevice::GetExtendedProperties(void* propertyChain) const
+{
+    // Requires Vulkan 1.1 instance, given chain is filled by the driver
+    VkPhysicalDeviceProperties2 properties2{};
+    properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+    properties2.pNext = propertyChain;
+    vkGetPhysicalDeviceProperties2(handle_, &properties2);
+}
+
+bool VulkanPhysicalDevice::IsExtensionSupported(const std::string& extensionName) const
+{
+    std::uint32_t extensionCount = 0;
+    vkEnumerateDeviceExtensionProperties(handle_, nullptr, &extensionCount, nullptr);
+
+    std::vector<VkExtensionProperties> extensions(extensionCount);
+    vkEnumerateDeviceExtensionProperties(handle_, nullptr, &extensionCount, extensions.data());
+
+    return std::ranges::any_of(extensions, [&](const VkExtensionProperties& extension) {
+        return extensionName == extension.extensionName;
+    });
+}
+
+VkFormatProperties VulkanPhysicalDevice::GetFormatProperties(const VkFormat& format) const
+{
+    VkFormatProperties props;
+    vkGetPhysicalDeviceFormatProperties(handle_, format, &props);
+    return props;
+}
+
 VkFormat VulkanPhysicalDevice::FindSupportedFormat(const std::vector<VkFormat>& candidateFormats,
                                                    const VkFormatFeatureFlags& features,
                                                    const VkImageTiling& tiling) const
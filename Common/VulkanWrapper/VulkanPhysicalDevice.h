@@ -13,6 +13,7 @@
 
 #include <functional>
 #include <optional>
+#include <string>
 #include <vector>
 
 #include <vulkan/vulkan_core.h>
@@ -51,6 +52,14 @@ public:
 
     COMMON_API VkPhysicalDeviceFeatures GetSupportedFeatures() const;
 
+    COMMON_API void GetExtendedFeatures(void* featureChain) const;
+
+    COMMON_API void GetExtendedProperties(void* propertyChain) const;
+
+    COMMON_API bool IsExtensionSupported(const std::string& extensionName) const;
+
+    COMMON_API VkFormatProperties GetFormatProperties(const VkFormat& format) const;
+
     COMMON_API VkFormat FindSupportedFormat(const std::vector<VkFormat>& candidateFormats,
                                  const VkFormatFeatureFlags& features,
                                  const VkImageTiling& tiling = VK_IMAGE_TILING_OPTIMAL) const;
@@ -34,6 +34,15 @@ inline VkSamplerCreateInfo GetDefaultSamplerCreateInfo()
     return createInfo;
 }
 
+inline VkSamplerReductionModeCreateInfoEXT GetDefaultReductionModeCreateInfo()
+{
+    VkSamplerReductionModeCreateInfoEXT reductionModeInfo{};
+    reductionModeInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO_EXT;
+    reductionModeInfo.pNext = nullptr;
+    reductionModeInfo.reductionMode = VK_SAMPLER_REDUCTION_MODE_WEIGHTED_AVERAGE_EXT;
+    return reductionModeInfo;
+}
+
 VulkanSampler::VulkanSampler(std::shared_ptr<VulkanDevice> device, VkSampler sampler)
     : VulkanObject(std::move(device), sampler)
 {
@@ -49,7 +58,10 @@ VulkanSampler::~VulkanSampler()
     }
 }
 
-VulkanSamplerBuilder::VulkanSamplerBuilder() : createInfo_(GetDefaultSamplerCreateInfo()) {}
+VulkanSamplerBuilder::VulkanSamplerBuilder()
+    : createInfo_(GetDefaultSamplerCreateInfo()), reductionModeInfo_(GetDefaultReductionModeCreateInfo())
+{
+}
 
 VulkanSamplerBuilder& VulkanSamplerBuilder::SetCreateFlags(const VkSamplerCreateFlags& flags)
 {
@@ -129,10 +141,22 @@ VulkanSamplerBuilder& VulkanSamplerBuilder::EnableUnnormalizedCoordinates(const
     return *this;
 }
 
+VulkanSamplerBuilder& VulkanSamplerBuilder::SetReductionMode(const VkSamplerReductionModeEXT& reductionMode)
+{
+    reductionModeInfo_.reductionMode = reductionMode;
+    return *this;
+}
+
 std::shared_ptr<VulkanSampler> VulkanSamplerBuilder::Build(std::shared_ptr<VulkanDevice> device) const
 {
+    // Reduction mode is chained only if it isn't the default one, so VK_EXT_sampler_filter_minmax isn't required
+    VkSamplerCreateInfo createInfo = createInfo_;
+    if (reductionModeInfo_.reductionMode != VK_SAMPLER_REDUCTION_MODE_WEIGHTED_AVERAGE_EXT) {
+        createInfo.pNext = &reductionModeInfo_;
+    }
+
     VkSampler sampler = VK_NULL_HANDLE;
-    if (vkCreateSampler(device->GetHandle(), &createInfo_, nullptr, &sampler) != VK_SUCCESS) {
+    if (vkCreateSampler(device->GetHandle(), &createInfo, nullptr, &sampler) != VK_SUCCESS) {
         std::cerr << "Failed to create sampler!" << std::endl;
         return nullptr;
     }
@@ -61,9 +61,12 @@ public:
 
     VulkanSamplerBuilder& EnableUnnormalizedCoordinates(bool isEnabled);
 
+    VulkanSamplerBuilder& SetReductionMode(const VkSamplerReductionModeEXT& reductionMode);
+
     [[nodiscard]] std::shared_ptr<VulkanSampler> Build(std::shared_ptr<VulkanDevice> device) const;
 
 private:
     VkSamplerCreateInfo createInfo_;
+    VkSamplerReductionModeCreateInfoEXT reductionModeInfo_;
 };
 } // namespace common::vulkan_wrapper
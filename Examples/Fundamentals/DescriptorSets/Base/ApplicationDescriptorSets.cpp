@@ -192,7 +192,8 @@ void ApplicationDescriptorSets::CreateBuffers(const std::vector<BufferResourceCr
 void ApplicationDescriptorSets::SetBuffer(const std::string& name, const void* data, const std::uint64_t dataSize)
 {
     buffers_[name]->MapMemory();
-    buffers_[name]->FlushData(data, dataSize);
+    buffers_[name]->WriteData(data, dataSize);
+    buffers_[name]->FlushDirtyRanges();
     buffers_[name]->UnmapMemory();
 }
 
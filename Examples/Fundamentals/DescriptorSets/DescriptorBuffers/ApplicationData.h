@@ -0,0 +1,46 @@
+/**
+ * @file    ApplicationData.h
+ * @brief   This header file keeps user-provided application data (vertices etc.).
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <vector>
+
+#include "Vertex.h"
+#include "glm/glm.hpp"
+
+namespace examples::fundamentals::descriptor_sets::descriptor_buffers
+{
+// Vertex Attribute Layout
+struct VertexPos2
+{
+    common::utility::Attribute<common::utility::Vec2, 0> Position; // layout(location=0) in vec2 position;
+};
+
+// Vertex Data (unit square, it is scaled to a grid cell with the model matrix)
+const std::vector vertices{
+    VertexPos2{{-0.5, -0.5}}, // 0
+    VertexPos2{{0.5, -0.5}},  // 1
+    VertexPos2{{0.5, 0.5}},   // 2
+    VertexPos2{{-0.5, 0.5}}   // 3
+};
+
+// Index Data
+const std::vector<std::uint16_t> indices{
+    0, 1, 2, // First triangle
+    2, 3, 0  // Second triangle
+};
+
+// Per-draw Data (for Uniform Buffer)
+struct UniformBufferObject
+{
+    glm::mat4 model;
+    glm::vec4 color;
+};
+} // namespace examples::fundamentals::descriptor_sets::descriptor_buffers
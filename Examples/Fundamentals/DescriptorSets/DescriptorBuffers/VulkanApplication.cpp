@@ -0,0 +1,479 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "VulkanApplication.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <string>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "AppConfig.h"
+#include "ShaderLoader.h"
+#include "TimeUtils.h"
+#include "VulkanHelpers.h"
+#include "VulkanShaderModule.h"
+
+namespace examples::fundamentals::descriptor_sets::descriptor_buffers
+{
+using namespace common::utility;
+using namespace common::vulkan_wrapper;
+using namespace common::vulkan_framework;
+
+VulkanApplication::VulkanApplication(ParameterServer&& params) : ApplicationDescriptorSets(std::move(params)) {}
+
+bool VulkanApplication::Init()
+{
+    try {
+        currentWindowWidth_ = GetParamU32(WindowParams::Width);
+        currentWindowHeight_ = GetParamU32(WindowParams::Height);
+
+        CreateDefaultSurface();
+        SelectDefaultPhysicalDevice();
+        CreateLogicalDevice();
+        CreateDefaultQueue();
+        CreateDefaultSwapChain();
+        CreateDefaultCommandPool();
+        CreateDefaultSyncObjects(GetParamU32(AppConstants::MaxFramesInFlight));
+
+        CreateResources();
+        InitResources();
+        RunChurnBenchmark(); // Nothing is in flight yet, so both backends can be reset freely
+
+        CreateDefaultRenderPass();
+        CreatePipeline();
+        CreateDefaultFramebuffers();
+
+        CreateCommandBuffers(); // Recording in DrawFrame, descriptors are written per draw
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return false;
+    }
+
+    return true;
+}
+
+void VulkanApplication::DrawFrame()
+{
+    inFlightFences_[currentIndex_]->WaitForFence(true, UINT64_MAX);
+    inFlightFences_[currentIndex_]->ResetFence();
+
+    // Descriptors that were written for this frame index last time are not in use anymore
+    if (useDescriptorBuffer_) {
+        descriptorRegistry_->GetDescriptorBuffer(quadDescriptorBufferHandle_)->BeginFrame(currentIndex_);
+    } else {
+        descriptorRegistry_->BeginFrame(currentIndex_);
+    }
+
+    uint32_t imageIndex = swapChain_->AcquireNextImage(imageAvailableSemaphores_[currentIndex_], nullptr);
+
+    if (swapImagesFences_[imageIndex] != nullptr) {
+        swapImagesFences_[imageIndex]->WaitForFence(true, UINT64_MAX);
+    }
+
+    swapImagesFences_[imageIndex] = inFlightFences_[currentIndex_];
+
+    UpdateUniformBuffers();
+
+    const auto& cmdBuffer = cmdBuffers_[currentIndex_];
+    if (!cmdBuffer->ResetCommandBuffer()) {
+        throw std::runtime_error("Failed to reset command buffer!");
+    }
+    RecordCommandBuffer(cmdBuffer, imageIndex, indices.size());
+
+    queue_->Submit({cmdBuffer}, {imageAvailableSemaphores_[currentIndex_]}, {renderFinishedSemaphores_[imageIndex]},
+                   inFlightFences_[currentIndex_], {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT});
+
+    queue_->Present({swapChain_}, {imageIndex}, {renderFinishedSemaphores_[imageIndex]});
+
+    currentIndex_ = (currentIndex_ + 1) % GetParamU32(AppConstants::MaxFramesInFlight);
+}
+
+void VulkanApplication::CreateLogicalDevice()
+{
+    // Descriptor buffers are optional, the example uses descriptor pools and sets without the extension
+    VkPhysicalDeviceBufferDeviceAddressFeatures supportedAddressFeatures{};
+    supportedAddressFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES;
+    VkPhysicalDeviceDescriptorBufferFeaturesEXT supportedBufferFeatures{};
+    supportedBufferFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT;
+    supportedBufferFeatures.pNext = &supportedAddressFeatures;
+
+    if (physicalDevice_->IsExtensionSupported(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME)) {
+        physicalDevice_->GetExtendedFeatures(&supportedBufferFeatures);
+        isDescriptorBufferSupported_ =
+                supportedBufferFeatures.descriptorBuffer && supportedAddressFeatures.bufferDeviceAddress;
+    }
+
+    std::vector<std::string> extensions = {VK_KHR_SWAPCHAIN_EXTENSION_NAME};
+    if (isDescriptorBufferSupported_) {
+        extensions.emplace_back(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+    }
+
+    VkPhysicalDeviceBufferDeviceAddressFeatures addressFeatures{};
+    addressFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES;
+    addressFeatures.bufferDeviceAddress = VK_TRUE;
+    VkPhysicalDeviceDescriptorBufferFeaturesEXT bufferFeatures{};
+    bufferFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT;
+    bufferFeatures.pNext = &addressFeatures;
+    bufferFeatures.descriptorBuffer = VK_TRUE;
+
+    std::vector queuePriorities = {1.0f};
+
+    device_ = physicalDevice_->CreateDevice([&](auto& builder) {
+        builder.AddLayer("VK_LAYER_KHRONOS_validation").AddExtensions(extensions).AddQueueInfo([&](auto& queueInfo) {
+            queueInfo.queueFamilyIndex = currentQueueFamilyIndex_;
+            queueInfo.queueCount = 1;
+            queueInfo.pQueuePriorities = queuePriorities.data();
+        });
+        if (isDescriptorBufferSupported_) {
+            builder.SetNext(&bufferFeatures);
+        }
+    });
+
+    if (!device_) {
+        throw std::runtime_error("Failed to create logical device!");
+    }
+}
+
+void VulkanApplication::CreateResources()
+{
+    const auto gridSize = std::max(GetParamU32(AppSettings::GridSize), 1u);
+    const std::uint32_t vertexBufferSize = vertices.size() * sizeof(VertexPos2);
+    const std::uint32_t indexBufferSize = indices.size() * sizeof(uint16_t);
+    constexpr std::uint32_t uniformBufferSize = sizeof(UniformBufferObject);
+
+    std::vector<BufferResourceCreateInfo> bufferCreateInfos = {
+        {GetParamStr(AppConstants::MainVertexBuffer), vertexBufferSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT},
+        {GetParamStr(AppConstants::MainIndexBuffer), indexBufferSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT}};
+
+    // Descriptor buffers refer uniform buffers with their device addresses
+    VkBufferUsageFlags uniformBufferUsage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    VkMemoryAllocateFlags uniformBufferAllocateFlags = 0;
+    if (isDescriptorBufferSupported_) {
+        uniformBufferUsage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+        uniformBufferAllocateFlags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+    }
+
+    // Every quad has its own uniform buffer, so the binding changes on every draw
+    quadBufferNames_.clear();
+    for (std::uint32_t i = 0; i < gridSize * gridSize; ++i) {
+        quadBufferNames_.push_back(GetParamStr(AppConstants::QuadUniformBufferPrefix) + std::to_string(i));
+        bufferCreateInfos.push_back({quadBufferNames_.back(), uniformBufferSize, uniformBufferUsage,
+                                     VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                     uniformBufferAllocateFlags});
+    }
+    CreateBuffers(bufferCreateInfos);
+
+    quadBufferAddresses_.clear();
+    if (isDescriptorBufferSupported_) {
+        for (const auto& bufferName: quadBufferNames_) {
+            quadBufferAddresses_.push_back(buffers_[bufferName]->GetBuffer()->GetDeviceAddress());
+        }
+    }
+
+    const ShaderModulesCreateInfo shaderModuleCreateInfo = {
+        .BasePath = SHADERS_DIR,
+        .ShaderType = params_.Get<ShaderBaseType>(AppConstants::BaseShaderType),
+        .Modules = {{.Name = GetParamStr(AppConstants::MainVertexShaderKey),
+                     .FileName = GetParamStr(AppConstants::MainVertexShaderFile)},
+                    {.Name = GetParamStr(AppConstants::MainFragmentShaderKey),
+                     .FileName = GetParamStr(AppConstants::MainFragmentShaderFile)}}};
+    CreateShaderModules(shaderModuleCreateInfo);
+
+    CreateDescriptors();
+}
+
+void VulkanApplication::InitResources()
+{
+    SetBuffer(GetParamStr(AppConstants::MainVertexBuffer), vertices.data(), vertices.size() * sizeof(VertexPos2));
+    SetBuffer(GetParamStr(AppConstants::MainIndexBuffer), indices.data(), indices.size() * sizeof(uint16_t));
+
+    // Place quads to the cells of the grid with different colors
+    const auto gridSize = std::max(GetParamU32(AppSettings::GridSize), 1u);
+    const float cellSize = 2.0f / static_cast<float>(gridSize);
+    quadObjects_.clear();
+    for (std::uint32_t row = 0; row < gridSize; ++row) {
+        for (std::uint32_t column = 0; column < gridSize; ++column) {
+            const glm::vec3 position{-1.0f + (static_cast<float>(column) + 0.5f) * cellSize,
+                                     -1.0f + (static_cast<float>(row) + 0.5f) * cellSize, 0.0f};
+            UniformBufferObject quadObject{};
+            quadObject.model = glm::translate(glm::mat4(1.0f), position);
+            quadObject.color = glm::vec4(static_cast<float>(column + 1) / static_cast<float>(gridSize),
+                                         static_cast<float>(row + 1) / static_cast<float>(gridSize), 0.5f, 1.0f);
+            quadObjects_.push_back(quadObject);
+        }
+    }
+
+    UpdateUniformBuffers();
+}
+
+void VulkanApplication::CreateDescriptors()
+{
+    const auto maxFramesInFlight = GetParamU32(AppConstants::MaxFramesInFlight);
+    const auto quadCount = static_cast<std::uint32_t>(quadBufferNames_.size());
+    constexpr VkShaderStageFlags quadStages = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+    const std::vector<VkDescriptorSetLayoutBinding> quadBindings = {
+            {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, quadStages, nullptr}};
+
+    descriptorRegistry_ = std::make_unique<DescriptorRegistry>(device_);
+
+    // Pool backend: transient sets from per-frame pools
+    descriptorRegistry_->CreateLayout(GetParamStr(AppConstants::QuadLayout), quadBindings);
+    descriptorRegistry_->CreateFrameAllocator(maxFramesInFlight, quadCount,
+                                              {{VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1.0f}});
+    quadLayoutHandle_ = descriptorRegistry_->GetDescriptorLayoutHandle(GetParamStr(AppConstants::QuadLayout));
+
+    // Descriptor buffer backend: same bindings, sets are offsets in a per-frame region of the buffer
+    if (descriptorRegistry_->IsDescriptorBufferSupported()) {
+        descriptorRegistry_->CreateLayout(GetParamStr(AppConstants::QuadBufferLayout), quadBindings,
+                                          VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT);
+        quadBufferLayoutHandle_ =
+                descriptorRegistry_->GetDescriptorLayoutHandle(GetParamStr(AppConstants::QuadBufferLayout));
+
+        // Every set starts from an offset aligned to descriptorBufferOffsetAlignment
+        VkPhysicalDeviceDescriptorBufferPropertiesEXT bufferProperties{};
+        bufferProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT;
+        physicalDevice_->GetExtendedProperties(&bufferProperties);
+
+        const auto setSize = descriptorRegistry_->GetDescriptorLayout(quadBufferLayoutHandle_)->GetLayoutSizeInBytes();
+        const auto alignedSetSize = AlignUp(setSize, bufferProperties.descriptorBufferOffsetAlignment);
+        descriptorRegistry_->CreateDescriptorBuffer(GetParamStr(AppConstants::QuadDescriptorBuffer),
+                                                    alignedSetSize * quadCount, maxFramesInFlight);
+        quadDescriptorBufferHandle_ =
+                descriptorRegistry_->GetDescriptorBufferHandle(GetParamStr(AppConstants::QuadDescriptorBuffer));
+    }
+
+    useDescriptorBuffer_ = descriptorRegistry_->IsDescriptorBufferSupported() &&
+                           params_.Get<bool>(AppSettings::UseDescriptorBuffer);
+    if (useDescriptorBuffer_) {
+        std::cout << "Per-draw bindings: VK_EXT_descriptor_buffer" << std::endl;
+    } else {
+        std::cout << "Per-draw bindings: descriptor pools and sets" << std::endl;
+    }
+}
+
+void VulkanApplication::RunChurnBenchmark()
+{
+    const auto iterations = GetParamU32(AppSettings::BenchmarkIterations);
+    const auto setCount = static_cast<std::uint64_t>(iterations) * quadBufferNames_.size();
+    if (setCount == 0) {
+        return;
+    }
+
+    using Clock = std::chrono::steady_clock;
+    const auto printResult = [&](const char* backendName, const Clock::duration elapsed) {
+        const auto elapsedUs = std::chrono::duration<double, std::micro>(elapsed).count();
+        std::cout << backendName << ": " << elapsedUs / 1000.0 << " ms, " << elapsedUs * 1000.0 / setCount
+                  << " ns per set" << std::endl;
+    };
+
+    std::cout << "Set churn benchmark (" << iterations << " frames x " << quadBufferNames_.size()
+              << " sets allocated and written per frame)" << std::endl;
+
+    // Pool backend: pool reset, then allocate and write a set for every quad
+    const auto poolStart = Clock::now();
+    for (std::uint32_t i = 0; i < iterations; ++i) {
+        descriptorRegistry_->BeginFrame(0);
+        for (const auto& bufferName: quadBufferNames_) {
+            const auto descriptorSet = descriptorRegistry_->AllocateTransientSet(quadLayoutHandle_);
+
+            VkDescriptorBufferInfo bufferInfo;
+            bufferInfo.buffer = buffers_[bufferName]->GetBuffer()->GetHandle();
+            bufferInfo.offset = 0;
+            bufferInfo.range = VK_WHOLE_SIZE;
+
+            VkWriteDescriptorSet write{};
+            write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            write.dstSet = descriptorSet->GetHandle();
+            write.dstBinding = 0;
+            write.descriptorCount = 1;
+            write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            write.pBufferInfo = &bufferInfo;
+            device_->UpdateDescriptorSets({write});
+        }
+    }
+    printResult("Descriptor pools and sets", Clock::now() - poolStart);
+
+    if (!descriptorRegistry_->IsDescriptorBufferSupported()) {
+        std::cout << "VK_EXT_descriptor_buffer is not supported, descriptor buffer backend is skipped" << std::endl;
+        return;
+    }
+
+    // Descriptor buffer backend: region reset, then reserve an offset and write a descriptor for every quad
+    auto& descriptorBuffer = *descriptorRegistry_->GetDescriptorBuffer(quadDescriptorBufferHandle_);
+    const auto bufferLayout = descriptorRegistry_->GetDescriptorLayout(quadBufferLayoutHandle_);
+    const auto bufferStart = Clock::now();
+    for (std::uint32_t i = 0; i < iterations; ++i) {
+        descriptorBuffer.BeginFrame(0);
+        for (const auto& address: quadBufferAddresses_) {
+            const auto setOffset = descriptorBuffer.AllocateSet(bufferLayout);
+            descriptorBuffer.WriteBufferDescriptor(setOffset, bufferLayout, 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+                                                   address, sizeof(UniformBufferObject));
+        }
+    }
+    printResult("Descriptor buffer", Clock::now() - bufferStart);
+}
+
+void VulkanApplication::CreatePipeline()
+{
+    const auto& layoutHandle = useDescriptorBuffer_ ? quadBufferLayoutHandle_ : quadLayoutHandle_;
+    pipelineLayout_ = device_->CreatePipelineLayout({descriptorRegistry_->GetDescriptorLayout(layoutHandle)});
+
+    if (!pipelineLayout_) {
+        throw std::runtime_error("Failed to create pipeline layout!");
+    }
+
+    VkViewport viewport{0,    0,   static_cast<float>(currentWindowWidth_), static_cast<float>(currentWindowHeight_),
+                        0.0f, 1.0f};
+    VkRect2D scissor{0, 0, currentWindowWidth_, currentWindowHeight_};
+
+    VkPipelineColorBlendAttachmentState colorBlendAttachment;
+    colorBlendAttachment.blendEnable = VK_FALSE;
+    colorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.colorBlendOp = VK_BLEND_OP_ADD;
+    colorBlendAttachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+    colorBlendAttachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+    colorBlendAttachment.alphaBlendOp = VK_BLEND_OP_ADD;
+    colorBlendAttachment.colorWriteMask =
+            VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+
+    constexpr uint32_t bindingIndex = 0;
+    auto bindingDescription = GenerateBindingDescription<VertexPos2>(bindingIndex);
+    const auto posAttribDescription = GenerateAttributeDescription(VertexPos2, Position, bindingIndex);
+    const std::array attributeDescriptions{posAttribDescription};
+
+    pipeline_ = device_->CreateGraphicsPipeline(pipelineLayout_, renderPass_, [&](auto& builder) {
+        if (useDescriptorBuffer_) {
+            builder.SetCreateFlags(VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT);
+        }
+        builder.AddShaderStage([&](auto& shaderStageCreateInfo) {
+            shaderStageCreateInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;
+            shaderStageCreateInfo.module =
+                    shaderResources_->GetShaderModule(GetParamStr(AppConstants::MainVertexShaderKey))->GetHandle();
+        });
+        builder.AddShaderStage([&](auto& shaderStageCreateInfo) {
+            shaderStageCreateInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+            shaderStageCreateInfo.module =
+                    shaderResources_->GetShaderModule(GetParamStr(AppConstants::MainFragmentShaderKey))->GetHandle();
+        });
+        builder.SetVertexInputState([&](auto& vertexInputStateCreateInfo) {
+            vertexInputStateCreateInfo.vertexBindingDescriptionCount = 1;
+            vertexInputStateCreateInfo.pVertexBindingDescriptions = &bindingDescription;
+            vertexInputStateCreateInfo.vertexAttributeDescriptionCount = attributeDescriptions.size();
+            vertexInputStateCreateInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
+        });
+        builder.SetViewportState([&](auto& viewportStateCreateInfo) {
+            viewportStateCreateInfo.viewportCount = 1;
+            viewportStateCreateInfo.pViewports = &viewport;
+            viewportStateCreateInfo.scissorCount = 1;
+            viewportStateCreateInfo.pScissors = &scissor;
+        });
+        builder.SetColorBlendState([&](auto& blendStateCreateInfo) {
+            blendStateCreateInfo.attachmentCount = 1;
+            blendStateCreateInfo.pAttachments = &colorBlendAttachment;
+        });
+    });
+
+    if (!pipeline_) {
+        throw std::runtime_error("Failed to create graphics pipeline!");
+    }
+}
+
+void VulkanApplication::CreateCommandBuffers()
+{
+    cmdBuffers_ = cmdPool_->CreateCommandBuffers(GetParamU32(AppConstants::MaxFramesInFlight),
+                                                 VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+
+    if (cmdBuffers_.empty()) {
+        throw std::runtime_error("Failed to create command buffers!");
+    }
+}
+
+void VulkanApplication::RecordCommandBuffer(const std::shared_ptr<VulkanCommandBuffer>& cmdBuffer,
+                                            const std::uint32_t imageIndex,
+                                            const std::uint32_t indexCount) const
+{
+    VkClearValue clearColor;
+    clearColor.color = params_.Get<VkClearColorValue>(AppSettings::ClearColor);
+    if (!cmdBuffer->BeginCommandBuffer(nullptr)) {
+        throw std::runtime_error("Failed to begin recording command buffer!");
+    }
+    cmdBuffer->BeginRenderPass(
+            [&](auto& beginInfo) {
+                beginInfo.renderPass = renderPass_->GetHandle();
+                beginInfo.framebuffer = framebuffers_[imageIndex]->GetHandle();
+                beginInfo.renderArea.offset = {0, 0};
+                beginInfo.renderArea.extent = VkExtent2D(currentWindowWidth_, currentWindowHeight_);
+                beginInfo.clearValueCount = 1;
+                beginInfo.pClearValues = &clearColor;
+            },
+            VK_SUBPASS_CONTENTS_INLINE);
+    cmdBuffer->BindPipeline(pipeline_, VK_PIPELINE_BIND_POINT_GRAPHICS);
+    cmdBuffer->BindVertexBuffers({buffers_.at(GetParamStr(AppConstants::MainVertexBuffer))->GetBuffer()}, 0, 1, {0});
+    cmdBuffer->BindIndexBuffer(buffers_.at(GetParamStr(AppConstants::MainIndexBuffer))->GetBuffer(), 0,
+                               VK_INDEX_TYPE_UINT16);
+
+    if (useDescriptorBuffer_) {
+        // Buffer is bound once, every draw only changes the offset of set 0
+        auto& descriptorBuffer = *descriptorRegistry_->GetDescriptorBuffer(quadDescriptorBufferHandle_);
+        const auto layout = descriptorRegistry_->GetDescriptorLayout(quadBufferLayoutHandle_);
+        descriptorBuffer.Bind(cmdBuffer);
+        for (const auto& address: quadBufferAddresses_) {
+            const auto setOffset = descriptorBuffer.AllocateSet(layout);
+            descriptorBuffer.WriteBufferDescriptor(setOffset, layout, 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, address,
+                                                   sizeof(UniformBufferObject));
+            descriptorBuffer.BindSet(cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_, 0, setOffset);
+            cmdBuffer->DrawIndexed(indexCount, 1, 0, 0, 0);
+        }
+    } else {
+        for (const auto& bufferName: quadBufferNames_) {
+            const auto descriptorSet = descriptorRegistry_->AllocateTransientSet(quadLayoutHandle_);
+
+            VkDescriptorBufferInfo bufferInfo;
+            bufferInfo.buffer = buffers_.at(bufferName)->GetBuffer()->GetHandle();
+            bufferInfo.offset = 0;
+            bufferInfo.range = VK_WHOLE_SIZE;
+
+            VkWriteDescriptorSet write{};
+            write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            write.dstSet = descriptorSet->GetHandle();
+            write.dstBinding = 0;
+            write.descriptorCount = 1;
+            write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            write.pBufferInfo = &bufferInfo;
+            device_->UpdateDescriptorSets({write});
+
+            cmdBuffer->BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_, 0, {descriptorSet});
+            cmdBuffer->DrawIndexed(indexCount, 1, 0, 0, 0);
+        }
+    }
+
+    cmdBuffer->EndRenderPass();
+    if (!cmdBuffer->EndCommandBuffer()) {
+        throw std::runtime_error("Failed to end recording command buffer!");
+    }
+}
+
+void VulkanApplication::UpdateUniformBuffers()
+{
+    const auto currentTime = static_cast<float>(GetCurrentTime());
+    const auto gridSize = std::max(GetParamU32(AppSettings::GridSize), 1u);
+    const float quadScale = 1.4f / static_cast<float>(gridSize);
+
+    for (std::size_t i = 0; i < quadObjects_.size(); ++i) {
+        UniformBufferObject ubObject = quadObjects_[i];
+        ubObject.model = glm::rotate(ubObject.model, currentTime + static_cast<float>(i) * 0.2f,
+                                     glm::vec3(0.0f, 0.0f, 1.0f));
+        ubObject.model = glm::scale(ubObject.model, glm::vec3(quadScale, quadScale, 1.0f));
+        SetBuffer(quadBufferNames_[i], &ubObject, sizeof(UniformBufferObject));
+    }
+}
+} // namespace examples::fundamentals::descriptor_sets::descriptor_buffers
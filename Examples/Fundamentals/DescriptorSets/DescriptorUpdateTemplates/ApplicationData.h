@@ -0,0 +1,59 @@
+/**
+ * @file    ApplicationData.h
+ * @brief   This header file keeps user-provided application data (vertices etc.).
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include <vulkan/vulkan_core.h>
+
+#include "Vertex.h"
+#include "glm/glm.hpp"
+
+namespace examples::fundamentals::descriptor_sets::descriptor_update_templates
+{
+// Vertex Attribute Layout
+struct VertexPos2
+{
+    common::utility::Attribute<common::utility::Vec2, 0> Position; // layout(location=0) in vec2 position;
+};
+
+// Vertex Data
+const std::vector vertices{
+    // Square
+    VertexPos2{{-0.25, -0.25}}, // 0
+    VertexPos2{{0.25, -0.25}},  // 1
+    VertexPos2{{0.25, 0.25}},   // 2
+    VertexPos2{{-0.25, 0.25}}   // 3
+};
+
+// Index Data
+const std::vector<std::uint16_t> indices{
+    0, 1, 2, // First triangle
+    2, 3, 0  // Second triangle
+};
+
+// Model Matrix (for Uniform Buffer)
+struct UniformBufferObject
+{
+    glm::mat4 model;
+};
+
+// Positions of the squares (top left, top right, bottom left, bottom right)
+const std::array<glm::vec3, 4> quadPositions{glm::vec3{-0.5f, -0.5f, 0.0f}, glm::vec3{0.5f, -0.5f, 0.0f},
+                                             glm::vec3{-0.5f, 0.5f, 0.0f}, glm::vec3{0.5f, 0.5f, 0.0f}};
+
+// Packed descriptor infos of a quad set (for Descriptor Update Template)
+struct QuadDescriptors
+{
+    VkDescriptorBufferInfo Transform; // layout(set = 0, binding = 0) uniform UBO
+};
+} // namespace examples::fundamentals::descriptor_sets::descriptor_update_templates
@@ -0,0 +1,325 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "VulkanApplication.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "AppConfig.h"
+#include "ShaderLoader.h"
+#include "TimeUtils.h"
+#include "VulkanDescriptorUpdateTemplate.h"
+#include "VulkanHelpers.h"
+#include "VulkanShaderModule.h"
+
+namespace examples::fundamentals::descriptor_sets::descriptor_update_templates
+{
+using namespace common::utility;
+using namespace common::vulkan_wrapper;
+using namespace common::vulkan_framework;
+
+VulkanApplication::VulkanApplication(ParameterServer&& params) : ApplicationDescriptorSets(std::move(params)) {}
+
+bool VulkanApplication::Init()
+{
+    try {
+        currentWindowWidth_ = GetParamU32(WindowParams::Width);
+        currentWindowHeight_ = GetParamU32(WindowParams::Height);
+
+        CreateDefaultSurface();
+        SelectDefaultPhysicalDevice();
+        CreateDefaultLogicalDevice();
+        CreateDefaultQueue();
+        CreateDefaultSwapChain();
+        CreateDefaultCommandPool();
+        CreateDefaultSyncObjects(GetParamU32(AppConstants::MaxFramesInFlight));
+
+        CreateResources();
+        InitResources();
+        RunUpdateBenchmark(); // Sets are not in use yet, so they can be rewritten freely
+
+        CreateDefaultRenderPass();
+        CreatePipeline();
+        CreateDefaultFramebuffers();
+
+        const uint32_t indexCount = indices.size();
+        CreateCommandBuffers();
+        RecordCommandBuffers(indexCount); // Recording in Init for this example
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return false;
+    }
+
+    return true;
+}
+
+void VulkanApplication::DrawFrame()
+{
+    inFlightFences_[currentIndex_]->WaitForFence(true, UINT64_MAX);
+    inFlightFences_[currentIndex_]->ResetFence();
+
+    uint32_t imageIndex = swapChain_->AcquireNextImage(imageAvailableSemaphores_[currentIndex_], nullptr);
+
+    if (swapImagesFences_[imageIndex] != nullptr) {
+        swapImagesFences_[imageIndex]->WaitForFence(true, UINT64_MAX);
+    }
+
+    swapImagesFences_[imageIndex] = inFlightFences_[currentIndex_];
+
+    UpdateUniformBuffers();
+
+    queue_->Submit({cmdBuffers_[imageIndex]}, {imageAvailableSemaphores_[currentIndex_]},
+                   {renderFinishedSemaphores_[imageIndex]}, inFlightFences_[currentIndex_],
+                   {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT});
+
+    queue_->Present({swapChain_}, {imageIndex}, {renderFinishedSemaphores_[imageIndex]});
+
+    currentIndex_ = (currentIndex_ + 1) % GetParamU32(AppConstants::MaxFramesInFlight);
+}
+
+void VulkanApplication::CreateResources()
+{
+    const std::uint32_t vertexBufferSize = vertices.size() * sizeof(VertexPos2);
+    const std::uint32_t indexBufferSize = indices.size() * sizeof(uint16_t);
+    constexpr std::uint32_t uniformBufferSize = sizeof(UniformBufferObject);
+
+    std::vector<BufferResourceCreateInfo> bufferCreateInfos = {
+        {GetParamStr(AppConstants::MainVertexBuffer), vertexBufferSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT},
+        {GetParamStr(AppConstants::MainIndexBuffer), indexBufferSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT}};
+    for (const auto& bufferName: params_.Get<std::vector<std::string>>(AppConstants::QuadUniformBuffers)) {
+        bufferCreateInfos.push_back({bufferName, uniformBufferSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+                                     VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT});
+    }
+    CreateBuffers(bufferCreateInfos);
+
+    const ShaderModulesCreateInfo shaderModuleCreateInfo = {
+        .BasePath = SHADERS_DIR,
+        .ShaderType = params_.Get<ShaderBaseType>(AppConstants::BaseShaderType),
+        .Modules = {{.Name = GetParamStr(AppConstants::MainVertexShaderKey),
+                     .FileName = GetParamStr(AppConstants::MainVertexShaderFile)},
+                    {.Name = GetParamStr(AppConstants::MainFragmentShaderKey),
+                     .FileName = GetParamStr(AppConstants::MainFragmentShaderFile)}}};
+    CreateShaderModules(shaderModuleCreateInfo);
+
+    CreateDescriptors();
+}
+
+void VulkanApplication::InitResources()
+{
+    SetBuffer(GetParamStr(AppConstants::MainVertexBuffer), vertices.data(), vertices.size() * sizeof(VertexPos2));
+    SetBuffer(GetParamStr(AppConstants::MainIndexBuffer), indices.data(), indices.size() * sizeof(uint16_t));
+
+    UpdateUniformBuffers();
+
+    // Initial writes of the sets are done with the update template
+    for (std::size_t i = 0; i < quadDescriptorSets_.size(); ++i) {
+        descriptorUpdater_->ApplyTemplateUpdate(quadDescriptorSets_[i], quadUpdateTemplate_, GetQuadDescriptors(i));
+    }
+}
+
+void VulkanApplication::CreateDescriptors()
+{
+    const auto layoutName = GetParamStr(AppConstants::QuadLayout);
+    const auto setNames = params_.Get<std::vector<std::string>>(AppConstants::QuadDescriptorSets);
+
+    DescriptorResourceCreateInfo descriptorCreateInfo;
+    descriptorCreateInfo.MaxSets = setNames.size();
+    descriptorCreateInfo.PoolSizes = {
+            {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, static_cast<std::uint32_t>(setNames.size())}};
+    descriptorCreateInfo.Layouts = {
+            {layoutName, {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT, nullptr}}}};
+    for (const auto& setName: setNames) {
+        descriptorCreateInfo.DescriptorSets.push_back({setName, layoutName});
+    }
+
+    descriptorRegistry_ = std::make_unique<DescriptorRegistry>(device_);
+    descriptorRegistry_->CreateDescriptors(descriptorCreateInfo);
+    descriptorUpdater_ = std::make_unique<DescriptorUpdater>(device_, *descriptorRegistry_);
+
+    // The template is built once for the layout and every set of the layout is updated with it
+    quadUpdateTemplate_ = descriptorRegistry_->CreateUpdateTemplate(
+            layoutName, {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, offsetof(QuadDescriptors, Transform)}});
+
+    for (const auto& setName: setNames) {
+        quadDescriptorSets_.push_back(descriptorRegistry_->GetDescriptorSet(setName));
+    }
+}
+
+void VulkanApplication::RunUpdateBenchmark()
+{
+    const auto iterationCount = GetParamU32(AppSettings::BenchmarkIterations);
+    const auto setNames = params_.Get<std::vector<std::string>>(AppConstants::QuadDescriptorSets);
+
+    std::vector<QuadDescriptors> quadDescriptors;
+    for (std::size_t i = 0; i < quadDescriptorSets_.size(); ++i) {
+        quadDescriptors.push_back(GetQuadDescriptors(i));
+    }
+
+    // Generic path: one write request per refresh, resolved by name and applied with vkUpdateDescriptorSets
+    const auto writesStart = std::chrono::steady_clock::now();
+    for (std::uint32_t i = 0; i < iterationCount; ++i) {
+        const auto quadIndex = i % quadDescriptors.size();
+        descriptorUpdater_->AddBufferUpdate(
+                {setNames[quadIndex], 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, {quadDescriptors[quadIndex].Transform}});
+        descriptorUpdater_->ApplyUpdates();
+    }
+    const std::chrono::duration<double, std::milli> writesElapsed = std::chrono::steady_clock::now() - writesStart;
+
+    // Template path: one vkUpdateDescriptorSetWithTemplate call from the packed struct per refresh
+    const auto templateStart = std::chrono::steady_clock::now();
+    for (std::uint32_t i = 0; i < iterationCount; ++i) {
+        const auto quadIndex = i % quadDescriptors.size();
+        descriptorUpdater_->ApplyTemplateUpdate(quadDescriptorSets_[quadIndex], quadUpdateTemplate_,
+                                                quadDescriptors[quadIndex]);
+    }
+    const std::chrono::duration<double, std::milli> templateElapsed = std::chrono::steady_clock::now() - templateStart;
+
+    std::cout << "Descriptor update benchmark (" << iterationCount << " updates):" << std::endl;
+    std::cout << "  Generic writes  : " << writesElapsed.count() << " ms" << std::endl;
+    std::cout << "  Update template : " << templateElapsed.count() << " ms" << std::endl;
+    if (templateElapsed.count() > 0.0) {
+        std::cout << "  Speedup         : " << writesElapsed.count() / templateElapsed.count() << "x" << std::endl;
+    }
+}
+
+void VulkanApplication::CreatePipeline()
+{
+    const auto quadLayout = descriptorRegistry_->GetDescriptorLayout(GetParamStr(AppConstants::QuadLayout));
+    pipelineLayout_ = device_->CreatePipelineLayout({quadLayout});
+
+    if (!pipelineLayout_) {
+        throw std::runtime_error("Failed to create pipeline layout!");
+    }
+
+    VkViewport viewport{0,    0,   static_cast<float>(currentWindowWidth_), static_cast<float>(currentWindowHeight_),
+                        0.0f, 1.0f};
+    VkRect2D scissor{0, 0, currentWindowWidth_, currentWindowHeight_};
+
+    VkPipelineColorBlendAttachmentState colorBlendAttachment;
+    colorBlendAttachment.blendEnable = VK_FALSE;
+    colorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.colorBlendOp = VK_BLEND_OP_ADD;
+    colorBlendAttachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+    colorBlendAttachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+    colorBlendAttachment.alphaBlendOp = VK_BLEND_OP_ADD;
+    colorBlendAttachment.colorWriteMask =
+            VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+
+    constexpr uint32_t bindingIndex = 0;
+    auto bindingDescription = GenerateBindingDescription<VertexPos2>(bindingIndex);
+    const auto posAttribDescription = GenerateAttributeDescription(VertexPos2, Position, bindingIndex);
+    const std::array attributeDescriptions{posAttribDescription};
+
+    pipeline_ = device_->CreateGraphicsPipeline(pipelineLayout_, renderPass_, [&](auto& builder) {
+        builder.AddShaderStage([&](auto& shaderStageCreateInfo) {
+            shaderStageCreateInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;
+            shaderStageCreateInfo.module =
+                    shaderResources_->GetShaderModule(GetParamStr(AppConstants::MainVertexShaderKey))->GetHandle();
+        });
+        builder.AddShaderStage([&](auto& shaderStageCreateInfo) {
+            shaderStageCreateInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+            shaderStageCreateInfo.module =
+                    shaderResources_->GetShaderModule(GetParamStr(AppConstants::MainFragmentShaderKey))->GetHandle();
+        });
+        builder.SetVertexInputState([&](auto& vertexInputStateCreateInfo) {
+            vertexInputStateCreateInfo.vertexBindingDescriptionCount = 1;
+            vertexInputStateCreateInfo.pVertexBindingDescriptions = &bindingDescription;
+            vertexInputStateCreateInfo.vertexAttributeDescriptionCount = attributeDescriptions.size();
+            vertexInputStateCreateInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
+        });
+        builder.SetViewportState([&](auto& viewportStateCreateInfo) {
+            viewportStateCreateInfo.viewportCount = 1;
+            viewportStateCreateInfo.pViewports = &viewport;
+            viewportStateCreateInfo.scissorCount = 1;
+            viewportStateCreateInfo.pScissors = &scissor;
+        });
+        builder.SetColorBlendState([&](auto& blendStateCreateInfo) {
+            blendStateCreateInfo.attachmentCount = 1;
+            blendStateCreateInfo.pAttachments = &colorBlendAttachment;
+        });
+    });
+
+    if (!pipeline_) {
+        throw std::runtime_error("Failed to create graphics pipeline!");
+    }
+}
+
+void VulkanApplication::CreateCommandBuffers()
+{
+    cmdBuffers_ = cmdPool_->CreateCommandBuffers(framebuffers_.size(), VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+
+    if (cmdBuffers_.empty()) {
+        throw std::runtime_error("Failed to create command buffers!");
+    }
+}
+
+void VulkanApplication::RecordCommandBuffers(const std::uint32_t indexCount)
+{
+    for (size_t i = 0; i < framebuffers_.size(); ++i) {
+        VkClearValue clearColor;
+        clearColor.color = params_.Get<VkClearColorValue>(AppSettings::ClearColor);
+        if (!cmdBuffers_[i]->BeginCommandBuffer(nullptr)) {
+            throw std::runtime_error("Failed to begin recording command buffer!");
+        }
+        cmdBuffers_[i]->BeginRenderPass(
+                [&](auto& beginInfo) {
+                    beginInfo.renderPass = renderPass_->GetHandle();
+                    beginInfo.framebuffer = framebuffers_[i]->GetHandle();
+                    beginInfo.renderArea.offset = {0, 0};
+                    beginInfo.renderArea.extent = VkExtent2D(currentWindowWidth_, currentWindowHeight_);
+                    beginInfo.clearValueCount = 1;
+                    beginInfo.pClearValues = &clearColor;
+                },
+                VK_SUBPASS_CONTENTS_INLINE);
+        cmdBuffers_[i]->BindPipeline(pipeline_, VK_PIPELINE_BIND_POINT_GRAPHICS);
+        cmdBuffers_[i]->BindVertexBuffers({buffers_[GetParamStr(AppConstants::MainVertexBuffer)]->GetBuffer()}, 0, 1,
+                                          {0});
+        cmdBuffers_[i]->BindIndexBuffer(buffers_[GetParamStr(AppConstants::MainIndexBuffer)]->GetBuffer(), 0,
+                                        VK_INDEX_TYPE_UINT16);
+        for (const auto& descriptorSet: quadDescriptorSets_) {
+            cmdBuffers_[i]->BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_, 0, {descriptorSet});
+            cmdBuffers_[i]->DrawIndexed(indexCount, 1, 0, 0, 0);
+        }
+        cmdBuffers_[i]->EndRenderPass();
+        if (!cmdBuffers_[i]->EndCommandBuffer()) {
+            throw std::runtime_error("Failed to end recording command buffer!");
+        }
+    }
+}
+
+void VulkanApplication::UpdateUniformBuffers()
+{
+    const auto currentTime = static_cast<float>(GetCurrentTime());
+    const auto bufferNames = params_.Get<std::vector<std::string>>(AppConstants::QuadUniformBuffers);
+
+    for (std::size_t i = 0; i < bufferNames.size(); ++i) {
+        UniformBufferObject ubObject{};
+        ubObject.model = glm::translate(glm::mat4(1.0f), quadPositions[i % quadPositions.size()]);
+        ubObject.model = glm::rotate(ubObject.model, currentTime * static_cast<float>(i + 1) * 0.5f,
+                                     glm::vec3(0.0f, 0.0f, 1.0f));
+        SetBuffer(bufferNames[i], &ubObject, sizeof(UniformBufferObject));
+    }
+}
+
+QuadDescriptors VulkanApplication::GetQuadDescriptors(const std::size_t quadIndex) const
+{
+    const auto bufferNames = params_.Get<std::vector<std::string>>(AppConstants::QuadUniformBuffers);
+
+    QuadDescriptors quadDescriptors{};
+    quadDescriptors.Transform.buffer = buffers_.at(bufferNames[quadIndex])->GetBuffer()->GetHandle();
+    quadDescriptors.Transform.offset = 0;
+    quadDescriptors.Transform.range = VK_WHOLE_SIZE;
+
+    return quadDescriptors;
+}
+} // namespace examples::fundamentals::descriptor_sets::descriptor_update_templates
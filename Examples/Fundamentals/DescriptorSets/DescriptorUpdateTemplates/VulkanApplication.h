@@ -0,0 +1,72 @@
+/**
+ * @file    VulkanApplication.h
+ * @brief   This file contains VulkanApplication and VulkanApplicationSettings implementations.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ApplicationData.h"
+#include "ApplicationDescriptorSets.h"
+#include "DescriptorRegistry.h"
+#include "DescriptorUpdater.h"
+#include "VulkanCommandBuffer.h"
+#include "VulkanDevice.h"
+#include "VulkanPipeline.h"
+#include "VulkanPipelineLayout.h"
+#include "Window.h"
+
+namespace examples::fundamentals::descriptor_sets::descriptor_update_templates
+{
+class VulkanApplication final : public base::ApplicationDescriptorSets
+{
+public:
+    explicit VulkanApplication(common::utility::ParameterServer&& params);
+
+protected:
+    bool Init() override;
+
+    void DrawFrame() override;
+
+private:
+    void CreateResources();
+
+    void InitResources();
+
+    void CreateDescriptors();
+
+    void RunUpdateBenchmark();
+
+    void CreatePipeline();
+
+    void CreateCommandBuffers();
+
+    void RecordCommandBuffers(std::uint32_t indexCount);
+
+    void UpdateUniformBuffers();
+
+    [[nodiscard]] QuadDescriptors GetQuadDescriptors(std::size_t quadIndex) const;
+
+    std::uint32_t currentIndex_ = 0;
+    std::uint32_t currentWindowWidth_ = 0;
+    std::uint32_t currentWindowHeight_ = 0;
+
+    // Descriptors
+    std::unique_ptr<common::vulkan_framework::DescriptorRegistry> descriptorRegistry_;
+    std::unique_ptr<common::vulkan_framework::DescriptorUpdater> descriptorUpdater_;
+    std::shared_ptr<common::vulkan_wrapper::VulkanDescriptorUpdateTemplate> quadUpdateTemplate_;
+    std::vector<std::shared_ptr<common::vulkan_wrapper::VulkanDescriptorSet>> quadDescriptorSets_;
+
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipelineLayout> pipelineLayout_;
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipeline> pipeline_;
+    std::vector<std::shared_ptr<common::vulkan_wrapper::VulkanCommandBuffer>> cmdBuffers_;
+};
+} // namespace examples::fundamentals::descriptor_sets::descriptor_update_templates
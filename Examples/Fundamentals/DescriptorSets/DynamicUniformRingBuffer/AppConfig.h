@@ -0,0 +1,38 @@
+/**
+ * @file    AppConfig.h
+ * @brief   This header file keeps key names for user-provided config key names.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include "AppCommonConfig.h"
+
+namespace examples::fundamentals::descriptor_sets::dynamic_uniform_ring_buffer
+{
+namespace AppConstants
+{
+    constexpr auto MaxFramesInFlight = "AppConstants.MaxFramesInFlight";
+    constexpr auto BaseShaderType = "AppConstants.BaseShaderType";
+    constexpr auto MainVertexShaderFile = "AppConstants.MainVertexShaderFile";
+    constexpr auto MainFragmentShaderFile = "AppConstants.MainFragmentShaderFile";
+    constexpr auto MainVertexShaderKey = "AppConstants.MainVertexShaderKey";
+    constexpr auto MainFragmentShaderKey = "AppConstants.MainFragmentShaderKey";
+
+    // Resources
+    constexpr auto MainVertexBuffer = "AppConstants.MainVertexBuffer";
+    constexpr auto MainIndexBuffer = "AppConstants.MainIndexBuffer";
+    constexpr auto QuadLayout = "AppConstants.QuadLayout";
+    constexpr auto QuadDescriptorSet = "AppConstants.QuadDescriptorSet";
+} // namespace AppConstants
+
+namespace AppSettings
+{
+    constexpr auto ClearColor = "AppSettings.ClearColor";
+    constexpr auto GridSize = "AppSettings.GridSize";
+} // namespace AppSettings
+} // namespace examples::fundamentals::descriptor_sets::dynamic_uniform_ring_buffer
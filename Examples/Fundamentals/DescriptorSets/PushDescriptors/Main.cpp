@@ -0,0 +1,95 @@
+/**
+ * @file    Main.cpp
+ * @brief   This example draws a grid of rotating squares and every square uses its own uniform buffer. Per-draw
+ *          uniform buffers are bound with push descriptors, or with transient descriptor sets if the device doesn't
+ *          support VK_KHR_push_descriptor.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "AppConfig.h"
+#include "ShaderLoader.h"
+#include "VulkanApplication.h"
+#include "Window.h"
+
+using namespace common::utility;
+using namespace common::window_wrapper;
+using namespace common::vulkan_framework;
+using namespace examples::fundamentals::descriptor_sets::push_descriptors;
+
+inline ParameterSchema CreateParameterSchema()
+{
+    ParameterSchema schema;
+    SetCommonParamSchema(schema);
+
+    // Register Constants
+    schema.RegisterImmutableParam<std::uint32_t>(AppConstants::MaxFramesInFlight, 2);
+    schema.RegisterImmutableParam<ShaderBaseType>(AppConstants::BaseShaderType, ShaderBaseType::GLSL);
+    schema.RegisterImmutableParam<std::string>(AppConstants::MainVertexShaderFile, "push_descriptors.vert.spv");
+    schema.RegisterImmutableParam<std::string>(AppConstants::MainFragmentShaderFile, "push_descriptors.frag.spv");
+    schema.RegisterImmutableParam<std::string>(AppConstants::MainVertexShaderKey, "vertMain");
+    schema.RegisterImmutableParam<std::string>(AppConstants::MainFragmentShaderKey, "fragMain");
+
+    schema.RegisterImmutableParam<std::string>(AppConstants::MainVertexBuffer, "mainVertexBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::MainIndexBuffer, "mainIndexBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::QuadUniformBufferPrefix, "quadUB");
+    schema.RegisterImmutableParam<std::string>(AppConstants::QuadLayout, "quadLayout");
+
+    // Register Customizable Settings
+    schema.RegisterParam<VkClearColorValue>(AppSettings::ClearColor);
+    schema.RegisterParam<std::uint32_t>(AppSettings::GridSize, 4);
+
+    return schema;
+}
+
+bool SetParams(ParameterServer& params)
+{
+    try {
+        // Initial window settings
+        params.Set<std::uint32_t>(WindowParams::Width, 800);
+        params.Set<std::uint32_t>(WindowParams::Height, 800);
+        params.Set(WindowParams::Title, std::string(EXAMPLE_APPLICATION_NAME));
+
+        // Vulkan settings (VK_KHR_push_descriptor requires Vulkan 1.1 or VK_KHR_get_physical_device_properties2)
+        params.Set<std::string>(VulkanParams::ApplicationName, params.Get<std::string>(WindowParams::Title));
+        params.Set<std::uint32_t>(VulkanParams::VulkanApiVersion, VK_API_VERSION_1_1);
+        params.Set<std::vector<std::string>>(VulkanParams::InstanceLayers, {"VK_LAYER_KHRONOS_validation"});
+
+        // Project customizable settings
+        params.Set(AppSettings::ClearColor, VkClearColorValue{0.1f, 0.1f, 0.3f, 1.0f});
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return false;
+    }
+
+    return true;
+}
+
+int main()
+{
+    ParameterServer params{CreateParameterSchema()};
+    if (!SetParams(params)) {
+        std::cerr << "Failed to set parameters!" << std::endl;
+        return -1;
+    }
+
+    // Create a window
+    const auto window = std::make_shared<Window>(params.Get<std::string>(WindowParams::Title));
+    if (!window->Init(params.Get<std::uint32_t>(WindowParams::Width), params.Get<std::uint32_t>(WindowParams::Height),
+                      params.Get<bool>(WindowParams::Resizable), params.Get<unsigned int>(WindowParams::SampleCount))) {
+        std::cerr << "Failed to initialize window." << std::endl;
+        return -1;
+    }
+    params.Set<std::vector<std::string>>(VulkanParams::InstanceExtensions, Window::GetVulkanInstanceExtensions());
+
+    // Init Vulkan application
+    VulkanApplication app{std::move(params)};
+    app.SetWindow(window);
+    app.Run();
+
+    return 0;
+}
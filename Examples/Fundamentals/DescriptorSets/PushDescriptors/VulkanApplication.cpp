@@ -0,0 +1,331 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "VulkanApplication.h"
+
+#include <algorithm>
+#include <array>
+#include <string>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "AppConfig.h"
+#include "ShaderLoader.h"
+#include "TimeUtils.h"
+#include "VulkanHelpers.h"
+#include "VulkanShaderModule.h"
+
+namespace examples::fundamentals::descriptor_sets::push_descriptors
+{
+using namespace common::utility;
+using namespace common::vulkan_wrapper;
+using namespace common::vulkan_framework;
+
+VulkanApplication::VulkanApplication(ParameterServer&& params) : ApplicationDescriptorSets(std::move(params)) {}
+
+bool VulkanApplication::Init()
+{
+    try {
+        currentWindowWidth_ = GetParamU32(WindowParams::Width);
+        currentWindowHeight_ = GetParamU32(WindowParams::Height);
+
+        CreateDefaultSurface();
+        SelectDefaultPhysicalDevice();
+        CreateLogicalDevice();
+        CreateDefaultQueue();
+        CreateDefaultSwapChain();
+        CreateDefaultCommandPool();
+        CreateDefaultSyncObjects(GetParamU32(AppConstants::MaxFramesInFlight));
+
+        CreateResources();
+        InitResources();
+
+        CreateDefaultRenderPass();
+        CreatePipeline();
+        CreateDefaultFramebuffers();
+
+        CreateCommandBuffers(); // Recording in DrawFrame, descriptors are pushed per draw
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return false;
+    }
+
+    return true;
+}
+
+void VulkanApplication::DrawFrame()
+{
+    inFlightFences_[currentIndex_]->WaitForFence(true, UINT64_MAX);
+    inFlightFences_[currentIndex_]->ResetFence();
+
+    // Transient sets of the fallback path that were used by this frame index are free now
+    descriptorRegistry_->BeginFrame(currentIndex_);
+
+    uint32_t imageIndex = swapChain_->AcquireNextImage(imageAvailableSemaphores_[currentIndex_], nullptr);
+
+    if (swapImagesFences_[imageIndex] != nullptr) {
+        swapImagesFences_[imageIndex]->WaitForFence(true, UINT64_MAX);
+    }
+
+    swapImagesFences_[imageIndex] = inFlightFences_[currentIndex_];
+
+    UpdateUniformBuffers();
+
+    const auto& cmdBuffer = cmdBuffers_[currentIndex_];
+    if (!cmdBuffer->ResetCommandBuffer()) {
+        throw std::runtime_error("Failed to reset command buffer!");
+    }
+    RecordCommandBuffer(cmdBuffer, imageIndex, indices.size());
+
+    queue_->Submit({cmdBuffer}, {imageAvailableSemaphores_[currentIndex_]}, {renderFinishedSemaphores_[imageIndex]},
+                   inFlightFences_[currentIndex_], {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT});
+
+    queue_->Present({swapChain_}, {imageIndex}, {renderFinishedSemaphores_[imageIndex]});
+
+    currentIndex_ = (currentIndex_ + 1) % GetParamU32(AppConstants::MaxFramesInFlight);
+}
+
+void VulkanApplication::CreateLogicalDevice()
+{
+    // Push descriptors are optional, registry falls back to transient descriptor sets without the extension
+    std::vector<std::string> extensions = {VK_KHR_SWAPCHAIN_EXTENSION_NAME};
+    if (physicalDevice_->IsExtensionSupported(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME)) {
+        extensions.emplace_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+    }
+
+    std::vector queuePriorities = {1.0f};
+
+    device_ = physicalDevice_->CreateDevice([&](auto& builder) {
+        builder.AddLayer("VK_LAYER_KHRONOS_validation").AddExtensions(extensions).AddQueueInfo([&](auto& queueInfo) {
+            queueInfo.queueFamilyIndex = currentQueueFamilyIndex_;
+            queueInfo.queueCount = 1;
+            queueInfo.pQueuePriorities = queuePriorities.data();
+        });
+    });
+
+    if (!device_) {
+        throw std::runtime_error("Failed to create logical device!");
+    }
+}
+
+void VulkanApplication::CreateResources()
+{
+    const auto gridSize = std::max(GetParamU32(AppSettings::GridSize), 1u);
+    const std::uint32_t vertexBufferSize = vertices.size() * sizeof(VertexPos2);
+    const std::uint32_t indexBufferSize = indices.size() * sizeof(uint16_t);
+    constexpr std::uint32_t uniformBufferSize = sizeof(UniformBufferObject);
+
+    std::vector<BufferResourceCreateInfo> bufferCreateInfos = {
+        {GetParamStr(AppConstants::MainVertexBuffer), vertexBufferSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT},
+        {GetParamStr(AppConstants::MainIndexBuffer), indexBufferSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT}};
+
+    // Every quad has its own uniform buffer, so the binding changes on every draw
+    quadBufferNames_.clear();
+    for (std::uint32_t i = 0; i < gridSize * gridSize; ++i) {
+        quadBufferNames_.push_back(GetParamStr(AppConstants::QuadUniformBufferPrefix) + std::to_string(i));
+        bufferCreateInfos.push_back({quadBufferNames_.back(), uniformBufferSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+                                     VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT});
+    }
+    CreateBuffers(bufferCreateInfos);
+
+    const ShaderModulesCreateInfo shaderModuleCreateInfo = {
+        .BasePath = SHADERS_DIR,
+        .ShaderType = params_.Get<ShaderBaseType>(AppConstants::BaseShaderType),
+        .Modules = {{.Name = GetParamStr(AppConstants::MainVertexShaderKey),
+                     .FileName = GetParamStr(AppConstants::MainVertexShaderFile)},
+                    {.Name = GetParamStr(AppConstants::MainFragmentShaderKey),
+                     .FileName = GetParamStr(AppConstants::MainFragmentShaderFile)}}};
+    CreateShaderModules(shaderModuleCreateInfo);
+
+    CreateDescriptors();
+}
+
+void VulkanApplication::InitResources()
+{
+    SetBuffer(GetParamStr(AppConstants::MainVertexBuffer), vertices.data(), vertices.size() * sizeof(VertexPos2));
+    SetBuffer(GetParamStr(AppConstants::MainIndexBuffer), indices.data(), indices.size() * sizeof(uint16_t));
+
+    // Place quads to the cells of the grid with different colors
+    const auto gridSize = std::max(GetParamU32(AppSettings::GridSize), 1u);
+    const float cellSize = 2.0f / static_cast<float>(gridSize);
+    quadObjects_.clear();
+    for (std::uint32_t row = 0; row < gridSize; ++row) {
+        for (std::uint32_t column = 0; column < gridSize; ++column) {
+            const glm::vec3 position{-1.0f + (static_cast<float>(column) + 0.5f) * cellSize,
+                                     -1.0f + (static_cast<float>(row) + 0.5f) * cellSize, 0.0f};
+            UniformBufferObject quadObject{};
+            quadObject.model = glm::translate(glm::mat4(1.0f), position);
+            quadObject.color = glm::vec4(static_cast<float>(column + 1) / static_cast<float>(gridSize),
+                                         static_cast<float>(row + 1) / static_cast<float>(gridSize), 0.5f, 1.0f);
+            quadObjects_.push_back(quadObject);
+        }
+    }
+
+    UpdateUniformBuffers();
+}
+
+void VulkanApplication::CreateDescriptors()
+{
+    const auto maxFramesInFlight = GetParamU32(AppConstants::MaxFramesInFlight);
+
+    descriptorRegistry_ = std::make_unique<DescriptorRegistry>(device_);
+    descriptorRegistry_->CreateLayout(
+            GetParamStr(AppConstants::QuadLayout),
+            {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+              nullptr}},
+            VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR);
+    quadLayoutHandle_ = descriptorRegistry_->GetDescriptorLayoutHandle(GetParamStr(AppConstants::QuadLayout));
+
+    // Only used by the fallback path, one set per draw in every frame
+    descriptorRegistry_->CreateFrameAllocator(maxFramesInFlight, quadBufferNames_.size(),
+                                              {{VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1.0f}});
+
+    if (descriptorRegistry_->IsPushDescriptorSupported()) {
+        std::cout << "Per-draw bindings: VK_KHR_push_descriptor" << std::endl;
+    } else {
+        std::cout << "Per-draw bindings: transient descriptor sets (VK_KHR_push_descriptor is not supported)"
+                  << std::endl;
+    }
+}
+
+void VulkanApplication::CreatePipeline()
+{
+    pipelineLayout_ = device_->CreatePipelineLayout({descriptorRegistry_->GetDescriptorLayout(quadLayoutHandle_)});
+
+    if (!pipelineLayout_) {
+        throw std::runtime_error("Failed to create pipeline layout!");
+    }
+
+    VkViewport viewport{0,    0,   static_cast<float>(currentWindowWidth_), static_cast<float>(currentWindowHeight_),
+                        0.0f, 1.0f};
+    VkRect2D scissor{0, 0, currentWindowWidth_, currentWindowHeight_};
+
+    VkPipelineColorBlendAttachmentState colorBlendAttachment;
+    colorBlendAttachment.blendEnable = VK_FALSE;
+    colorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.colorBlendOp = VK_BLEND_OP_ADD;
+    colorBlendAttachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+    colorBlendAttachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+    colorBlendAttachment.alphaBlendOp = VK_BLEND_OP_ADD;
+    colorBlendAttachment.colorWriteMask =
+            VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+
+    constexpr uint32_t bindingIndex = 0;
+    auto bindingDescription = GenerateBindingDescription<VertexPos2>(bindingIndex);
+    const auto posAttribDescription = GenerateAttributeDescription(VertexPos2, Position, bindingIndex);
+    const std::array attributeDescriptions{posAttribDescription};
+
+    pipeline_ = device_->CreateGraphicsPipeline(pipelineLayout_, renderPass_, [&](auto& builder) {
+        builder.AddShaderStage([&](auto& shaderStageCreateInfo) {
+            shaderStageCreateInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;
+            shaderStageCreateInfo.module =
+                    shaderResources_->GetShaderModule(GetParamStr(AppConstants::MainVertexShaderKey))->GetHandle();
+        });
+        builder.AddShaderStage([&](auto& shaderStageCreateInfo) {
+            shaderStageCreateInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+            shaderStageCreateInfo.module =
+                    shaderResources_->GetShaderModule(GetParamStr(AppConstants::MainFragmentShaderKey))->GetHandle();
+        });
+        builder.SetVertexInputState([&](auto& vertexInputStateCreateInfo) {
+            vertexInputStateCreateInfo.vertexBindingDescriptionCount = 1;
+            vertexInputStateCreateInfo.pVertexBindingDescriptions = &bindingDescription;
+            vertexInputStateCreateInfo.vertexAttributeDescriptionCount = attributeDescriptions.size();
+            vertexInputStateCreateInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
+        });
+        builder.SetViewportState([&](auto& viewportStateCreateInfo) {
+            viewportStateCreateInfo.viewportCount = 1;
+            viewportStateCreateInfo.pViewports = &viewport;
+            viewportStateCreateInfo.scissorCount = 1;
+            viewportStateCreateInfo.pScissors = &scissor;
+        });
+        builder.SetColorBlendState([&](auto& blendStateCreateInfo) {
+            blendStateCreateInfo.attachmentCount = 1;
+            blendStateCreateInfo.pAttachments = &colorBlendAttachment;
+        });
+    });
+
+    if (!pipeline_) {
+        throw std::runtime_error("Failed to create graphics pipeline!");
+    }
+}
+
+void VulkanApplication::CreateCommandBuffers()
+{
+    cmdBuffers_ = cmdPool_->CreateCommandBuffers(GetParamU32(AppConstants::MaxFramesInFlight),
+                                                 VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+
+    if (cmdBuffers_.empty()) {
+        throw std::runtime_error("Failed to create command buffers!");
+    }
+}
+
+void VulkanApplication::RecordCommandBuffer(const std::shared_ptr<VulkanCommandBuffer>& cmdBuffer,
+                                            const std::uint32_t imageIndex,
+                                            const std::uint32_t indexCount) const
+{
+    VkClearValue clearColor;
+    clearColor.color = params_.Get<VkClearColorValue>(AppSettings::ClearColor);
+    if (!cmdBuffer->BeginCommandBuffer(nullptr)) {
+        throw std::runtime_error("Failed to begin recording command buffer!");
+    }
+    cmdBuffer->BeginRenderPass(
+            [&](auto& beginInfo) {
+                beginInfo.renderPass = renderPass_->GetHandle();
+                beginInfo.framebuffer = framebuffers_[imageIndex]->GetHandle();
+                beginInfo.renderArea.offset = {0, 0};
+                beginInfo.renderArea.extent = VkExtent2D(currentWindowWidth_, currentWindowHeight_);
+                beginInfo.clearValueCount = 1;
+                beginInfo.pClearValues = &clearColor;
+            },
+            VK_SUBPASS_CONTENTS_INLINE);
+    cmdBuffer->BindPipeline(pipeline_, VK_PIPELINE_BIND_POINT_GRAPHICS);
+    cmdBuffer->BindVertexBuffers({buffers_.at(GetParamStr(AppConstants::MainVertexBuffer))->GetBuffer()}, 0, 1, {0});
+    cmdBuffer->BindIndexBuffer(buffers_.at(GetParamStr(AppConstants::MainIndexBuffer))->GetBuffer(), 0,
+                               VK_INDEX_TYPE_UINT16);
+
+    // Binding of every draw is written straight into the command buffer (or into a transient set as fallback)
+    for (const auto& bufferName: quadBufferNames_) {
+        VkDescriptorBufferInfo bufferInfo;
+        bufferInfo.buffer = buffers_.at(bufferName)->GetBuffer()->GetHandle();
+        bufferInfo.offset = 0;
+        bufferInfo.range = VK_WHOLE_SIZE;
+
+        VkWriteDescriptorSet write{};
+        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstBinding = 0;
+        write.descriptorCount = 1;
+        write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        write.pBufferInfo = &bufferInfo;
+
+        descriptorRegistry_->PushDescriptorSet(cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_, 0,
+                                               quadLayoutHandle_, {write});
+        cmdBuffer->DrawIndexed(indexCount, 1, 0, 0, 0);
+    }
+
+    cmdBuffer->EndRenderPass();
+    if (!cmdBuffer->EndCommandBuffer()) {
+        throw std::runtime_error("Failed to end recording command buffer!");
+    }
+}
+
+void VulkanApplication::UpdateUniformBuffers()
+{
+    const auto currentTime = static_cast<float>(GetCurrentTime());
+    const auto gridSize = std::max(GetParamU32(AppSettings::GridSize), 1u);
+    const float quadScale = 1.4f / static_cast<float>(gridSize);
+
+    for (std::size_t i = 0; i < quadObjects_.size(); ++i) {
+        UniformBufferObject ubObject = quadObjects_[i];
+        ubObject.model = glm::rotate(ubObject.model, currentTime + static_cast<float>(i) * 0.2f,
+                                     glm::vec3(0.0f, 0.0f, 1.0f));
+        ubObject.model = glm::scale(ubObject.model, glm::vec3(quadScale, quadScale, 1.0f));
+        SetBuffer(quadBufferNames_[i], &ubObject, sizeof(UniformBufferObject));
+    }
+}
+} // namespace examples::fundamentals::descriptor_sets::push_descriptors
@@ -0,0 +1,74 @@
+/**
+ * @file    VulkanApplication.h
+ * @brief   This file contains VulkanApplication and VulkanApplicationSettings implementations.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ApplicationData.h"
+#include "ApplicationDescriptorSets.h"
+#include "DescriptorRegistry.h"
+#include "VulkanCommandBuffer.h"
+#include "VulkanDevice.h"
+#include "VulkanPipeline.h"
+#include "VulkanPipelineLayout.h"
+#include "Window.h"
+
+namespace examples::fundamentals::descriptor_sets::push_descriptors
+{
+class VulkanApplication final : public base::ApplicationDescriptorSets
+{
+public:
+    explicit VulkanApplication(common::utility::ParameterServer&& params);
+
+protected:
+    bool Init() override;
+
+    void DrawFrame() override;
+
+private:
+    void CreateLogicalDevice();
+
+    void CreateResources();
+
+    void InitResources();
+
+    void CreateDescriptors();
+
+    void CreatePipeline();
+
+    void CreateCommandBuffers();
+
+    void RecordCommandBuffer(const std::shared_ptr<common::vulkan_wrapper::VulkanCommandBuffer>& cmdBuffer,
+                             std::uint32_t imageIndex,
+                             std::uint32_t indexCount) const;
+
+    void UpdateUniformBuffers();
+
+    std::uint32_t currentIndex_ = 0;
+    std::uint32_t currentWindowWidth_ = 0;
+    std::uint32_t currentWindowHeight_ = 0;
+
+    // Per-draw resources
+    std::vector<std::string> quadBufferNames_;
+    std::vector<UniformBufferObject> quadObjects_;
+
+    // Descriptors
+    std::unique_ptr<common::vulkan_framework::DescriptorRegistry> descriptorRegistry_;
+    common::vulkan_framework::DescriptorLayoutHandle quadLayoutHandle_;
+
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipelineLayout> pipelineLayout_;
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipeline> pipeline_;
+    std::vector<std::shared_ptr<common::vulkan_wrapper::VulkanCommandBuffer>> cmdBuffers_;
+};
+} // namespace examples::fundamentals::descriptor_sets::push_descriptors
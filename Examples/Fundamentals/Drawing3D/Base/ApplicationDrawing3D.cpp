@@ -167,7 +167,8 @@ void ApplicationDrawing3D::CreateBuffers(const std::vector<BufferResourceCreateI
 void ApplicationDrawing3D::SetBuffer(const std::string& name, const void* data, const std::uint64_t dataSize)
 {
     buffers_[name]->MapMemory();
-    buffers_[name]->FlushData(data, dataSize);
+    buffers_[name]->WriteData(data, dataSize);
+    buffers_[name]->FlushDirtyRanges();
     buffers_[name]->UnmapMemory();
 }
 
@@ -0,0 +1,46 @@
+/**
+ * @file    AppConfig.h
+ * @brief   This header file keeps key names for user-provided config key names.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+namespace examples::fundamentals::drawing_3d::instance_streaming
+{
+namespace AppConstants
+{
+    constexpr auto MaxFramesInFlight = "AppConstants.MaxFramesInFlight";
+    constexpr auto MaxInstanceCount = "AppConstants.MaxInstanceCount";
+    constexpr auto CpuTimeReportInterval = "AppConstants.CpuTimeReportInterval";
+
+    // Shaders
+    constexpr auto BaseShaderType = "AppConstants.BaseShaderType";
+    constexpr auto VertexStreamShaderFile = "AppConstants.VertexStreamShaderFile";
+    constexpr auto StorageBufferShaderFile = "AppConstants.StorageBufferShaderFile";
+    constexpr auto MainFragmentShaderFile = "AppConstants.MainFragmentShaderFile";
+    constexpr auto MainVertexShaderKey = "AppConstants.MainVertexShaderKey";
+    constexpr auto MainFragmentShaderKey = "AppConstants.MainFragmentShaderKey";
+
+    // Resources
+    constexpr auto MainVertexBuffer = "AppConstants.MainVertexBuffer";
+    constexpr auto MainIndexBuffer = "AppConstants.MainIndexBuffer";
+    constexpr auto InstanceBuffer = "AppConstants.InstanceBuffer";
+    constexpr auto DepthImage = "AppConstants.DepthImage";
+    constexpr auto DepthImageView = "AppConstants.DepthImageView";
+    constexpr auto InstanceDescSetLayout = "AppConstants.InstanceDescSetLayout";
+} // namespace AppConstants
+
+namespace AppSettings
+{
+    constexpr auto ClearColor = "AppSettings.ClearColor";
+    constexpr auto MouseSensitivity = "AppSettings.MouseSensitivity";
+    constexpr auto CameraSpeed = "AppSettings.CameraSpeed";
+    constexpr auto InstanceCount = "AppSettings.InstanceCount";
+    constexpr auto UseStorageBuffer = "AppSettings.UseStorageBuffer";
+} // namespace AppSettings
+} // namespace examples::fundamentals::drawing_3d::instance_streaming
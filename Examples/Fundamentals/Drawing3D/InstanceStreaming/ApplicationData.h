@@ -0,0 +1,88 @@
+/**
+ * @file    ApplicationData.h
+ * @brief   This header file keeps user-provided application data (vertices, indices etc.).
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <vector>
+
+#include "Vertex.h"
+#include "glm/glm.hpp"
+
+namespace examples::fundamentals::drawing_3d::instance_streaming
+{
+// Vertex Attribute Layout
+struct VertexPos3Uv2
+{
+    common::utility::Attribute<common::utility::Vec3, 0> Position; // layout(location=0) in vec3 position;
+    common::utility::Attribute<common::utility::Vec2, 1> Uv;       // layout(location=1) in vec2 texCoord;
+};
+
+// Vertex Data
+const std::vector vertices{
+    // Front face
+    VertexPos3Uv2{{-0.5f, -0.5f, 0.5f}, {0.0f, 0.0f}}, // 0
+    VertexPos3Uv2{{0.5f, -0.5f, 0.5f}, {1.0f, 0.0f}},  // 1
+    VertexPos3Uv2{{0.5f, 0.5f, 0.5f}, {1.0f, 1.0f}},   // 2
+    VertexPos3Uv2{{-0.5f, 0.5f, 0.5f}, {0.0f, 1.0f}},  // 3
+
+    // Back face
+    VertexPos3Uv2{{-0.5f, -0.5f, -0.5f}, {1.0f, 0.0f}}, // 4
+    VertexPos3Uv2{{0.5f, -0.5f, -0.5f}, {0.0f, 0.0f}},  // 5
+    VertexPos3Uv2{{0.5f, 0.5f, -0.5f}, {0.0f, 1.0f}},   // 6
+    VertexPos3Uv2{{-0.5f, 0.5f, -0.5f}, {1.0f, 1.0f}},  // 7
+
+    // Left face
+    VertexPos3Uv2{{-0.5f, -0.5f, -0.5f}, {0.0f, 0.0f}}, // 8
+    VertexPos3Uv2{{-0.5f, -0.5f, 0.5f}, {1.0f, 0.0f}},  // 9
+    VertexPos3Uv2{{-0.5f, 0.5f, 0.5f}, {1.0f, 1.0f}},   // 10
+    VertexPos3Uv2{{-0.5f, 0.5f, -0.5f}, {0.0f, 1.0f}},  // 11
+
+    // Right face
+    VertexPos3Uv2{{0.5f, -0.5f, -0.5f}, {1.0f, 0.0f}}, // 12
+    VertexPos3Uv2{{0.5f, -0.5f, 0.5f}, {0.0f, 0.0f}},  // 13
+    VertexPos3Uv2{{0.5f, 0.5f, 0.5f}, {0.0f, 1.0f}},   // 14
+    VertexPos3Uv2{{0.5f, 0.5f, -0.5f}, {1.0f, 1.0f}},  // 15
+
+    // Top face
+    VertexPos3Uv2{{-0.5f, 0.5f, 0.5f}, {0.0f, 0.0f}},  // 16
+    VertexPos3Uv2{{0.5f, 0.5f, 0.5f}, {1.0f, 0.0f}},   // 17
+    VertexPos3Uv2{{0.5f, 0.5f, -0.5f}, {1.0f, 1.0f}},  // 18
+    VertexPos3Uv2{{-0.5f, 0.5f, -0.5f}, {0.0f, 1.0f}}, // 19
+
+    // Bottom face
+    VertexPos3Uv2{{-0.5f, -0.5f, 0.5f}, {0.0f, 0.0f}}, // 20
+    VertexPos3Uv2{{0.5f, -0.5f, 0.5f}, {1.0f, 0.0f}},  // 21
+    VertexPos3Uv2{{0.5f, -0.5f, -0.5f}, {1.0f, 1.0f}}, // 22
+    VertexPos3Uv2{{-0.5f, -0.5f, -0.5f}, {0.0f, 1.0f}} // 23
+};
+
+// Index Data
+const std::vector<uint16_t> indices{
+    0,  1,  2,  2,  3,  0,  // Front
+    4,  5,  6,  6,  7,  4,  // Back
+    8,  9,  10, 10, 11, 8,  // Left
+    12, 13, 14, 14, 15, 12, // Right
+    16, 17, 18, 18, 19, 16, // Top
+    20, 21, 22, 22, 23, 20  // Bottom
+};
+
+// Per-instance Data (instance rate vertex stream or storage buffer element, both use the same layout)
+struct InstanceData
+{
+    common::utility::Attribute<common::utility::Vec4, 2> PositionScale; // layout(location=2) in vec4 positionScale;
+    common::utility::Attribute<common::utility::Color4, 3> Color;       // layout(location=3) in vec4 color;
+};
+
+// View-projection Matrix (for Push Constants)
+struct CameraData
+{
+    glm::mat4 viewProjection;
+};
+} // namespace examples::fundamentals::drawing_3d::instance_streaming
@@ -0,0 +1,130 @@
+/**
+ * @file    Main.cpp
+ * @brief   This example streams per-instance data of up to a million cubes every frame and draws all of them with a
+ *          single instanced draw call. Instance data is read from an instance rate vertex stream or a storage buffer.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "AppCommonConfig.h"
+#include "AppConfig.h"
+#include "ParameterOverrides.h"
+#include "ShaderLoader.h"
+#include "VulkanApplication.h"
+#include "Window.h"
+
+using namespace common::utility;
+using namespace common::window_wrapper;
+using namespace common::vulkan_framework;
+using namespace examples::fundamentals::drawing_3d::instance_streaming;
+
+inline ParameterSchema CreateParameterSchema()
+{
+    ParameterSchema schema;
+    SetCommonParamSchema(schema);
+
+    // Register Constants
+    schema.RegisterImmutableParam<std::uint32_t>(AppConstants::MaxFramesInFlight, 2);
+    schema.RegisterImmutableParam<std::uint32_t>(AppConstants::MaxInstanceCount, 1000000);
+    schema.RegisterImmutableParam<std::uint32_t>(AppConstants::CpuTimeReportInterval, 240);
+
+    schema.RegisterImmutableParam<ShaderBaseType>(AppConstants::BaseShaderType, ShaderBaseType::GLSL);
+    schema.RegisterImmutableParam<std::string>(AppConstants::VertexStreamShaderFile, "instance_stream.vert.spv");
+    schema.RegisterImmutableParam<std::string>(AppConstants::StorageBufferShaderFile, "instance_ssbo.vert.spv");
+    schema.RegisterImmutableParam<std::string>(AppConstants::MainFragmentShaderFile, "instance_stream.frag.spv");
+    schema.RegisterImmutableParam<std::string>(AppConstants::MainVertexShaderKey, "vertMain");
+    schema.RegisterImmutableParam<std::string>(AppConstants::MainFragmentShaderKey, "fragMain");
+
+    schema.RegisterImmutableParam<std::string>(AppConstants::MainVertexBuffer, "mainVertexBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::MainIndexBuffer, "mainIndexBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::InstanceBuffer, "instanceBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::DepthImage, "depthImage");
+    schema.RegisterImmutableParam<std::string>(AppConstants::DepthImageView, "depthImageView");
+    schema.RegisterImmutableParam<std::string>(AppConstants::InstanceDescSetLayout, "instanceDescSetLayout");
+
+    // Register Customizable Settings
+    schema.RegisterParam<VkClearColorValue>(AppSettings::ClearColor);
+    schema.RegisterParam<float>(AppSettings::MouseSensitivity);
+    schema.RegisterParam<float>(AppSettings::CameraSpeed);
+    schema.RegisterParam<std::uint32_t>(AppSettings::InstanceCount, 100000);
+    schema.RegisterParam<bool>(AppSettings::UseStorageBuffer, false);
+
+    return schema;
+}
+
+bool SetParams(ParameterServer& params)
+{
+    try {
+        // Initial window settings
+        params.Set<std::uint32_t>(WindowParams::Width, 800);
+        params.Set<std::uint32_t>(WindowParams::Height, 600);
+        params.Set(WindowParams::Title, std::string(EXAMPLE_APPLICATION_NAME));
+
+        // Vulkan settings
+        params.Set<std::string>(VulkanParams::ApplicationName, params.Get<std::string>(WindowParams::Title));
+        params.Set<std::vector<std::string>>(VulkanParams::InstanceLayers, {"VK_LAYER_KHRONOS_validation"});
+
+        // Project customizable settings
+        params.Set(AppSettings::ClearColor, VkClearColorValue{0.0f, 0.3f, 0.3f, 1.0f});
+        params.Set(AppSettings::MouseSensitivity, 3.0f);
+        params.Set(AppSettings::CameraSpeed, 30.0f);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return false;
+    }
+
+    return true;
+}
+
+bool RunApplication(ParameterServer params)
+{
+    // Create a window
+    const auto window = std::make_shared<Window>(params.Get<std::string>(WindowParams::Title));
+    if (!window->Init(params.Get<std::uint32_t>(WindowParams::Width), params.Get<std::uint32_t>(WindowParams::Height),
+                      params.Get<bool>(WindowParams::Resizable), params.Get<unsigned int>(WindowParams::SampleCount))) {
+        std::cerr << "Failed to initialize window." << std::endl;
+        return false;
+    }
+    params.Set<std::vector<std::string>>(VulkanParams::InstanceExtensions, Window::GetVulkanInstanceExtensions());
+
+    // Init Vulkan application
+    VulkanApplication app{std::move(params)};
+    app.SetWindow(window);
+    return app.Run();
+}
+
+int main(const int argc, char* argv[])
+{
+    // Config file (--config=<path>), --<key>=<value> overrides and --sweep.<key>=<v0>|<v1> axes
+    ParameterOverrides overrides;
+    if (!overrides.ParseCommandLine(argc, argv)) {
+        std::cerr << "Failed to parse command line!" << std::endl;
+        return -1;
+    }
+
+    for (std::uint32_t configIndex = 0; configIndex < overrides.GetConfigurationCount(); ++configIndex) {
+        ParameterServer params{CreateParameterSchema()};
+        if (!SetParams(params)) {
+            std::cerr << "Failed to set parameters!" << std::endl;
+            return -1;
+        }
+
+        try {
+            overrides.Apply(params, configIndex);
+            params.Set<std::string>(BenchmarkParams::ConfigurationName, overrides.GetConfigurationName(configIndex));
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << '\n';
+            return -1;
+        }
+
+        if (!RunApplication(std::move(params))) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,534 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "VulkanApplication.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+
+#include "AppCommonConfig.h"
+#include "AppConfig.h"
+#include "ApplicationData.h"
+#include "TimeUtils.h"
+#include "VulkanHelpers.h"
+#include "VulkanShaderModule.h"
+
+namespace examples::fundamentals::drawing_3d::instance_streaming
+{
+using namespace common::utility;
+using namespace common::vulkan_wrapper;
+using namespace common::vulkan_framework;
+using namespace common::window_wrapper;
+
+VulkanApplication::VulkanApplication(ParameterServer&& params) : ApplicationDrawing3D(std::move(params)) {}
+
+bool VulkanApplication::Init()
+{
+    try {
+        ResolveParamKeys();
+
+        // Instance count can be changed from the command line, e.g. --AppSettings.InstanceCount=1000000
+        instanceCount_ = std::clamp(GetParamU32(AppSettings::InstanceCount), 1u,
+                                    GetParamU32(AppConstants::MaxInstanceCount));
+        useStorageBuffer_ = params_.Get<bool>(AppSettings::UseStorageBuffer);
+        std::cout << "Instances: " << instanceCount_ << ", instance data source: "
+                  << (useStorageBuffer_ ? "storage buffer" : "instance rate vertex buffer") << std::endl;
+
+        currentWindowWidth_ = GetParamU32(WindowParams::Width);
+        currentWindowHeight_ = GetParamU32(WindowParams::Height);
+
+        InitInputSystem();
+
+        CreateDefaultSurface();
+        SelectDefaultPhysicalDevice();
+        CreateDefaultLogicalDevice();
+        CreateDefaultQueue();
+        CreateDefaultSwapChain();
+        CreateDefaultCommandPool();
+        CreateDefaultSyncObjects(GetParamU32(AppConstants::MaxFramesInFlight));
+
+        CreateResources();
+        InitResources();
+
+        CreateRenderPass();
+        CreatePipeline();
+        CreateDefaultFramebuffers(images_[GetParamStr(AppConstants::DepthImage)]->GetImageView(
+                GetParamStr(AppConstants::DepthImageView)));
+
+        CreateCommandBuffers();
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return false;
+    }
+
+    return true;
+}
+
+void VulkanApplication::DrawFrame()
+{
+    inFlightFences_[currentIndex_]->WaitForFence(true, UINT64_MAX);
+    inFlightFences_[currentIndex_]->ResetFence();
+
+    uint32_t imageIndex = swapChain_->AcquireNextImage(imageAvailableSemaphores_[currentIndex_], nullptr);
+
+    if (swapImagesFences_[imageIndex] != nullptr) {
+        swapImagesFences_[imageIndex]->WaitForFence(true, UINT64_MAX);
+    }
+
+    swapImagesFences_[imageIndex] = inFlightFences_[currentIndex_];
+
+    // Only the CPU work of the frame is measured, waits for the GPU and the swap chain are excluded
+    const auto cpuStart = std::chrono::steady_clock::now();
+
+    CalculateViewProjection();
+    const auto instanceOffset = StreamInstanceData();
+    RecordPresentCommandBuffers(imageIndex, instanceOffset);
+
+    queue_->Submit({cmdBuffersPresent_[imageIndex]}, {imageAvailableSemaphores_[currentIndex_]},
+                   {renderFinishedSemaphores_[imageIndex]}, inFlightFences_[currentIndex_],
+                   {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT});
+
+    const std::chrono::duration<double, std::milli> cpuTime = std::chrono::steady_clock::now() - cpuStart;
+    ReportCpuTime(cpuTime.count());
+
+    queue_->Present({swapChain_}, {imageIndex}, {renderFinishedSemaphores_[imageIndex]});
+
+    currentIndex_ = (currentIndex_ + 1) % GetParam(maxFramesInFlightKey_);
+}
+
+void VulkanApplication::PreUpdate()
+{
+    // Calculate delta time
+    const double currentFrame = GetCurrentTime();
+    deltaTime_ = currentFrame - lastFrame_;
+    lastFrame_ = currentFrame;
+
+    // Poll events
+    ApplicationDrawing3D::PreUpdate();
+
+    // Process continuous inputs
+    ProcessInput();
+}
+
+void VulkanApplication::InitInputSystem()
+{
+    lastX_ = static_cast<float>(currentWindowWidth_) / 2.0f;
+    lastY_ = static_cast<float>(currentWindowHeight_) / 2.0f;
+
+    window_->DisableCursor();
+
+    window_->OnMouseMove([&](const MouseMoveEvent& event) {
+        const auto xPos = static_cast<float>(event.X);
+        const auto yPos = static_cast<float>(event.Y);
+
+        if (firstMouseTriggered_) {
+            lastX_ = xPos;
+            lastY_ = yPos;
+            firstMouseTriggered_ = false;
+        }
+
+        float xOffset = xPos - lastX_;
+        float yOffset = lastY_ - yPos;
+        lastX_ = xPos;
+        lastY_ = yPos;
+
+        const float sensitivity = GetParam(mouseSensitivityKey_) * static_cast<float>(deltaTime_);
+        xOffset *= sensitivity;
+        yOffset *= sensitivity;
+
+        yawAngle_ += xOffset;
+        pitchAngle_ += yOffset;
+
+        pitchAngle_ = std::clamp(pitchAngle_, -89.0f, 89.0f);
+
+        const float yawRad = glm::radians(yawAngle_);
+        const float pitchRad = glm::radians(pitchAngle_);
+
+        const glm::vec3 front{std::cos(yawRad) * std::cos(pitchRad), std::sin(pitchRad),
+                              std::sin(yawRad) * std::cos(pitchRad)};
+        cameraFront_ = glm::normalize(front);
+    });
+}
+
+void VulkanApplication::CreateResources()
+{
+    depthImageFormat_ = physicalDevice_->FindSupportedFormat(
+            {VK_FORMAT_D32_SFLOAT, VK_FORMAT_D32_SFLOAT_S8_UINT, VK_FORMAT_D24_UNORM_S8_UINT},
+            VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT);
+
+    // Regions start from aligned offsets, so they can be bound as dynamic storage buffer offsets too
+    instanceRegionSize_ = AlignUp(instanceCount_ * sizeof(InstanceData),
+                                  physicalDevice_->GetProperties().limits.minStorageBufferOffsetAlignment);
+
+    // Fill buffer create infos
+    const std::uint32_t vertexBufferSize = vertices.size() * sizeof(VertexPos3Uv2);
+    const uint32_t indexDataSize = indices.size() * sizeof(indices[0]);
+    const VkDeviceSize instanceBufferSize = instanceRegionSize_ * GetParamU32(AppConstants::MaxFramesInFlight);
+    const std::vector<BufferResourceCreateInfo> bufferCreateInfos = {
+        {GetParamStr(AppConstants::MainVertexBuffer), vertexBufferSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT},
+        {GetParamStr(AppConstants::MainIndexBuffer), indexDataSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT},
+        {GetParamStr(AppConstants::InstanceBuffer), instanceBufferSize,
+         VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT}};
+    CreateBuffers(bufferCreateInfos);
+
+    // Fill shader module create infos
+    const auto vertexShaderFile = useStorageBuffer_ ? GetParamStr(AppConstants::StorageBufferShaderFile)
+                                                    : GetParamStr(AppConstants::VertexStreamShaderFile);
+    const ShaderModulesCreateInfo shaderModuleCreateInfo = {
+        .BasePath = SHADERS_DIR,
+        .ShaderType = params_.Get<ShaderBaseType>(AppConstants::BaseShaderType),
+        .Modules = {{.Name = GetParamStr(AppConstants::MainVertexShaderKey), .FileName = vertexShaderFile},
+                    {.Name = GetParamStr(AppConstants::MainFragmentShaderKey),
+                     .FileName = GetParamStr(AppConstants::MainFragmentShaderFile)}}};
+    CreateShaderModules(shaderModuleCreateInfo);
+
+    // Storage buffer path needs one set, the dynamic offset selects the region of the frame
+    if (useStorageBuffer_) {
+        const DescriptorResourceCreateInfo descriptorSetCreateInfo = {
+            .MaxSets = 1,
+            .PoolSizes = {{VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1}},
+            .Layouts = {{.Name = GetParamStr(AppConstants::InstanceDescSetLayout),
+                         .Bindings = {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1, VK_SHADER_STAGE_VERTEX_BIT,
+                                       nullptr}}}},
+            .DescriptorSets = {{.Name = GetParamStr(AppConstants::InstanceDescSetLayout),
+                                .LayoutName = GetParamStr(AppConstants::InstanceDescSetLayout)}}};
+        CreateDescriptorSets(descriptorSetCreateInfo);
+    }
+
+    const std::vector<ImageResourceCreateInfo> imageResourceCreateInfos = {
+        {.Name = GetParamStr(AppConstants::DepthImage),
+         .MemProperties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+         .Format = depthImageFormat_,
+         .Dimensions = {currentWindowWidth_, currentWindowHeight_, 1},
+         .UsageFlags = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
+         .Views = {ImageViewCreateInfo{.ViewName = GetParamStr(AppConstants::DepthImageView),
+                                       .Format = depthImageFormat_,
+                                       .SubresourceRange = {.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT,
+                                                            .baseMipLevel = 0,
+                                                            .levelCount = 1,
+                                                            .baseArrayLayer = 0,
+                                                            .layerCount = 1}}}}};
+    CreateImages(imageResourceCreateInfos);
+}
+
+void VulkanApplication::InitResources()
+{
+    SetBuffer(GetParamStr(AppConstants::MainVertexBuffer), vertices.data(), vertices.size() * sizeof(VertexPos3Uv2));
+    SetBuffer(GetParamStr(AppConstants::MainIndexBuffer), indices.data(), indices.size() * sizeof(indices[0]));
+
+    // Instance buffer stays mapped, instance data is written into it directly every frame
+    buffers_[GetParamStr(AppConstants::InstanceBuffer)]->MapMemory();
+
+    // Place instances into a cube shaped grid, w component keeps the animation phase of the instance
+    const auto gridSize = static_cast<std::uint32_t>(std::ceil(std::cbrt(static_cast<double>(instanceCount_))));
+    constexpr float spacing = 2.0f;
+    const float halfExtent = static_cast<float>(gridSize - 1) * spacing * 0.5f;
+    instanceBasePositions_.resize(instanceCount_);
+    instanceColors_.resize(instanceCount_);
+    for (std::uint32_t i = 0; i < instanceCount_; ++i) {
+        const glm::vec3 cell{static_cast<float>(i % gridSize), static_cast<float>(i / gridSize % gridSize),
+                             static_cast<float>(i / (gridSize * gridSize))};
+        instanceBasePositions_[i] = glm::vec4(cell * spacing - halfExtent, static_cast<float>(i) * 0.37f);
+        instanceColors_[i] = glm::vec4((cell + 1.0f) / static_cast<float>(gridSize), 1.0f);
+    }
+
+    // Start in front of the grid
+    cameraPos_ = glm::vec3(0.0f, 0.0f, halfExtent + 10.0f);
+
+    if (useStorageBuffer_) {
+        UpdateDescriptorSets();
+    }
+}
+
+void VulkanApplication::CreateRenderPass()
+{
+    VkAttachmentReference colorAttachmentRef{0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+
+    VkAttachmentReference depthAttachmentRef{1, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL};
+
+    renderPass_ = device_->CreateRenderPass([&](auto& builder) {
+        builder.AddAttachment([](auto& attachmentCreateInfo) {
+                   attachmentCreateInfo.format = VK_FORMAT_B8G8R8A8_SRGB;
+                   attachmentCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+                   attachmentCreateInfo.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+                   attachmentCreateInfo.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+                   attachmentCreateInfo.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+                   attachmentCreateInfo.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+                   attachmentCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+                   attachmentCreateInfo.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+               })
+                .AddAttachment([&](auto& attachmentCreateInfo) {
+                    attachmentCreateInfo.format = depthImageFormat_;
+                    attachmentCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+                    attachmentCreateInfo.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+                    attachmentCreateInfo.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+                    attachmentCreateInfo.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+                    attachmentCreateInfo.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+                    attachmentCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+                    attachmentCreateInfo.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+                })
+                .AddSubpass([&](auto& subpassCreateInfo) {
+                    subpassCreateInfo.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+                    subpassCreateInfo.colorAttachmentCount = 1;
+                    subpassCreateInfo.pColorAttachments = &colorAttachmentRef;
+                    subpassCreateInfo.pDepthStencilAttachment = &depthAttachmentRef;
+                });
+    });
+
+    if (!renderPass_) {
+        throw std::runtime_error("Failed to create render pass!");
+    }
+}
+
+void VulkanApplication::CreatePipeline()
+{
+    VkPushConstantRange cameraPushConstant;
+    cameraPushConstant.offset = 0;
+    cameraPushConstant.size = sizeof(CameraData);
+    cameraPushConstant.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+
+    std::vector<std::shared_ptr<VulkanDescriptorSetLayout>> descSetLayouts;
+    if (useStorageBuffer_) {
+        descSetLayouts.push_back(
+                descriptorRegistry_->GetDescriptorLayout(GetParamStr(AppConstants::InstanceDescSetLayout)));
+    }
+    pipelineLayout_ = device_->CreatePipelineLayout(descSetLayouts, {cameraPushConstant});
+
+    if (!pipelineLayout_) {
+        throw std::runtime_error("Failed to create pipeline layout!");
+    }
+
+    VkViewport viewport{0,    0,   static_cast<float>(currentWindowWidth_), static_cast<float>(currentWindowHeight_),
+                        0.0f, 1.0f};
+    VkRect2D scissor{0, 0, currentWindowWidth_, currentWindowHeight_};
+
+    VkPipelineColorBlendAttachmentState colorBlendAttachment;
+    colorBlendAttachment.blendEnable = VK_FALSE;
+    colorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.colorBlendOp = VK_BLEND_OP_ADD;
+    colorBlendAttachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+    colorBlendAttachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+    colorBlendAttachment.alphaBlendOp = VK_BLEND_OP_ADD;
+    colorBlendAttachment.colorWriteMask =
+            VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+
+    // Binding 0 advances per vertex, binding 1 advances per instance (only used by the vertex stream path)
+    constexpr uint32_t vertexBindingIndex = 0;
+    constexpr uint32_t instanceBindingIndex = 1;
+    std::vector bindingDescriptions{GenerateBindingDescription<VertexPos3Uv2>(vertexBindingIndex)};
+    std::vector attributeDescriptions{GenerateAttributeDescription(VertexPos3Uv2, Position, vertexBindingIndex),
+                                      GenerateAttributeDescription(VertexPos3Uv2, Uv, vertexBindingIndex)};
+    if (!useStorageBuffer_) {
+        bindingDescriptions.push_back(
+                GenerateBindingDescription<InstanceData>(instanceBindingIndex, VK_VERTEX_INPUT_RATE_INSTANCE));
+        attributeDescriptions.push_back(
+                GenerateAttributeDescription(InstanceData, PositionScale, instanceBindingIndex));
+        attributeDescriptions.push_back(GenerateAttributeDescription(InstanceData, Color, instanceBindingIndex));
+    }
+
+    pipeline_ = device_->CreateGraphicsPipeline(pipelineLayout_, renderPass_, [&](auto& builder) {
+        builder.AddShaderStage([&](auto& shaderStageCreateInfo) {
+            shaderStageCreateInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;
+            shaderStageCreateInfo.module =
+                    shaderResources_->GetShaderModule(GetParamStr(AppConstants::MainVertexShaderKey))->GetHandle();
+        });
+        builder.AddShaderStage([&](auto& shaderStageCreateInfo) {
+            shaderStageCreateInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+            shaderStageCreateInfo.module =
+                    shaderResources_->GetShaderModule(GetParamStr(AppConstants::MainFragmentShaderKey))->GetHandle();
+        });
+        builder.SetVertexInputState([&](auto& vertexInputStateCreateInfo) {
+            vertexInputStateCreateInfo.vertexBindingDescriptionCount = bindingDescriptions.size();
+            vertexInputStateCreateInfo.pVertexBindingDescriptions = bindingDescriptions.data();
+            vertexInputStateCreateInfo.vertexAttributeDescriptionCount = attributeDescriptions.size();
+            vertexInputStateCreateInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
+        });
+        builder.SetViewportState([&](auto& viewportStateCreateInfo) {
+            viewportStateCreateInfo.viewportCount = 1;
+            viewportStateCreateInfo.pViewports = &viewport;
+            viewportStateCreateInfo.scissorCount = 1;
+            viewportStateCreateInfo.pScissors = &scissor;
+        });
+        builder.SetColorBlendState([&](auto& blendStateCreateInfo) {
+            blendStateCreateInfo.attachmentCount = 1;
+            blendStateCreateInfo.pAttachments = &colorBlendAttachment;
+        });
+        builder.SetDepthStencilState([&](auto& depthStencilStateCreateInfo) {
+            depthStencilStateCreateInfo.depthTestEnable = VK_TRUE;
+            depthStencilStateCreateInfo.depthWriteEnable = VK_TRUE;
+            depthStencilStateCreateInfo.depthCompareOp = VK_COMPARE_OP_LESS;
+        });
+    });
+
+    if (!pipeline_) {
+        throw std::runtime_error("Failed to create graphics pipeline!");
+    }
+}
+
+void VulkanApplication::UpdateDescriptorSets()
+{
+    std::vector<VkDescriptorBufferInfo> bufferInfos;
+    bufferInfos.emplace_back(buffers_[GetParamStr(AppConstants::InstanceBuffer)]->GetBuffer()->GetHandle(), 0,
+                             instanceRegionSize_);
+
+    BufferWriteRequest bufferUpdateRequest;
+    bufferUpdateRequest.LayoutName = GetParamStr(AppConstants::InstanceDescSetLayout);
+    bufferUpdateRequest.BindingIndex = 0;
+    bufferUpdateRequest.Buffers = bufferInfos;
+    bufferUpdateRequest.Type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+
+    const DescriptorUpdateInfo descriptorSetUpdateInfo = {.BufferWriteRequests = {bufferUpdateRequest}};
+
+    UpdateDescriptorSet(descriptorSetUpdateInfo);
+}
+
+void VulkanApplication::CreateCommandBuffers()
+{
+    cmdBuffersPresent_ = cmdPool_->CreateCommandBuffers(framebuffers_.size(), VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+
+    if (cmdBuffersPresent_.empty()) {
+        throw std::runtime_error("Failed to create command buffers!");
+    }
+}
+
+void VulkanApplication::RecordPresentCommandBuffers(const std::uint32_t currentImageIndex,
+                                                    const VkDeviceSize instanceOffset)
+{
+    std::array<VkClearValue, 2> clearValues{};
+    clearValues[0].color = GetParam(clearColorKey_);
+    clearValues[1].depthStencil = {1.0f, 0};
+
+    const auto& currentCmdBuffer = cmdBuffersPresent_[currentImageIndex];
+
+    if (!currentCmdBuffer->BeginCommandBuffer(nullptr)) {
+        throw std::runtime_error("Failed to begin recording command buffer!");
+    }
+    currentCmdBuffer->BeginRenderPass(
+            [&](auto& beginInfo) {
+                beginInfo.renderPass = renderPass_->GetHandle();
+                beginInfo.framebuffer = framebuffers_[currentImageIndex]->GetHandle();
+                beginInfo.renderArea.offset = {0, 0};
+                beginInfo.renderArea.extent = VkExtent2D(currentWindowWidth_, currentWindowHeight_);
+                beginInfo.clearValueCount = clearValues.size();
+                beginInfo.pClearValues = clearValues.data();
+            },
+            VK_SUBPASS_CONTENTS_INLINE);
+
+    currentCmdBuffer->BindPipeline(pipeline_, VK_PIPELINE_BIND_POINT_GRAPHICS);
+    currentCmdBuffer->PushConstants(pipelineLayout_, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(CameraData), &cameraData_);
+
+    if (useStorageBuffer_) {
+        const std::vector descSets{descriptorRegistry_->GetDescriptorSet(GetParam(instanceDescSetLayoutKey_))};
+        currentCmdBuffer->BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_, 0, descSets,
+                                             {static_cast<std::uint32_t>(instanceOffset)});
+        currentCmdBuffer->BindVertexBuffers({buffers_[GetParam(mainVertexBufferKey_)]->GetBuffer()}, 0, 1, {0});
+    } else {
+        const std::vector vertexBuffers{buffers_[GetParam(mainVertexBufferKey_)]->GetBuffer(),
+                                        buffers_[GetParam(instanceBufferKey_)]->GetBuffer()};
+        currentCmdBuffer->BindVertexBuffers(vertexBuffers, 0, 2, {0, instanceOffset});
+    }
+    currentCmdBuffer->BindIndexBuffer(buffers_[GetParam(mainIndexBufferKey_)]->GetBuffer());
+
+    // All instances are drawn with one call
+    currentCmdBuffer->DrawIndexed(indices.size(), instanceCount_, 0, 0, 0);
+
+    currentCmdBuffer->EndRenderPass();
+    if (!currentCmdBuffer->EndCommandBuffer()) {
+        throw std::runtime_error("Failed to end recording command buffer!");
+    }
+}
+
+VkDeviceSize VulkanApplication::StreamInstanceData()
+{
+    const auto currentTime = static_cast<float>(GetCurrentTime());
+
+    // GPU doesn't read the region of this frame index anymore (its fence is waited), so it is written in place
+    const VkDeviceSize instanceOffset = currentIndex_ * instanceRegionSize_;
+    auto* instances = reinterpret_cast<InstanceData*>(
+            static_cast<std::uint8_t*>(buffers_[GetParam(instanceBufferKey_)]->GetMappedData()) + instanceOffset);
+
+    for (std::uint32_t i = 0; i < instanceCount_; ++i) {
+        const glm::vec4& base = instanceBasePositions_[i];
+        const float bounce = std::sin(currentTime * 2.0f + base.w) * 0.5f;
+        const float scale = 0.75f + std::sin(currentTime + base.w) * 0.25f;
+        const glm::vec4& color = instanceColors_[i];
+
+        instances[i].PositionScale.data = {base.x, base.y + bounce, base.z, scale};
+        instances[i].Color.data = {color.r, color.g, color.b, color.a};
+    }
+
+    // Memory is host coherent, so there is no flush
+    return instanceOffset;
+}
+
+void VulkanApplication::CalculateViewProjection()
+{
+    const glm::mat4 view = glm::lookAt(cameraPos_, cameraPos_ + cameraFront_, cameraUp_);
+
+    const float aspectRatio = static_cast<float>(currentWindowWidth_) / static_cast<float>(currentWindowHeight_);
+    glm::mat4 proj = glm::perspective(glm::radians(45.0f), // FOV
+                                      aspectRatio,         // Aspect ratio
+                                      0.1f,                // Near clipping-plane
+                                      1000.0f              // Far clipping plane
+    );
+    proj[1][1] *= -1;                                      // Vulkan trick for projection
+
+    cameraData_.viewProjection = proj * view;
+}
+
+void VulkanApplication::ReportCpuTime(const double cpuTimeMs)
+{
+    cpuTimeSumMs_ += cpuTimeMs;
+    ++cpuTimeFrameCount_;
+
+    if (cpuTimeFrameCount_ < GetParamU32(AppConstants::CpuTimeReportInterval)) {
+        return;
+    }
+
+    std::cout << "Instances: " << instanceCount_ << ", CPU: " << cpuTimeSumMs_ / cpuTimeFrameCount_ << " ms/frame"
+              << std::endl;
+    cpuTimeSumMs_ = 0.0;
+    cpuTimeFrameCount_ = 0;
+}
+
+void VulkanApplication::ResolveParamKeys()
+{
+    maxFramesInFlightKey_ = ResolveParam<std::uint32_t>(AppConstants::MaxFramesInFlight);
+    clearColorKey_ = ResolveParam<VkClearColorValue>(AppSettings::ClearColor);
+    mouseSensitivityKey_ = ResolveParam<float>(AppSettings::MouseSensitivity);
+    cameraSpeedKey_ = ResolveParam<float>(AppSettings::CameraSpeed);
+    mainVertexBufferKey_ = ResolveParam<std::string>(AppConstants::MainVertexBuffer);
+    mainIndexBufferKey_ = ResolveParam<std::string>(AppConstants::MainIndexBuffer);
+    instanceBufferKey_ = ResolveParam<std::string>(AppConstants::InstanceBuffer);
+    instanceDescSetLayoutKey_ = ResolveParam<std::string>(AppConstants::InstanceDescSetLayout);
+}
+
+void VulkanApplication::ProcessInput()
+{
+    const float cameraSpeed = GetParam(cameraSpeedKey_) * static_cast<float>(deltaTime_);
+    if (window_->IsKeyPressed(GLFW_KEY_W)) {
+        cameraPos_ += cameraSpeed * cameraFront_;
+    }
+    if (window_->IsKeyPressed(GLFW_KEY_S)) {
+        cameraPos_ -= cameraSpeed * cameraFront_;
+    }
+    if (window_->IsKeyPressed(GLFW_KEY_A)) {
+        cameraPos_ -= glm::normalize(glm::cross(cameraFront_, cameraUp_)) * cameraSpeed;
+    }
+    if (window_->IsKeyPressed(GLFW_KEY_D)) {
+        cameraPos_ += glm::normalize(glm::cross(cameraFront_, cameraUp_)) * cameraSpeed;
+    }
+}
+} // namespace examples::fundamentals::drawing_3d::instance_streaming
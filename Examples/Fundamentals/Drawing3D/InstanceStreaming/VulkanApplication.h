@@ -0,0 +1,118 @@
+/**
+ * @file    VulkanApplication.h
+ * @brief   This file contains VulkanApplication and ApplicationSettings implementations.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ApplicationData.h"
+#include "ApplicationDrawing3D.h"
+#include "VulkanCommandBuffer.h"
+#include "VulkanPipeline.h"
+#include "VulkanPipelineLayout.h"
+#include "Window.h"
+
+namespace examples::fundamentals::drawing_3d::instance_streaming
+{
+class VulkanApplication final : public base::ApplicationDrawing3D
+{
+public:
+    explicit VulkanApplication(common::utility::ParameterServer&& params);
+
+    ~VulkanApplication() override = default;
+
+protected:
+    bool Init() override;
+
+    void DrawFrame() override;
+
+    void PreUpdate() override;
+
+private:
+    void InitInputSystem();
+
+    void CreateResources();
+
+    void InitResources();
+
+    void CreateRenderPass();
+
+    void CreatePipeline();
+
+    void UpdateDescriptorSets();
+
+    void CreateCommandBuffers();
+
+    void RecordPresentCommandBuffers(std::uint32_t currentImageIndex, VkDeviceSize instanceOffset);
+
+    [[nodiscard]] VkDeviceSize StreamInstanceData();
+
+    void CalculateViewProjection();
+
+    void ReportCpuTime(double cpuTimeMs);
+
+    void ProcessInput();
+
+    void ResolveParamKeys();
+
+    std::uint32_t currentIndex_ = 0;
+    std::uint32_t currentWindowWidth_ = UINT32_MAX;
+    std::uint32_t currentWindowHeight_ = UINT32_MAX;
+    VkFormat depthImageFormat_ = VK_FORMAT_UNDEFINED;
+    CameraData cameraData_{glm::mat4(1.0f)};
+
+    // Pre-resolved parameter keys for per-frame reads
+    common::utility::ParamKey<std::uint32_t> maxFramesInFlightKey_;
+    common::utility::ParamKey<VkClearColorValue> clearColorKey_;
+    common::utility::ParamKey<float> mouseSensitivityKey_;
+    common::utility::ParamKey<float> cameraSpeedKey_;
+    common::utility::ParamKey<std::string> mainVertexBufferKey_;
+    common::utility::ParamKey<std::string> mainIndexBufferKey_;
+    common::utility::ParamKey<std::string> instanceBufferKey_;
+    common::utility::ParamKey<std::string> instanceDescSetLayoutKey_;
+
+    // Instance data of every frame in flight is written to its own region of one persistently mapped buffer
+    std::uint32_t instanceCount_ = 0;
+    bool useStorageBuffer_ = false;
+    VkDeviceSize instanceRegionSize_ = 0;
+    std::vector<glm::vec4> instanceBasePositions_;
+    std::vector<glm::vec4> instanceColors_;
+
+    // CPU time measurement (update + record + submit, fence waits are excluded)
+    double cpuTimeSumMs_ = 0.0;
+    std::uint32_t cpuTimeFrameCount_ = 0;
+
+    // Pipelines
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipelineLayout> pipelineLayout_;
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipeline> pipeline_;
+
+    // Command buffers
+    std::vector<std::shared_ptr<common::vulkan_wrapper::VulkanCommandBuffer>> cmdBuffersPresent_;
+
+    // Camera values
+    glm::vec3 cameraPos_ = glm::vec3(0.0f, 0.0f, 4.0f);
+    glm::vec3 cameraFront_ = glm::vec3(0.0f, 0.0f, -1.0f);
+    glm::vec3 cameraUp_ = glm::vec3(0.0f, 1.0f, 0.0f);
+
+    // Delta time related values
+    double deltaTime_ = 0.0f;
+    double lastFrame_ = 0.0f;
+
+    // Mouse related values
+    bool firstMouseTriggered_ = true;
+    float yawAngle_ = -90.0f;
+    float pitchAngle_ = 0.0f;
+    float lastX_ = 0.0f;
+    float lastY_ = 0.0f;
+};
+} // namespace examples::fundamentals::drawing_3d::instance_streaming
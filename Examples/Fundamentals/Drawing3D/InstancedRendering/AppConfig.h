@@ -22,18 +22,25 @@ namespace AppConstants
     constexpr auto MainFragmentShaderFile = "AppConstants.MainFragmentShaderFile";
     constexpr auto MainVertexShaderKey = "AppConstants.MainVertexShaderKey";
     constexpr auto MainFragmentShaderKey = "AppConstants.MainFragmentShaderKey";
+    constexpr auto ComputeShaderFile = "AppConstants.ComputeShaderFile";
+    constexpr auto ComputeShaderKey = "AppConstants.ComputeShaderKey";
 
     // Resources
     constexpr auto MainVertexBuffer = "AppConstants.MainVertexBuffer";
     constexpr auto MainIndexBuffer = "AppConstants.MainIndexBuffer";
     constexpr auto ImageStagingBuffer = "AppConstants.ImageStagingBuffer";
-    constexpr auto MainUniformBuffer = "AppConstants.MainUniformBuffer";
     constexpr auto CrateImage = "AppConstants.CrateImage";
     constexpr auto CrateImageView = "AppConstants.CrateImageView";
     constexpr auto DepthImage = "AppConstants.DepthImage";
     constexpr auto DepthImageView = "AppConstants.DepthImageView";
     constexpr auto MainSampler = "AppConstants.MainSampler";
     constexpr auto MainDescSetLayout = "AppConstants.MainDescSetLayout";
+    constexpr auto ComputeDescSetLayout = "AppConstants.ComputeDescSetLayout";
+    constexpr auto AnimationBuffer = "AppConstants.AnimationBuffer";
+    constexpr auto AnimationStagingBuffer = "AppConstants.AnimationStagingBuffer";
+    constexpr auto TransformBuffer = "AppConstants.TransformBuffer";
+    constexpr auto TransformStagingBuffer = "AppConstants.TransformStagingBuffer";
+    constexpr auto TransformReadbackBuffer = "AppConstants.TransformReadbackBuffer";
     constexpr auto CrateTexturePath = "AppConstants.CrateTexturePath";
 } // namespace AppConstants
 
@@ -43,5 +50,9 @@ namespace AppSettings
     constexpr auto MouseSensitivity = "AppSettings.MouseSensitivity";
     constexpr auto CameraSpeed = "AppSettings.CameraSpeed";
     constexpr auto FirstInstanceIndex = "AppSettings.FirstInstanceIndex";
+    constexpr auto CubeCount = "AppSettings.CubeCount";
+    constexpr auto TransformBenchmarkCount = "AppSettings.TransformBenchmarkCount";
+    constexpr auto UseComputeAnimation = "AppSettings.UseComputeAnimation";
+    constexpr auto VerifyComputeAnimation = "AppSettings.VerifyComputeAnimation";
 } // namespace AppSettings
 } // namespace examples::fundamentals::drawing_3d::instanced_rendering
@@ -10,6 +10,8 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <iterator>
 #include <vector>
 
 #include "Vertex.h"
@@ -17,8 +19,6 @@
 
 namespace examples::fundamentals::drawing_3d::instanced_rendering
 {
-#define NUM_CUBES 20
-
 // Vertex Attribute Layout
 struct VertexPos3Uv2
 {
@@ -75,14 +75,36 @@ const std::vector<uint16_t> indices{
     20, 21, 22, 22, 23, 20  // Bottom
 };
 
-// MVP Matrices (for Push Constants)
-struct MvpData
+// Animation parameters of a cube (for the compute shader, std430 layout)
+struct CubeAnimation
+{
+    glm::vec4 Position;         // xyz: position
+    glm::vec4 AxisAngularSpeed; // xyz: normalized rotation axis, w: angular speed (radians per second)
+};
+
+// Push constants of the animation compute shader
+struct AnimationPushConstants
 {
-    glm::mat4 mvpMatrix;
+    glm::mat4 ViewProjection;
+    float Time;
+    std::uint32_t InstanceCount;
 };
 
+// Work group size of the animation compute shader (local_size_x)
+inline constexpr std::uint32_t animationGroupSize = 64;
+
+// Rotation speed of all cubes
+inline const float cubeAngularSpeed = glm::radians(120.0f);
+
+// Rotation axis changes with the cube index
+inline glm::vec3 GetCubeRotationAxis(const std::size_t index)
+{
+    return glm::normalize(glm::vec3(index % 2 == 0 ? 1.0f : 0.0f, index % 5 == 0 ? 1.0f : 0.0f,
+                                    index % 2 == 0 ? 0.0f : 1.0f));
+}
+
 // Model position vectors
-inline constexpr glm::vec3 modelPositions[NUM_CUBES] = {
+inline constexpr glm::vec3 modelPositions[] = {
     glm::vec3(0.0f, 0.0f, 0.0f),   glm::vec3(-4.0f, 1.5f, -5.0f), glm::vec3(5.0f, -1.2f, 3.0f),
     glm::vec3(-3.0f, 4.0f, -2.5f), glm::vec3(6.0f, -3.5f, 5.0f),  glm::vec3(-1.5f, -5.0f, 2.5f),
     glm::vec3(-5.0f, 1.0f, -4.0f), glm::vec3(2.0f, 4.5f, -3.5f),  glm::vec3(4.5f, -3.0f, 5.5f),
@@ -90,4 +112,22 @@ inline constexpr glm::vec3 modelPositions[NUM_CUBES] = {
     glm::vec3(1.0f, 3.0f, -5.0f),  glm::vec3(5.5f, -3.0f, -2.5f), glm::vec3(-2.5f, 5.5f, 1.0f),
     glm::vec3(5.0f, -4.0f, -5.0f), glm::vec3(-4.0f, 1.5f, 4.0f),  glm::vec3(3.0f, 2.5f, -3.0f),
     glm::vec3(-1.5f, -5.5f, 5.0f), glm::vec3(2.5f, 4.5f, -0.5f)};
+
+// First cubes use the fixed positions, the other ones are placed on grid layers behind them
+inline glm::vec3 GetCubePosition(const std::size_t index)
+{
+    constexpr std::size_t fixedCount = std::size(modelPositions);
+    if (index < fixedCount) {
+        return modelPositions[index];
+    }
+
+    constexpr std::size_t gridWidth = 64;
+    constexpr float spacing = 1.5f;
+    const std::size_t gridIndex = index - fixedCount;
+    const auto column = static_cast<float>(gridIndex % gridWidth);
+    const auto row = static_cast<float>(gridIndex / gridWidth % gridWidth);
+    const auto layer = static_cast<float>(gridIndex / (gridWidth * gridWidth));
+    constexpr float halfWidth = static_cast<float>(gridWidth) * 0.5f;
+    return {(column - halfWidth) * spacing, (row - halfWidth) * spacing, -8.0f - layer * spacing};
+}
 } // namespace examples::fundamentals::drawing_3d::instanced_rendering
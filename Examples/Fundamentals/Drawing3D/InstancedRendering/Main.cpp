@@ -11,6 +11,7 @@
 
 #include "AppCommonConfig.h"
 #include "AppConfig.h"
+#include "ParameterOverrides.h"
 #include "ShaderLoader.h"
 #include "VulkanApplication.h"
 #include "Window.h"
@@ -33,17 +34,24 @@ inline ParameterSchema CreateParameterSchema()
     schema.RegisterImmutableParam<std::string>(AppConstants::MainFragmentShaderFile, "instanced_cube.frag.spv");
     schema.RegisterImmutableParam<std::string>(AppConstants::MainVertexShaderKey, "vertMain");
     schema.RegisterImmutableParam<std::string>(AppConstants::MainFragmentShaderKey, "fragMain");
+    schema.RegisterImmutableParam<std::string>(AppConstants::ComputeShaderFile, "instance_animation.comp.spv");
+    schema.RegisterImmutableParam<std::string>(AppConstants::ComputeShaderKey, "compMain");
 
     schema.RegisterImmutableParam<std::string>(AppConstants::MainVertexBuffer, "mainVertexBuffer");
     schema.RegisterImmutableParam<std::string>(AppConstants::MainIndexBuffer, "mainIndexBuffer");
     schema.RegisterImmutableParam<std::string>(AppConstants::ImageStagingBuffer, "imageStagingBuffer");
-    schema.RegisterImmutableParam<std::string>(AppConstants::MainUniformBuffer, "mainUniformBuffer");
     schema.RegisterImmutableParam<std::string>(AppConstants::CrateImage, "crateImage");
     schema.RegisterImmutableParam<std::string>(AppConstants::CrateImageView, "crateImageView");
     schema.RegisterImmutableParam<std::string>(AppConstants::DepthImage, "depthImage");
     schema.RegisterImmutableParam<std::string>(AppConstants::DepthImageView, "depthImageView");
     schema.RegisterImmutableParam<std::string>(AppConstants::MainSampler, "mainSampler");
     schema.RegisterImmutableParam<std::string>(AppConstants::MainDescSetLayout, "mainDescSetLayout");
+    schema.RegisterImmutableParam<std::string>(AppConstants::ComputeDescSetLayout, "computeDescSetLayout");
+    schema.RegisterImmutableParam<std::string>(AppConstants::AnimationBuffer, "animationBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::AnimationStagingBuffer, "animationStagingBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::TransformBuffer, "transformBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::TransformStagingBuffer, "transformStagingBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::TransformReadbackBuffer, "transformReadbackBuffer");
     schema.RegisterImmutableParam<std::string>(AppConstants::CrateTexturePath, "Textures/crate1_diffuse.png");
 
     // Register Customizable Settings
@@ -51,6 +59,10 @@ inline ParameterSchema CreateParameterSchema()
     schema.RegisterParam<float>(AppSettings::MouseSensitivity);
     schema.RegisterParam<float>(AppSettings::CameraSpeed);
     schema.RegisterParam<std::uint32_t>(AppSettings::FirstInstanceIndex, 0);
+    schema.RegisterParam<std::uint32_t>(AppSettings::CubeCount, 20);
+    schema.RegisterParam<std::uint32_t>(AppSettings::TransformBenchmarkCount, 100000);
+    schema.RegisterParam<bool>(AppSettings::UseComputeAnimation, false);
+    schema.RegisterParam<bool>(AppSettings::VerifyComputeAnimation, false);
 
     return schema;
 }
@@ -79,27 +91,51 @@ bool SetParams(ParameterServer& params)
     return true;
 }
 
-int main()
+bool RunApplication(ParameterServer params)
 {
-    ParameterServer params{CreateParameterSchema()};
-    if (!SetParams(params)) {
-        std::cerr << "Failed to set parameters!" << std::endl;
-        return -1;
-    }
-
     // Create a window
     const auto window = std::make_shared<Window>(params.Get<std::string>(WindowParams::Title));
     if (!window->Init(params.Get<std::uint32_t>(WindowParams::Width), params.Get<std::uint32_t>(WindowParams::Height),
                       params.Get<bool>(WindowParams::Resizable), params.Get<unsigned int>(WindowParams::SampleCount))) {
         std::cerr << "Failed to initialize window." << std::endl;
-        return -1;
+        return false;
     }
     params.Set<std::vector<std::string>>(VulkanParams::InstanceExtensions, Window::GetVulkanInstanceExtensions());
 
     // Init Vulkan application
     VulkanApplication app{std::move(params)};
     app.SetWindow(window);
-    app.Run();
+    return app.Run();
+}
+
+int main(const int argc, char* argv[])
+{
+    // Config file (--config=<path>), --<key>=<value> overrides and --sweep.<key>=<v0>|<v1> axes
+    ParameterOverrides overrides;
+    if (!overrides.ParseCommandLine(argc, argv)) {
+        std::cerr << "Failed to parse command line!" << std::endl;
+        return -1;
+    }
+
+    for (std::uint32_t configIndex = 0; configIndex < overrides.GetConfigurationCount(); ++configIndex) {
+        ParameterServer params{CreateParameterSchema()};
+        if (!SetParams(params)) {
+            std::cerr << "Failed to set parameters!" << std::endl;
+            return -1;
+        }
+
+        try {
+            overrides.Apply(params, configIndex);
+            params.Set<std::string>(BenchmarkParams::ConfigurationName, overrides.GetConfigurationName(configIndex));
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << '\n';
+            return -1;
+        }
+
+        if (!RunApplication(std::move(params))) {
+            return -1;
+        }
+    }
 
     return 0;
 }
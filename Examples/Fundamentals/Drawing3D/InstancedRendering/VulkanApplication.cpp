@@ -9,15 +9,20 @@
 #include <algorithm>
 #include <array>
 #include <chrono>
+#include <cmath>
+#include <cstring>
+#include <random>
 
 #include <glm/ext/matrix_clip_space.hpp>
 #include <glm/ext/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
 
 #include "AppCommonConfig.h"
 #include "AppConfig.h"
 #include "ApplicationData.h"
 #include "TimeUtils.h"
 #include "VulkanHelpers.h"
+#include "VulkanPipeline.h"
 #include "VulkanSampler.h"
 #include "VulkanShaderModule.h"
 
@@ -33,6 +38,18 @@ VulkanApplication::VulkanApplication(ParameterServer&& params) : ApplicationDraw
 bool VulkanApplication::Init()
 {
     try {
+        ResolveParamKeys();
+
+        cubeCount_ = GetParamU32(AppSettings::CubeCount);
+        if (cubeCount_ == 0) {
+            throw std::runtime_error("Cube count must be greater than zero!");
+        }
+
+        useComputeAnimation_ = params_.Get<bool>(AppSettings::UseComputeAnimation);
+        verifyPending_ = useComputeAnimation_ && params_.Get<bool>(AppSettings::VerifyComputeAnimation);
+        std::cout << "Cube animation: " << (useComputeAnimation_ ? "compute shader" : "CPU") << ", " << cubeCount_
+                  << " cubes" << std::endl;
+
         currentWindowWidth_ = GetParamU32(WindowParams::Width);
         currentWindowHeight_ = GetParamU32(WindowParams::Height);
 
@@ -51,10 +68,15 @@ bool VulkanApplication::Init()
 
         CreateRenderPass();
         CreatePipeline();
+        if (useComputeAnimation_) {
+            CreateComputePipeline();
+        }
         CreateDefaultFramebuffers(images_[GetParamStr(AppConstants::DepthImage)]->GetImageView(
                 GetParamStr(AppConstants::DepthImageView)));
 
         CreateCommandBuffers();
+
+        RunTransformBenchmark();
     } catch (const std::exception& e) {
         std::cerr << e.what() << '\n';
         return false;
@@ -70,8 +92,20 @@ void VulkanApplication::DrawFrame()
 
     uint32_t imageIndex = swapChain_->AcquireNextImage(imageAvailableSemaphores_[currentIndex_], nullptr);
 
-    CalculateAndSetMvp();
-    RecordPresentCommandBuffers(imageIndex);
+    // Region of this frame index is not used by the GPU anymore, it is bound with the dynamic offset
+    const auto mvpDynamicOffset = static_cast<std::uint32_t>(currentIndex_ * transformRegionSize_);
+    const auto animationStart = std::chrono::steady_clock::now();
+    if (useComputeAnimation_) {
+        // Compute pass writes MVP matrices of this frame, CPU only updates the push constants
+        animationPushConstants_ = {.ViewProjection = CalculateViewProjection(),
+                                   .Time = static_cast<float>(GetCurrentTime()),
+                                   .InstanceCount = cubeCount_};
+    } else {
+        CalculateAndSetMvp(mvpDynamicOffset);
+    }
+    PrintAnimationStats(std::chrono::duration<double>(std::chrono::steady_clock::now() - animationStart).count());
+
+    RecordPresentCommandBuffers(imageIndex, mvpDynamicOffset);
 
     if (swapImagesFences_[imageIndex] != nullptr) {
         swapImagesFences_[imageIndex]->WaitForFence(true, UINT64_MAX);
@@ -83,9 +117,14 @@ void VulkanApplication::DrawFrame()
                    {renderFinishedSemaphores_[imageIndex]}, inFlightFences_[currentIndex_],
                    {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT});
 
+    if (verifyPending_) {
+        VerifyComputeAnimation(mvpDynamicOffset);
+        verifyPending_ = false;
+    }
+
     queue_->Present({swapChain_}, {imageIndex}, {renderFinishedSemaphores_[imageIndex]});
 
-    currentIndex_ = (currentIndex_ + 1) % GetParamU32(AppConstants::MaxFramesInFlight);
+    currentIndex_ = (currentIndex_ + 1) % GetParam(maxFramesInFlightKey_);
 }
 
 void VulkanApplication::PreUpdate()
@@ -124,7 +163,7 @@ void VulkanApplication::InitInputSystem()
         lastX_ = xPos;
         lastY_ = yPos;
 
-        const float sensitivity = GetParamFloat(AppSettings::MouseSensitivity) * static_cast<float>(deltaTime_);
+        const float sensitivity = GetParam(mouseSensitivityKey_) * static_cast<float>(deltaTime_);
         xOffset *= sensitivity;
         yOffset *= sensitivity;
 
@@ -160,32 +199,95 @@ void VulkanApplication::CreateResources()
          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT},
         {GetParamStr(AppConstants::MainIndexBuffer), indexDataSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT},
-        {GetParamStr(AppConstants::MainUniformBuffer), sizeof(mvpData_), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
-         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT},
         {GetParamStr(AppConstants::ImageStagingBuffer), static_cast<std::uint32_t>(crateTextureHandler_.Data.size()),
          VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT}};
     CreateBuffers(bufferCreateInfos);
 
+    // MVP matrices of every frame in flight are written to their own region of the transform buffer (by the CPU or
+    // the compute shader), so the GPU never reads half-updated data. The vertex shader reads the region of the frame
+    // as a storage buffer, so the cube count is only limited by maxStorageBufferRange.
+    const auto& limits = physicalDevice_->GetProperties().limits;
+    const VkDeviceSize transformSize = sizeof(glm::mat4) * cubeCount_;
+    if (transformSize > limits.maxStorageBufferRange) {
+        throw std::runtime_error("MVP matrices of the cubes exceed the maximum storage buffer range!");
+    }
+    // Regions are also aligned to the dirty blocks of the staging buffer (all of them are powers of two), so the dirty
+    // ranges of the CPU path never overlap two regions
+    constexpr VkDeviceSize dirtyBlockSize = 256;
+    transformRegionSize_ = AlignUp(transformSize, std::max({limits.minStorageBufferOffsetAlignment,
+                                                            limits.nonCoherentAtomSize, dirtyBlockSize}));
+    const VkDeviceSize transformBufferSize = transformRegionSize_ * GetParamU32(AppConstants::MaxFramesInFlight);
+
+    if (useComputeAnimation_) {
+        // Animation parameters are uploaded once, MVP matrices are written by the compute shader
+        const VkDeviceSize animationBufferSize = sizeof(CubeAnimation) * cubeCount_;
+        std::vector<BufferResourceCreateInfo> computeBufferCreateInfos = {
+            {GetParamStr(AppConstants::AnimationBuffer), animationBufferSize,
+             VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+             VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT},
+            {GetParamStr(AppConstants::AnimationStagingBuffer), animationBufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+             VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT},
+            {GetParamStr(AppConstants::TransformBuffer), transformBufferSize,
+             VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+             VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT}};
+        if (verifyPending_) {
+            computeBufferCreateInfos.push_back(
+                    {GetParamStr(AppConstants::TransformReadbackBuffer), transformSize,
+                     VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                     VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT});
+        }
+        CreateBuffers(computeBufferCreateInfos);
+    } else {
+        // CPU writes MVP matrices to the region of the frame in the persistently mapped staging buffer, only the dirty
+        // ranges are flushed and copied to the same region of the device local buffer
+        CreateBuffers({{.Name = GetParamStr(AppConstants::TransformStagingBuffer),
+                        .BufferSizeInBytes = transformBufferSize,
+                        .UsageFlags = VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                        .MemoryProperties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                        .DirtyBlockSize = dirtyBlockSize},
+                       {GetParamStr(AppConstants::TransformBuffer), transformBufferSize,
+                        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT}});
+    }
+
     // Fill shader module create infos
-    const ShaderModulesCreateInfo shaderModuleCreateInfo = {
+    ShaderModulesCreateInfo shaderModuleCreateInfo = {
         .BasePath = SHADERS_DIR,
         .ShaderType = params_.Get<ShaderBaseType>(AppConstants::BaseShaderType),
         .Modules = {{.Name = GetParamStr(AppConstants::MainVertexShaderKey),
                      .FileName = GetParamStr(AppConstants::MainVertexShaderFile)},
                     {.Name = GetParamStr(AppConstants::MainFragmentShaderKey),
                      .FileName = GetParamStr(AppConstants::MainFragmentShaderFile)}}};
+    if (useComputeAnimation_) {
+        shaderModuleCreateInfo.Modules.push_back({.Name = GetParamStr(AppConstants::ComputeShaderKey),
+                                                  .FileName = GetParamStr(AppConstants::ComputeShaderFile)});
+    }
     CreateShaderModules(shaderModuleCreateInfo);
 
     // Fill descriptor set create infos
-    const DescriptorResourceCreateInfo descriptorSetCreateInfo = {
+    DescriptorResourceCreateInfo descriptorSetCreateInfo = {
         .MaxSets = 1,
-        .PoolSizes = {{VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1}, {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1}},
+        .PoolSizes = {{VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1}, {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1}},
         .Layouts = {{.Name = GetParamStr(AppConstants::MainDescSetLayout),
                      .Bindings = {{0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_FRAGMENT_BIT,
                                    nullptr},
-                                  {1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT, nullptr}}}},
+                                  {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1, VK_SHADER_STAGE_VERTEX_BIT,
+                                   nullptr}}}},
         .DescriptorSets = {{.Name = GetParamStr(AppConstants::MainDescSetLayout),
                             .LayoutName = GetParamStr(AppConstants::MainDescSetLayout)}}};
+    if (useComputeAnimation_) {
+        descriptorSetCreateInfo.MaxSets = 2;
+        descriptorSetCreateInfo.PoolSizes.push_back({VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1});
+        descriptorSetCreateInfo.PoolSizes.push_back({VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1});
+        descriptorSetCreateInfo.Layouts.push_back(
+                {.Name = GetParamStr(AppConstants::ComputeDescSetLayout),
+                 .Bindings = {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+                              {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1, VK_SHADER_STAGE_COMPUTE_BIT,
+                               nullptr}}});
+        descriptorSetCreateInfo.DescriptorSets.push_back(
+                {.Name = GetParamStr(AppConstants::ComputeDescSetLayout),
+                 .LayoutName = GetParamStr(AppConstants::ComputeDescSetLayout)});
+    }
     CreateDescriptorSets(descriptorSetCreateInfo);
 
     const std::vector<ImageResourceCreateInfo> imageResourceCreateInfos = {
@@ -222,6 +324,18 @@ void VulkanApplication::InitResources()
     SetBuffer(GetParamStr(AppConstants::ImageStagingBuffer), crateTextureHandler_.Data.data(),
               crateTextureHandler_.Data.size());
 
+    if (useComputeAnimation_) {
+        UploadAnimationData();
+    } else {
+        cubeTransforms_.Resize(cubeCount_);
+        for (std::size_t i = 0; i < cubeCount_; i++) {
+            cubeTransforms_.Set(i, GetCubePosition(i), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f));
+        }
+        mvpMatrices_.resize(cubeCount_);
+        // Stays mapped for the lifetime of the application
+        buffers_[GetParamStr(AppConstants::TransformStagingBuffer)]->MapMemory();
+    }
+
     SetImageFromBuffer(GetParamStr(AppConstants::CrateImage),
                        buffers_[GetParamStr(AppConstants::ImageStagingBuffer)]->GetBuffer(),
                        {crateTextureHandler_.Width, crateTextureHandler_.Height, 1});
@@ -338,6 +452,34 @@ void VulkanApplication::CreatePipeline()
     }
 }
 
+void VulkanApplication::CreateComputePipeline()
+{
+    const auto queueFamilyProperties = physicalDevice_->GetQueueFamilyProperties();
+    if (!(queueFamilyProperties[currentQueueFamilyIndex_].queueFlags & VK_QUEUE_COMPUTE_BIT)) {
+        throw std::runtime_error("Selected queue family doesn't support compute operations!");
+    }
+
+    const VkPushConstantRange pushConstantRange{VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(AnimationPushConstants)};
+    computePipelineLayout_ = device_->CreatePipelineLayout(
+            {descriptorRegistry_->GetDescriptorLayout(GetParamStr(AppConstants::ComputeDescSetLayout))},
+            {pushConstantRange});
+
+    if (!computePipelineLayout_) {
+        throw std::runtime_error("Failed to create compute pipeline layout!");
+    }
+
+    computePipeline_ = device_->CreateComputePipeline(computePipelineLayout_, [&](auto& builder) {
+        builder.SetShaderStage([&](auto& shaderStageCreateInfo) {
+            shaderStageCreateInfo.module =
+                    shaderResources_->GetShaderModule(GetParamStr(AppConstants::ComputeShaderKey))->GetHandle();
+        });
+    });
+
+    if (!computePipeline_) {
+        throw std::runtime_error("Failed to create compute pipeline!");
+    }
+}
+
 void VulkanApplication::UpdateDescriptorSets()
 {
     std::vector<VkDescriptorImageInfo> imageSamplerInfos;
@@ -347,9 +489,11 @@ void VulkanApplication::UpdateDescriptorSets()
                                            ->GetHandle(),
                                    VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
 
+    // Vertex shader reads MVP matrices of the frame which are written by the CPU or by the compute pass
+    const auto mvpBuffer = buffers_[GetParamStr(AppConstants::TransformBuffer)]->GetBuffer();
+    const VkDeviceSize transformSize = sizeof(glm::mat4) * cubeCount_;
     std::vector<VkDescriptorBufferInfo> bufferInfos;
-    bufferInfos.emplace_back(buffers_[GetParamStr(AppConstants::MainUniformBuffer)]->GetBuffer()->GetHandle(), 0,
-                             sizeof(mvpData_));
+    bufferInfos.emplace_back(mvpBuffer->GetHandle(), 0, transformSize);
 
     ImageWriteRequest samplerUpdateRequest;
     samplerUpdateRequest.LayoutName = GetParamStr(AppConstants::MainDescSetLayout);
@@ -361,10 +505,29 @@ void VulkanApplication::UpdateDescriptorSets()
     bufferUpdateRequest.LayoutName = GetParamStr(AppConstants::MainDescSetLayout);
     bufferUpdateRequest.BindingIndex = 1;
     bufferUpdateRequest.Buffers = bufferInfos;
-    bufferUpdateRequest.Type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-
-    const DescriptorUpdateInfo descriptorSetUpdateInfo = {.BufferWriteRequests = {bufferUpdateRequest},
-                                                          .ImageWriteRequests = {samplerUpdateRequest}};
+    bufferUpdateRequest.Type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+
+    DescriptorUpdateInfo descriptorSetUpdateInfo = {.BufferWriteRequests = {bufferUpdateRequest},
+                                                    .ImageWriteRequests = {samplerUpdateRequest}};
+
+    if (useComputeAnimation_) {
+        BufferWriteRequest animationUpdateRequest;
+        animationUpdateRequest.LayoutName = GetParamStr(AppConstants::ComputeDescSetLayout);
+        animationUpdateRequest.BindingIndex = 0;
+        animationUpdateRequest.Buffers = {
+            {buffers_[GetParamStr(AppConstants::AnimationBuffer)]->GetBuffer()->GetHandle(), 0,
+             sizeof(CubeAnimation) * cubeCount_}};
+        animationUpdateRequest.Type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+
+        BufferWriteRequest transformUpdateRequest;
+        transformUpdateRequest.LayoutName = GetParamStr(AppConstants::ComputeDescSetLayout);
+        transformUpdateRequest.BindingIndex = 1;
+        transformUpdateRequest.Buffers = {{mvpBuffer->GetHandle(), 0, transformSize}};
+        transformUpdateRequest.Type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+
+        descriptorSetUpdateInfo.BufferWriteRequests.push_back(animationUpdateRequest);
+        descriptorSetUpdateInfo.BufferWriteRequests.push_back(transformUpdateRequest);
+    }
 
     UpdateDescriptorSet(descriptorSetUpdateInfo);
 }
@@ -378,10 +541,11 @@ void VulkanApplication::CreateCommandBuffers()
     }
 }
 
-void VulkanApplication::RecordPresentCommandBuffers(const std::uint32_t currentImageIndex)
+void VulkanApplication::RecordPresentCommandBuffers(const std::uint32_t currentImageIndex,
+                                                    const std::uint32_t mvpDynamicOffset)
 {
     std::array<VkClearValue, 2> clearValues{};
-    clearValues[0].color = params_.Get<VkClearColorValue>(AppSettings::ClearColor);
+    clearValues[0].color = GetParam(clearColorKey_);
     clearValues[1].depthStencil = {1.0f, 0};
 
     const auto& currentCmdBuffer = cmdBuffersPresent_[currentImageIndex];
@@ -389,6 +553,13 @@ void VulkanApplication::RecordPresentCommandBuffers(const std::uint32_t currentI
     if (!currentCmdBuffer->BeginCommandBuffer(nullptr)) {
         throw std::runtime_error("Failed to begin recording command buffer!");
     }
+
+    if (useComputeAnimation_) {
+        RecordAnimationDispatch(currentCmdBuffer, mvpDynamicOffset);
+    } else {
+        RecordTransformUpload(currentCmdBuffer);
+    }
+
     currentCmdBuffer->BeginRenderPass(
             [&](auto& beginInfo) {
                 beginInfo.renderPass = renderPass_->GetHandle();
@@ -401,12 +572,13 @@ void VulkanApplication::RecordPresentCommandBuffers(const std::uint32_t currentI
             VK_SUBPASS_CONTENTS_INLINE);
 
     currentCmdBuffer->BindPipeline(pipeline_, VK_PIPELINE_BIND_POINT_GRAPHICS);
-    const std::vector descSets{descriptorRegistry_->GetDescriptorSet(GetParamStr(AppConstants::MainDescSetLayout))};
-    currentCmdBuffer->BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_, 0, descSets);
-    const std::vector vertexBuffers{buffers_[GetParamStr(AppConstants::MainVertexBuffer)]->GetBuffer()};
+    const std::vector descSets{descriptorRegistry_->GetDescriptorSet(GetParam(mainDescSetLayoutKey_))};
+    currentCmdBuffer->BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_, 0, descSets,
+                                         {mvpDynamicOffset});
+    const std::vector vertexBuffers{buffers_[GetParam(mainVertexBufferKey_)]->GetBuffer()};
     currentCmdBuffer->BindVertexBuffers(vertexBuffers, 0, 1, {0});
-    currentCmdBuffer->BindIndexBuffer(buffers_[GetParamStr(AppConstants::MainIndexBuffer)]->GetBuffer());
-    currentCmdBuffer->DrawIndexed(indices.size(), NUM_CUBES, 0, 0, GetParamU32(AppSettings::FirstInstanceIndex));
+    currentCmdBuffer->BindIndexBuffer(buffers_[GetParam(mainIndexBufferKey_)]->GetBuffer());
+    currentCmdBuffer->DrawIndexed(indices.size(), cubeCount_, 0, 0, GetParam(firstInstanceIndexKey_));
 
     currentCmdBuffer->EndRenderPass();
     if (!currentCmdBuffer->EndCommandBuffer()) {
@@ -414,41 +586,300 @@ void VulkanApplication::RecordPresentCommandBuffers(const std::uint32_t currentI
     }
 }
 
-void VulkanApplication::CalculateAndSetMvp()
+void VulkanApplication::CalculateAndSetMvp(const std::uint32_t transformOffset)
 {
     const auto currentTime = static_cast<float>(GetCurrentTime());
 
-    for (size_t i = 0; i < NUM_CUBES; i++) {
-        auto model = glm::mat4(1.0f);
-        model = glm::translate(model, modelPositions[i]);
+    for (size_t i = 0; i < cubeCount_; i++) {
+        const auto rotation = glm::angleAxis(currentTime * cubeAngularSpeed, GetCubeRotationAxis(i));
+        cubeTransforms_.RotationX[i] = rotation.x;
+        cubeTransforms_.RotationY[i] = rotation.y;
+        cubeTransforms_.RotationZ[i] = rotation.z;
+        cubeTransforms_.RotationW[i] = rotation.w;
+    }
+
+    // Calculate MVP matrices of all cubes at once
+    ComposeMvpMatrices(cubeTransforms_, CalculateViewProjection(), mvpMatrices_);
+
+    // Only the region of this frame is written and marked as dirty, the other regions may still be read by the GPU
+    buffers_[GetParam(transformStagingBufferKey_)]->WriteData(mvpMatrices_.data(),
+                                                              mvpMatrices_.size() * sizeof(glm::mat4), transformOffset);
+}
 
-        // Change rotation axis to the cube index
-        auto axis = glm::vec3(i % 2 == 0 ? 1.0f : 0.0f, i % 5 == 0 ? 1.0f : 0.0f, i % 2 == 0 ? 0.0f : 1.0f);
-        model = glm::rotate(model, currentTime * glm::radians(45.0f), axis);
-        model = glm::rotate(model, currentTime * glm::radians(45.0f), axis);
-        model = glm::rotate(model, currentTime * glm::radians(30.0f), axis);
+void VulkanApplication::RecordTransformUpload(const std::shared_ptr<VulkanCommandBuffer>& cmdBuffer)
+{
+    const auto& stagingBuffer = buffers_[GetParam(transformStagingBufferKey_)];
+    const auto& transformBuffer = buffers_[GetParam(transformBufferKey_)];
 
-        const glm::mat4 view = glm::lookAt(cameraPos_, cameraPos_ + cameraFront_, cameraUp_);
+    // Both buffers have the same layout, so the dirty ranges of the staging buffer are copied to the same offsets
+    const auto copyRegions = stagingBuffer->GetDirtyCopyRegions();
+    if (copyRegions.empty()) {
+        return;
+    }
+    stagingBuffer->FlushDirtyRanges();
+    cmdBuffer->CopyBuffer(stagingBuffer->GetBuffer(), transformBuffer->GetBuffer(), copyRegions);
+
+    // MVP matrices must be copied before the vertex shader reads them from the storage buffer
+    VkBufferMemoryBarrier transformBarrier{};
+    transformBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    transformBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    transformBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    transformBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    transformBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    transformBarrier.buffer = transformBuffer->GetBuffer()->GetHandle();
+    transformBarrier.offset = copyRegions.front().dstOffset;
+    transformBarrier.size = copyRegions.back().dstOffset + copyRegions.back().size - copyRegions.front().dstOffset;
+    cmdBuffer->PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT, {},
+                               {transformBarrier});
+}
 
-        const float aspectRatio = static_cast<float>(currentWindowWidth_) / static_cast<float>(currentWindowHeight_);
-        glm::mat4 proj = glm::perspective(glm::radians(45.0f), // FOV
-                                          aspectRatio,         // Aspect ratio
-                                          0.1f,                // Near clipping-plane
-                                          30.0f                // Far clipping plane
-        );
-        proj[1][1] *= -1;                                      // Vulkan trick for projection
+void VulkanApplication::PrintAnimationStats(const double animationSeconds)
+{
+    animationSeconds_ += animationSeconds;
+    ++statsFrameCount_;
 
+    // Statistics are printed once per second
+    statsElapsedTime_ += deltaTime_;
+    if (statsElapsedTime_ < 1.0) {
+        return;
+    }
 
-        // Calculate MVP matrix
-        mvpData_[i].mvpMatrix = proj * view * model;
+    std::cout << "Cube animation (" << (useComputeAnimation_ ? "compute shader" : "CPU") << ", " << cubeCount_
+              << " cubes): " << animationSeconds_ * 1000.0 / statsFrameCount_ << " ms CPU time per frame"
+              << std::endl;
+
+    if (!useComputeAnimation_) {
+        // Upload counters of the staging buffer since the last print, averaged per frame
+        const auto& stagingBuffer = buffers_[GetParam(transformStagingBufferKey_)];
+        const auto& uploadStats = stagingBuffer->GetUploadStats();
+        std::cout << "Transform upload: " << uploadStats.WrittenBytes / statsFrameCount_ << " bytes written, "
+                  << uploadStats.FlushedBytes / statsFrameCount_ << " bytes in "
+                  << static_cast<double>(uploadStats.FlushedRangeCount) / statsFrameCount_
+                  << " ranges flushed and copied per frame (buffer size " << uploadStats.BufferSize << " bytes)"
+                  << std::endl;
+        stagingBuffer->ResetUploadStats();
     }
 
-    SetBuffer(GetParamStr(AppConstants::MainUniformBuffer), mvpData_, sizeof(mvpData_));
+    animationSeconds_ = 0.0;
+    statsElapsedTime_ = 0.0;
+    statsFrameCount_ = 0;
+}
+
+glm::mat4 VulkanApplication::CalculateViewProjection() const
+{
+    // View and projection are same for all cubes, so they are calculated once per frame
+    const glm::mat4 view = glm::lookAt(cameraPos_, cameraPos_ + cameraFront_, cameraUp_);
+
+    const float aspectRatio = static_cast<float>(currentWindowWidth_) / static_cast<float>(currentWindowHeight_);
+    glm::mat4 proj = glm::perspective(glm::radians(45.0f), // FOV
+                                      aspectRatio,         // Aspect ratio
+                                      0.1f,                // Near clipping-plane
+                                      30.0f                // Far clipping plane
+    );
+    proj[1][1] *= -1;                                      // Vulkan trick for projection
+
+    return proj * view;
+}
+
+void VulkanApplication::RunTransformBenchmark() const
+{
+    const auto count = GetParamU32(AppSettings::TransformBenchmarkCount);
+    if (count == 0) {
+        return;
+    }
+
+    // Random transforms with a fixed seed, so every run composes the same matrices
+    std::mt19937 generator{1234};
+    std::uniform_real_distribution distribution{-1.0f, 1.0f};
+    TransformArrays transforms;
+    transforms.Resize(count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        const glm::vec3 position{distribution(generator), distribution(generator), distribution(generator)};
+        const glm::quat rotation = glm::normalize(glm::quat(distribution(generator), distribution(generator),
+                                                            distribution(generator), distribution(generator)));
+        const glm::vec3 scale{distribution(generator) + 2.0f};
+        transforms.Set(i, position * 10.0f, rotation, scale);
+    }
+
+    const glm::mat4 viewProjection = glm::perspective(glm::radians(45.0f), 4.0f / 3.0f, 0.1f, 30.0f) *
+                                     glm::lookAt(glm::vec3(0.0f, 0.0f, 20.0f), glm::vec3(0.0f), cameraUp_);
+    std::vector<glm::mat4> reference(count);
+    std::vector<glm::mat4> batched(count);
+
+    // Reference: the usual per-object glm path
+    const auto glmStart = std::chrono::steady_clock::now();
+    for (std::uint32_t i = 0; i < count; ++i) {
+        const glm::vec3 position{transforms.PositionX[i], transforms.PositionY[i], transforms.PositionZ[i]};
+        const glm::quat rotation{transforms.RotationW[i], transforms.RotationX[i], transforms.RotationY[i],
+                                 transforms.RotationZ[i]};
+        const glm::vec3 scale{transforms.ScaleX[i], transforms.ScaleY[i], transforms.ScaleZ[i]};
+        reference[i] = viewProjection * (glm::translate(glm::mat4(1.0f), position) * glm::mat4_cast(rotation) *
+                                         glm::scale(glm::mat4(1.0f), scale));
+    }
+    const auto glmEnd = std::chrono::steady_clock::now();
+
+    ComposeMvpMatrices(transforms, viewProjection, batched);
+    const auto batchEnd = std::chrono::steady_clock::now();
+
+    float maxError = 0.0f;
+    for (std::uint32_t i = 0; i < count; ++i) {
+        for (int column = 0; column < 4; ++column) {
+            for (int row = 0; row < 4; ++row) {
+                maxError = std::max(maxError, std::abs(reference[i][column][row] - batched[i][column][row]));
+            }
+        }
+    }
+
+    const auto toMatricesPerSecond = [count](const auto duration) {
+        const double seconds = std::chrono::duration<double>(duration).count();
+        return seconds > 0.0 ? static_cast<double>(count) / seconds / 1e6 : 0.0;
+    };
+    std::cout << "Batch transform (" << GetBatchTransformBackend() << ", " << count
+              << " objects): glm " << toMatricesPerSecond(glmEnd - glmStart) << " M matrices/s, batch "
+              << toMatricesPerSecond(batchEnd - glmEnd) << " M matrices/s, max error " << maxError << std::endl;
+}
+
+void VulkanApplication::UploadAnimationData()
+{
+    std::vector<CubeAnimation> animations(cubeCount_);
+    for (std::size_t i = 0; i < cubeCount_; i++) {
+        animations[i] = {.Position = glm::vec4(GetCubePosition(i), 1.0f),
+                         .AxisAngularSpeed = glm::vec4(GetCubeRotationAxis(i), cubeAngularSpeed)};
+    }
+    SetBuffer(GetParamStr(AppConstants::AnimationStagingBuffer), animations.data(),
+              animations.size() * sizeof(CubeAnimation));
+
+    // Animation parameters don't change, so they are copied to device local memory once
+    const auto cmdBufferTransfer = cmdPool_->CreateCommandBuffers(1, VK_COMMAND_BUFFER_LEVEL_PRIMARY).front();
+    if (!cmdBufferTransfer->BeginCommandBuffer(
+                [](auto& beginInfo) { beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT; })) {
+        throw std::runtime_error("Failed to begin recording command buffer!");
+    }
+
+    VkBufferCopy copyRegion{};
+    copyRegion.size = animations.size() * sizeof(CubeAnimation);
+    cmdBufferTransfer->CopyBuffer(buffers_[GetParamStr(AppConstants::AnimationStagingBuffer)]->GetBuffer(),
+                                  buffers_[GetParamStr(AppConstants::AnimationBuffer)]->GetBuffer(), {copyRegion});
+
+    if (!cmdBufferTransfer->EndCommandBuffer()) {
+        throw std::runtime_error("Failed to end recording command buffer!");
+    }
+
+    // Directly submit this command buffer to queue
+    queue_->Submit({cmdBufferTransfer});
+    queue_->WaitIdle();
+}
+
+void VulkanApplication::RecordAnimationDispatch(const std::shared_ptr<VulkanCommandBuffer>& cmdBuffer,
+                                                const std::uint32_t transformOffset) const
+{
+    cmdBuffer->BindPipeline(computePipeline_, VK_PIPELINE_BIND_POINT_COMPUTE);
+    const std::vector descSets{descriptorRegistry_->GetDescriptorSet(GetParamStr(AppConstants::ComputeDescSetLayout))};
+    cmdBuffer->BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, computePipelineLayout_, 0, descSets,
+                                  {transformOffset});
+    cmdBuffer->PushConstants(computePipelineLayout_, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(AnimationPushConstants),
+                             &animationPushConstants_);
+    cmdBuffer->Dispatch((cubeCount_ + animationGroupSize - 1) / animationGroupSize, 1, 1);
+
+    // MVP matrices must be written before the vertex shader reads them from the storage buffer
+    VkBufferMemoryBarrier transformBarrier{};
+    transformBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    transformBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    transformBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    transformBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    transformBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    transformBarrier.buffer = buffers_.at(GetParamStr(AppConstants::TransformBuffer))->GetBuffer()->GetHandle();
+    transformBarrier.offset = transformOffset;
+    transformBarrier.size = sizeof(glm::mat4) * cubeCount_;
+    cmdBuffer->PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT, {},
+                               {transformBarrier});
+}
+
+void VulkanApplication::VerifyComputeAnimation(const std::uint32_t transformOffset) const
+{
+    const auto cmdBufferTransfer = cmdPool_->CreateCommandBuffers(1, VK_COMMAND_BUFFER_LEVEL_PRIMARY).front();
+    if (!cmdBufferTransfer->BeginCommandBuffer(
+                [](auto& beginInfo) { beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT; })) {
+        throw std::runtime_error("Failed to begin recording command buffer!");
+    }
+
+    // Compute writes of the frame that was just submitted must be visible to the copy, and the copy to the host
+    VkMemoryBarrier computeToTransfer{};
+    computeToTransfer.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    computeToTransfer.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    computeToTransfer.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    cmdBufferTransfer->PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, {}, {},
+                                       {computeToTransfer});
+
+    VkBufferCopy copyRegion{};
+    copyRegion.srcOffset = transformOffset;
+    copyRegion.size = sizeof(glm::mat4) * cubeCount_;
+    const auto& readbackBuffer = buffers_.at(GetParamStr(AppConstants::TransformReadbackBuffer));
+    cmdBufferTransfer->CopyBuffer(buffers_.at(GetParamStr(AppConstants::TransformBuffer))->GetBuffer(),
+                                  readbackBuffer->GetBuffer(), {copyRegion});
+
+    VkMemoryBarrier transferToHost{};
+    transferToHost.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    transferToHost.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    transferToHost.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    cmdBufferTransfer->PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, {}, {},
+                                       {transferToHost});
+
+    if (!cmdBufferTransfer->EndCommandBuffer()) {
+        throw std::runtime_error("Failed to end recording command buffer!");
+    }
+
+    queue_->Submit({cmdBufferTransfer});
+    queue_->WaitIdle();
+
+    // Reference matrices are composed on the CPU with the same time and view-projection values
+    TransformArrays transforms;
+    transforms.Resize(cubeCount_);
+    for (std::size_t i = 0; i < cubeCount_; i++) {
+        transforms.Set(i, GetCubePosition(i),
+                       glm::angleAxis(animationPushConstants_.Time * cubeAngularSpeed, GetCubeRotationAxis(i)),
+                       glm::vec3(1.0f));
+    }
+    std::vector<glm::mat4> reference(cubeCount_);
+    ComposeMvpMatrices(transforms, animationPushConstants_.ViewProjection, reference);
+
+    std::vector<glm::mat4> gpuMatrices(cubeCount_);
+    readbackBuffer->MapMemory();
+    std::memcpy(gpuMatrices.data(), readbackBuffer->GetMappedData(), gpuMatrices.size() * sizeof(glm::mat4));
+    readbackBuffer->UnmapMemory();
+
+    float maxError = 0.0f;
+    for (std::size_t i = 0; i < cubeCount_; i++) {
+        for (int column = 0; column < 4; ++column) {
+            for (int row = 0; row < 4; ++row) {
+                maxError = std::max(maxError, std::abs(reference[i][column][row] - gpuMatrices[i][column][row]));
+            }
+        }
+    }
+
+    // GPU sin/cos are not exactly same with the CPU ones, so a small tolerance is used
+    constexpr float tolerance = 1e-3f;
+    std::cout << "Compute animation readback: max error " << maxError
+              << (maxError <= tolerance ? " (passed)" : " (failed)") << std::endl;
+}
+
+void VulkanApplication::ResolveParamKeys()
+{
+    maxFramesInFlightKey_ = ResolveParam<std::uint32_t>(AppConstants::MaxFramesInFlight);
+    firstInstanceIndexKey_ = ResolveParam<std::uint32_t>(AppSettings::FirstInstanceIndex);
+    clearColorKey_ = ResolveParam<VkClearColorValue>(AppSettings::ClearColor);
+    mouseSensitivityKey_ = ResolveParam<float>(AppSettings::MouseSensitivity);
+    cameraSpeedKey_ = ResolveParam<float>(AppSettings::CameraSpeed);
+    mainVertexBufferKey_ = ResolveParam<std::string>(AppConstants::MainVertexBuffer);
+    mainIndexBufferKey_ = ResolveParam<std::string>(AppConstants::MainIndexBuffer);
+    mainDescSetLayoutKey_ = ResolveParam<std::string>(AppConstants::MainDescSetLayout);
+    transformBufferKey_ = ResolveParam<std::string>(AppConstants::TransformBuffer);
+    transformStagingBufferKey_ = ResolveParam<std::string>(AppConstants::TransformStagingBuffer);
 }
 
 void VulkanApplication::ProcessInput()
 {
-    const float cameraSpeed = GetParamFloat(AppSettings::CameraSpeed) * static_cast<float>(deltaTime_);
+    const float cameraSpeed = GetParam(cameraSpeedKey_) * static_cast<float>(deltaTime_);
     if (window_->IsKeyPressed(GLFW_KEY_W)) {
         cameraPos_ += cameraSpeed * cameraFront_;
     }
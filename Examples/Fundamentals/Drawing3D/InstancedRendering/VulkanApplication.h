@@ -12,9 +12,11 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "ApplicationData.h"
 #include "ApplicationDrawing3D.h"
+#include "BatchTransform.h"
 #include "TextureLoader.h"
 #include "VulkanCommandBuffer.h"
 #include "VulkanPipeline.h"
@@ -48,21 +50,66 @@ private:
 
     void CreatePipeline();
 
+    void CreateComputePipeline();
+
     void UpdateDescriptorSets();
 
     void CreateCommandBuffers();
 
-    void RecordPresentCommandBuffers(std::uint32_t currentImageIndex);
+    void RecordPresentCommandBuffers(std::uint32_t currentImageIndex, std::uint32_t mvpDynamicOffset);
+
+    void CalculateAndSetMvp(std::uint32_t transformOffset);
+
+    void RecordTransformUpload(const std::shared_ptr<common::vulkan_wrapper::VulkanCommandBuffer>& cmdBuffer);
+
+    void PrintAnimationStats(double animationSeconds);
+
+    [[nodiscard]] glm::mat4 CalculateViewProjection() const;
 
-    void CalculateAndSetMvp();
+    void RunTransformBenchmark() const;
+
+    void UploadAnimationData();
+
+    void RecordAnimationDispatch(const std::shared_ptr<common::vulkan_wrapper::VulkanCommandBuffer>& cmdBuffer,
+                                 std::uint32_t transformOffset) const;
+
+    void VerifyComputeAnimation(std::uint32_t transformOffset) const;
 
     void ProcessInput();
 
+    void ResolveParamKeys();
+
     std::uint32_t currentIndex_ = 0;
     std::uint32_t currentWindowWidth_ = UINT32_MAX;
     std::uint32_t currentWindowHeight_ = UINT32_MAX;
     VkFormat depthImageFormat_ = VK_FORMAT_UNDEFINED;
-    MvpData mvpData_[NUM_CUBES] = {glm::mat4(1.0)};
+    std::uint32_t cubeCount_ = 0;
+    std::vector<glm::mat4> mvpMatrices_;
+    bool useComputeAnimation_ = false;
+    bool verifyPending_ = false;
+    VkDeviceSize transformRegionSize_ = 0; // MVP matrices of every frame in flight have their own region
+    AnimationPushConstants animationPushConstants_{};
+
+    // Transforms of the cubes in structure of arrays layout for the batch transform kernels
+    common::utility::TransformArrays cubeTransforms_;
+
+    // Pre-resolved parameter keys for per-frame reads
+    common::utility::ParamKey<std::uint32_t> maxFramesInFlightKey_;
+    common::utility::ParamKey<std::uint32_t> firstInstanceIndexKey_;
+    common::utility::ParamKey<VkClearColorValue> clearColorKey_;
+    common::utility::ParamKey<float> mouseSensitivityKey_;
+    common::utility::ParamKey<float> cameraSpeedKey_;
+    common::utility::ParamKey<std::string> mainVertexBufferKey_;
+    common::utility::ParamKey<std::string> mainIndexBufferKey_;
+    common::utility::ParamKey<std::string> mainDescSetLayoutKey_;
+    common::utility::ParamKey<std::string> transformBufferKey_;
+    common::utility::ParamKey<std::string> transformStagingBufferKey_;
+
+    // CPU time of the animation (composing or dispatching MVP matrices) and uploads of the CPU path, they are printed
+    // once per second
+    double animationSeconds_ = 0.0;
+    double statsElapsedTime_ = 0.0;
+    std::uint32_t statsFrameCount_ = 0;
 
     // Texture resource
     common::utility::TextureHandler crateTextureHandler_{};
@@ -70,6 +117,8 @@ private:
     // Pipelines
     std::shared_ptr<common::vulkan_wrapper::VulkanPipelineLayout> pipelineLayout_;
     std::shared_ptr<common::vulkan_wrapper::VulkanPipeline> pipeline_;
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipelineLayout> computePipelineLayout_;
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipeline> computePipeline_;
 
     // Command buffers
     std::vector<std::shared_ptr<common::vulkan_wrapper::VulkanCommandBuffer>> cmdBuffersPresent_;
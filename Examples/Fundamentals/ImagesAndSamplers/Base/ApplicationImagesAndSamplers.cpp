@@ -193,7 +193,8 @@ void ApplicationImagesAndSamplers::CreateBuffers(const std::vector<BufferResourc
 void ApplicationImagesAndSamplers::SetBuffer(const std::string& name, const void* data, const std::uint64_t dataSize)
 {
     buffers_[name]->MapMemory();
-    buffers_[name]->FlushData(data, dataSize);
+    buffers_[name]->WriteData(data, dataSize);
+    buffers_[name]->FlushDirtyRanges();
     buffers_[name]->UnmapMemory();
 }
 
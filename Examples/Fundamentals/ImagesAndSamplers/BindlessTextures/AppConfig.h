@@ -0,0 +1,42 @@
+/**
+ * @file    AppConfig.h
+ * @brief   This header file keeps key names for user-provided config key names.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include "AppCommonConfig.h"
+
+namespace examples::fundamentals::images_and_samplers::bindless_textures
+{
+namespace AppConstants
+{
+    constexpr auto MaxFramesInFlight = "AppConstants.MaxFramesInFlight";
+    constexpr auto BaseShaderType = "AppConstants.BaseShaderType";
+    constexpr auto MainVertexShaderFile = "AppConstants.MainVertexShaderFile";
+    constexpr auto MainFragmentShaderFile = "AppConstants.MainFragmentShaderFile";
+    constexpr auto MainVertexShaderKey = "AppConstants.MainVertexShaderKey";
+    constexpr auto MainFragmentShaderKey = "AppConstants.MainFragmentShaderKey";
+
+    // Resources
+    constexpr auto MainVertexBuffer = "AppConstants.MainVertexBuffer";
+    constexpr auto MainIndexBuffer = "AppConstants.MainIndexBuffer";
+    constexpr auto InstanceBuffer = "AppConstants.InstanceBuffer";
+    constexpr auto MainSampler = "AppConstants.MainSampler";
+    constexpr auto TextureImageView = "AppConstants.TextureImageView";
+    constexpr auto BindlessTextureTable = "AppConstants.BindlessTextureTable";
+    constexpr auto MaxBindlessTextures = "AppConstants.MaxBindlessTextures";
+    constexpr auto TexturePaths = "AppConstants.TexturePaths";
+} // namespace AppConstants
+
+namespace AppSettings
+{
+    constexpr auto ClearColor = "AppSettings.ClearColor";
+    constexpr auto GridSize = "AppSettings.GridSize";
+} // namespace AppSettings
+} // namespace examples::fundamentals::images_and_samplers::bindless_textures
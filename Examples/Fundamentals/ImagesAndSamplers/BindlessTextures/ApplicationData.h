@@ -0,0 +1,44 @@
+/**
+ * @file    ApplicationData.h
+ * @brief   This header file keeps user-provided application data (vertices, indices etc.).
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Vertex.h"
+
+namespace examples::fundamentals::images_and_samplers::bindless_textures
+{
+// Vertex Attribute Layout
+struct VertexPos2Uv2
+{
+    common::utility::Attribute<common::utility::Vec2, 0> Position; // layout(location=0) in vec2 position;
+    common::utility::Attribute<common::utility::Vec2, 1> Uv;       // layout(location=1) in vec2 texCoord;
+};
+
+// Instance Attribute Layout
+struct InstanceData
+{
+    common::utility::Attribute<common::utility::Vec2, 2> Offset; // layout(location=2) in vec2 offset;
+    common::utility::Attribute<float, 3> Scale;                  // layout(location=3) in float scale;
+    common::utility::Attribute<std::uint32_t, 4> TextureIndex;   // layout(location=4) in uint textureIndex;
+};
+
+// Vertex Data (unit quad, it is scaled and moved with instance data)
+const std::vector vertices{VertexPos2Uv2{{-1.0f, -1.0f}, {0.0f, 0.0f}}, VertexPos2Uv2{{1.0f, -1.0f}, {1.0f, 0.0f}},
+                           VertexPos2Uv2{{1.0f, 1.0f}, {1.0f, 1.0f}}, VertexPos2Uv2{{-1.0f, 1.0f}, {0.0f, 1.0f}}};
+
+// Index Data
+const std::vector<uint16_t> indices{
+    0, 1, 2, // First triangle of quad
+    2, 3, 0  // Second triangle of quad
+};
+} // namespace examples::fundamentals::images_and_samplers::bindless_textures
@@ -0,0 +1,348 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "VulkanApplication.h"
+
+#include <algorithm>
+#include <array>
+#include <string>
+
+#include "AppConfig.h"
+#include "TextureLoader.h"
+#include "VulkanHelpers.h"
+#include "VulkanShaderModule.h"
+
+namespace examples::fundamentals::images_and_samplers::bindless_textures
+{
+using namespace common::utility;
+using namespace common::vulkan_wrapper;
+using namespace common::vulkan_framework;
+
+VulkanApplication::VulkanApplication(ParameterServer&& params) : ApplicationImagesAndSamplers(std::move(params)) {}
+
+bool VulkanApplication::Init()
+{
+    try {
+        currentWindowWidth_ = GetParamU32(WindowParams::Width);
+        currentWindowHeight_ = GetParamU32(WindowParams::Height);
+
+        CreateDefaultSurface();
+        SelectDefaultPhysicalDevice();
+        CreateLogicalDevice();
+        CreateDefaultQueue();
+        CreateDefaultSwapChain();
+        CreateDefaultCommandPool();
+        CreateDefaultSyncObjects(GetParamU32(AppConstants::MaxFramesInFlight));
+
+        CreateResources();
+        InitResources();
+
+        CreateDefaultRenderPass();
+        CreatePipeline();
+        CreateDefaultFramebuffers();
+
+        const uint32_t indexCount = indices.size();
+        CreateCommandBuffers();
+        RecordPresentCommandBuffers(indexCount, static_cast<std::uint32_t>(instances_.size()));
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return false;
+    }
+
+    return true;
+}
+
+void VulkanApplication::DrawFrame()
+{
+    inFlightFences_[currentIndex_]->WaitForFence(true, UINT64_MAX);
+    inFlightFences_[currentIndex_]->ResetFence();
+
+    uint32_t imageIndex = swapChain_->AcquireNextImage(imageAvailableSemaphores_[currentIndex_], nullptr);
+
+    if (swapImagesFences_[imageIndex] != nullptr) {
+        swapImagesFences_[imageIndex]->WaitForFence(true, UINT64_MAX);
+    }
+
+    swapImagesFences_[imageIndex] = inFlightFences_[currentIndex_];
+
+    queue_->Submit({cmdBuffersPresent_[imageIndex]}, {imageAvailableSemaphores_[currentIndex_]},
+                   {renderFinishedSemaphores_[imageIndex]}, inFlightFences_[currentIndex_],
+                   {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT});
+
+    queue_->Present({swapChain_}, {imageIndex}, {renderFinishedSemaphores_[imageIndex]});
+
+    currentIndex_ = (currentIndex_ + 1) % GetParamU32(AppConstants::MaxFramesInFlight);
+}
+
+void VulkanApplication::CreateLogicalDevice()
+{
+    // Descriptor indexing is core in Vulkan 1.2, older devices need the extension (its feature struct is the same) and
+    // its dependency VK_KHR_maintenance3
+    const bool isDescriptorIndexingCore = physicalDevice_->GetProperties().apiVersion >= VK_API_VERSION_1_2;
+    if (!isDescriptorIndexingCore &&
+        (!physicalDevice_->IsExtensionSupported(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME) ||
+         !physicalDevice_->IsExtensionSupported(VK_KHR_MAINTENANCE_3_EXTENSION_NAME))) {
+        throw std::runtime_error("Bindless textures need a Vulkan 1.2 device or the " +
+                                 std::string(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME) + " and " +
+                                 std::string(VK_KHR_MAINTENANCE_3_EXTENSION_NAME) + " extensions!");
+    }
+
+    // Check descriptor indexing features that bindless texture table needs
+    VkPhysicalDeviceDescriptorIndexingFeatures supportedFeatures{};
+    supportedFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+    physicalDevice_->GetExtendedFeatures(&supportedFeatures);
+
+    if (!supportedFeatures.runtimeDescriptorArray || !supportedFeatures.descriptorBindingPartiallyBound ||
+        !supportedFeatures.descriptorBindingVariableDescriptorCount ||
+        !supportedFeatures.descriptorBindingSampledImageUpdateAfterBind ||
+        !supportedFeatures.descriptorBindingUpdateUnusedWhilePending ||
+        !supportedFeatures.shaderSampledImageArrayNonUniformIndexing) {
+        throw std::runtime_error("Descriptor indexing features are not supported by the physical device!");
+    }
+
+    VkPhysicalDeviceDescriptorIndexingFeatures indexingFeatures{};
+    indexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+    indexingFeatures.runtimeDescriptorArray = VK_TRUE;
+    indexingFeatures.descriptorBindingPartiallyBound = VK_TRUE;
+    indexingFeatures.descriptorBindingVariableDescriptorCount = VK_TRUE;
+    indexingFeatures.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+    indexingFeatures.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+    indexingFeatures.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+
+    std::vector queuePriorities = {1.0f};
+
+    device_ = physicalDevice_->CreateDevice([&](auto& builder) {
+        builder.AddLayer("VK_LAYER_KHRONOS_validation")
+                .AddExtension(VK_KHR_SWAPCHAIN_EXTENSION_NAME)
+                .AddQueueInfo([&](auto& queueInfo) {
+                    queueInfo.queueFamilyIndex = currentQueueFamilyIndex_;
+                    queueInfo.queueCount = 1;
+                    queueInfo.pQueuePriorities = queuePriorities.data();
+                })
+                .SetNext(&indexingFeatures);
+        if (!isDescriptorIndexingCore) {
+            builder.AddExtension(VK_KHR_MAINTENANCE_3_EXTENSION_NAME)
+                    .AddExtension(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME);
+        }
+    });
+
+    if (!device_) {
+        throw std::runtime_error("Failed to create logical device!");
+    }
+}
+
+void VulkanApplication::CreateResources()
+{
+    resources_ = std::make_unique<ResourceManager>(physicalDevice_, device_);
+
+    // Fill instance data, every quad selects one of the textures with its texture index
+    const auto gridSize = std::max(GetParamU32(AppSettings::GridSize), 1u);
+    const float cellSize = 2.0f / static_cast<float>(gridSize);
+    instances_.clear();
+    for (std::uint32_t row = 0; row < gridSize; ++row) {
+        for (std::uint32_t column = 0; column < gridSize; ++column) {
+            InstanceData instance{};
+            instance.Offset = {{-1.0f + cellSize * (static_cast<float>(column) + 0.5f),
+                                -1.0f + cellSize * (static_cast<float>(row) + 0.5f)}};
+            instance.Scale = {cellSize * 0.45f};
+            instances_.push_back(instance);
+        }
+    }
+
+    // Fill buffer create infos
+    const std::uint32_t vertexBufferSize = vertices.size() * sizeof(VertexPos2Uv2);
+    const uint32_t indexDataSize = indices.size() * sizeof(indices[0]);
+    const std::uint32_t instanceBufferSize = instances_.size() * sizeof(InstanceData);
+    resources_->CreateBuffers(
+            {{GetParamStr(AppConstants::MainVertexBuffer), vertexBufferSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT},
+             {GetParamStr(AppConstants::MainIndexBuffer), indexDataSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT},
+             {GetParamStr(AppConstants::InstanceBuffer), instanceBufferSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+              VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT}});
+
+    // Fill shader module create infos
+    resources_->CreateShaderModules({.BasePath = SHADERS_DIR,
+                                     .ShaderType = params_.Get<ShaderBaseType>(AppConstants::BaseShaderType),
+                                     .Modules = {{.Name = GetParamStr(AppConstants::MainVertexShaderKey),
+                                                  .FileName = GetParamStr(AppConstants::MainVertexShaderFile)},
+                                                 {.Name = GetParamStr(AppConstants::MainFragmentShaderKey),
+                                                  .FileName = GetParamStr(AppConstants::MainFragmentShaderFile)}}});
+
+    resources_->CreateSamplers(
+            {{.Name = GetParamStr(AppConstants::MainSampler),
+              .FilteringBehavior = {.MagFilter = VK_FILTER_LINEAR, .MinFilter = VK_FILTER_LINEAR}}});
+
+    // Texture array size must fit into update after bind limits of the device
+    VkPhysicalDeviceDescriptorIndexingProperties indexingProperties{};
+    indexingProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES;
+    physicalDevice_->GetExtendedProperties(&indexingProperties);
+
+    const auto maxTextureCount =
+            std::min({GetParamU32(AppConstants::MaxBindlessTextures),
+                      indexingProperties.maxDescriptorSetUpdateAfterBindSampledImages,
+                      indexingProperties.maxPerStageDescriptorUpdateAfterBindSampledImages});
+    resources_->CreateBindlessTextureTable(GetParamStr(AppConstants::BindlessTextureTable), maxTextureCount);
+}
+
+void VulkanApplication::InitResources()
+{
+    // Upload textures and give them stable indices in the bindless texture table
+    const TextureLoader textureLoader{ASSETS_DIR};
+    const auto samplerHandle = resources_->GetSamplerHandle(GetParamStr(AppConstants::MainSampler));
+    const auto texturePaths = params_.Get<std::vector<std::string>>(AppConstants::TexturePaths);
+    for (const auto& texturePath: texturePaths) {
+        const auto textureHandler = textureLoader.Load(texturePath);
+
+        const ImageResourceCreateInfo imageCreateInfo{
+            .Name = texturePath,
+            .MemProperties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+            .Format = VK_FORMAT_R8G8B8A8_SRGB,
+            .Dimensions = {textureHandler.Width, textureHandler.Height, 1},
+            .Views = {ImageViewCreateInfo{.ViewName = GetParamStr(AppConstants::TextureImageView),
+                                          .Format = VK_FORMAT_R8G8B8A8_SRGB}}};
+        const auto imageHandle = resources_->CreateImages({imageCreateInfo}).front();
+        resources_->SetImageFromTexture(cmdPool_, queue_, texturePath, textureHandler);
+
+        textureImages_.push_back(imageHandle);
+        textureIndices_.push_back(resources_->AddBindlessTexture(GetParamStr(AppConstants::BindlessTextureTable),
+                                                                 imageHandle,
+                                                                 GetParamStr(AppConstants::TextureImageView),
+                                                                 samplerHandle));
+    }
+
+    if (textureIndices_.empty()) {
+        throw std::runtime_error("No texture is given for bindless texture table!");
+    }
+
+    for (size_t i = 0; i < instances_.size(); ++i) {
+        instances_[i].TextureIndex = {textureIndices_[i % textureIndices_.size()]};
+    }
+
+    resources_->SetBuffer(GetParamStr(AppConstants::MainVertexBuffer), vertices.data(),
+                          vertices.size() * sizeof(VertexPos2Uv2));
+    resources_->SetBuffer(GetParamStr(AppConstants::MainIndexBuffer), indices.data(),
+                          indices.size() * sizeof(indices[0]));
+    resources_->SetBuffer(GetParamStr(AppConstants::InstanceBuffer), instances_.data(),
+                          instances_.size() * sizeof(InstanceData));
+}
+
+void VulkanApplication::CreatePipeline()
+{
+    pipelineLayout_ = device_->CreatePipelineLayout(
+            {resources_->GetDescriptorLayout(GetParamStr(AppConstants::BindlessTextureTable))});
+
+    if (!pipelineLayout_) {
+        throw std::runtime_error("Failed to create pipeline layout!");
+    }
+
+    VkViewport viewport{0,    0,   static_cast<float>(currentWindowWidth_), static_cast<float>(currentWindowHeight_),
+                        0.0f, 1.0f};
+    VkRect2D scissor{0, 0, currentWindowWidth_, currentWindowHeight_};
+
+    VkPipelineColorBlendAttachmentState colorBlendAttachment;
+    colorBlendAttachment.blendEnable = VK_FALSE;
+    colorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.colorBlendOp = VK_BLEND_OP_ADD;
+    colorBlendAttachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+    colorBlendAttachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+    colorBlendAttachment.alphaBlendOp = VK_BLEND_OP_ADD;
+    colorBlendAttachment.colorWriteMask =
+            VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+
+    constexpr uint32_t vertexBindingIndex = 0;
+    constexpr uint32_t instanceBindingIndex = 1;
+    const std::array bindingDescriptions{
+        GenerateBindingDescription<VertexPos2Uv2>(vertexBindingIndex),
+        GenerateBindingDescription<InstanceData>(instanceBindingIndex, VK_VERTEX_INPUT_RATE_INSTANCE)};
+    const std::array attributeDescriptions{
+        GenerateAttributeDescription(VertexPos2Uv2, Position, vertexBindingIndex),
+        GenerateAttributeDescription(VertexPos2Uv2, Uv, vertexBindingIndex),
+        GenerateAttributeDescription(InstanceData, Offset, instanceBindingIndex),
+        GenerateAttributeDescription(InstanceData, Scale, instanceBindingIndex),
+        GenerateAttributeDescription(InstanceData, TextureIndex, instanceBindingIndex)};
+
+    pipeline_ = device_->CreateGraphicsPipeline(pipelineLayout_, renderPass_, [&](auto& builder) {
+        builder.AddShaderStage([&](auto& shaderStageCreateInfo) {
+            shaderStageCreateInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;
+            shaderStageCreateInfo.module =
+                    resources_->GetShaderModule(GetParamStr(AppConstants::MainVertexShaderKey))->GetHandle();
+        });
+        builder.AddShaderStage([&](auto& shaderStageCreateInfo) {
+            shaderStageCreateInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+            shaderStageCreateInfo.module =
+                    resources_->GetShaderModule(GetParamStr(AppConstants::MainFragmentShaderKey))->GetHandle();
+        });
+        builder.SetVertexInputState([&](auto& vertexInputStateCreateInfo) {
+            vertexInputStateCreateInfo.vertexBindingDescriptionCount = bindingDescriptions.size();
+            vertexInputStateCreateInfo.pVertexBindingDescriptions = bindingDescriptions.data();
+            vertexInputStateCreateInfo.vertexAttributeDescriptionCount = attributeDescriptions.size();
+            vertexInputStateCreateInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
+        });
+        builder.SetViewportState([&](auto& viewportStateCreateInfo) {
+            viewportStateCreateInfo.viewportCount = 1;
+            viewportStateCreateInfo.pViewports = &viewport;
+            viewportStateCreateInfo.scissorCount = 1;
+            viewportStateCreateInfo.pScissors = &scissor;
+        });
+        builder.SetColorBlendState([&](auto& blendStateCreateInfo) {
+            blendStateCreateInfo.attachmentCount = 1;
+            blendStateCreateInfo.pAttachments = &colorBlendAttachment;
+        });
+    });
+
+    if (!pipeline_) {
+        throw std::runtime_error("Failed to create graphics pipeline!");
+    }
+}
+
+void VulkanApplication::CreateCommandBuffers()
+{
+    cmdBuffersPresent_ = cmdPool_->CreateCommandBuffers(framebuffers_.size(), VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+
+    if (cmdBuffersPresent_.empty()) {
+        throw std::runtime_error("Failed to create command buffers!");
+    }
+}
+
+void VulkanApplication::RecordPresentCommandBuffers(const std::uint32_t indexCount, const std::uint32_t instanceCount)
+{
+    for (size_t i = 0; i < framebuffers_.size(); ++i) {
+        VkClearValue clearColor;
+        clearColor.color = params_.Get<VkClearColorValue>(AppSettings::ClearColor);
+        if (!cmdBuffersPresent_[i]->BeginCommandBuffer(nullptr)) {
+            throw std::runtime_error("Failed to begin recording command buffer!");
+        }
+        cmdBuffersPresent_[i]->BeginRenderPass(
+                [&](auto& beginInfo) {
+                    beginInfo.renderPass = renderPass_->GetHandle();
+                    beginInfo.framebuffer = framebuffers_[i]->GetHandle();
+                    beginInfo.renderArea.offset = {0, 0};
+                    beginInfo.renderArea.extent = VkExtent2D(currentWindowWidth_, currentWindowHeight_);
+                    beginInfo.clearValueCount = 1;
+                    beginInfo.pClearValues = &clearColor;
+                },
+                VK_SUBPASS_CONTENTS_INLINE);
+        cmdBuffersPresent_[i]->BindPipeline(pipeline_, VK_PIPELINE_BIND_POINT_GRAPHICS);
+
+        // Texture array is bound once, all quads are drawn with one draw call
+        cmdBuffersPresent_[i]->BindDescriptorSets(
+                VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_, 0,
+                {resources_->GetDescriptorSet(GetParamStr(AppConstants::BindlessTextureTable))});
+        cmdBuffersPresent_[i]->BindVertexBuffers({resources_->GetBuffer(GetParamStr(AppConstants::MainVertexBuffer)),
+                                                  resources_->GetBuffer(GetParamStr(AppConstants::InstanceBuffer))},
+                                                 0, 2, {0, 0});
+        cmdBuffersPresent_[i]->BindIndexBuffer(resources_->GetBuffer(GetParamStr(AppConstants::MainIndexBuffer)), 0,
+                                               VK_INDEX_TYPE_UINT16);
+        cmdBuffersPresent_[i]->DrawIndexed(indexCount, instanceCount, 0, 0, 0);
+        cmdBuffersPresent_[i]->EndRenderPass();
+        if (!cmdBuffersPresent_[i]->EndCommandBuffer()) {
+            throw std::runtime_error("Failed to end recording command buffer!");
+        }
+    }
+}
+} // namespace examples::fundamentals::images_and_samplers::bindless_textures
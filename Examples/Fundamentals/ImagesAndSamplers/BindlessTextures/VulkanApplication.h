@@ -0,0 +1,69 @@
+/**
+ * @file    VulkanApplication.h
+ * @brief   This file contains VulkanApplication and ApplicationSettings implementations.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ApplicationData.h"
+#include "ApplicationImagesAndSamplers.h"
+#include "ResourceManager.h"
+#include "VulkanCommandBuffer.h"
+#include "VulkanPipeline.h"
+#include "VulkanPipelineLayout.h"
+#include "Window.h"
+
+namespace examples::fundamentals::images_and_samplers::bindless_textures
+{
+class VulkanApplication final : public base::ApplicationImagesAndSamplers
+{
+public:
+    explicit VulkanApplication(common::utility::ParameterServer&& params);
+
+    ~VulkanApplication() override = default;
+
+protected:
+    bool Init() override;
+
+    void DrawFrame() override;
+
+private:
+    void CreateLogicalDevice();
+
+    void CreateResources();
+
+    void InitResources();
+
+    void CreatePipeline();
+
+    void CreateCommandBuffers();
+
+    void RecordPresentCommandBuffers(std::uint32_t indexCount, std::uint32_t instanceCount);
+
+    std::uint32_t currentIndex_ = 0;
+    std::uint32_t currentWindowWidth_ = UINT32_MAX;
+    std::uint32_t currentWindowHeight_ = UINT32_MAX;
+
+    // Resources (buffers, textures and the bindless texture table)
+    std::unique_ptr<common::vulkan_framework::ResourceManager> resources_;
+    std::vector<common::vulkan_framework::ImageHandle> textureImages_;
+    std::vector<std::uint32_t> textureIndices_;
+    std::vector<InstanceData> instances_;
+
+    // Pipelines
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipelineLayout> pipelineLayout_;
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipeline> pipeline_;
+
+    // Command buffers
+    std::vector<std::shared_ptr<common::vulkan_wrapper::VulkanCommandBuffer>> cmdBuffersPresent_;
+};
+} // namespace examples::fundamentals::images_and_samplers::bindless_textures
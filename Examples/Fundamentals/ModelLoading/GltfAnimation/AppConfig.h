@@ -0,0 +1,41 @@
+/**
+ * @file    AppConfig.h
+ * @brief   This header file keeps key names for user-provided config key names.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include "AppCommonConfig.h"
+
+namespace examples::fundamentals::model_loading::gltf_animation
+{
+namespace AppConstants
+{
+    constexpr auto MaxFramesInFlight = "AppConstants.MaxFramesInFlight";
+    constexpr auto BaseShaderType = "AppConstants.BaseShaderType";
+    constexpr auto MainVertexShaderFile = "AppConstants.MainVertexShaderFile";
+    constexpr auto MainFragmentShaderFile = "AppConstants.MainFragmentShaderFile";
+    constexpr auto MainVertexShaderKey = "AppConstants.MainVertexShaderKey";
+    constexpr auto MainFragmentShaderKey = "AppConstants.MainFragmentShaderKey";
+
+    // Resources
+    constexpr auto DepthImage = "AppConstants.DepthImage";
+    constexpr auto DepthImageView = "AppConstants.DepthImageView";
+    constexpr auto AnimatedModelPath = "AppConstants.AnimatedModelPath";
+} // namespace AppConstants
+
+namespace AppSettings
+{
+    constexpr auto ClearColor = "AppSettings.ClearColor";
+    constexpr auto MouseSensitivity = "AppSettings.MouseSensitivity";
+    constexpr auto CameraSpeed = "AppSettings.CameraSpeed";
+    constexpr auto AnimationIndex = "AppSettings.AnimationIndex";
+    constexpr auto PlaybackSpeed = "AppSettings.PlaybackSpeed";
+    constexpr auto AnimationBenchmarkChannelCount = "AppSettings.AnimationBenchmarkChannelCount";
+} // namespace AppSettings
+} // namespace examples::fundamentals::model_loading::gltf_animation
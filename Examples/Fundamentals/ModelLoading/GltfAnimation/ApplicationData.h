@@ -0,0 +1,55 @@
+/**
+ * @file    ApplicationData.h
+ * @brief   This header file keeps user-provided application data (vertices, indices etc.).
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <vector>
+
+#include "ModelLoader.h"
+#include "Vertex.h"
+#include "glm/glm.hpp"
+
+namespace examples::fundamentals::model_loading::gltf_animation
+{
+// Vertex Attribute Layout
+struct VertexPos3Norm3
+{
+    common::utility::Attribute<common::utility::Vec3, 0> Position; // layout(location=0) in vec3 position;
+    common::utility::Attribute<common::utility::Vec3, 1> Normal;   // layout(location=1) in vec3 normal;
+};
+
+// MVP and model matrices (for Push Constants)
+struct MvpData
+{
+    glm::mat4 mvpMatrix;
+    glm::mat4 modelMatrix;
+};
+} // namespace examples::fundamentals::model_loading::gltf_animation
+
+namespace common::utility
+{
+template<>
+inline std::vector<examples::fundamentals::model_loading::gltf_animation::VertexPos3Norm3> GltfMesh::GetVerticesAs()
+{
+    std::vector<examples::fundamentals::model_loading::gltf_animation::VertexPos3Norm3> result;
+    for (const auto& vertex: Vertices) {
+        examples::fundamentals::model_loading::gltf_animation::VertexPos3Norm3 current{};
+        current.Position.data.X = vertex.Position.x;
+        current.Position.data.Y = vertex.Position.y;
+        current.Position.data.Z = vertex.Position.z;
+        current.Normal.data.X = vertex.Normal.x;
+        current.Normal.data.Y = vertex.Normal.y;
+        current.Normal.data.Z = vertex.Normal.z;
+        result.push_back(current);
+    }
+
+    return result;
+}
+} // namespace common::utility
@@ -0,0 +1,529 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "VulkanApplication.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include "AppConfig.h"
+#include "ApplicationData.h"
+#include "VulkanHelpers.h"
+#include "VulkanShaderModule.h"
+
+namespace examples::fundamentals::model_loading::gltf_animation
+{
+using namespace common::utility;
+using namespace common::vulkan_wrapper;
+using namespace common::vulkan_framework;
+using namespace common::window_wrapper;
+
+VulkanApplication::VulkanApplication(ParameterServer&& params) : ApplicationModelLoading(std::move(params)) {}
+
+bool VulkanApplication::Init()
+{
+    try {
+        ResolveParamKeys();
+
+        currentWindowWidth_ = GetParamU32(WindowParams::Width);
+        currentWindowHeight_ = GetParamU32(WindowParams::Height);
+
+        float aspectRatio = static_cast<float>(currentWindowWidth_) / static_cast<float>(currentWindowHeight_);
+        camera_ = std::make_unique<PerspectiveCamera>(glm::vec3(0.0f, 1.0f, 6.0f), aspectRatio);
+
+        InitInputSystem();
+
+        CreateDefaultSurface();
+        SelectDefaultPhysicalDevice();
+        CreateDefaultLogicalDevice();
+        CreateDefaultQueue();
+        CreateDefaultSwapChain();
+        CreateDefaultCommandPool();
+        CreateDefaultSyncObjects(GetParamU32(AppConstants::MaxFramesInFlight));
+
+        CreateResources();
+        InitResources();
+
+        CreateRenderPass();
+        CreatePipeline();
+        CreateDefaultFramebuffers(resources_->GetImageView(GetParamStr(AppConstants::DepthImage),
+                                                           GetParamStr(AppConstants::DepthImageView)));
+        CreateCommandBuffers();
+
+        RunAnimationBenchmark();
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return false;
+    }
+
+    return true;
+}
+
+void VulkanApplication::DrawFrame()
+{
+    inFlightFences_[currentIndex_]->WaitForFence(true, UINT64_MAX);
+    inFlightFences_[currentIndex_]->ResetFence();
+
+    uint32_t imageIndex = swapChain_->AcquireNextImage(imageAvailableSemaphores_[currentIndex_], nullptr);
+
+    RecordPresentCommandBuffers(imageIndex);
+
+    if (swapImagesFences_[imageIndex] != nullptr) {
+        swapImagesFences_[imageIndex]->WaitForFence(true, UINT64_MAX);
+    }
+
+    swapImagesFences_[imageIndex] = inFlightFences_[currentIndex_];
+
+    queue_->Submit({cmdBuffersPresent_[imageIndex]}, {imageAvailableSemaphores_[currentIndex_]},
+                   {renderFinishedSemaphores_[imageIndex]}, inFlightFences_[currentIndex_],
+                   {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT});
+
+    queue_->Present({swapChain_}, {imageIndex}, {renderFinishedSemaphores_[imageIndex]});
+
+    currentIndex_ = (currentIndex_ + 1) % GetParam(maxFramesInFlightKey_);
+}
+
+void VulkanApplication::PreUpdate()
+{
+    // Poll events
+    ApplicationModelLoading::PreUpdate();
+
+    // Process continuous inputs
+    ProcessInput();
+
+    UpdateAnimation();
+}
+
+void VulkanApplication::InitInputSystem()
+{
+    lastX_ = static_cast<float>(currentWindowWidth_) / 2.0f;
+    lastY_ = static_cast<float>(currentWindowHeight_) / 2.0f;
+
+    window_->DisableCursor();
+
+    window_->OnMouseMove([&](const MouseMoveEvent& event) {
+        const auto xPos = static_cast<float>(event.X);
+        const auto yPos = static_cast<float>(event.Y);
+
+        if (firstMouseTriggered_) {
+            lastX_ = xPos;
+            lastY_ = yPos;
+            firstMouseTriggered_ = false;
+        }
+
+        float xOffset = xPos - lastX_;
+        float yOffset = lastY_ - yPos;
+        lastX_ = xPos;
+        lastY_ = yPos;
+
+        const float sensitivity = GetParam(mouseSensitivityKey_) * static_cast<float>(deltaTime_);
+        xOffset *= sensitivity;
+        yOffset *= sensitivity;
+
+        camera_->Rotate(xOffset, yOffset);
+    });
+}
+
+void VulkanApplication::CreateResources()
+{
+    depthImageFormat_ = physicalDevice_->FindSupportedFormat(
+            {VK_FORMAT_D32_SFLOAT, VK_FORMAT_D32_SFLOAT_S8_UINT, VK_FORMAT_D24_UNORM_S8_UINT},
+            VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT);
+
+    // Load models
+    ModelLoader modelLoader{ASSETS_DIR};
+    animatedModel_ = modelLoader.LoadBinaryGltfFromFile(GetParamStr(AppConstants::AnimatedModelPath));
+    if (!animatedModel_) {
+        throw std::runtime_error("Failed to load animated model!");
+    }
+
+    // Animation is optional, a model without animations is drawn in its rest pose
+    const auto animationIndex = GetParamU32(AppSettings::AnimationIndex);
+    if (animationIndex < animatedModel_->Animations.size()) {
+        animationSampler_ = std::make_unique<AnimationSampler>(animatedModel_->Animations[animationIndex]);
+        std::cout << "Playing animation " << animationIndex << " (" << animatedModel_->Animations[animationIndex].Name
+                  << "), " << animatedModel_->Animations[animationIndex].Channels.size() << " channels" << std::endl;
+    }
+
+    ResourceDescriptor resourceCreateInfo;
+
+    // Fill buffer create infos
+    std::vector<BufferResourceCreateInfo> bufferCreateInfos;
+    for (const auto& mesh: animatedModel_->Meshes) {
+        const std::uint32_t vertexBufferSize = mesh.Vertices.size() * sizeof(VertexPos3Norm3);
+        const uint32_t indexBufferSize = mesh.Indices.size() * sizeof(std::uint16_t);
+
+        bufferCreateInfos.emplace_back(mesh.GetVertexBufferName(), vertexBufferSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+                                       VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        bufferCreateInfos.emplace_back(mesh.GetIndexBufferName(), indexBufferSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+                                       VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    }
+    resourceCreateInfo.Buffers = bufferCreateInfos;
+
+    // Fill shader module create infos
+    resourceCreateInfo.Shaders = {.BasePath = SHADERS_DIR,
+                                  .ShaderType = params_.Get<ShaderBaseType>(AppConstants::BaseShaderType),
+                                  .Modules = {{.Name = GetParamStr(AppConstants::MainVertexShaderKey),
+                                               .FileName = GetParamStr(AppConstants::MainVertexShaderFile)},
+                                              {.Name = GetParamStr(AppConstants::MainFragmentShaderKey),
+                                               .FileName = GetParamStr(AppConstants::MainFragmentShaderFile)}}};
+
+    resourceCreateInfo.Images = {ImageResourceCreateInfo{
+        .Name = GetParamStr(AppConstants::DepthImage),
+        .MemProperties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+        .Format = depthImageFormat_,
+        .Dimensions = {currentWindowWidth_, currentWindowHeight_, 1},
+        .UsageFlags = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
+        .Views = {ImageViewCreateInfo{.ViewName = GetParamStr(AppConstants::DepthImageView),
+                                      .Format = depthImageFormat_,
+                                      .SubresourceRange = {.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT,
+                                                           .baseMipLevel = 0,
+                                                           .levelCount = 1,
+                                                           .baseArrayLayer = 0,
+                                                           .layerCount = 1}}}}};
+
+    CreateVulkanResources(resourceCreateInfo);
+
+    // Resolve handles once, draw loop doesn't look up resources by name
+    meshBufferHandles_.clear();
+    for (const auto& mesh: animatedModel_->Meshes) {
+        meshBufferHandles_.push_back({resources_->GetBufferHandle(mesh.GetVertexBufferName()),
+                                      resources_->GetBufferHandle(mesh.GetIndexBufferName())});
+    }
+}
+
+void VulkanApplication::InitResources() const
+{
+    for (auto& mesh: animatedModel_->Meshes) {
+        const auto& vertexBufferData = mesh.GetVerticesAs<VertexPos3Norm3>();
+        const auto& indexBufferData = mesh.Indices;
+        const std::uint32_t vertexBufferSize = vertexBufferData.size() * sizeof(VertexPos3Norm3);
+        const uint32_t indexBufferSize = indexBufferData.size() * sizeof(std::uint16_t);
+
+        resources_->SetBuffer(mesh.GetVertexBufferName(), vertexBufferData.data(), vertexBufferSize);
+        resources_->SetBuffer(mesh.GetIndexBufferName(), indexBufferData.data(), indexBufferSize);
+    }
+}
+
+void VulkanApplication::CreateRenderPass()
+{
+    VkAttachmentReference colorAttachmentRef{0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+
+    VkAttachmentReference depthAttachmentRef{1, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL};
+
+    renderPass_ = device_->CreateRenderPass([&](auto& builder) {
+        builder.AddAttachment([](auto& attachmentCreateInfo) {
+                   attachmentCreateInfo.format = VK_FORMAT_B8G8R8A8_SRGB;
+                   attachmentCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+                   attachmentCreateInfo.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+                   attachmentCreateInfo.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+                   attachmentCreateInfo.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+                   attachmentCreateInfo.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+                   attachmentCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+                   attachmentCreateInfo.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+               })
+                .AddAttachment([&](auto& attachmentCreateInfo) {
+                    attachmentCreateInfo.format = depthImageFormat_;
+                    attachmentCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+                    attachmentCreateInfo.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+                    attachmentCreateInfo.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+                    attachmentCreateInfo.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+                    attachmentCreateInfo.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+                    attachmentCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+                    attachmentCreateInfo.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+                })
+                .AddSubpass([&](auto& subpassCreateInfo) {
+                    subpassCreateInfo.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+                    subpassCreateInfo.colorAttachmentCount = 1;
+                    subpassCreateInfo.pColorAttachments = &colorAttachmentRef;
+                    subpassCreateInfo.pDepthStencilAttachment = &depthAttachmentRef;
+                });
+    });
+
+    if (!renderPass_) {
+        throw std::runtime_error("Failed to create render pass!");
+    }
+}
+
+void VulkanApplication::CreatePipeline()
+{
+    VkPushConstantRange mvpPushConstant;
+    mvpPushConstant.offset = 0;
+    mvpPushConstant.size = sizeof(MvpData);
+    mvpPushConstant.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+
+    pipelineLayout_ = device_->CreatePipelineLayout({}, {mvpPushConstant});
+
+    if (!pipelineLayout_) {
+        throw std::runtime_error("Failed to create pipeline layout!");
+    }
+
+    VkViewport viewport{0,    0,   static_cast<float>(currentWindowWidth_), static_cast<float>(currentWindowHeight_),
+                        0.0f, 1.0f};
+    VkRect2D scissor{0, 0, currentWindowWidth_, currentWindowHeight_};
+
+    VkPipelineColorBlendAttachmentState colorBlendAttachment;
+    colorBlendAttachment.blendEnable = VK_FALSE;
+    colorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.colorBlendOp = VK_BLEND_OP_ADD;
+    colorBlendAttachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+    colorBlendAttachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+    colorBlendAttachment.alphaBlendOp = VK_BLEND_OP_ADD;
+    colorBlendAttachment.colorWriteMask =
+            VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+
+    constexpr uint32_t bindingIndex = 0;
+    auto bindingDescription = GenerateBindingDescription<VertexPos3Norm3>(bindingIndex);
+    const auto posAttribDescription = GenerateAttributeDescription(VertexPos3Norm3, Position, bindingIndex);
+    const auto normalAttribDescription = GenerateAttributeDescription(VertexPos3Norm3, Normal, bindingIndex);
+    const std::array attributeDescriptions{posAttribDescription, normalAttribDescription};
+
+    pipeline_ = device_->CreateGraphicsPipeline(pipelineLayout_, renderPass_, [&](auto& builder) {
+        builder.AddShaderStage([&](auto& shaderStageCreateInfo) {
+            shaderStageCreateInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;
+            shaderStageCreateInfo.module =
+                    resources_->GetShaderModule(GetParamStr(AppConstants::MainVertexShaderKey))->GetHandle();
+        });
+        builder.AddShaderStage([&](auto& shaderStageCreateInfo) {
+            shaderStageCreateInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+            shaderStageCreateInfo.module =
+                    resources_->GetShaderModule(GetParamStr(AppConstants::MainFragmentShaderKey))->GetHandle();
+        });
+        builder.SetVertexInputState([&](auto& vertexInputStateCreateInfo) {
+            vertexInputStateCreateInfo.vertexBindingDescriptionCount = 1;
+            vertexInputStateCreateInfo.pVertexBindingDescriptions = &bindingDescription;
+            vertexInputStateCreateInfo.vertexAttributeDescriptionCount = attributeDescriptions.size();
+            vertexInputStateCreateInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
+        });
+        builder.SetViewportState([&](auto& viewportStateCreateInfo) {
+            viewportStateCreateInfo.viewportCount = 1;
+            viewportStateCreateInfo.pViewports = &viewport;
+            viewportStateCreateInfo.scissorCount = 1;
+            viewportStateCreateInfo.pScissors = &scissor;
+        });
+        builder.SetColorBlendState([&](auto& blendStateCreateInfo) {
+            blendStateCreateInfo.attachmentCount = 1;
+            blendStateCreateInfo.pAttachments = &colorBlendAttachment;
+        });
+        builder.SetDepthStencilState([&](auto& depthStencilStateCreateInfo) {
+            depthStencilStateCreateInfo.depthTestEnable = VK_TRUE;
+            depthStencilStateCreateInfo.depthWriteEnable = VK_TRUE;
+            depthStencilStateCreateInfo.depthCompareOp = VK_COMPARE_OP_LESS;
+        });
+    });
+
+    if (!pipeline_) {
+        throw std::runtime_error("Failed to create graphics pipeline!");
+    }
+}
+
+void VulkanApplication::CreateCommandBuffers()
+{
+    cmdBuffersPresent_ = cmdPool_->CreateCommandBuffers(framebuffers_.size(), VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+
+    if (cmdBuffersPresent_.empty()) {
+        throw std::runtime_error("Failed to create command buffers!");
+    }
+}
+
+void VulkanApplication::RecordPresentCommandBuffers(const std::uint32_t currentImageIndex)
+{
+    std::array<VkClearValue, 2> clearValues{};
+    clearValues[0].color = GetParam(clearColorKey_);
+    clearValues[1].depthStencil = {1.0f, 0};
+
+    const auto& currentCmdBuffer = cmdBuffersPresent_[currentImageIndex];
+
+    if (!currentCmdBuffer->BeginCommandBuffer(nullptr)) {
+        throw std::runtime_error("Failed to begin recording command buffer!");
+    }
+    currentCmdBuffer->BeginRenderPass(
+            [&](auto& beginInfo) {
+                beginInfo.renderPass = renderPass_->GetHandle();
+                beginInfo.framebuffer = framebuffers_[currentImageIndex]->GetHandle();
+                beginInfo.renderArea.offset = {0, 0};
+                beginInfo.renderArea.extent = VkExtent2D(currentWindowWidth_, currentWindowHeight_);
+                beginInfo.clearValueCount = clearValues.size();
+                beginInfo.pClearValues = clearValues.data();
+            },
+            VK_SUBPASS_CONTENTS_INLINE);
+    currentCmdBuffer->BindPipeline(pipeline_, VK_PIPELINE_BIND_POINT_GRAPHICS);
+
+    // Draw meshes with the animated world transforms of their nodes
+    const auto& hierarchy = animatedModel_->NodeHierarchy;
+    const glm::mat4 viewProjection = camera_->GetProjectionMatrix() * camera_->GetViewMatrix();
+    for (std::uint32_t nodeIndex = 0; nodeIndex < animatedModel_->Nodes.size(); ++nodeIndex) {
+        const auto& node = animatedModel_->Nodes[nodeIndex];
+        if (node.MeshIndex == UINT32_MAX) {
+            continue;
+        }
+
+        const auto& mesh = animatedModel_->Meshes[node.MeshIndex];
+        const auto& meshBuffers = meshBufferHandles_[node.MeshIndex];
+
+        MvpData mvpData{};
+        mvpData.modelMatrix = hierarchy.GetWorldTransform(hierarchy.GetFlatIndex(nodeIndex));
+        mvpData.mvpMatrix = viewProjection * mvpData.modelMatrix;
+        currentCmdBuffer->PushConstants(pipelineLayout_, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(MvpData), &mvpData);
+
+        const std::vector vertexBuffers{resources_->GetBuffer(meshBuffers.VertexBuffer)};
+        currentCmdBuffer->BindVertexBuffers(vertexBuffers, 0, 1, {0});
+        currentCmdBuffer->BindIndexBuffer(resources_->GetBuffer(meshBuffers.IndexBuffer));
+        currentCmdBuffer->DrawIndexed(mesh.Indices.size(), 1, 0, 0, 0);
+    }
+
+    currentCmdBuffer->EndRenderPass();
+    if (!currentCmdBuffer->EndCommandBuffer()) {
+        throw std::runtime_error("Failed to end recording command buffer!");
+    }
+}
+
+void VulkanApplication::UpdateAnimation()
+{
+    if (!animationSampler_) {
+        return;
+    }
+
+    // Time is wrapped in double precision, so a long running playback doesn't lose float precision
+    const float duration = animationSampler_->GetAnimation().Duration;
+    animationTime_ += deltaTime_ * GetParam(playbackSpeedKey_);
+    if (duration > 0.0f) {
+        animationTime_ = std::fmod(animationTime_, static_cast<double>(duration));
+    }
+
+    animationSampler_->Sample(static_cast<float>(animationTime_));
+    animationSampler_->Apply(*animatedModel_);
+    animatedModel_->NodeHierarchy.Update();
+}
+
+void VulkanApplication::RunAnimationBenchmark() const
+{
+    const auto channelCount = GetParamU32(AppSettings::AnimationBenchmarkChannelCount);
+    if (channelCount == 0) {
+        return;
+    }
+
+    // Random animation with a fixed seed, half of the channels are rotations and the rest are translations
+    constexpr std::uint32_t keyCount = 64;
+    constexpr std::uint32_t frameCount = 240;
+    std::mt19937 generator{1234};
+    std::uniform_real_distribution distribution{-1.0f, 1.0f};
+    GltfAnimation animation;
+    animation.Channels.resize(channelCount);
+    for (std::uint32_t i = 0; i < channelCount; ++i) {
+        auto& channel = animation.Channels[i];
+        channel.NodeIndex = i;
+        channel.Path = i % 2 == 0 ? GltfAnimationPath::ROTATION : GltfAnimationPath::TRANSLATION;
+
+        float time = 0.0f;
+        for (std::uint32_t key = 0; key < keyCount; ++key) {
+            time += 0.1f + 0.05f * distribution(generator);
+            channel.Times.push_back(time);
+            if (channel.Path == GltfAnimationPath::ROTATION) {
+                const glm::quat rotation = glm::normalize(glm::quat(distribution(generator), distribution(generator),
+                                                                    distribution(generator), distribution(generator)));
+                channel.Values.emplace_back(rotation.x, rotation.y, rotation.z, rotation.w);
+            } else {
+                channel.Values.emplace_back(distribution(generator), distribution(generator), distribution(generator),
+                                            0.0f);
+            }
+        }
+        animation.Duration = std::max(animation.Duration, time);
+    }
+
+    // Reference: binary search per channel per frame, glm::mix and glm::slerp per channel
+    std::vector<glm::vec4> reference(channelCount);
+    const auto sampleReference = [&](const float time) {
+        for (std::uint32_t i = 0; i < channelCount; ++i) {
+            const auto& channel = animation.Channels[i];
+            const auto& times = channel.Times;
+            if (time <= times.front() || time >= times.back()) {
+                reference[i] = time <= times.front() ? channel.Values.front() : channel.Values.back();
+                continue;
+            }
+
+            const auto key = static_cast<std::size_t>(std::ranges::upper_bound(times, time) - times.begin()) - 1;
+            const float factor = (time - times[key]) / (times[key + 1] - times[key]);
+            const glm::vec4& from = channel.Values[key];
+            const glm::vec4& to = channel.Values[key + 1];
+            if (channel.Path == GltfAnimationPath::ROTATION) {
+                const glm::quat fromRotation{from.w, from.x, from.y, from.z};
+                const glm::quat rotation = glm::slerp(fromRotation, glm::quat(to.w, to.x, to.y, to.z), factor);
+                reference[i] = glm::vec4(rotation.x, rotation.y, rotation.z, rotation.w);
+            } else {
+                reference[i] = glm::mix(from, to, factor);
+            }
+        }
+    };
+
+    const float frameTime = animation.Duration / static_cast<float>(frameCount);
+    AnimationSampler sampler{animation};
+
+    const auto referenceStart = std::chrono::steady_clock::now();
+    for (std::uint32_t frame = 0; frame < frameCount; ++frame) {
+        sampleReference(static_cast<float>(frame) * frameTime);
+    }
+    const auto referenceEnd = std::chrono::steady_clock::now();
+
+    for (std::uint32_t frame = 0; frame < frameCount; ++frame) {
+        sampler.Sample(static_cast<float>(frame) * frameTime, false);
+    }
+    const auto samplerEnd = std::chrono::steady_clock::now();
+
+    // Accuracy check on a subset of the frames (time goes back first, so the rewind path is used as well)
+    float maxError = 0.0f;
+    for (std::uint32_t frame = 0; frame < frameCount; frame += 7) {
+        const float time = static_cast<float>(frame) * frameTime;
+        sampleReference(time);
+        sampler.Sample(time, false);
+        const auto values = sampler.GetValues();
+        for (std::uint32_t i = 0; i < channelCount; ++i) {
+            for (int component = 0; component < 4; ++component) {
+                maxError = std::max(maxError, std::abs(values[i][component] - reference[i][component]));
+            }
+        }
+    }
+
+    using Microseconds = std::chrono::duration<double, std::micro>;
+    std::cout << "Animation sampling (" << channelCount << " channels, " << keyCount << " keyframes): binary search + "
+              << "glm " << Microseconds(referenceEnd - referenceStart).count() / frameCount << " us/frame, cached "
+              << "cursors + batch " << Microseconds(samplerEnd - referenceEnd).count() / frameCount
+              << " us/frame, max error " << maxError << std::endl;
+}
+
+void VulkanApplication::ResolveParamKeys()
+{
+    maxFramesInFlightKey_ = ResolveParam<std::uint32_t>(AppConstants::MaxFramesInFlight);
+    clearColorKey_ = ResolveParam<VkClearColorValue>(AppSettings::ClearColor);
+    mouseSensitivityKey_ = ResolveParam<float>(AppSettings::MouseSensitivity);
+    cameraSpeedKey_ = ResolveParam<float>(AppSettings::CameraSpeed);
+    playbackSpeedKey_ = ResolveParam<float>(AppSettings::PlaybackSpeed);
+}
+
+void VulkanApplication::ProcessInput() const
+{
+    const float cameraSpeed = GetParam(cameraSpeedKey_) * static_cast<float>(deltaTime_);
+    if (window_->IsKeyPressed(GLFW_KEY_W)) {
+        camera_->Move(camera_->GetFrontVector() * cameraSpeed);
+    }
+    if (window_->IsKeyPressed(GLFW_KEY_S)) {
+        camera_->Move(-camera_->GetFrontVector() * cameraSpeed);
+    }
+    if (window_->IsKeyPressed(GLFW_KEY_A)) {
+        camera_->Move(-camera_->GetRightVector() * cameraSpeed);
+    }
+    if (window_->IsKeyPressed(GLFW_KEY_D)) {
+        camera_->Move(camera_->GetRightVector() * cameraSpeed);
+    }
+}
+} // namespace examples::fundamentals::model_loading::gltf_animation
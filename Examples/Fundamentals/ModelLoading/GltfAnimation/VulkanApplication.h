@@ -0,0 +1,107 @@
+/**
+ * @file    VulkanApplication.h
+ * @brief   This file contains VulkanApplication implementation.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "AnimationSampler.h"
+#include "ApplicationData.h"
+#include "ApplicationModelLoading.h"
+#include "ModelLoader.h"
+#include "PerspectiveCamera.h"
+#include "VulkanCommandBuffer.h"
+#include "VulkanPipeline.h"
+#include "VulkanPipelineLayout.h"
+#include "Window.h"
+
+namespace examples::fundamentals::model_loading::gltf_animation
+{
+class VulkanApplication final : public base::ApplicationModelLoading
+{
+public:
+    explicit VulkanApplication(common::utility::ParameterServer&& params);
+
+    ~VulkanApplication() override = default;
+
+protected:
+    bool Init() override;
+
+    void DrawFrame() override;
+
+    void PreUpdate() override;
+
+private:
+    void InitInputSystem();
+
+    void CreateResources();
+
+    void InitResources() const;
+
+    void CreateRenderPass();
+
+    void CreatePipeline();
+
+    void CreateCommandBuffers();
+
+    void RecordPresentCommandBuffers(std::uint32_t currentImageIndex);
+
+    void ProcessInput() const;
+
+    void UpdateAnimation();
+
+    void RunAnimationBenchmark() const;
+
+    void ResolveParamKeys();
+
+    std::uint32_t currentIndex_ = 0;
+    std::uint32_t currentWindowWidth_ = UINT32_MAX;
+    std::uint32_t currentWindowHeight_ = UINT32_MAX;
+    VkFormat depthImageFormat_ = VK_FORMAT_UNDEFINED;
+
+    // Pre-resolved parameter keys for per-frame reads
+    common::utility::ParamKey<std::uint32_t> maxFramesInFlightKey_;
+    common::utility::ParamKey<VkClearColorValue> clearColorKey_;
+    common::utility::ParamKey<float> mouseSensitivityKey_;
+    common::utility::ParamKey<float> cameraSpeedKey_;
+    common::utility::ParamKey<float> playbackSpeedKey_;
+
+    // Models
+    std::shared_ptr<common::utility::GltfModelHandler> animatedModel_;
+
+    // Animation
+    std::unique_ptr<common::utility::AnimationSampler> animationSampler_;
+    double animationTime_ = 0.0;
+
+    // Resource handles which are used in the per-frame code (indexed with mesh index)
+    struct MeshBufferHandles
+    {
+        common::vulkan_framework::BufferHandle VertexBuffer;
+        common::vulkan_framework::BufferHandle IndexBuffer;
+    };
+    std::vector<MeshBufferHandles> meshBufferHandles_;
+
+    // Pipelines
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipelineLayout> pipelineLayout_;
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipeline> pipeline_;
+
+    // Command buffers
+    std::vector<std::shared_ptr<common::vulkan_wrapper::VulkanCommandBuffer>> cmdBuffersPresent_;
+
+    // Mouse related values
+    bool firstMouseTriggered_ = true;
+    float lastX_ = 0.0f;
+    float lastY_ = 0.0f;
+
+    // Camera
+    std::unique_ptr<common::utility::PerspectiveCamera> camera_;
+};
+} // namespace examples::fundamentals::model_loading::gltf_animation
@@ -0,0 +1,53 @@
+/**
+ * @file    AppConfig.h
+ * @brief   This header file keeps key names for user-provided config key names.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include "AppCommonConfig.h"
+
+namespace examples::fundamentals::model_loading::gltf_gpu_culling
+{
+namespace AppConstants
+{
+    constexpr auto MaxFramesInFlight = "AppConstants.MaxFramesInFlight";
+    constexpr auto BaseShaderType = "AppConstants.BaseShaderType";
+    constexpr auto MainVertexShaderFile = "AppConstants.MainVertexShaderFile";
+    constexpr auto MainFragmentShaderFile = "AppConstants.MainFragmentShaderFile";
+    constexpr auto CullingComputeShaderFile = "AppConstants.CullingComputeShaderFile";
+    constexpr auto MainVertexShaderKey = "AppConstants.MainVertexShaderKey";
+    constexpr auto MainFragmentShaderKey = "AppConstants.MainFragmentShaderKey";
+    constexpr auto CullingComputeShaderKey = "AppConstants.CullingComputeShaderKey";
+
+    // Resources
+    constexpr auto DepthImage = "AppConstants.DepthImage";
+    constexpr auto DepthImageView = "AppConstants.DepthImageView";
+    constexpr auto LanternModelPath = "AppConstants.LanternModelPath";
+    constexpr auto CullingDescSetLayout = "AppConstants.CullingDescSetLayout";
+    constexpr auto MeshVertexBuffer = "AppConstants.MeshVertexBuffer";
+    constexpr auto MeshIndexBuffer = "AppConstants.MeshIndexBuffer";
+    constexpr auto ObjectIndexBuffer = "AppConstants.ObjectIndexBuffer";
+    constexpr auto CullObjectBuffer = "AppConstants.CullObjectBuffer";
+    constexpr auto UploadStagingBuffer = "AppConstants.UploadStagingBuffer";
+    constexpr auto DrawCommandBuffer = "AppConstants.DrawCommandBuffer";
+    constexpr auto DrawCountBuffer = "AppConstants.DrawCountBuffer";
+    constexpr auto DrawCountReadbackBuffer = "AppConstants.DrawCountReadbackBuffer";
+} // namespace AppConstants
+
+namespace AppSettings
+{
+    constexpr auto ClearColor = "AppSettings.ClearColor";
+    constexpr auto MouseSensitivity = "AppSettings.MouseSensitivity";
+    constexpr auto CameraSpeed = "AppSettings.CameraSpeed";
+    constexpr auto InstanceCount = "AppSettings.InstanceCount";
+    constexpr auto InstanceSpacing = "AppSettings.InstanceSpacing";
+    constexpr auto UseDrawCount = "AppSettings.UseDrawCount";
+    constexpr auto VerifyCulling = "AppSettings.VerifyCulling";
+} // namespace AppSettings
+} // namespace examples::fundamentals::model_loading::gltf_gpu_culling
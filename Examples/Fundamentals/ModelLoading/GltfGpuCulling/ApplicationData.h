@@ -0,0 +1,85 @@
+/**
+ * @file    ApplicationData.h
+ * @brief   This header file keeps user-provided application data (vertices, indices etc.).
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "ModelLoader.h"
+#include "Vertex.h"
+#include "glm/glm.hpp"
+
+namespace examples::fundamentals::model_loading::gltf_gpu_culling
+{
+// Vertex Attribute Layout (meshes of the model are packed into one vertex buffer)
+struct VertexPos3Norm3
+{
+    common::utility::Attribute<common::utility::Vec3, 0> Position; // layout(location=0) in vec3 position;
+    common::utility::Attribute<common::utility::Vec3, 1> Normal;   // layout(location=1) in vec3 normal;
+};
+
+// Per-instance attribute, firstInstance of a draw command selects the object
+struct ObjectIndexData
+{
+    common::utility::Attribute<std::uint32_t, 2> ObjectIndex; // layout(location=2) in uint objectIndex;
+};
+
+// View-projection matrix (for Push Constants of the drawing pipeline)
+struct ViewProjectionData
+{
+    glm::mat4 viewProjectionMatrix;
+};
+
+// Object that is tested by the culling compute shader (std430 layout), one mesh of one model instance
+struct CullObject
+{
+    glm::mat4 Model;
+    glm::vec4 BoundsCenter; // xyz: center of the world bounding box
+    glm::vec4 BoundsExtent; // xyz: half size of the world bounding box
+    std::uint32_t IndexCount;
+    std::uint32_t FirstIndex;
+    std::int32_t VertexOffset;
+    std::uint32_t Padding;
+};
+
+// Push constants of the culling compute shader
+struct CullingPushConstants
+{
+    glm::vec4 FrustumPlanes[6];
+    std::uint32_t ObjectCount;
+    std::uint32_t CompactDraws; // 1: visible commands are packed and counted, 0: culled commands have no instances
+    std::uint32_t Padding[2];
+};
+
+// Work group size of the culling compute shader (local_size_x)
+inline constexpr std::uint32_t cullingGroupSize = 64;
+} // namespace examples::fundamentals::model_loading::gltf_gpu_culling
+
+namespace common::utility
+{
+template<>
+inline std::vector<examples::fundamentals::model_loading::gltf_gpu_culling::VertexPos3Norm3> GltfMesh::GetVerticesAs()
+{
+    std::vector<examples::fundamentals::model_loading::gltf_gpu_culling::VertexPos3Norm3> result;
+    for (const auto& vertex: Vertices) {
+        examples::fundamentals::model_loading::gltf_gpu_culling::VertexPos3Norm3 current{};
+        current.Position.data.X = vertex.Position.x;
+        current.Position.data.Y = vertex.Position.y;
+        current.Position.data.Z = vertex.Position.z;
+        current.Normal.data.X = vertex.Normal.x;
+        current.Normal.data.Y = vertex.Normal.y;
+        current.Normal.data.Z = vertex.Normal.z;
+        result.push_back(current);
+    }
+
+    return result;
+}
+} // namespace common::utility
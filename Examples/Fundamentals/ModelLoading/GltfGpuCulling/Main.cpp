@@ -0,0 +1,110 @@
+/**
+ * @file    Main.cpp
+ * @brief   In this example, thousands of glTF model instances are culled against the camera frustum by a compute
+ *          shader which writes indirect draw commands and their count.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "AppConfig.h"
+#include "ShaderLoader.h"
+#include "VulkanApplication.h"
+#include "Window.h"
+
+using namespace common::utility;
+using namespace common::window_wrapper;
+using namespace common::vulkan_framework;
+using namespace examples::fundamentals::model_loading::gltf_gpu_culling;
+
+inline ParameterSchema CreateParameterSchema()
+{
+    ParameterSchema schema;
+    SetCommonParamSchema(schema);
+
+    // Register Constants
+    schema.RegisterImmutableParam<std::uint32_t>(AppConstants::MaxFramesInFlight, 2);
+    schema.RegisterImmutableParam<ShaderBaseType>(AppConstants::BaseShaderType, ShaderBaseType::GLSL);
+    schema.RegisterImmutableParam<std::string>(AppConstants::MainVertexShaderFile, "drawing_culled_objects.vert.spv");
+    schema.RegisterImmutableParam<std::string>(AppConstants::MainFragmentShaderFile, "drawing_culled_objects.frag.spv");
+    schema.RegisterImmutableParam<std::string>(AppConstants::CullingComputeShaderFile, "frustum_culling.comp.spv");
+    schema.RegisterImmutableParam<std::string>(AppConstants::MainVertexShaderKey, "vertMain");
+    schema.RegisterImmutableParam<std::string>(AppConstants::MainFragmentShaderKey, "fragMain");
+    schema.RegisterImmutableParam<std::string>(AppConstants::CullingComputeShaderKey, "compMain");
+
+    schema.RegisterImmutableParam<std::string>(AppConstants::DepthImage, "depthImage");
+    schema.RegisterImmutableParam<std::string>(AppConstants::DepthImageView, "depthImageView");
+    schema.RegisterImmutableParam<std::string>(AppConstants::LanternModelPath, "Models/Lantern.glb");
+    schema.RegisterImmutableParam<std::string>(AppConstants::CullingDescSetLayout, "cullingDescSetLayout");
+    schema.RegisterImmutableParam<std::string>(AppConstants::MeshVertexBuffer, "meshVertexBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::MeshIndexBuffer, "meshIndexBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::ObjectIndexBuffer, "objectIndexBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::CullObjectBuffer, "cullObjectBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::UploadStagingBuffer, "uploadStagingBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::DrawCommandBuffer, "drawCommandBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::DrawCountBuffer, "drawCountBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::DrawCountReadbackBuffer, "drawCountReadbackBuffer");
+
+    // Register Customizable Settings
+    schema.RegisterParam<VkClearColorValue>(AppSettings::ClearColor);
+    schema.RegisterParam<float>(AppSettings::MouseSensitivity);
+    schema.RegisterParam<float>(AppSettings::CameraSpeed);
+    schema.RegisterParam<std::uint32_t>(AppSettings::InstanceCount, 16384);
+    schema.RegisterParam<float>(AppSettings::InstanceSpacing, 3.0f);
+    schema.RegisterParam<bool>(AppSettings::UseDrawCount, true);
+    schema.RegisterParam<bool>(AppSettings::VerifyCulling, false);
+
+    return schema;
+}
+
+bool SetParams(ParameterServer& params)
+{
+    try {
+        // Initial window settings
+        params.Set<std::uint32_t>(WindowParams::Width, 800);
+        params.Set<std::uint32_t>(WindowParams::Height, 600);
+        params.Set(WindowParams::Title, std::string(EXAMPLE_APPLICATION_NAME));
+
+        // Vulkan settings
+        params.Set<std::string>(VulkanParams::ApplicationName, params.Get<std::string>(WindowParams::Title));
+        params.Set<std::vector<std::string>>(VulkanParams::InstanceLayers, {"VK_LAYER_KHRONOS_validation"});
+
+        // Project customizable settings
+        params.Set(AppSettings::ClearColor, VkClearColorValue{0.0f, 0.3f, 0.3f, 1.0f});
+        params.Set(AppSettings::MouseSensitivity, 2.2f);
+        params.Set(AppSettings::CameraSpeed, 2.2f);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return false;
+    }
+
+    return true;
+}
+
+int main()
+{
+    ParameterServer params{CreateParameterSchema()};
+    if (!SetParams(params)) {
+        std::cerr << "Failed to set parameters!" << std::endl;
+        return -1;
+    }
+
+    // Create a window
+    const auto window = std::make_shared<Window>(params.Get<std::string>(WindowParams::Title));
+    if (!window->Init(params.Get<std::uint32_t>(WindowParams::Width), params.Get<std::uint32_t>(WindowParams::Height),
+                      params.Get<bool>(WindowParams::Resizable), params.Get<unsigned int>(WindowParams::SampleCount))) {
+        std::cerr << "Failed to initialize window." << std::endl;
+        return -1;
+    }
+    params.Set<std::vector<std::string>>(VulkanParams::InstanceExtensions, Window::GetVulkanInstanceExtensions());
+
+    // Init Vulkan application
+    VulkanApplication app{std::move(params)};
+    app.SetWindow(window);
+    app.Run();
+
+    return 0;
+}
@@ -0,0 +1,762 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "VulkanApplication.h"
+
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+
+#include "AppConfig.h"
+#include "ApplicationData.h"
+#include "FrustumCulling.h"
+#include "VulkanHelpers.h"
+#include "VulkanShaderModule.h"
+
+namespace examples::fundamentals::model_loading::gltf_gpu_culling
+{
+using namespace common::utility;
+using namespace common::vulkan_wrapper;
+using namespace common::vulkan_framework;
+using namespace common::window_wrapper;
+
+VulkanApplication::VulkanApplication(ParameterServer&& params) : ApplicationModelLoading(std::move(params)) {}
+
+bool VulkanApplication::Init()
+{
+    try {
+        ResolveParamKeys();
+
+        verifyPending_ = params_.Get<bool>(AppSettings::VerifyCulling);
+
+        currentWindowWidth_ = GetParamU32(WindowParams::Width);
+        currentWindowHeight_ = GetParamU32(WindowParams::Height);
+
+        float aspectRatio = static_cast<float>(currentWindowWidth_) / static_cast<float>(currentWindowHeight_);
+        camera_ = std::make_unique<PerspectiveCamera>(glm::vec3(0.0f, 3.0f, 10.0f), aspectRatio);
+
+        InitInputSystem();
+
+        CreateDefaultSurface();
+        SelectDefaultPhysicalDevice();
+        CreateLogicalDevice();
+        CreateDefaultQueue();
+        CreateDefaultSwapChain();
+        CreateDefaultCommandPool();
+        CreateDefaultSyncObjects(GetParamU32(AppConstants::MaxFramesInFlight));
+
+        CreateResources();
+        InitResources();
+
+        CreateRenderPass();
+        CreatePipeline();
+        CreateCullingPipeline();
+        CreateDefaultFramebuffers(resources_->GetImageView(GetParamStr(AppConstants::DepthImage),
+                                                           GetParamStr(AppConstants::DepthImageView)));
+        CreateCommandBuffers();
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return false;
+    }
+
+    return true;
+}
+
+void VulkanApplication::DrawFrame()
+{
+    inFlightFences_[currentIndex_]->WaitForFence(true, UINT64_MAX);
+    inFlightFences_[currentIndex_]->ResetFence();
+
+    // Only the frustum planes are sent every frame, the CPU doesn't touch the objects
+    const Frustum frustum = camera_->GetFrustum();
+    for (std::size_t i = 0; i < frustum.Planes.size(); ++i) {
+        cullingPushConstants_.FrustumPlanes[i] = frustum.Planes[i];
+    }
+
+    uint32_t imageIndex = swapChain_->AcquireNextImage(imageAvailableSemaphores_[currentIndex_], nullptr);
+
+    RecordPresentCommandBuffers(imageIndex);
+
+    if (swapImagesFences_[imageIndex] != nullptr) {
+        swapImagesFences_[imageIndex]->WaitForFence(true, UINT64_MAX);
+    }
+
+    swapImagesFences_[imageIndex] = inFlightFences_[currentIndex_];
+
+    queue_->Submit({cmdBuffersPresent_[imageIndex]}, {imageAvailableSemaphores_[currentIndex_]},
+                   {renderFinishedSemaphores_[imageIndex]}, inFlightFences_[currentIndex_],
+                   {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT});
+
+    if (verifyPending_) {
+        VerifyCulling();
+        verifyPending_ = false;
+    }
+
+    queue_->Present({swapChain_}, {imageIndex}, {renderFinishedSemaphores_[imageIndex]});
+
+    currentIndex_ = (currentIndex_ + 1) % GetParam(maxFramesInFlightKey_);
+}
+
+void VulkanApplication::PreUpdate()
+{
+    // Poll events
+    ApplicationModelLoading::PreUpdate();
+
+    // Process continuous inputs
+    ProcessInput();
+}
+
+void VulkanApplication::InitInputSystem()
+{
+    lastX_ = static_cast<float>(currentWindowWidth_) / 2.0f;
+    lastY_ = static_cast<float>(currentWindowHeight_) / 2.0f;
+
+    window_->DisableCursor();
+
+    window_->OnMouseMove([&](const MouseMoveEvent& event) {
+        const auto xPos = static_cast<float>(event.X);
+        const auto yPos = static_cast<float>(event.Y);
+
+        if (firstMouseTriggered_) {
+            lastX_ = xPos;
+            lastY_ = yPos;
+            firstMouseTriggered_ = false;
+        }
+
+        float xOffset = xPos - lastX_;
+        float yOffset = lastY_ - yPos;
+        lastX_ = xPos;
+        lastY_ = yPos;
+
+        const float sensitivity = GetParam(mouseSensitivityKey_) * static_cast<float>(deltaTime_);
+        xOffset *= sensitivity;
+        yOffset *= sensitivity;
+
+        camera_->Rotate(xOffset, yOffset);
+    });
+}
+
+void VulkanApplication::CreateLogicalDevice()
+{
+    // Every draw command selects its object with firstInstance. Multi draw and draw count are optional, without them
+    // the commands are drawn one by one or culled commands are kept with zero instances.
+    const auto supportedFeatures = physicalDevice_->GetSupportedFeatures();
+    if (!supportedFeatures.drawIndirectFirstInstance) {
+        throw std::runtime_error("Device doesn't support drawIndirectFirstInstance feature!");
+    }
+    isMultiDrawIndirectSupported_ = supportedFeatures.multiDrawIndirect;
+    isDrawCountSupported_ = physicalDevice_->IsExtensionSupported(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+    useDrawCount_ = isDrawCountSupported_ && params_.Get<bool>(AppSettings::UseDrawCount);
+
+    std::vector<std::string> extensions = {VK_KHR_SWAPCHAIN_EXTENSION_NAME};
+    if (isDrawCountSupported_) {
+        extensions.emplace_back(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+    }
+
+    VkPhysicalDeviceFeatures deviceFeatures{};
+    deviceFeatures.drawIndirectFirstInstance = VK_TRUE;
+    deviceFeatures.multiDrawIndirect = isMultiDrawIndirectSupported_ ? VK_TRUE : VK_FALSE;
+
+    std::vector queuePriorities = {1.0f};
+
+    device_ = physicalDevice_->CreateDevice([&](auto& builder) {
+        builder.AddLayer("VK_LAYER_KHRONOS_validation")
+                .AddExtensions(extensions)
+                .AddQueueInfo([&](auto& queueInfo) {
+                    queueInfo.queueFamilyIndex = currentQueueFamilyIndex_;
+                    queueInfo.queueCount = 1;
+                    queueInfo.pQueuePriorities = queuePriorities.data();
+                })
+                .SetDeviceFeatures(deviceFeatures);
+    });
+
+    if (!device_) {
+        throw std::runtime_error("Failed to create logical device!");
+    }
+}
+
+void VulkanApplication::CollectObjects()
+{
+    // Meshes are packed into one vertex and index buffer, so one indirect draw call can draw all of them
+    struct MeshRange
+    {
+        std::uint32_t IndexCount;
+        std::uint32_t FirstIndex;
+        std::int32_t VertexOffset;
+    };
+    std::vector<MeshRange> meshRanges;
+    for (auto& mesh: lanternModel_->Meshes) {
+        meshRanges.push_back({static_cast<std::uint32_t>(mesh.Indices.size()),
+                              static_cast<std::uint32_t>(meshIndices_.size()),
+                              static_cast<std::int32_t>(meshVertices_.size())});
+        const auto vertices = mesh.GetVerticesAs<VertexPos3Norm3>();
+        meshVertices_.insert(meshVertices_.end(), vertices.begin(), vertices.end());
+        meshIndices_.insert(meshIndices_.end(), mesh.Indices.begin(), mesh.Indices.end());
+    }
+
+    // Instances are placed on a grid, every mesh node of every instance is an object with its own world bounds
+    const auto instanceCount = GetParamU32(AppSettings::InstanceCount);
+    const auto spacing = GetParamFloat(AppSettings::InstanceSpacing);
+    const auto gridSize = static_cast<std::uint32_t>(std::ceil(std::sqrt(static_cast<float>(instanceCount))));
+    const glm::mat4 modelScale = glm::scale(glm::mat4(1.0f), glm::vec3(0.1f));
+    for (std::uint32_t instance = 0; instance < instanceCount; ++instance) {
+        const float x = (static_cast<float>(instance % gridSize) - static_cast<float>(gridSize - 1) / 2.0f) * spacing;
+        const float z = -static_cast<float>(instance / gridSize) * spacing;
+        const glm::mat4 instanceTransform = glm::translate(glm::mat4(1.0f), glm::vec3(x, 0.0f, z)) * modelScale;
+
+        for (const auto& node: lanternModel_->Nodes) {
+            if (node.MeshIndex >= meshRanges.size()) {
+                continue;
+            }
+
+            const auto& mesh = lanternModel_->Meshes[node.MeshIndex];
+            const auto& range = meshRanges[node.MeshIndex];
+            CullObject object{};
+            object.Model = instanceTransform * node.WorldTransform;
+            glm::vec3 boundsMin, boundsMax;
+            TransformBounds(mesh.BoundsMin, mesh.BoundsMax, object.Model, boundsMin, boundsMax);
+            object.BoundsCenter = glm::vec4((boundsMin + boundsMax) * 0.5f, 0.0f);
+            object.BoundsExtent = glm::vec4((boundsMax - boundsMin) * 0.5f, 0.0f);
+            object.IndexCount = range.IndexCount;
+            object.FirstIndex = range.FirstIndex;
+            object.VertexOffset = range.VertexOffset;
+            cullObjects_.push_back(object);
+        }
+    }
+
+    if (cullObjects_.empty()) {
+        throw std::runtime_error("There is no object to draw!");
+    }
+    objectCount_ = static_cast<std::uint32_t>(cullObjects_.size());
+}
+
+void VulkanApplication::CreateResources()
+{
+    depthImageFormat_ = physicalDevice_->FindSupportedFormat(
+            {VK_FORMAT_D32_SFLOAT, VK_FORMAT_D32_SFLOAT_S8_UINT, VK_FORMAT_D24_UNORM_S8_UINT},
+            VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT);
+
+    // Load models
+    ModelLoader modelLoader{ASSETS_DIR};
+    lanternModel_ = modelLoader.LoadBinaryGltfFromFile(GetParamStr(AppConstants::LanternModelPath));
+    if (!lanternModel_) {
+        throw std::runtime_error("Failed to load lantern model!");
+    }
+
+    CollectObjects();
+
+    const auto limits = physicalDevice_->GetProperties().limits;
+    if (!isMultiDrawIndirectSupported_ && !useDrawCount_) {
+        std::cout << "multiDrawIndirect is not supported, draw commands are recorded one by one" << std::endl;
+    } else if (objectCount_ > limits.maxDrawIndirectCount) {
+        throw std::runtime_error("Object count is larger than maxDrawIndirectCount!");
+    }
+    std::cout << "Culling " << objectCount_ << " objects on the GPU, "
+              << (useDrawCount_ ? "drawing with vkCmdDrawIndexedIndirectCountKHR"
+                                : "drawing culled commands with zero instances")
+              << std::endl;
+
+    const auto vertexSize = static_cast<std::uint32_t>(meshVertices_.size() * sizeof(VertexPos3Norm3));
+    const auto indexSize = static_cast<std::uint32_t>(meshIndices_.size() * sizeof(std::uint16_t));
+    const auto objectIndexSize = static_cast<std::uint32_t>(objectCount_ * sizeof(ObjectIndexData));
+    const auto objectSize = static_cast<std::uint32_t>(cullObjects_.size() * sizeof(CullObject));
+    const auto commandSize = static_cast<std::uint32_t>(objectCount_ * sizeof(VkDrawIndexedIndirectCommand));
+
+    ResourceDescriptor resourceCreateInfo;
+
+    // Objects don't change, so they are copied to device local memory once. Draw commands and their count are written
+    // and read only by the GPU.
+    std::vector<BufferResourceCreateInfo> bufferCreateInfos = {
+        {GetParamStr(AppConstants::MeshVertexBuffer), vertexSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT},
+        {GetParamStr(AppConstants::MeshIndexBuffer), indexSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT},
+        {GetParamStr(AppConstants::ObjectIndexBuffer), objectIndexSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT},
+        {GetParamStr(AppConstants::CullObjectBuffer), objectSize,
+         VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT},
+        {GetParamStr(AppConstants::UploadStagingBuffer), objectSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT},
+        {GetParamStr(AppConstants::DrawCommandBuffer), commandSize,
+         VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT},
+        {GetParamStr(AppConstants::DrawCountBuffer), sizeof(std::uint32_t),
+         VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+                 VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+         VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT}};
+    if (verifyPending_) {
+        bufferCreateInfos.push_back({GetParamStr(AppConstants::DrawCountReadbackBuffer), sizeof(std::uint32_t),
+                                     VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                     VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT});
+    }
+    resourceCreateInfo.Buffers = bufferCreateInfos;
+
+    // Fill shader module create infos
+    resourceCreateInfo.Shaders = {.BasePath = SHADERS_DIR,
+                                  .ShaderType = params_.Get<ShaderBaseType>(AppConstants::BaseShaderType),
+                                  .Modules = {{.Name = GetParamStr(AppConstants::MainVertexShaderKey),
+                                               .FileName = GetParamStr(AppConstants::MainVertexShaderFile)},
+                                              {.Name = GetParamStr(AppConstants::MainFragmentShaderKey),
+                                               .FileName = GetParamStr(AppConstants::MainFragmentShaderFile)},
+                                              {.Name = GetParamStr(AppConstants::CullingComputeShaderKey),
+                                               .FileName = GetParamStr(AppConstants::CullingComputeShaderFile)}}};
+
+    // Fill descriptor set create infos, model matrices of the objects are read by the vertex shader as well
+    resourceCreateInfo.Descriptors = {
+        .MaxSets = 1,
+        .PoolSizes = {{VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 3}},
+        .Layouts = {{.Name = GetParamStr(AppConstants::CullingDescSetLayout),
+                     .Bindings = {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1,
+                                   VK_SHADER_STAGE_COMPUTE_BIT | VK_SHADER_STAGE_VERTEX_BIT, nullptr},
+                                  {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+                                  {2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}}}},
+        .DescriptorSets = {{.Name = GetParamStr(AppConstants::CullingDescSetLayout),
+                            .LayoutName = GetParamStr(AppConstants::CullingDescSetLayout)}}};
+
+    resourceCreateInfo.Images = {ImageResourceCreateInfo{
+        .Name = GetParamStr(AppConstants::DepthImage),
+        .MemProperties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+        .Format = depthImageFormat_,
+        .Dimensions = {currentWindowWidth_, currentWindowHeight_, 1},
+        .UsageFlags = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
+        .Views = {ImageViewCreateInfo{.ViewName = GetParamStr(AppConstants::DepthImageView),
+                                      .Format = depthImageFormat_,
+                                      .SubresourceRange = {.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT,
+                                                           .baseMipLevel = 0,
+                                                           .levelCount = 1,
+                                                           .baseArrayLayer = 0,
+                                                           .layerCount = 1}}}}};
+
+    CreateVulkanResources(resourceCreateInfo);
+
+    // Resolve handles once, draw loop doesn't look up resources by name
+    meshVertexBuffer_ = resources_->GetBufferHandle(GetParamStr(AppConstants::MeshVertexBuffer));
+    meshIndexBuffer_ = resources_->GetBufferHandle(GetParamStr(AppConstants::MeshIndexBuffer));
+    objectIndexBuffer_ = resources_->GetBufferHandle(GetParamStr(AppConstants::ObjectIndexBuffer));
+    drawCommandBuffer_ = resources_->GetBufferHandle(GetParamStr(AppConstants::DrawCommandBuffer));
+    drawCountBuffer_ = resources_->GetBufferHandle(GetParamStr(AppConstants::DrawCountBuffer));
+    cullingDescSet_ = resources_->GetDescriptorSetHandle(GetParamStr(AppConstants::CullingDescSetLayout));
+
+    cullingPushConstants_.ObjectCount = objectCount_;
+    cullingPushConstants_.CompactDraws = useDrawCount_ ? 1 : 0;
+}
+
+void VulkanApplication::InitResources()
+{
+    std::vector<ObjectIndexData> objectIndices(objectCount_);
+    for (std::uint32_t i = 0; i < objectCount_; ++i) {
+        objectIndices[i].ObjectIndex.data = i;
+    }
+
+    resources_->SetBuffer(meshVertexBuffer_, meshVertices_.data(), meshVertices_.size() * sizeof(VertexPos3Norm3));
+    resources_->SetBuffer(meshIndexBuffer_, meshIndices_.data(), meshIndices_.size() * sizeof(std::uint16_t));
+    resources_->SetBuffer(objectIndexBuffer_, objectIndices.data(), objectIndices.size() * sizeof(ObjectIndexData));
+
+    const auto objectSize = cullObjects_.size() * sizeof(CullObject);
+    const auto& stagingBufferName = GetParamStr(AppConstants::UploadStagingBuffer);
+    resources_->UpdateBuffer(stagingBufferName, cullObjects_.data(), objectSize, 0);
+
+    const auto cmdBufferTransfer = cmdPool_->CreateCommandBuffers(1, VK_COMMAND_BUFFER_LEVEL_PRIMARY).front();
+    if (!cmdBufferTransfer->BeginCommandBuffer(
+                [](auto& beginInfo) { beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT; })) {
+        throw std::runtime_error("Failed to begin recording command buffer!");
+    }
+
+    cmdBufferTransfer->CopyBuffer(resources_->GetBuffer(stagingBufferName),
+                                  resources_->GetBuffer(GetParamStr(AppConstants::CullObjectBuffer)),
+                                  {VkBufferCopy{0, 0, objectSize}});
+
+    if (!cmdBufferTransfer->EndCommandBuffer()) {
+        throw std::runtime_error("Failed to end recording command buffer!");
+    }
+
+    // Directly submit this command buffer to queue, staging buffer isn't needed after the copy
+    queue_->Submit({cmdBufferTransfer});
+    queue_->WaitIdle();
+    resources_->DeleteBuffer(stagingBufferName);
+
+    UpdateDescriptorSets();
+}
+
+void VulkanApplication::UpdateDescriptorSets() const
+{
+    const std::array bufferNames{GetParamStr(AppConstants::CullObjectBuffer),
+                                 GetParamStr(AppConstants::DrawCommandBuffer),
+                                 GetParamStr(AppConstants::DrawCountBuffer)};
+
+    DescriptorUpdateInfo descriptorSetUpdateInfo;
+    for (std::uint32_t binding = 0; binding < bufferNames.size(); ++binding) {
+        BufferWriteRequest bufferUpdateRequest;
+        bufferUpdateRequest.LayoutName = GetParamStr(AppConstants::CullingDescSetLayout);
+        bufferUpdateRequest.BindingIndex = binding;
+        bufferUpdateRequest.Buffers = {{resources_->GetBuffer(bufferNames[binding])->GetHandle(), 0, VK_WHOLE_SIZE}};
+        bufferUpdateRequest.Type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        descriptorSetUpdateInfo.BufferWriteRequests.push_back(bufferUpdateRequest);
+    }
+
+    resources_->UpdateDescriptorSet(descriptorSetUpdateInfo);
+}
+
+void VulkanApplication::CreateRenderPass()
+{
+    VkAttachmentReference colorAttachmentRef{0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+
+    VkAttachmentReference depthAttachmentRef{1, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL};
+
+    renderPass_ = device_->CreateRenderPass([&](auto& builder) {
+        builder.AddAttachment([](auto& attachmentCreateInfo) {
+                   attachmentCreateInfo.format = VK_FORMAT_B8G8R8A8_SRGB;
+                   attachmentCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+                   attachmentCreateInfo.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+                   attachmentCreateInfo.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+                   attachmentCreateInfo.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+                   attachmentCreateInfo.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+                   attachmentCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+                   attachmentCreateInfo.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+               })
+                .AddAttachment([&](auto& attachmentCreateInfo) {
+                    attachmentCreateInfo.format = depthImageFormat_;
+                    attachmentCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+                    attachmentCreateInfo.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+                    attachmentCreateInfo.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+                    attachmentCreateInfo.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+                    attachmentCreateInfo.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+                    attachmentCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+                    attachmentCreateInfo.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+                })
+                .AddSubpass([&](auto& subpassCreateInfo) {
+                    subpassCreateInfo.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+                    subpassCreateInfo.colorAttachmentCount = 1;
+                    subpassCreateInfo.pColorAttachments = &colorAttachmentRef;
+                    subpassCreateInfo.pDepthStencilAttachment = &depthAttachmentRef;
+                });
+    });
+
+    if (!renderPass_) {
+        throw std::runtime_error("Failed to create render pass!");
+    }
+}
+
+void VulkanApplication::CreatePipeline()
+{
+    VkPushConstantRange viewProjectionPushConstant;
+    viewProjectionPushConstant.offset = 0;
+    viewProjectionPushConstant.size = sizeof(ViewProjectionData);
+    viewProjectionPushConstant.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+
+    pipelineLayout_ = device_->CreatePipelineLayout(
+            {resources_->GetDescriptorLayout(GetParamStr(AppConstants::CullingDescSetLayout))},
+            {viewProjectionPushConstant});
+
+    if (!pipelineLayout_) {
+        throw std::runtime_error("Failed to create pipeline layout!");
+    }
+
+    VkViewport viewport{0,    0,   static_cast<float>(currentWindowWidth_), static_cast<float>(currentWindowHeight_),
+                        0.0f, 1.0f};
+    VkRect2D scissor{0, 0, currentWindowWidth_, currentWindowHeight_};
+
+    VkPipelineColorBlendAttachmentState colorBlendAttachment;
+    colorBlendAttachment.blendEnable = VK_FALSE;
+    colorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.colorBlendOp = VK_BLEND_OP_ADD;
+    colorBlendAttachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+    colorBlendAttachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+    colorBlendAttachment.alphaBlendOp = VK_BLEND_OP_ADD;
+    colorBlendAttachment.colorWriteMask =
+            VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+
+    // Mesh vertices (binding 0) and the object index of the draw command (binding 1, advanced once per instance)
+    constexpr uint32_t vertexBindingIndex = 0;
+    constexpr uint32_t objectBindingIndex = 1;
+    const std::array bindingDescriptions{
+        GenerateBindingDescription<VertexPos3Norm3>(vertexBindingIndex),
+        GenerateBindingDescription<ObjectIndexData>(objectBindingIndex, VK_VERTEX_INPUT_RATE_INSTANCE)};
+    const std::array attributeDescriptions{
+        GenerateAttributeDescription(VertexPos3Norm3, Position, vertexBindingIndex),
+        GenerateAttributeDescription(VertexPos3Norm3, Normal, vertexBindingIndex),
+        GenerateAttributeDescription(ObjectIndexData, ObjectIndex, objectBindingIndex)};
+
+    pipeline_ = device_->CreateGraphicsPipeline(pipelineLayout_, renderPass_, [&](auto& builder) {
+        builder.AddShaderStage([&](auto& shaderStageCreateInfo) {
+            shaderStageCreateInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;
+            shaderStageCreateInfo.module =
+                    resources_->GetShaderModule(GetParamStr(AppConstants::MainVertexShaderKey))->GetHandle();
+        });
+        builder.AddShaderStage([&](auto& shaderStageCreateInfo) {
+            shaderStageCreateInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+            shaderStageCreateInfo.module =
+                    resources_->GetShaderModule(GetParamStr(AppConstants::MainFragmentShaderKey))->GetHandle();
+        });
+        builder.SetVertexInputState([&](auto& vertexInputStateCreateInfo) {
+            vertexInputStateCreateInfo.vertexBindingDescriptionCount = bindingDescriptions.size();
+            vertexInputStateCreateInfo.pVertexBindingDescriptions = bindingDescriptions.data();
+            vertexInputStateCreateInfo.vertexAttributeDescriptionCount = attributeDescriptions.size();
+            vertexInputStateCreateInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
+        });
+        builder.SetViewportState([&](auto& viewportStateCreateInfo) {
+            viewportStateCreateInfo.viewportCount = 1;
+            viewportStateCreateInfo.pViewports = &viewport;
+            viewportStateCreateInfo.scissorCount = 1;
+            viewportStateCreateInfo.pScissors = &scissor;
+        });
+        builder.SetColorBlendState([&](auto& blendStateCreateInfo) {
+            blendStateCreateInfo.attachmentCount = 1;
+            blendStateCreateInfo.pAttachments = &colorBlendAttachment;
+        });
+        builder.SetDepthStencilState([&](auto& depthStencilStateCreateInfo) {
+            depthStencilStateCreateInfo.depthTestEnable = VK_TRUE;
+            depthStencilStateCreateInfo.depthWriteEnable = VK_TRUE;
+            depthStencilStateCreateInfo.depthCompareOp = VK_COMPARE_OP_LESS;
+        });
+    });
+
+    if (!pipeline_) {
+        throw std::runtime_error("Failed to create graphics pipeline!");
+    }
+}
+
+void VulkanApplication::CreateCullingPipeline()
+{
+    const auto queueFamilyProperties = physicalDevice_->GetQueueFamilyProperties();
+    if (!(queueFamilyProperties[currentQueueFamilyIndex_].queueFlags & VK_QUEUE_COMPUTE_BIT)) {
+        throw std::runtime_error("Selected queue family doesn't support compute operations!");
+    }
+
+    const VkPushConstantRange pushConstantRange{VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(CullingPushConstants)};
+    cullingPipelineLayout_ = device_->CreatePipelineLayout(
+            {resources_->GetDescriptorLayout(GetParamStr(AppConstants::CullingDescSetLayout))}, {pushConstantRange});
+
+    if (!cullingPipelineLayout_) {
+        throw std::runtime_error("Failed to create culling pipeline layout!");
+    }
+
+    cullingPipeline_ = device_->CreateComputePipeline(cullingPipelineLayout_, [&](auto& builder) {
+        builder.SetShaderStage([&](auto& shaderStageCreateInfo) {
+            shaderStageCreateInfo.module =
+                    resources_->GetShaderModule(GetParamStr(AppConstants::CullingComputeShaderKey))->GetHandle();
+        });
+    });
+
+    if (!cullingPipeline_) {
+        throw std::runtime_error("Failed to create culling pipeline!");
+    }
+}
+
+void VulkanApplication::CreateCommandBuffers()
+{
+    cmdBuffersPresent_ = cmdPool_->CreateCommandBuffers(framebuffers_.size(), VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+
+    if (cmdBuffersPresent_.empty()) {
+        throw std::runtime_error("Failed to create command buffers!");
+    }
+}
+
+void VulkanApplication::RecordPresentCommandBuffers(const std::uint32_t currentImageIndex)
+{
+    std::array<VkClearValue, 2> clearValues{};
+    clearValues[0].color = GetParam(clearColorKey_);
+    clearValues[1].depthStencil = {1.0f, 0};
+
+    const auto& currentCmdBuffer = cmdBuffersPresent_[currentImageIndex];
+
+    if (!currentCmdBuffer->BeginCommandBuffer(nullptr)) {
+        throw std::runtime_error("Failed to begin recording command buffer!");
+    }
+
+    RecordCullingDispatch(currentCmdBuffer);
+
+    currentCmdBuffer->BeginRenderPass(
+            [&](auto& beginInfo) {
+                beginInfo.renderPass = renderPass_->GetHandle();
+                beginInfo.framebuffer = framebuffers_[currentImageIndex]->GetHandle();
+                beginInfo.renderArea.offset = {0, 0};
+                beginInfo.renderArea.extent = VkExtent2D(currentWindowWidth_, currentWindowHeight_);
+                beginInfo.clearValueCount = clearValues.size();
+                beginInfo.pClearValues = clearValues.data();
+            },
+            VK_SUBPASS_CONTENTS_INLINE);
+
+    RecordIndirectDraws(currentCmdBuffer);
+
+    currentCmdBuffer->EndRenderPass();
+    if (!currentCmdBuffer->EndCommandBuffer()) {
+        throw std::runtime_error("Failed to end recording command buffer!");
+    }
+}
+
+void VulkanApplication::RecordCullingDispatch(const std::shared_ptr<VulkanCommandBuffer>& cmdBuffer) const
+{
+    const auto commandBuffer = resources_->GetBuffer(drawCommandBuffer_);
+    const auto countBuffer = resources_->GetBuffer(drawCountBuffer_);
+
+    // Indirect reads of the previous frame must be finished before the commands and the count are overwritten
+    VkBufferMemoryBarrier commandBarrier{};
+    commandBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    commandBarrier.srcAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+    commandBarrier.dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    commandBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    commandBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    commandBarrier.buffer = commandBuffer->GetHandle();
+    commandBarrier.offset = 0;
+    commandBarrier.size = VK_WHOLE_SIZE;
+    VkBufferMemoryBarrier countBarrier = commandBarrier;
+    countBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    countBarrier.buffer = countBuffer->GetHandle();
+    cmdBuffer->PipelineBarrier(VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT,
+                               VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, {},
+                               {commandBarrier, countBarrier});
+
+    // Count is reset before the visible objects are appended with atomic adds
+    cmdBuffer->FillBuffer(countBuffer, 0, sizeof(std::uint32_t), 0);
+    countBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    countBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    cmdBuffer->PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, {},
+                               {countBarrier});
+
+    // One invocation per object
+    cmdBuffer->BindPipeline(cullingPipeline_, VK_PIPELINE_BIND_POINT_COMPUTE);
+    const std::vector descSets{resources_->GetDescriptorSet(cullingDescSet_)};
+    cmdBuffer->BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, cullingPipelineLayout_, 0, descSets);
+    cmdBuffer->PushConstants(cullingPipelineLayout_, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(CullingPushConstants),
+                             &cullingPushConstants_);
+    cmdBuffer->Dispatch((objectCount_ + cullingGroupSize - 1) / cullingGroupSize, 1, 1);
+
+    // Commands and the count must be written before they are read by the indirect draw
+    commandBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    commandBarrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+    countBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    countBarrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+    cmdBuffer->PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, {},
+                               {commandBarrier, countBarrier});
+}
+
+void VulkanApplication::RecordIndirectDraws(const std::shared_ptr<VulkanCommandBuffer>& cmdBuffer) const
+{
+    cmdBuffer->BindPipeline(pipeline_, VK_PIPELINE_BIND_POINT_GRAPHICS);
+    const std::vector descSets{resources_->GetDescriptorSet(cullingDescSet_)};
+    cmdBuffer->BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_, 0, descSets);
+
+    ViewProjectionData viewProjectionData{};
+    viewProjectionData.viewProjectionMatrix = camera_->GetProjectionMatrix() * camera_->GetViewMatrix();
+    cmdBuffer->PushConstants(pipelineLayout_, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(ViewProjectionData),
+                             &viewProjectionData);
+
+    const std::vector vertexBuffers{resources_->GetBuffer(meshVertexBuffer_),
+                                    resources_->GetBuffer(objectIndexBuffer_)};
+    cmdBuffer->BindVertexBuffers(vertexBuffers, 0, 2, {0, 0});
+    cmdBuffer->BindIndexBuffer(resources_->GetBuffer(meshIndexBuffer_));
+
+    // Number of the recorded calls doesn't depend on the visible objects (except the fallback without multi draw)
+    const auto commandBuffer = resources_->GetBuffer(drawCommandBuffer_);
+    constexpr auto stride = static_cast<std::uint32_t>(sizeof(VkDrawIndexedIndirectCommand));
+    if (useDrawCount_) {
+        if (!cmdBuffer->DrawIndexedIndirectCount(commandBuffer, 0, resources_->GetBuffer(drawCountBuffer_), 0,
+                                                 objectCount_, stride)) {
+            throw std::runtime_error("Failed to record indirect draw with count!");
+        }
+    } else if (isMultiDrawIndirectSupported_) {
+        cmdBuffer->DrawIndexedIndirect(commandBuffer, 0, objectCount_, stride);
+    } else {
+        for (std::uint32_t i = 0; i < objectCount_; ++i) {
+            cmdBuffer->DrawIndexedIndirect(commandBuffer, static_cast<VkDeviceSize>(i) * stride, 1, stride);
+        }
+    }
+}
+
+void VulkanApplication::VerifyCulling() const
+{
+    const auto cmdBufferTransfer = cmdPool_->CreateCommandBuffers(1, VK_COMMAND_BUFFER_LEVEL_PRIMARY).front();
+    if (!cmdBufferTransfer->BeginCommandBuffer(
+                [](auto& beginInfo) { beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT; })) {
+        throw std::runtime_error("Failed to begin recording command buffer!");
+    }
+
+    // Compute writes of the frame that was just submitted must be visible to the copy, and the copy to the host
+    VkMemoryBarrier computeToTransfer{};
+    computeToTransfer.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    computeToTransfer.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    computeToTransfer.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    cmdBufferTransfer->PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, {}, {},
+                                       {computeToTransfer});
+
+    VkBufferCopy copyRegion{};
+    copyRegion.size = sizeof(std::uint32_t);
+    const auto readbackHandle = resources_->GetBufferHandle(GetParamStr(AppConstants::DrawCountReadbackBuffer));
+    cmdBufferTransfer->CopyBuffer(resources_->GetBuffer(drawCountBuffer_), resources_->GetBuffer(readbackHandle),
+                                  {copyRegion});
+
+    VkMemoryBarrier transferToHost{};
+    transferToHost.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    transferToHost.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    transferToHost.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    cmdBufferTransfer->PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, {}, {},
+                                       {transferToHost});
+
+    if (!cmdBufferTransfer->EndCommandBuffer()) {
+        throw std::runtime_error("Failed to end recording command buffer!");
+    }
+
+    queue_->Submit({cmdBufferTransfer});
+    queue_->WaitIdle();
+
+    std::uint32_t gpuVisibleCount = 0;
+    auto* readbackBuffer = resources_->GetBufferResource(readbackHandle);
+    readbackBuffer->MapMemory();
+    std::memcpy(&gpuVisibleCount, readbackBuffer->GetMappedData(), sizeof(std::uint32_t));
+    readbackBuffer->UnmapMemory();
+
+    // Reference count is calculated on the CPU with the same planes and bounds
+    Frustum frustum{};
+    for (std::size_t i = 0; i < frustum.Planes.size(); ++i) {
+        frustum.Planes[i] = cullingPushConstants_.FrustumPlanes[i];
+    }
+    BoundsArrays bounds;
+    bounds.Resize(objectCount_);
+    for (std::uint32_t i = 0; i < objectCount_; ++i) {
+        const auto& object = cullObjects_[i];
+        bounds.Set(i, glm::vec3(object.BoundsCenter - object.BoundsExtent),
+                   glm::vec3(object.BoundsCenter + object.BoundsExtent));
+    }
+    std::vector<std::uint32_t> visibleIndices;
+    const auto cpuVisibleCount = CullBounds(frustum, bounds, visibleIndices);
+
+    // Objects exactly on a plane can be classified differently because of the floating point differences
+    const auto difference = static_cast<std::int64_t>(gpuVisibleCount) - static_cast<std::int64_t>(cpuVisibleCount);
+    std::cout << "GPU culling (" << objectCount_ << " objects): " << gpuVisibleCount << " visible, "
+              << objectCount_ - gpuVisibleCount << " culled, CPU " << cpuVisibleCount << " visible" << std::endl;
+    if (std::abs(difference) > 1) {
+        throw std::runtime_error("Visible object counts of the GPU and CPU culling don't match!");
+    }
+}
+
+void VulkanApplication::ResolveParamKeys()
+{
+    maxFramesInFlightKey_ = ResolveParam<std::uint32_t>(AppConstants::MaxFramesInFlight);
+    clearColorKey_ = ResolveParam<VkClearColorValue>(AppSettings::ClearColor);
+    mouseSensitivityKey_ = ResolveParam<float>(AppSettings::MouseSensitivity);
+    cameraSpeedKey_ = ResolveParam<float>(AppSettings::CameraSpeed);
+}
+
+void VulkanApplication::ProcessInput() const
+{
+    const float cameraSpeed = GetParam(cameraSpeedKey_) * static_cast<float>(deltaTime_);
+    if (window_->IsKeyPressed(GLFW_KEY_W)) {
+        camera_->Move(camera_->GetFrontVector() * cameraSpeed);
+    }
+    if (window_->IsKeyPressed(GLFW_KEY_S)) {
+        camera_->Move(-camera_->GetFrontVector() * cameraSpeed);
+    }
+    if (window_->IsKeyPressed(GLFW_KEY_A)) {
+        camera_->Move(-camera_->GetRightVector() * cameraSpeed);
+    }
+    if (window_->IsKeyPressed(GLFW_KEY_D)) {
+        camera_->Move(camera_->GetRightVector() * cameraSpeed);
+    }
+}
+} // namespace examples::fundamentals::model_loading::gltf_gpu_culling
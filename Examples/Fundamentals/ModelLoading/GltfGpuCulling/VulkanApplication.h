@@ -0,0 +1,128 @@
+/**
+ * @file    VulkanApplication.h
+ * @brief   This file contains VulkanApplication implementation.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ApplicationData.h"
+#include "ApplicationModelLoading.h"
+#include "ModelLoader.h"
+#include "PerspectiveCamera.h"
+#include "VulkanCommandBuffer.h"
+#include "VulkanPipeline.h"
+#include "VulkanPipelineLayout.h"
+#include "Window.h"
+
+namespace examples::fundamentals::model_loading::gltf_gpu_culling
+{
+class VulkanApplication final : public base::ApplicationModelLoading
+{
+public:
+    explicit VulkanApplication(common::utility::ParameterServer&& params);
+
+    ~VulkanApplication() override = default;
+
+protected:
+    bool Init() override;
+
+    void DrawFrame() override;
+
+    void PreUpdate() override;
+
+private:
+    void InitInputSystem();
+
+    void CreateLogicalDevice();
+
+    void CollectObjects();
+
+    void CreateResources();
+
+    void InitResources();
+
+    void UpdateDescriptorSets() const;
+
+    void CreateRenderPass();
+
+    void CreatePipeline();
+
+    void CreateCullingPipeline();
+
+    void CreateCommandBuffers();
+
+    void RecordPresentCommandBuffers(std::uint32_t currentImageIndex);
+
+    void RecordCullingDispatch(const std::shared_ptr<common::vulkan_wrapper::VulkanCommandBuffer>& cmdBuffer) const;
+
+    void RecordIndirectDraws(const std::shared_ptr<common::vulkan_wrapper::VulkanCommandBuffer>& cmdBuffer) const;
+
+    void ProcessInput() const;
+
+    void VerifyCulling() const;
+
+    void ResolveParamKeys();
+
+    std::uint32_t currentIndex_ = 0;
+    std::uint32_t currentWindowWidth_ = UINT32_MAX;
+    std::uint32_t currentWindowHeight_ = UINT32_MAX;
+    VkFormat depthImageFormat_ = VK_FORMAT_UNDEFINED;
+
+    // Pre-resolved parameter keys for per-frame reads
+    common::utility::ParamKey<std::uint32_t> maxFramesInFlightKey_;
+    common::utility::ParamKey<VkClearColorValue> clearColorKey_;
+    common::utility::ParamKey<float> mouseSensitivityKey_;
+    common::utility::ParamKey<float> cameraSpeedKey_;
+
+    // Models
+    std::shared_ptr<common::utility::GltfModelHandler> lanternModel_;
+
+    // Packed geometry of all meshes and one cull object per mesh node of every instance
+    std::vector<VertexPos3Norm3> meshVertices_;
+    std::vector<std::uint16_t> meshIndices_;
+    std::vector<CullObject> cullObjects_;
+    std::uint32_t objectCount_ = 0;
+
+    // Supported indirect draw paths
+    bool isDrawCountSupported_ = false;
+    bool isMultiDrawIndirectSupported_ = false;
+    bool useDrawCount_ = false;
+
+    CullingPushConstants cullingPushConstants_{};
+    bool verifyPending_ = false;
+
+    // Resource handles which are used in the per-frame code
+    common::vulkan_framework::BufferHandle meshVertexBuffer_;
+    common::vulkan_framework::BufferHandle meshIndexBuffer_;
+    common::vulkan_framework::BufferHandle objectIndexBuffer_;
+    common::vulkan_framework::BufferHandle drawCommandBuffer_;
+    common::vulkan_framework::BufferHandle drawCountBuffer_;
+    common::vulkan_framework::DescriptorSetHandle cullingDescSet_;
+
+    // Pipelines
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipelineLayout> pipelineLayout_;
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipeline> pipeline_;
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipelineLayout> cullingPipelineLayout_;
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipeline> cullingPipeline_;
+
+    // Command buffers
+    std::vector<std::shared_ptr<common::vulkan_wrapper::VulkanCommandBuffer>> cmdBuffersPresent_;
+
+    // Mouse related values
+    bool firstMouseTriggered_ = true;
+    float lastX_ = 0.0f;
+    float lastY_ = 0.0f;
+
+    // Camera
+    std::unique_ptr<common::utility::PerspectiveCamera> camera_;
+};
+} // namespace examples::fundamentals::model_loading::gltf_gpu_culling
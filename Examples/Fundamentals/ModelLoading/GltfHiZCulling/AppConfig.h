@@ -0,0 +1,65 @@
+/**
+ * @file    AppConfig.h
+ * @brief   This header file keeps key names for user-provided config key names.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include "AppCommonConfig.h"
+
+namespace examples::fundamentals::model_loading::gltf_hiz_culling
+{
+namespace AppConstants
+{
+    constexpr auto MaxFramesInFlight = "AppConstants.MaxFramesInFlight";
+    constexpr auto BaseShaderType = "AppConstants.BaseShaderType";
+    constexpr auto MainVertexShaderFile = "AppConstants.MainVertexShaderFile";
+    constexpr auto MainFragmentShaderFile = "AppConstants.MainFragmentShaderFile";
+    constexpr auto CullingComputeShaderFile = "AppConstants.CullingComputeShaderFile";
+    constexpr auto DepthReduceComputeShaderFile = "AppConstants.DepthReduceComputeShaderFile";
+    constexpr auto MainVertexShaderKey = "AppConstants.MainVertexShaderKey";
+    constexpr auto MainFragmentShaderKey = "AppConstants.MainFragmentShaderKey";
+    constexpr auto CullingComputeShaderKey = "AppConstants.CullingComputeShaderKey";
+    constexpr auto DepthReduceComputeShaderKey = "AppConstants.DepthReduceComputeShaderKey";
+
+    // Resources
+    constexpr auto DepthImage = "AppConstants.DepthImage";
+    constexpr auto DepthImageView = "AppConstants.DepthImageView";
+    constexpr auto DepthPyramidImage = "AppConstants.DepthPyramidImage";
+    constexpr auto DepthPyramidView = "AppConstants.DepthPyramidView";
+    constexpr auto DepthPyramidLevelView = "AppConstants.DepthPyramidLevelView";
+    constexpr auto DepthSampler = "AppConstants.DepthSampler";
+    constexpr auto DepthPyramidSampler = "AppConstants.DepthPyramidSampler";
+    constexpr auto LanternModelPath = "AppConstants.LanternModelPath";
+    constexpr auto CullingDescSetLayout = "AppConstants.CullingDescSetLayout";
+    constexpr auto DepthReduceDescSetLayout = "AppConstants.DepthReduceDescSetLayout";
+    constexpr auto DepthReduceDescSet = "AppConstants.DepthReduceDescSet";
+    constexpr auto MeshVertexBuffer = "AppConstants.MeshVertexBuffer";
+    constexpr auto MeshIndexBuffer = "AppConstants.MeshIndexBuffer";
+    constexpr auto ObjectIndexBuffer = "AppConstants.ObjectIndexBuffer";
+    constexpr auto CullObjectBuffer = "AppConstants.CullObjectBuffer";
+    constexpr auto UploadStagingBuffer = "AppConstants.UploadStagingBuffer";
+    constexpr auto VisibilityBuffer = "AppConstants.VisibilityBuffer";
+    constexpr auto DrawCommandBuffer = "AppConstants.DrawCommandBuffer";
+    constexpr auto CullingStatsBuffer = "AppConstants.CullingStatsBuffer";
+    constexpr auto CullingStatsReadbackBuffer = "AppConstants.CullingStatsReadbackBuffer";
+} // namespace AppConstants
+
+namespace AppSettings
+{
+    constexpr auto ClearColor = "AppSettings.ClearColor";
+    constexpr auto MouseSensitivity = "AppSettings.MouseSensitivity";
+    constexpr auto CameraSpeed = "AppSettings.CameraSpeed";
+    constexpr auto InstanceCount = "AppSettings.InstanceCount";
+    constexpr auto InstanceSpacing = "AppSettings.InstanceSpacing";
+    constexpr auto WallRowInterval = "AppSettings.WallRowInterval";
+    constexpr auto UseDrawCount = "AppSettings.UseDrawCount";
+    constexpr auto UseMinMaxSampler = "AppSettings.UseMinMaxSampler";
+    constexpr auto PrintCullingStats = "AppSettings.PrintCullingStats";
+} // namespace AppSettings
+} // namespace examples::fundamentals::model_loading::gltf_hiz_culling
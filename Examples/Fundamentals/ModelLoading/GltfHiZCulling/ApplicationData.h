@@ -0,0 +1,163 @@
+/**
+ * @file    ApplicationData.h
+ * @brief   This header file keeps user-provided application data (vertices, indices etc.).
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "ModelLoader.h"
+#include "Vertex.h"
+#include "glm/glm.hpp"
+
+namespace examples::fundamentals::model_loading::gltf_hiz_culling
+{
+// Vertex Attribute Layout (meshes of the model and the wall box are packed into one vertex buffer)
+struct VertexPos3Norm3
+{
+    common::utility::Attribute<common::utility::Vec3, 0> Position; // layout(location=0) in vec3 position;
+    common::utility::Attribute<common::utility::Vec3, 1> Normal;   // layout(location=1) in vec3 normal;
+};
+
+// Per-instance attribute, firstInstance of a draw command selects the object
+struct ObjectIndexData
+{
+    common::utility::Attribute<std::uint32_t, 2> ObjectIndex; // layout(location=2) in uint objectIndex;
+};
+
+// View-projection matrix (for Push Constants of the drawing pipeline)
+struct ViewProjectionData
+{
+    glm::mat4 viewProjectionMatrix;
+};
+
+// Object that is tested by the culling compute shader (std430 layout), one mesh of one model instance or a wall
+struct CullObject
+{
+    glm::mat4 Model;
+    glm::vec4 BoundsCenter; // xyz: center of the world bounding box
+    glm::vec4 BoundsExtent; // xyz: half size of the world bounding box
+    std::uint32_t IndexCount;
+    std::uint32_t FirstIndex;
+    std::int32_t VertexOffset;
+    std::uint32_t Padding;
+};
+
+// Push constants of the culling compute shader, frustum planes are extracted from the view-projection matrix
+struct CullingPushConstants
+{
+    glm::mat4 ViewProjection;
+    glm::vec2 PyramidSize; // Size of the first level of the depth pyramid
+    std::uint32_t PyramidLevelCount;
+    std::uint32_t ObjectCount;
+    std::uint32_t CompactDraws; // 1: visible commands are packed and counted, 0: culled commands have no instances
+    std::uint32_t Phase;        // 0: early pass (visible in the last frame), 1: late pass (occlusion test)
+    std::uint32_t UseMinMaxSampler;
+    std::uint32_t Padding;
+};
+
+// Push constants of the depth reduction compute shader
+struct DepthReducePushConstants
+{
+    std::uint32_t SrcWidth;
+    std::uint32_t SrcHeight;
+    std::uint32_t DstWidth;
+    std::uint32_t DstHeight;
+    std::uint32_t UseMinMaxSampler; // Source is exactly 2x of the destination and sampled with a MAX reduction sampler
+    std::uint32_t Padding[3];
+};
+
+// Counters which are written by the culling compute shader, first two of them are the draw counts of the phases
+struct CullingStats
+{
+    std::uint32_t EarlyDrawCount;
+    std::uint32_t LateDrawCount;
+    std::uint32_t VisibleCount;
+    std::uint32_t OccludedCount;
+};
+
+// Culling phases
+inline constexpr std::uint32_t earlyPhase = 0;
+inline constexpr std::uint32_t latePhase = 1;
+
+// Work group sizes of the compute shaders (local_size_x, local_size_y)
+inline constexpr std::uint32_t cullingGroupSize = 64;
+inline constexpr std::uint32_t depthReduceGroupSize = 8;
+
+// Vertex Data for the wall box (unit cube)
+const std::vector wallVertices{
+    // Front face
+    VertexPos3Norm3{{-0.5f, -0.5f, 0.5f}, {0.0f, 0.0f, 1.0f}}, // 0
+    VertexPos3Norm3{{0.5f, -0.5f, 0.5f}, {0.0f, 0.0f, 1.0f}},  // 1
+    VertexPos3Norm3{{0.5f, 0.5f, 0.5f}, {0.0f, 0.0f, 1.0f}},   // 2
+    VertexPos3Norm3{{-0.5f, 0.5f, 0.5f}, {0.0f, 0.0f, 1.0f}},  // 3
+
+    // Back face
+    VertexPos3Norm3{{-0.5f, -0.5f, -0.5f}, {0.0f, 0.0f, -1.0f}}, // 4
+    VertexPos3Norm3{{0.5f, -0.5f, -0.5f}, {0.0f, 0.0f, -1.0f}},  // 5
+    VertexPos3Norm3{{0.5f, 0.5f, -0.5f}, {0.0f, 0.0f, -1.0f}},   // 6
+    VertexPos3Norm3{{-0.5f, 0.5f, -0.5f}, {0.0f, 0.0f, -1.0f}},  // 7
+
+    // Left face
+    VertexPos3Norm3{{-0.5f, -0.5f, -0.5f}, {-1.0f, 0.0f, 0.0f}}, // 8
+    VertexPos3Norm3{{-0.5f, -0.5f, 0.5f}, {-1.0f, 0.0f, 0.0f}},  // 9
+    VertexPos3Norm3{{-0.5f, 0.5f, 0.5f}, {-1.0f, 0.0f, 0.0f}},   // 10
+    VertexPos3Norm3{{-0.5f, 0.5f, -0.5f}, {-1.0f, 0.0f, 0.0f}},  // 11
+
+    // Right face
+    VertexPos3Norm3{{0.5f, -0.5f, -0.5f}, {1.0f, 0.0f, 0.0f}}, // 12
+    VertexPos3Norm3{{0.5f, -0.5f, 0.5f}, {1.0f, 0.0f, 0.0f}},  // 13
+    VertexPos3Norm3{{0.5f, 0.5f, 0.5f}, {1.0f, 0.0f, 0.0f}},   // 14
+    VertexPos3Norm3{{0.5f, 0.5f, -0.5f}, {1.0f, 0.0f, 0.0f}},  // 15
+
+    // Top face
+    VertexPos3Norm3{{-0.5f, 0.5f, 0.5f}, {0.0f, 1.0f, 0.0f}},  // 16
+    VertexPos3Norm3{{0.5f, 0.5f, 0.5f}, {0.0f, 1.0f, 0.0f}},   // 17
+    VertexPos3Norm3{{0.5f, 0.5f, -0.5f}, {0.0f, 1.0f, 0.0f}},  // 18
+    VertexPos3Norm3{{-0.5f, 0.5f, -0.5f}, {0.0f, 1.0f, 0.0f}}, // 19
+
+    // Bottom face
+    VertexPos3Norm3{{-0.5f, -0.5f, 0.5f}, {0.0f, -1.0f, 0.0f}}, // 20
+    VertexPos3Norm3{{0.5f, -0.5f, 0.5f}, {0.0f, -1.0f, 0.0f}},  // 21
+    VertexPos3Norm3{{0.5f, -0.5f, -0.5f}, {0.0f, -1.0f, 0.0f}}, // 22
+    VertexPos3Norm3{{-0.5f, -0.5f, -0.5f}, {0.0f, -1.0f, 0.0f}} // 23
+};
+
+// Index Data for the wall box
+const std::vector<uint16_t> wallIndices{
+    0,  1,  2,  2,  3,  0,  // Front
+    4,  5,  6,  6,  7,  4,  // Back
+    8,  9,  10, 10, 11, 8,  // Left
+    12, 13, 14, 14, 15, 12, // Right
+    16, 17, 18, 18, 19, 16, // Top
+    20, 21, 22, 22, 23, 20  // Bottom
+};
+} // namespace examples::fundamentals::model_loading::gltf_hiz_culling
+
+namespace common::utility
+{
+template<>
+inline std::vector<examples::fundamentals::model_loading::gltf_hiz_culling::VertexPos3Norm3> GltfMesh::GetVerticesAs()
+{
+    std::vector<examples::fundamentals::model_loading::gltf_hiz_culling::VertexPos3Norm3> result;
+    for (const auto& vertex: Vertices) {
+        examples::fundamentals::model_loading::gltf_hiz_culling::VertexPos3Norm3 current{};
+        current.Position.data.X = vertex.Position.x;
+        current.Position.data.Y = vertex.Position.y;
+        current.Position.data.Z = vertex.Position.z;
+        current.Normal.data.X = vertex.Normal.x;
+        current.Normal.data.Y = vertex.Normal.y;
+        current.Normal.data.Z = vertex.Normal.z;
+        result.push_back(current);
+    }
+
+    return result;
+}
+} // namespace common::utility
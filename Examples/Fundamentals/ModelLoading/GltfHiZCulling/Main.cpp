@@ -0,0 +1,122 @@
+/**
+ * @file    Main.cpp
+ * @brief   In this example, glTF model instances behind walls are culled with a two-phase hierarchical-Z occlusion
+ *          test in a compute shader, using a depth pyramid that is built from the early depth of the frame.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "AppConfig.h"
+#include "ShaderLoader.h"
+#include "VulkanApplication.h"
+#include "Window.h"
+
+using namespace common::utility;
+using namespace common::window_wrapper;
+using namespace common::vulkan_framework;
+using namespace examples::fundamentals::model_loading::gltf_hiz_culling;
+
+inline ParameterSchema CreateParameterSchema()
+{
+    ParameterSchema schema;
+    SetCommonParamSchema(schema);
+
+    // Register Constants
+    schema.RegisterImmutableParam<std::uint32_t>(AppConstants::MaxFramesInFlight, 2);
+    schema.RegisterImmutableParam<ShaderBaseType>(AppConstants::BaseShaderType, ShaderBaseType::GLSL);
+    schema.RegisterImmutableParam<std::string>(AppConstants::MainVertexShaderFile, "drawing_culled_objects.vert.spv");
+    schema.RegisterImmutableParam<std::string>(AppConstants::MainFragmentShaderFile, "drawing_culled_objects.frag.spv");
+    schema.RegisterImmutableParam<std::string>(AppConstants::CullingComputeShaderFile, "occlusion_culling.comp.spv");
+    schema.RegisterImmutableParam<std::string>(AppConstants::DepthReduceComputeShaderFile, "depth_reduce.comp.spv");
+    schema.RegisterImmutableParam<std::string>(AppConstants::MainVertexShaderKey, "vertMain");
+    schema.RegisterImmutableParam<std::string>(AppConstants::MainFragmentShaderKey, "fragMain");
+    schema.RegisterImmutableParam<std::string>(AppConstants::CullingComputeShaderKey, "compCulling");
+    schema.RegisterImmutableParam<std::string>(AppConstants::DepthReduceComputeShaderKey, "compDepthReduce");
+
+    schema.RegisterImmutableParam<std::string>(AppConstants::DepthImage, "depthImage");
+    schema.RegisterImmutableParam<std::string>(AppConstants::DepthImageView, "depthImageView");
+    schema.RegisterImmutableParam<std::string>(AppConstants::DepthPyramidImage, "depthPyramidImage");
+    schema.RegisterImmutableParam<std::string>(AppConstants::DepthPyramidView, "depthPyramidView");
+    schema.RegisterImmutableParam<std::string>(AppConstants::DepthPyramidLevelView, "depthPyramidLevelView");
+    schema.RegisterImmutableParam<std::string>(AppConstants::DepthSampler, "depthSampler");
+    schema.RegisterImmutableParam<std::string>(AppConstants::DepthPyramidSampler, "depthPyramidSampler");
+    schema.RegisterImmutableParam<std::string>(AppConstants::LanternModelPath, "Models/Lantern.glb");
+    schema.RegisterImmutableParam<std::string>(AppConstants::CullingDescSetLayout, "cullingDescSetLayout");
+    schema.RegisterImmutableParam<std::string>(AppConstants::DepthReduceDescSetLayout, "depthReduceDescSetLayout");
+    schema.RegisterImmutableParam<std::string>(AppConstants::DepthReduceDescSet, "depthReduceDescSet");
+    schema.RegisterImmutableParam<std::string>(AppConstants::MeshVertexBuffer, "meshVertexBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::MeshIndexBuffer, "meshIndexBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::ObjectIndexBuffer, "objectIndexBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::CullObjectBuffer, "cullObjectBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::UploadStagingBuffer, "uploadStagingBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::VisibilityBuffer, "visibilityBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::DrawCommandBuffer, "drawCommandBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::CullingStatsBuffer, "cullingStatsBuffer");
+    schema.RegisterImmutableParam<std::string>(AppConstants::CullingStatsReadbackBuffer, "cullingStatsReadbackBuffer");
+
+    // Register Customizable Settings
+    schema.RegisterParam<VkClearColorValue>(AppSettings::ClearColor);
+    schema.RegisterParam<float>(AppSettings::MouseSensitivity);
+    schema.RegisterParam<float>(AppSettings::CameraSpeed);
+    schema.RegisterParam<std::uint32_t>(AppSettings::InstanceCount, 4096);
+    schema.RegisterParam<float>(AppSettings::InstanceSpacing, 2.0f);
+    schema.RegisterParam<std::uint32_t>(AppSettings::WallRowInterval, 4);
+    schema.RegisterParam<bool>(AppSettings::UseDrawCount, true);
+    schema.RegisterParam<bool>(AppSettings::UseMinMaxSampler, true);
+    schema.RegisterParam<bool>(AppSettings::PrintCullingStats, true);
+
+    return schema;
+}
+
+bool SetParams(ParameterServer& params)
+{
+    try {
+        // Initial window settings
+        params.Set<std::uint32_t>(WindowParams::Width, 800);
+        params.Set<std::uint32_t>(WindowParams::Height, 600);
+        params.Set(WindowParams::Title, std::string(EXAMPLE_APPLICATION_NAME));
+
+        // Vulkan settings
+        params.Set<std::string>(VulkanParams::ApplicationName, params.Get<std::string>(WindowParams::Title));
+        params.Set<std::vector<std::string>>(VulkanParams::InstanceLayers, {"VK_LAYER_KHRONOS_validation"});
+
+        // Project customizable settings
+        params.Set(AppSettings::ClearColor, VkClearColorValue{0.0f, 0.3f, 0.3f, 1.0f});
+        params.Set(AppSettings::MouseSensitivity, 2.2f);
+        params.Set(AppSettings::CameraSpeed, 2.2f);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return false;
+    }
+
+    return true;
+}
+
+int main()
+{
+    ParameterServer params{CreateParameterSchema()};
+    if (!SetParams(params)) {
+        std::cerr << "Failed to set parameters!" << std::endl;
+        return -1;
+    }
+
+    // Create a window
+    const auto window = std::make_shared<Window>(params.Get<std::string>(WindowParams::Title));
+    if (!window->Init(params.Get<std::uint32_t>(WindowParams::Width), params.Get<std::uint32_t>(WindowParams::Height),
+                      params.Get<bool>(WindowParams::Resizable), params.Get<unsigned int>(WindowParams::SampleCount))) {
+        std::cerr << "Failed to initialize window." << std::endl;
+        return -1;
+    }
+    params.Set<std::vector<std::string>>(VulkanParams::InstanceExtensions, Window::GetVulkanInstanceExtensions());
+
+    // Init Vulkan application
+    VulkanApplication app{std::move(params)};
+    app.SetWindow(window);
+    app.Run();
+
+    return 0;
+}
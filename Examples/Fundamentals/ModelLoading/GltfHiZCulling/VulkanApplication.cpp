@@ -0,0 +1,1083 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "VulkanApplication.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+
+#include "AppConfig.h"
+#include "ApplicationData.h"
+#include "FrustumCulling.h"
+#include "VulkanHelpers.h"
+#include "VulkanShaderModule.h"
+
+namespace examples::fundamentals::model_loading::gltf_hiz_culling
+{
+using namespace common::utility;
+using namespace common::vulkan_wrapper;
+using namespace common::vulkan_framework;
+using namespace common::window_wrapper;
+
+VulkanApplication::VulkanApplication(ParameterServer&& params) : ApplicationModelLoading(std::move(params)) {}
+
+bool VulkanApplication::Init()
+{
+    try {
+        ResolveParamKeys();
+
+        printCullingStats_ = params_.Get<bool>(AppSettings::PrintCullingStats);
+
+        currentWindowWidth_ = GetParamU32(WindowParams::Width);
+        currentWindowHeight_ = GetParamU32(WindowParams::Height);
+
+        float aspectRatio = static_cast<float>(currentWindowWidth_) / static_cast<float>(currentWindowHeight_);
+        camera_ = std::make_unique<PerspectiveCamera>(glm::vec3(0.0f, 1.5f, 6.0f), aspectRatio);
+
+        InitInputSystem();
+
+        CreateDefaultSurface();
+        SelectDefaultPhysicalDevice();
+        CreateLogicalDevice();
+        CreateDefaultQueue();
+        CreateDefaultSwapChain();
+        CreateDefaultCommandPool();
+        CreateDefaultSyncObjects(GetParamU32(AppConstants::MaxFramesInFlight));
+
+        CreateResources();
+        InitResources();
+
+        CreateRenderPasses();
+        CreatePipeline();
+        CreateComputePipelines();
+        CreateDefaultFramebuffers(resources_->GetImageView(GetParamStr(AppConstants::DepthImage),
+                                                           GetParamStr(AppConstants::DepthImageView)));
+        CreateCommandBuffers();
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return false;
+    }
+
+    return true;
+}
+
+void VulkanApplication::DrawFrame()
+{
+    inFlightFences_[currentIndex_]->WaitForFence(true, UINT64_MAX);
+    inFlightFences_[currentIndex_]->ResetFence();
+
+    uint32_t imageIndex = swapChain_->AcquireNextImage(imageAvailableSemaphores_[currentIndex_], nullptr);
+
+    // Previous submission of this image must be finished, before its statistics are read and it is recorded again
+    if (swapImagesFences_[imageIndex] != nullptr) {
+        swapImagesFences_[imageIndex]->WaitForFence(true, UINT64_MAX);
+        PrintCullingStats(imageIndex);
+    }
+
+    swapImagesFences_[imageIndex] = inFlightFences_[currentIndex_];
+
+    // Only the view-projection matrix is sent every frame, the CPU doesn't touch the objects
+    cullingPushConstants_.ViewProjection = camera_->GetProjectionMatrix() * camera_->GetViewMatrix();
+
+    RecordPresentCommandBuffers(imageIndex);
+
+    queue_->Submit({cmdBuffersPresent_[imageIndex]}, {imageAvailableSemaphores_[currentIndex_]},
+                   {renderFinishedSemaphores_[imageIndex]}, inFlightFences_[currentIndex_],
+                   {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT});
+
+    queue_->Present({swapChain_}, {imageIndex}, {renderFinishedSemaphores_[imageIndex]});
+
+    currentIndex_ = (currentIndex_ + 1) % GetParam(maxFramesInFlightKey_);
+}
+
+void VulkanApplication::PreUpdate()
+{
+    // Poll events
+    ApplicationModelLoading::PreUpdate();
+
+    // Process continuous inputs
+    ProcessInput();
+}
+
+void VulkanApplication::InitInputSystem()
+{
+    lastX_ = static_cast<float>(currentWindowWidth_) / 2.0f;
+    lastY_ = static_cast<float>(currentWindowHeight_) / 2.0f;
+
+    window_->DisableCursor();
+
+    window_->OnMouseMove([&](const MouseMoveEvent& event) {
+        const auto xPos = static_cast<float>(event.X);
+        const auto yPos = static_cast<float>(event.Y);
+
+        if (firstMouseTriggered_) {
+            lastX_ = xPos;
+            lastY_ = yPos;
+            firstMouseTriggered_ = false;
+        }
+
+        float xOffset = xPos - lastX_;
+        float yOffset = lastY_ - yPos;
+        lastX_ = xPos;
+        lastY_ = yPos;
+
+        const float sensitivity = GetParam(mouseSensitivityKey_) * static_cast<float>(deltaTime_);
+        xOffset *= sensitivity;
+        yOffset *= sensitivity;
+
+        camera_->Rotate(xOffset, yOffset);
+    });
+}
+
+void VulkanApplication::CreateLogicalDevice()
+{
+    // Every draw command selects its object with firstInstance. Multi draw and draw count are optional, without them
+    // the commands are drawn one by one or culled commands are kept with zero instances.
+    const auto supportedFeatures = physicalDevice_->GetSupportedFeatures();
+    if (!supportedFeatures.drawIndirectFirstInstance) {
+        throw std::runtime_error("Device doesn't support drawIndirectFirstInstance feature!");
+    }
+    isMultiDrawIndirectSupported_ = supportedFeatures.multiDrawIndirect;
+    isDrawCountSupported_ = physicalDevice_->IsExtensionSupported(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+    useDrawCount_ = isDrawCountSupported_ && params_.Get<bool>(AppSettings::UseDrawCount);
+
+    // MAX reduction sampler reads the farthest depth of a 2x2 footprint with one fetch, it needs the extension and
+    // the minmax filter feature of the pyramid format. Otherwise the shaders fetch and compare the texels themselves.
+    const auto pyramidFormatProperties = physicalDevice_->GetFormatProperties(depthPyramidFormat_);
+    if (!(pyramidFormatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT)) {
+        throw std::runtime_error("Depth pyramid format doesn't support storage image usage!");
+    }
+    isMinMaxSamplerSupported_ =
+            physicalDevice_->IsExtensionSupported(VK_EXT_SAMPLER_FILTER_MINMAX_EXTENSION_NAME) &&
+            (pyramidFormatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_MINMAX_BIT_EXT);
+    useMinMaxSampler_ = isMinMaxSamplerSupported_ && params_.Get<bool>(AppSettings::UseMinMaxSampler);
+
+    std::vector<std::string> extensions = {VK_KHR_SWAPCHAIN_EXTENSION_NAME};
+    if (isDrawCountSupported_) {
+        extensions.emplace_back(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+    }
+    if (isMinMaxSamplerSupported_) {
+        extensions.emplace_back(VK_EXT_SAMPLER_FILTER_MINMAX_EXTENSION_NAME);
+    }
+
+    VkPhysicalDeviceFeatures deviceFeatures{};
+    deviceFeatures.drawIndirectFirstInstance = VK_TRUE;
+    deviceFeatures.multiDrawIndirect = isMultiDrawIndirectSupported_ ? VK_TRUE : VK_FALSE;
+
+    std::vector queuePriorities = {1.0f};
+
+    device_ = physicalDevice_->CreateDevice([&](auto& builder) {
+        builder.AddLayer("VK_LAYER_KHRONOS_validation")
+                .AddExtensions(extensions)
+                .AddQueueInfo([&](auto& queueInfo) {
+                    queueInfo.queueFamilyIndex = currentQueueFamilyIndex_;
+                    queueInfo.queueCount = 1;
+                    queueInfo.pQueuePriorities = queuePriorities.data();
+                })
+                .SetDeviceFeatures(deviceFeatures);
+    });
+
+    if (!device_) {
+        throw std::runtime_error("Failed to create logical device!");
+    }
+}
+
+void VulkanApplication::CollectObjects()
+{
+    // Meshes and the wall box are packed into one vertex and index buffer, so one indirect draw call can draw all
+    struct MeshRange
+    {
+        std::uint32_t IndexCount;
+        std::uint32_t FirstIndex;
+        std::int32_t VertexOffset;
+    };
+    const auto appendMesh = [&](const std::vector<VertexPos3Norm3>& vertices, const std::vector<uint16_t>& indices) {
+        const MeshRange range{static_cast<std::uint32_t>(indices.size()),
+                              static_cast<std::uint32_t>(meshIndices_.size()),
+                              static_cast<std::int32_t>(meshVertices_.size())};
+        meshVertices_.insert(meshVertices_.end(), vertices.begin(), vertices.end());
+        meshIndices_.insert(meshIndices_.end(), indices.begin(), indices.end());
+        return range;
+    };
+    const auto appendObject = [&](const glm::mat4& model, const glm::vec3& localMin, const glm::vec3& localMax,
+                                  const MeshRange& range) {
+        CullObject object{};
+        object.Model = model;
+        glm::vec3 boundsMin, boundsMax;
+        TransformBounds(localMin, localMax, model, boundsMin, boundsMax);
+        object.BoundsCenter = glm::vec4((boundsMin + boundsMax) * 0.5f, 0.0f);
+        object.BoundsExtent = glm::vec4((boundsMax - boundsMin) * 0.5f, 0.0f);
+        object.IndexCount = range.IndexCount;
+        object.FirstIndex = range.FirstIndex;
+        object.VertexOffset = range.VertexOffset;
+        cullObjects_.push_back(object);
+    };
+
+    std::vector<MeshRange> meshRanges;
+    for (auto& mesh: lanternModel_->Meshes) {
+        meshRanges.push_back(appendMesh(mesh.GetVerticesAs<VertexPos3Norm3>(), mesh.Indices));
+    }
+    const MeshRange wallRange = appendMesh(wallVertices, wallIndices);
+
+    // Instances are placed on a grid, every mesh node of every instance is an object with its own world bounds
+    const auto instanceCount = GetParamU32(AppSettings::InstanceCount);
+    const auto spacing = GetParamFloat(AppSettings::InstanceSpacing);
+    const auto gridSize = static_cast<std::uint32_t>(std::ceil(std::sqrt(static_cast<float>(instanceCount))));
+    const float gridWidth = static_cast<float>(gridSize) * spacing;
+    const glm::mat4 modelScale = glm::scale(glm::mat4(1.0f), glm::vec3(0.1f));
+    for (std::uint32_t instance = 0; instance < instanceCount; ++instance) {
+        const float x = (static_cast<float>(instance % gridSize) - static_cast<float>(gridSize - 1) / 2.0f) * spacing;
+        const float z = -static_cast<float>(instance / gridSize) * spacing;
+        const glm::mat4 instanceTransform = glm::translate(glm::mat4(1.0f), glm::vec3(x, 0.0f, z)) * modelScale;
+
+        for (const auto& node: lanternModel_->Nodes) {
+            if (node.MeshIndex >= meshRanges.size()) {
+                continue;
+            }
+
+            const auto& mesh = lanternModel_->Meshes[node.MeshIndex];
+            appendObject(instanceTransform * node.WorldTransform, mesh.BoundsMin, mesh.BoundsMax,
+                         meshRanges[node.MeshIndex]);
+        }
+    }
+
+    // Walls between the rows are the occluders, everything behind them is rejected by the late pass
+    const auto wallRowInterval = GetParamU32(AppSettings::WallRowInterval);
+    const auto rowCount = (instanceCount + gridSize - 1) / std::max(gridSize, 1u);
+    for (std::uint32_t row = wallRowInterval; wallRowInterval > 0 && row < rowCount; row += wallRowInterval) {
+        const float z = -(static_cast<float>(row) - 0.5f) * spacing;
+        const glm::mat4 model = glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 1.5f, z)),
+                                           glm::vec3(gridWidth, 3.0f, 0.2f));
+        appendObject(model, glm::vec3(-0.5f), glm::vec3(0.5f), wallRange);
+    }
+
+    if (cullObjects_.empty()) {
+        throw std::runtime_error("There is no object to draw!");
+    }
+    objectCount_ = static_cast<std::uint32_t>(cullObjects_.size());
+}
+
+void VulkanApplication::CreateResources()
+{
+    // Depth buffer is sampled by the first reduction pass of the depth pyramid
+    depthImageFormat_ = physicalDevice_->FindSupportedFormat(
+            {VK_FORMAT_D32_SFLOAT, VK_FORMAT_D16_UNORM},
+            VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT);
+
+    // Load models
+    ModelLoader modelLoader{ASSETS_DIR};
+    lanternModel_ = modelLoader.LoadBinaryGltfFromFile(GetParamStr(AppConstants::LanternModelPath));
+    if (!lanternModel_) {
+        throw std::runtime_error("Failed to load lantern model!");
+    }
+
+    CollectObjects();
+
+    const auto limits = physicalDevice_->GetProperties().limits;
+    if (!isMultiDrawIndirectSupported_ && !useDrawCount_) {
+        std::cout << "multiDrawIndirect is not supported, draw commands are recorded one by one" << std::endl;
+    } else if (objectCount_ > limits.maxDrawIndirectCount) {
+        throw std::runtime_error("Object count is larger than maxDrawIndirectCount!");
+    }
+
+    // First level of the pyramid is the largest power of two size which is not larger than the depth buffer, so all
+    // the following levels are exactly half of the previous one
+    pyramidWidth_ = std::bit_floor(currentWindowWidth_);
+    pyramidHeight_ = std::bit_floor(currentWindowHeight_);
+    pyramidLevelCount_ = std::bit_width(std::max(pyramidWidth_, pyramidHeight_));
+    std::cout << "HiZ culling of " << objectCount_ << " objects, depth pyramid " << pyramidWidth_ << "x"
+              << pyramidHeight_ << " (" << pyramidLevelCount_ << " levels), "
+              << (useMinMaxSampler_ ? "MAX reduction sampler" : "manual 2x2 reduction") << ", "
+              << (useDrawCount_ ? "vkCmdDrawIndexedIndirectCountKHR" : "culled commands with zero instances")
+              << std::endl;
+
+    const auto vertexSize = static_cast<std::uint32_t>(meshVertices_.size() * sizeof(VertexPos3Norm3));
+    const auto indexSize = static_cast<std::uint32_t>(meshIndices_.size() * sizeof(std::uint16_t));
+    const auto objectIndexSize = static_cast<std::uint32_t>(objectCount_ * sizeof(ObjectIndexData));
+    const auto objectSize = static_cast<std::uint32_t>(cullObjects_.size() * sizeof(CullObject));
+    const auto visibilitySize = static_cast<std::uint32_t>(objectCount_ * sizeof(std::uint32_t));
+    const auto commandSize = static_cast<std::uint32_t>(2 * objectCount_ * sizeof(VkDrawIndexedIndirectCommand));
+    const auto readbackSize = static_cast<std::uint32_t>(swapChainImageViews_.size() * sizeof(CullingStats));
+
+    ResourceDescriptor resourceCreateInfo;
+
+    // Objects don't change, so they are copied to device local memory once. Visibility of the last frame, draw
+    // commands of both phases and the counters are written and read only by the GPU.
+    resourceCreateInfo.Buffers = {
+        {GetParamStr(AppConstants::MeshVertexBuffer), vertexSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT},
+        {GetParamStr(AppConstants::MeshIndexBuffer), indexSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT},
+        {GetParamStr(AppConstants::ObjectIndexBuffer), objectIndexSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT},
+        {GetParamStr(AppConstants::CullObjectBuffer), objectSize,
+         VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT},
+        {GetParamStr(AppConstants::UploadStagingBuffer), objectSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT},
+        {GetParamStr(AppConstants::VisibilityBuffer), visibilitySize,
+         VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT},
+        {GetParamStr(AppConstants::DrawCommandBuffer), commandSize,
+         VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT},
+        {GetParamStr(AppConstants::CullingStatsBuffer), sizeof(CullingStats),
+         VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+                 VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+         VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT},
+        {GetParamStr(AppConstants::CullingStatsReadbackBuffer), readbackSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT}};
+
+    // Fill shader module create infos
+    resourceCreateInfo.Shaders = {.BasePath = SHADERS_DIR,
+                                  .ShaderType = params_.Get<ShaderBaseType>(AppConstants::BaseShaderType),
+                                  .Modules = {{.Name = GetParamStr(AppConstants::MainVertexShaderKey),
+                                               .FileName = GetParamStr(AppConstants::MainVertexShaderFile)},
+                                              {.Name = GetParamStr(AppConstants::MainFragmentShaderKey),
+                                               .FileName = GetParamStr(AppConstants::MainFragmentShaderFile)},
+                                              {.Name = GetParamStr(AppConstants::CullingComputeShaderKey),
+                                               .FileName = GetParamStr(AppConstants::CullingComputeShaderFile)},
+                                              {.Name = GetParamStr(AppConstants::DepthReduceComputeShaderKey),
+                                               .FileName = GetParamStr(AppConstants::DepthReduceComputeShaderFile)}}};
+
+    // Depth buffer is read texel by texel, pyramid levels are read with the MAX reduction sampler if it's supported
+    resourceCreateInfo.Samplers = {
+        {.Name = GetParamStr(AppConstants::DepthSampler),
+         .AddressModes = {.U = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
+                          .V = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
+                          .W = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE}},
+        {.Name = GetParamStr(AppConstants::DepthPyramidSampler),
+         .FilteringBehavior = {.MagFilter = useMinMaxSampler_ ? VK_FILTER_LINEAR : VK_FILTER_NEAREST,
+                               .MinFilter = useMinMaxSampler_ ? VK_FILTER_LINEAR : VK_FILTER_NEAREST,
+                               .MipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST,
+                               .ReductionMode = useMinMaxSampler_ ? VK_SAMPLER_REDUCTION_MODE_MAX_EXT
+                                                                  : VK_SAMPLER_REDUCTION_MODE_WEIGHTED_AVERAGE_EXT},
+         .AddressModes = {.U = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
+                          .V = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
+                          .W = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE},
+         .Lod = {.MaxLod = static_cast<float>(pyramidLevelCount_)}}};
+
+    // One reduction set per pyramid level: previous level (or the depth buffer) as source, current level as target
+    std::vector<DescriptorResourceCreateInfo::DescriptorSet> descriptorSets = {
+        {.Name = GetParamStr(AppConstants::CullingDescSetLayout),
+         .LayoutName = GetParamStr(AppConstants::CullingDescSetLayout)}};
+    for (std::uint32_t level = 0; level < pyramidLevelCount_; ++level) {
+        descriptorSets.push_back({.Name = GetParamStr(AppConstants::DepthReduceDescSet) + std::to_string(level),
+                                  .LayoutName = GetParamStr(AppConstants::DepthReduceDescSetLayout)});
+    }
+
+    resourceCreateInfo.Descriptors = {
+        .MaxSets = 1 + pyramidLevelCount_,
+        .PoolSizes = {{VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 4},
+                      {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1 + pyramidLevelCount_},
+                      {VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, pyramidLevelCount_}},
+        .Layouts = {{.Name = GetParamStr(AppConstants::CullingDescSetLayout),
+                     .Bindings = {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1,
+                                   VK_SHADER_STAGE_COMPUTE_BIT | VK_SHADER_STAGE_VERTEX_BIT, nullptr},
+                                  {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+                                  {2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+                                  {3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+                                  {4, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_COMPUTE_BIT,
+                                   nullptr}}},
+                    {.Name = GetParamStr(AppConstants::DepthReduceDescSetLayout),
+                     .Bindings = {{0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_COMPUTE_BIT,
+                                   nullptr},
+                                  {1, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}}}},
+        .DescriptorSets = descriptorSets};
+
+    std::vector<ImageViewCreateInfo> pyramidViews = {
+        {.ViewName = GetParamStr(AppConstants::DepthPyramidView),
+         .Format = depthPyramidFormat_,
+         .SubresourceRange = {.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                              .baseMipLevel = 0,
+                              .levelCount = pyramidLevelCount_,
+                              .baseArrayLayer = 0,
+                              .layerCount = 1}}};
+    for (std::uint32_t level = 0; level < pyramidLevelCount_; ++level) {
+        pyramidViews.push_back({.ViewName = GetParamStr(AppConstants::DepthPyramidLevelView) + std::to_string(level),
+                                .Format = depthPyramidFormat_,
+                                .SubresourceRange = {.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                                                     .baseMipLevel = level,
+                                                     .levelCount = 1,
+                                                     .baseArrayLayer = 0,
+                                                     .layerCount = 1}});
+    }
+
+    resourceCreateInfo.Images = {
+        ImageResourceCreateInfo{
+            .Name = GetParamStr(AppConstants::DepthImage),
+            .MemProperties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+            .Format = depthImageFormat_,
+            .Dimensions = {currentWindowWidth_, currentWindowHeight_, 1},
+            .UsageFlags = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+            .Views = {ImageViewCreateInfo{.ViewName = GetParamStr(AppConstants::DepthImageView),
+                                          .Format = depthImageFormat_,
+                                          .SubresourceRange = {.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT,
+                                                               .baseMipLevel = 0,
+                                                               .levelCount = 1,
+                                                               .baseArrayLayer = 0,
+                                                               .layerCount = 1}}}},
+        ImageResourceCreateInfo{.Name = GetParamStr(AppConstants::DepthPyramidImage),
+                                .MemProperties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                                .Format = depthPyramidFormat_,
+                                .Dimensions = {pyramidWidth_, pyramidHeight_, 1},
+                                .MipLevels = pyramidLevelCount_,
+                                .UsageFlags = VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+                                .Views = pyramidViews}};
+
+    CreateVulkanResources(resourceCreateInfo);
+
+    // Resolve handles once, draw loop doesn't look up resources by name
+    meshVertexBuffer_ = resources_->GetBufferHandle(GetParamStr(AppConstants::MeshVertexBuffer));
+    meshIndexBuffer_ = resources_->GetBufferHandle(GetParamStr(AppConstants::MeshIndexBuffer));
+    objectIndexBuffer_ = resources_->GetBufferHandle(GetParamStr(AppConstants::ObjectIndexBuffer));
+    visibilityBuffer_ = resources_->GetBufferHandle(GetParamStr(AppConstants::VisibilityBuffer));
+    drawCommandBuffer_ = resources_->GetBufferHandle(GetParamStr(AppConstants::DrawCommandBuffer));
+    statsBuffer_ = resources_->GetBufferHandle(GetParamStr(AppConstants::CullingStatsBuffer));
+    statsReadbackBuffer_ = resources_->GetBufferHandle(GetParamStr(AppConstants::CullingStatsReadbackBuffer));
+    depthImage_ = resources_->GetImageHandle(GetParamStr(AppConstants::DepthImage));
+    depthPyramidImage_ = resources_->GetImageHandle(GetParamStr(AppConstants::DepthPyramidImage));
+    cullingDescSet_ = resources_->GetDescriptorSetHandle(GetParamStr(AppConstants::CullingDescSetLayout));
+    for (std::uint32_t level = 0; level < pyramidLevelCount_; ++level) {
+        depthReduceDescSets_.push_back(resources_->GetDescriptorSetHandle(
+                GetParamStr(AppConstants::DepthReduceDescSet) + std::to_string(level)));
+    }
+
+    cullingPushConstants_.PyramidSize =
+            glm::vec2(static_cast<float>(pyramidWidth_), static_cast<float>(pyramidHeight_));
+    cullingPushConstants_.PyramidLevelCount = pyramidLevelCount_;
+    cullingPushConstants_.ObjectCount = objectCount_;
+    cullingPushConstants_.CompactDraws = useDrawCount_ ? 1 : 0;
+    cullingPushConstants_.UseMinMaxSampler = useMinMaxSampler_ ? 1 : 0;
+}
+
+void VulkanApplication::InitResources()
+{
+    std::vector<ObjectIndexData> objectIndices(objectCount_);
+    for (std::uint32_t i = 0; i < objectCount_; ++i) {
+        objectIndices[i].ObjectIndex.data = i;
+    }
+
+    resources_->SetBuffer(meshVertexBuffer_, meshVertices_.data(), meshVertices_.size() * sizeof(VertexPos3Norm3));
+    resources_->SetBuffer(meshIndexBuffer_, meshIndices_.data(), meshIndices_.size() * sizeof(std::uint16_t));
+    resources_->SetBuffer(objectIndexBuffer_, objectIndices.data(), objectIndices.size() * sizeof(ObjectIndexData));
+
+    const auto objectSize = cullObjects_.size() * sizeof(CullObject);
+    const auto& stagingBufferName = GetParamStr(AppConstants::UploadStagingBuffer);
+    resources_->UpdateBuffer(stagingBufferName, cullObjects_.data(), objectSize, 0);
+
+    const auto cmdBufferTransfer = cmdPool_->CreateCommandBuffers(1, VK_COMMAND_BUFFER_LEVEL_PRIMARY).front();
+    if (!cmdBufferTransfer->BeginCommandBuffer(
+                [](auto& beginInfo) { beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT; })) {
+        throw std::runtime_error("Failed to begin recording command buffer!");
+    }
+
+    cmdBufferTransfer->CopyBuffer(resources_->GetBuffer(stagingBufferName),
+                                  resources_->GetBuffer(GetParamStr(AppConstants::CullObjectBuffer)),
+                                  {VkBufferCopy{0, 0, objectSize}});
+
+    // Nothing was visible before the first frame, so its early pass draws nothing and the late pass draws everything
+    // which is inside the frustum
+    cmdBufferTransfer->FillBuffer(resources_->GetBuffer(visibilityBuffer_), 0, VK_WHOLE_SIZE, 0);
+
+    // Pyramid is written as a storage image and sampled in the same (general) layout
+    const auto pyramidBarrier = resources_->GetImage(depthPyramidImage_)->CreateImageMemoryBarrier(
+            0, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT, VK_IMAGE_LAYOUT_UNDEFINED,
+            VK_IMAGE_LAYOUT_GENERAL, VkImageSubresourceRange{VK_IMAGE_ASPECT_COLOR_BIT, 0, pyramidLevelCount_, 0, 1});
+    cmdBufferTransfer->PipelineBarrier(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                       {pyramidBarrier});
+
+    if (!cmdBufferTransfer->EndCommandBuffer()) {
+        throw std::runtime_error("Failed to end recording command buffer!");
+    }
+
+    // Directly submit this command buffer to queue, staging buffer isn't needed after the copy
+    queue_->Submit({cmdBufferTransfer});
+    queue_->WaitIdle();
+    resources_->DeleteBuffer(stagingBufferName);
+
+    UpdateDescriptorSets();
+}
+
+void VulkanApplication::UpdateDescriptorSets() const
+{
+    const std::array bufferNames{
+        GetParamStr(AppConstants::CullObjectBuffer), GetParamStr(AppConstants::DrawCommandBuffer),
+        GetParamStr(AppConstants::CullingStatsBuffer), GetParamStr(AppConstants::VisibilityBuffer)};
+
+    DescriptorUpdateInfo descriptorSetUpdateInfo;
+    for (std::uint32_t binding = 0; binding < bufferNames.size(); ++binding) {
+        BufferWriteRequest bufferUpdateRequest;
+        bufferUpdateRequest.LayoutName = GetParamStr(AppConstants::CullingDescSetLayout);
+        bufferUpdateRequest.BindingIndex = binding;
+        bufferUpdateRequest.Buffers = {{resources_->GetBuffer(bufferNames[binding])->GetHandle(), 0, VK_WHOLE_SIZE}};
+        bufferUpdateRequest.Type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        descriptorSetUpdateInfo.BufferWriteRequests.push_back(bufferUpdateRequest);
+    }
+
+    const auto pyramidSampler = resources_->GetSampler(GetParamStr(AppConstants::DepthPyramidSampler))->GetHandle();
+    const auto& pyramidName = GetParamStr(AppConstants::DepthPyramidImage);
+
+    ImageWriteRequest pyramidUpdateRequest;
+    pyramidUpdateRequest.LayoutName = GetParamStr(AppConstants::CullingDescSetLayout);
+    pyramidUpdateRequest.BindingIndex = static_cast<std::uint32_t>(bufferNames.size());
+    pyramidUpdateRequest.Images = {
+            {pyramidSampler,
+             resources_->GetImageView(pyramidName, GetParamStr(AppConstants::DepthPyramidView))->GetHandle(),
+             VK_IMAGE_LAYOUT_GENERAL}};
+    pyramidUpdateRequest.Type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    descriptorSetUpdateInfo.ImageWriteRequests.push_back(pyramidUpdateRequest);
+
+    // First level reads the depth buffer, other levels read the previous level of the pyramid
+    for (std::uint32_t level = 0; level < pyramidLevelCount_; ++level) {
+        const auto setName = GetParamStr(AppConstants::DepthReduceDescSet) + std::to_string(level);
+
+        ImageWriteRequest sourceUpdateRequest;
+        sourceUpdateRequest.LayoutName = setName;
+        sourceUpdateRequest.BindingIndex = 0;
+        if (level == 0) {
+            sourceUpdateRequest.Images = {
+                {resources_->GetSampler(GetParamStr(AppConstants::DepthSampler))->GetHandle(),
+                 resources_
+                         ->GetImageView(GetParamStr(AppConstants::DepthImage),
+                                        GetParamStr(AppConstants::DepthImageView))
+                         ->GetHandle(),
+                 VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL}};
+        } else {
+            const auto sourceViewName = GetParamStr(AppConstants::DepthPyramidLevelView) + std::to_string(level - 1);
+            sourceUpdateRequest.Images = {{pyramidSampler,
+                                           resources_->GetImageView(pyramidName, sourceViewName)->GetHandle(),
+                                           VK_IMAGE_LAYOUT_GENERAL}};
+        }
+        sourceUpdateRequest.Type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        descriptorSetUpdateInfo.ImageWriteRequests.push_back(sourceUpdateRequest);
+
+        ImageWriteRequest targetUpdateRequest;
+        targetUpdateRequest.LayoutName = setName;
+        targetUpdateRequest.BindingIndex = 1;
+        targetUpdateRequest.Images = {
+                {VK_NULL_HANDLE,
+                 resources_
+                         ->GetImageView(pyramidName,
+                                        GetParamStr(AppConstants::DepthPyramidLevelView) + std::to_string(level))
+                         ->GetHandle(),
+                 VK_IMAGE_LAYOUT_GENERAL}};
+        targetUpdateRequest.Type = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+        descriptorSetUpdateInfo.ImageWriteRequests.push_back(targetUpdateRequest);
+    }
+
+    resources_->UpdateDescriptorSet(descriptorSetUpdateInfo);
+}
+
+void VulkanApplication::CreateRenderPasses()
+{
+    VkAttachmentReference colorAttachmentRef{0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+
+    VkAttachmentReference depthAttachmentRef{1, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL};
+
+    // Early pass clears the attachments and keeps them for the late pass, layout of the depth buffer is changed with
+    // barriers while the pyramid is built
+    renderPass_ = device_->CreateRenderPass([&](auto& builder) {
+        builder.AddAttachment([](auto& attachmentCreateInfo) {
+                   attachmentCreateInfo.format = VK_FORMAT_B8G8R8A8_SRGB;
+                   attachmentCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+                   attachmentCreateInfo.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+                   attachmentCreateInfo.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+                   attachmentCreateInfo.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+                   attachmentCreateInfo.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+                   attachmentCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+                   attachmentCreateInfo.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+               })
+                .AddAttachment([&](auto& attachmentCreateInfo) {
+                    attachmentCreateInfo.format = depthImageFormat_;
+                    attachmentCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+                    attachmentCreateInfo.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+                    attachmentCreateInfo.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+                    attachmentCreateInfo.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+                    attachmentCreateInfo.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+                    attachmentCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+                    attachmentCreateInfo.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+                })
+                .AddSubpass([&](auto& subpassCreateInfo) {
+                    subpassCreateInfo.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+                    subpassCreateInfo.colorAttachmentCount = 1;
+                    subpassCreateInfo.pColorAttachments = &colorAttachmentRef;
+                    subpassCreateInfo.pDepthStencilAttachment = &depthAttachmentRef;
+                });
+    });
+
+    if (!renderPass_) {
+        throw std::runtime_error("Failed to create render pass (early)!");
+    }
+
+    // Late pass is compatible with the early one, so the same framebuffers and pipeline are used
+    lateRenderPass_ = device_->CreateRenderPass([&](auto& builder) {
+        builder.AddAttachment([](auto& attachmentCreateInfo) {
+                   attachmentCreateInfo.format = VK_FORMAT_B8G8R8A8_SRGB;
+                   attachmentCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+                   attachmentCreateInfo.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+                   attachmentCreateInfo.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+                   attachmentCreateInfo.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+                   attachmentCreateInfo.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+                   attachmentCreateInfo.initialLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+                   attachmentCreateInfo.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+               })
+                .AddAttachment([&](auto& attachmentCreateInfo) {
+                    attachmentCreateInfo.format = depthImageFormat_;
+                    attachmentCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+                    attachmentCreateInfo.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+                    attachmentCreateInfo.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+                    attachmentCreateInfo.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+                    attachmentCreateInfo.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+                    attachmentCreateInfo.initialLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+                    attachmentCreateInfo.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+                })
+                .AddSubpass([&](auto& subpassCreateInfo) {
+                    subpassCreateInfo.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+                    subpassCreateInfo.colorAttachmentCount = 1;
+                    subpassCreateInfo.pColorAttachments = &colorAttachmentRef;
+                    subpassCreateInfo.pDepthStencilAttachment = &depthAttachmentRef;
+                });
+    });
+
+    if (!lateRenderPass_) {
+        throw std::runtime_error("Failed to create render pass (late)!");
+    }
+}
+
+void VulkanApplication::CreatePipeline()
+{
+    VkPushConstantRange viewProjectionPushConstant;
+    viewProjectionPushConstant.offset = 0;
+    viewProjectionPushConstant.size = sizeof(ViewProjectionData);
+    viewProjectionPushConstant.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+
+    pipelineLayout_ = device_->CreatePipelineLayout(
+            {resources_->GetDescriptorLayout(GetParamStr(AppConstants::CullingDescSetLayout))},
+            {viewProjectionPushConstant});
+
+    if (!pipelineLayout_) {
+        throw std::runtime_error("Failed to create pipeline layout!");
+    }
+
+    VkViewport viewport{0,    0,   static_cast<float>(currentWindowWidth_), static_cast<float>(currentWindowHeight_),
+                        0.0f, 1.0f};
+    VkRect2D scissor{0, 0, currentWindowWidth_, currentWindowHeight_};
+
+    VkPipelineColorBlendAttachmentState colorBlendAttachment;
+    colorBlendAttachment.blendEnable = VK_FALSE;
+    colorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.colorBlendOp = VK_BLEND_OP_ADD;
+    colorBlendAttachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+    colorBlendAttachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+    colorBlendAttachment.alphaBlendOp = VK_BLEND_OP_ADD;
+    colorBlendAttachment.colorWriteMask =
+            VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+
+    // Mesh vertices (binding 0) and the object index of the draw command (binding 1, advanced once per instance)
+    constexpr uint32_t vertexBindingIndex = 0;
+    constexpr uint32_t objectBindingIndex = 1;
+    const std::array bindingDescriptions{
+        GenerateBindingDescription<VertexPos3Norm3>(vertexBindingIndex),
+        GenerateBindingDescription<ObjectIndexData>(objectBindingIndex, VK_VERTEX_INPUT_RATE_INSTANCE)};
+    const std::array attributeDescriptions{
+        GenerateAttributeDescription(VertexPos3Norm3, Position, vertexBindingIndex),
+        GenerateAttributeDescription(VertexPos3Norm3, Normal, vertexBindingIndex),
+        GenerateAttributeDescription(ObjectIndexData, ObjectIndex, objectBindingIndex)};
+
+    pipeline_ = device_->CreateGraphicsPipeline(pipelineLayout_, renderPass_, [&](auto& builder) {
+        builder.AddShaderStage([&](auto& shaderStageCreateInfo) {
+            shaderStageCreateInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;
+            shaderStageCreateInfo.module =
+                    resources_->GetShaderModule(GetParamStr(AppConstants::MainVertexShaderKey))->GetHandle();
+        });
+        builder.AddShaderStage([&](auto& shaderStageCreateInfo) {
+            shaderStageCreateInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+            shaderStageCreateInfo.module =
+                    resources_->GetShaderModule(GetParamStr(AppConstants::MainFragmentShaderKey))->GetHandle();
+        });
+        builder.SetVertexInputState([&](auto& vertexInputStateCreateInfo) {
+            vertexInputStateCreateInfo.vertexBindingDescriptionCount = bindingDescriptions.size();
+            vertexInputStateCreateInfo.pVertexBindingDescriptions = bindingDescriptions.data();
+            vertexInputStateCreateInfo.vertexAttributeDescriptionCount = attributeDescriptions.size();
+            vertexInputStateCreateInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
+        });
+        builder.SetViewportState([&](auto& viewportStateCreateInfo) {
+            viewportStateCreateInfo.viewportCount = 1;
+            viewportStateCreateInfo.pViewports = &viewport;
+            viewportStateCreateInfo.scissorCount = 1;
+            viewportStateCreateInfo.pScissors = &scissor;
+        });
+        builder.SetColorBlendState([&](auto& blendStateCreateInfo) {
+            blendStateCreateInfo.attachmentCount = 1;
+            blendStateCreateInfo.pAttachments = &colorBlendAttachment;
+        });
+        builder.SetDepthStencilState([&](auto& depthStencilStateCreateInfo) {
+            depthStencilStateCreateInfo.depthTestEnable = VK_TRUE;
+            depthStencilStateCreateInfo.depthWriteEnable = VK_TRUE;
+            depthStencilStateCreateInfo.depthCompareOp = VK_COMPARE_OP_LESS;
+        });
+    });
+
+    if (!pipeline_) {
+        throw std::runtime_error("Failed to create graphics pipeline!");
+    }
+}
+
+void VulkanApplication::CreateComputePipelines()
+{
+    const auto queueFamilyProperties = physicalDevice_->GetQueueFamilyProperties();
+    if (!(queueFamilyProperties[currentQueueFamilyIndex_].queueFlags & VK_QUEUE_COMPUTE_BIT)) {
+        throw std::runtime_error("Selected queue family doesn't support compute operations!");
+    }
+
+    const VkPushConstantRange cullingPushConstantRange{VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(CullingPushConstants)};
+    cullingPipelineLayout_ = device_->CreatePipelineLayout(
+            {resources_->GetDescriptorLayout(GetParamStr(AppConstants::CullingDescSetLayout))},
+            {cullingPushConstantRange});
+
+    if (!cullingPipelineLayout_) {
+        throw std::runtime_error("Failed to create culling pipeline layout!");
+    }
+
+    cullingPipeline_ = device_->CreateComputePipeline(cullingPipelineLayout_, [&](auto& builder) {
+        builder.SetShaderStage([&](auto& shaderStageCreateInfo) {
+            shaderStageCreateInfo.module =
+                    resources_->GetShaderModule(GetParamStr(AppConstants::CullingComputeShaderKey))->GetHandle();
+        });
+    });
+
+    if (!cullingPipeline_) {
+        throw std::runtime_error("Failed to create culling pipeline!");
+    }
+
+    const VkPushConstantRange reducePushConstantRange{VK_SHADER_STAGE_COMPUTE_BIT, 0,
+                                                      sizeof(DepthReducePushConstants)};
+    depthReducePipelineLayout_ = device_->CreatePipelineLayout(
+            {resources_->GetDescriptorLayout(GetParamStr(AppConstants::DepthReduceDescSetLayout))},
+            {reducePushConstantRange});
+
+    if (!depthReducePipelineLayout_) {
+        throw std::runtime_error("Failed to create depth reduction pipeline layout!");
+    }
+
+    depthReducePipeline_ = device_->CreateComputePipeline(depthReducePipelineLayout_, [&](auto& builder) {
+        builder.SetShaderStage([&](auto& shaderStageCreateInfo) {
+            shaderStageCreateInfo.module =
+                    resources_->GetShaderModule(GetParamStr(AppConstants::DepthReduceComputeShaderKey))->GetHandle();
+        });
+    });
+
+    if (!depthReducePipeline_) {
+        throw std::runtime_error("Failed to create depth reduction pipeline!");
+    }
+}
+
+void VulkanApplication::CreateCommandBuffers()
+{
+    cmdBuffersPresent_ = cmdPool_->CreateCommandBuffers(framebuffers_.size(), VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+
+    if (cmdBuffersPresent_.empty()) {
+        throw std::runtime_error("Failed to create command buffers!");
+    }
+}
+
+void VulkanApplication::RecordPresentCommandBuffers(const std::uint32_t currentImageIndex)
+{
+    std::array<VkClearValue, 2> clearValues{};
+    clearValues[0].color = GetParam(clearColorKey_);
+    clearValues[1].depthStencil = {1.0f, 0};
+
+    const auto& currentCmdBuffer = cmdBuffersPresent_[currentImageIndex];
+
+    if (!currentCmdBuffer->BeginCommandBuffer(nullptr)) {
+        throw std::runtime_error("Failed to begin recording command buffer!");
+    }
+
+    // Early phase: objects which were visible in the last frame are drawn without an occlusion test
+    RecordCullingDispatch(currentCmdBuffer, earlyPhase);
+
+    currentCmdBuffer->BeginRenderPass(
+            [&](auto& beginInfo) {
+                beginInfo.renderPass = renderPass_->GetHandle();
+                beginInfo.framebuffer = framebuffers_[currentImageIndex]->GetHandle();
+                beginInfo.renderArea.offset = {0, 0};
+                beginInfo.renderArea.extent = VkExtent2D(currentWindowWidth_, currentWindowHeight_);
+                beginInfo.clearValueCount = clearValues.size();
+                beginInfo.pClearValues = clearValues.data();
+            },
+            VK_SUBPASS_CONTENTS_INLINE);
+    RecordIndirectDraws(currentCmdBuffer, earlyPhase);
+    currentCmdBuffer->EndRenderPass();
+
+    // Late phase: all objects are tested against the pyramid of the early depth, newly visible ones are drawn
+    RecordDepthPyramid(currentCmdBuffer);
+    RecordCullingDispatch(currentCmdBuffer, latePhase);
+
+    currentCmdBuffer->BeginRenderPass(
+            [&](auto& beginInfo) {
+                beginInfo.renderPass = lateRenderPass_->GetHandle();
+                beginInfo.framebuffer = framebuffers_[currentImageIndex]->GetHandle();
+                beginInfo.renderArea.offset = {0, 0};
+                beginInfo.renderArea.extent = VkExtent2D(currentWindowWidth_, currentWindowHeight_);
+                beginInfo.clearValueCount = 0;
+                beginInfo.pClearValues = nullptr;
+            },
+            VK_SUBPASS_CONTENTS_INLINE);
+    RecordIndirectDraws(currentCmdBuffer, latePhase);
+    currentCmdBuffer->EndRenderPass();
+
+    if (printCullingStats_) {
+        RecordStatsReadback(currentCmdBuffer, currentImageIndex);
+    }
+
+    if (!currentCmdBuffer->EndCommandBuffer()) {
+        throw std::runtime_error("Failed to end recording command buffer!");
+    }
+}
+
+void VulkanApplication::RecordCullingDispatch(const std::shared_ptr<VulkanCommandBuffer>& cmdBuffer,
+                                              const std::uint32_t phase)
+{
+    const auto commandBuffer = resources_->GetBuffer(drawCommandBuffer_);
+    const auto statsBuffer = resources_->GetBuffer(statsBuffer_);
+
+    VkBufferMemoryBarrier commandBarrier{};
+    commandBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    commandBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    commandBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    commandBarrier.buffer = commandBuffer->GetHandle();
+    commandBarrier.offset = 0;
+    commandBarrier.size = VK_WHOLE_SIZE;
+    VkBufferMemoryBarrier statsBarrier = commandBarrier;
+    statsBarrier.buffer = statsBuffer->GetHandle();
+    VkBufferMemoryBarrier visibilityBarrier = commandBarrier;
+    visibilityBarrier.buffer = resources_->GetBuffer(visibilityBuffer_)->GetHandle();
+
+    if (phase == earlyPhase) {
+        // Indirect reads and the readback of the previous frame must be finished before the commands and the counters
+        // are overwritten, visibility written by the previous late pass must be visible to this early pass
+        commandBarrier.srcAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+        commandBarrier.dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        statsBarrier.srcAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_TRANSFER_READ_BIT;
+        statsBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        visibilityBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        visibilityBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        cmdBuffer->PipelineBarrier(VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT |
+                                           VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                   VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, {},
+                                   {commandBarrier, statsBarrier, visibilityBarrier});
+
+        // Counters are reset once per frame, both phases append to them with atomic adds
+        cmdBuffer->FillBuffer(statsBuffer, 0, sizeof(CullingStats), 0);
+        statsBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        statsBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+        cmdBuffer->PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, {},
+                                   {statsBarrier});
+    } else {
+        // Visibility which was read by the early pass is overwritten by the late pass
+        visibilityBarrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        visibilityBarrier.dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        cmdBuffer->PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, {},
+                                   {visibilityBarrier});
+    }
+
+    // One invocation per object
+    cullingPushConstants_.Phase = phase;
+    cmdBuffer->BindPipeline(cullingPipeline_, VK_PIPELINE_BIND_POINT_COMPUTE);
+    const std::vector descSets{resources_->GetDescriptorSet(cullingDescSet_)};
+    cmdBuffer->BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, cullingPipelineLayout_, 0, descSets);
+    cmdBuffer->PushConstants(cullingPipelineLayout_, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(CullingPushConstants),
+                             &cullingPushConstants_);
+    cmdBuffer->Dispatch((objectCount_ + cullingGroupSize - 1) / cullingGroupSize, 1, 1);
+
+    // Commands and the counters must be written before they are read by the indirect draw
+    commandBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    commandBarrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+    statsBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    statsBarrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+    cmdBuffer->PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, {},
+                               {commandBarrier, statsBarrier});
+}
+
+void VulkanApplication::RecordIndirectDraws(const std::shared_ptr<VulkanCommandBuffer>& cmdBuffer,
+                                            const std::uint32_t phase) const
+{
+    cmdBuffer->BindPipeline(pipeline_, VK_PIPELINE_BIND_POINT_GRAPHICS);
+    const std::vector descSets{resources_->GetDescriptorSet(cullingDescSet_)};
+    cmdBuffer->BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_, 0, descSets);
+
+    ViewProjectionData viewProjectionData{};
+    viewProjectionData.viewProjectionMatrix = cullingPushConstants_.ViewProjection;
+    cmdBuffer->PushConstants(pipelineLayout_, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(ViewProjectionData),
+                             &viewProjectionData);
+
+    const std::vector vertexBuffers{resources_->GetBuffer(meshVertexBuffer_),
+                                    resources_->GetBuffer(objectIndexBuffer_)};
+    cmdBuffer->BindVertexBuffers(vertexBuffers, 0, 2, {0, 0});
+    cmdBuffer->BindIndexBuffer(resources_->GetBuffer(meshIndexBuffer_));
+
+    // Every phase has its own command region and its own draw count (first two counters of the statistics)
+    const auto commandBuffer = resources_->GetBuffer(drawCommandBuffer_);
+    constexpr auto stride = static_cast<std::uint32_t>(sizeof(VkDrawIndexedIndirectCommand));
+    const VkDeviceSize commandOffset = static_cast<VkDeviceSize>(phase) * objectCount_ * stride;
+    if (useDrawCount_) {
+        if (!cmdBuffer->DrawIndexedIndirectCount(commandBuffer, commandOffset, resources_->GetBuffer(statsBuffer_),
+                                                 phase * sizeof(std::uint32_t), objectCount_, stride)) {
+            throw std::runtime_error("Failed to record indirect draw with count!");
+        }
+    } else if (isMultiDrawIndirectSupported_) {
+        cmdBuffer->DrawIndexedIndirect(commandBuffer, commandOffset, objectCount_, stride);
+    } else {
+        for (std::uint32_t i = 0; i < objectCount_; ++i) {
+            cmdBuffer->DrawIndexedIndirect(commandBuffer, commandOffset + static_cast<VkDeviceSize>(i) * stride, 1,
+                                           stride);
+        }
+    }
+}
+
+void VulkanApplication::RecordDepthPyramid(const std::shared_ptr<VulkanCommandBuffer>& cmdBuffer) const
+{
+    const auto depthImage = resources_->GetImage(depthImage_);
+    const auto pyramidImage = resources_->GetImage(depthPyramidImage_);
+    const VkImageSubresourceRange depthRange{VK_IMAGE_ASPECT_DEPTH_BIT, 0, 1, 0, 1};
+
+    // Early depth is sampled by the first reduction, early color is loaded by the late pass, and the pyramid of the
+    // previous frame must be read by its late pass before it is overwritten
+    const auto depthToShaderRead = depthImage->CreateImageMemoryBarrier(
+            VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT,
+            VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, depthRange);
+    const auto pyramidToWrite = pyramidImage->CreateImageMemoryBarrier(
+            VK_ACCESS_SHADER_READ_BIT, VK_ACCESS_SHADER_WRITE_BIT, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_GENERAL,
+            VkImageSubresourceRange{VK_IMAGE_ASPECT_COLOR_BIT, 0, pyramidLevelCount_, 0, 1});
+    VkMemoryBarrier colorBarrier{};
+    colorBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    colorBarrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    colorBarrier.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    cmdBuffer->PipelineBarrier(VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT |
+                                       VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+                                       VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                               VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                               {depthToShaderRead, pyramidToWrite}, {}, {colorBarrier});
+
+    cmdBuffer->BindPipeline(depthReducePipeline_, VK_PIPELINE_BIND_POINT_COMPUTE);
+
+    // Every level is written from the previous one, so the levels are separated with barriers
+    DepthReducePushConstants pushConstants{};
+    pushConstants.SrcWidth = currentWindowWidth_;
+    pushConstants.SrcHeight = currentWindowHeight_;
+    for (std::uint32_t level = 0; level < pyramidLevelCount_; ++level) {
+        pushConstants.DstWidth = std::max(pyramidWidth_ >> level, 1u);
+        pushConstants.DstHeight = std::max(pyramidHeight_ >> level, 1u);
+        pushConstants.UseMinMaxSampler = useMinMaxSampler_ && level > 0 ? 1 : 0;
+
+        const std::vector descSets{resources_->GetDescriptorSet(depthReduceDescSets_[level])};
+        cmdBuffer->BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, depthReducePipelineLayout_, 0, descSets);
+        cmdBuffer->PushConstants(depthReducePipelineLayout_, VK_SHADER_STAGE_COMPUTE_BIT, 0,
+                                 sizeof(DepthReducePushConstants), &pushConstants);
+        cmdBuffer->Dispatch((pushConstants.DstWidth + depthReduceGroupSize - 1) / depthReduceGroupSize,
+                            (pushConstants.DstHeight + depthReduceGroupSize - 1) / depthReduceGroupSize, 1);
+
+        const auto levelBarrier = pyramidImage->CreateImageMemoryBarrier(
+                VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_GENERAL,
+                VkImageSubresourceRange{VK_IMAGE_ASPECT_COLOR_BIT, level, 1, 0, 1});
+        cmdBuffer->PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                   {levelBarrier});
+
+        pushConstants.SrcWidth = pushConstants.DstWidth;
+        pushConstants.SrcHeight = pushConstants.DstHeight;
+    }
+
+    // Depth buffer is used as the attachment of the late pass again
+    const auto depthToAttachment = depthImage->CreateImageMemoryBarrier(
+            VK_ACCESS_SHADER_READ_BIT,
+            VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, depthRange);
+    cmdBuffer->PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                               VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+                               {depthToAttachment});
+}
+
+void VulkanApplication::RecordStatsReadback(const std::shared_ptr<VulkanCommandBuffer>& cmdBuffer,
+                                            const std::uint32_t currentImageIndex) const
+{
+    VkMemoryBarrier computeToTransfer{};
+    computeToTransfer.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    computeToTransfer.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    computeToTransfer.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    cmdBuffer->PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, {}, {},
+                               {computeToTransfer});
+
+    // Every swap chain image has its own region, it is read after the fence of the image is signaled
+    VkBufferCopy copyRegion{};
+    copyRegion.dstOffset = static_cast<VkDeviceSize>(currentImageIndex) * sizeof(CullingStats);
+    copyRegion.size = sizeof(CullingStats);
+    cmdBuffer->CopyBuffer(resources_->GetBuffer(statsBuffer_), resources_->GetBuffer(statsReadbackBuffer_),
+                          {copyRegion});
+
+    VkMemoryBarrier transferToHost{};
+    transferToHost.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    transferToHost.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    transferToHost.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    cmdBuffer->PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, {}, {}, {transferToHost});
+}
+
+void VulkanApplication::PrintCullingStats(const std::uint32_t currentImageIndex)
+{
+    if (!printCullingStats_) {
+        return;
+    }
+
+    // Statistics are printed once per second
+    statsElapsedTime_ += deltaTime_;
+    if (statsElapsedTime_ < 1.0) {
+        return;
+    }
+    statsElapsedTime_ = 0.0;
+
+    CullingStats stats{};
+    auto* readbackBuffer = resources_->GetBufferResource(statsReadbackBuffer_);
+    readbackBuffer->MapMemory();
+    std::memcpy(&stats, static_cast<const std::uint8_t*>(readbackBuffer->GetMappedData()) +
+                                static_cast<std::size_t>(currentImageIndex) * sizeof(CullingStats),
+                sizeof(CullingStats));
+    readbackBuffer->UnmapMemory();
+
+    const auto outsideCount = objectCount_ - std::min(objectCount_, stats.VisibleCount + stats.OccludedCount);
+    std::cout << "HiZ culling (" << objectCount_ << " objects): " << stats.EarlyDrawCount << " early draws, "
+              << stats.LateDrawCount << " late draws, " << stats.OccludedCount << " occluded, " << outsideCount
+              << " outside of the frustum" << std::endl;
+}
+
+void VulkanApplication::ResolveParamKeys()
+{
+    maxFramesInFlightKey_ = ResolveParam<std::uint32_t>(AppConstants::MaxFramesInFlight);
+    clearColorKey_ = ResolveParam<VkClearColorValue>(AppSettings::ClearColor);
+    mouseSensitivityKey_ = ResolveParam<float>(AppSettings::MouseSensitivity);
+    cameraSpeedKey_ = ResolveParam<float>(AppSettings::CameraSpeed);
+}
+
+void VulkanApplication::ProcessInput() const
+{
+    const float cameraSpeed = GetParam(cameraSpeedKey_) * static_cast<float>(deltaTime_);
+    if (window_->IsKeyPressed(GLFW_KEY_W)) {
+        camera_->Move(camera_->GetFrontVector() * cameraSpeed);
+    }
+    if (window_->IsKeyPressed(GLFW_KEY_S)) {
+        camera_->Move(-camera_->GetFrontVector() * cameraSpeed);
+    }
+    if (window_->IsKeyPressed(GLFW_KEY_A)) {
+        camera_->Move(-camera_->GetRightVector() * cameraSpeed);
+    }
+    if (window_->IsKeyPressed(GLFW_KEY_D)) {
+        camera_->Move(camera_->GetRightVector() * cameraSpeed);
+    }
+}
+} // namespace examples::fundamentals::model_loading::gltf_hiz_culling
@@ -0,0 +1,157 @@
+/**
+ * @file    VulkanApplication.h
+ * @brief   This file contains VulkanApplication implementation.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ApplicationData.h"
+#include "ApplicationModelLoading.h"
+#include "ModelLoader.h"
+#include "PerspectiveCamera.h"
+#include "VulkanCommandBuffer.h"
+#include "VulkanPipeline.h"
+#include "VulkanPipelineLayout.h"
+#include "VulkanRenderPass.h"
+#include "Window.h"
+
+namespace examples::fundamentals::model_loading::gltf_hiz_culling
+{
+class VulkanApplication final : public base::ApplicationModelLoading
+{
+public:
+    explicit VulkanApplication(common::utility::ParameterServer&& params);
+
+    ~VulkanApplication() override = default;
+
+protected:
+    bool Init() override;
+
+    void DrawFrame() override;
+
+    void PreUpdate() override;
+
+private:
+    void InitInputSystem();
+
+    void CreateLogicalDevice();
+
+    void CollectObjects();
+
+    void CreateResources();
+
+    void InitResources();
+
+    void UpdateDescriptorSets() const;
+
+    void CreateRenderPasses();
+
+    void CreatePipeline();
+
+    void CreateComputePipelines();
+
+    void CreateCommandBuffers();
+
+    void RecordPresentCommandBuffers(std::uint32_t currentImageIndex);
+
+    void RecordCullingDispatch(const std::shared_ptr<common::vulkan_wrapper::VulkanCommandBuffer>& cmdBuffer,
+                               std::uint32_t phase);
+
+    void RecordIndirectDraws(const std::shared_ptr<common::vulkan_wrapper::VulkanCommandBuffer>& cmdBuffer,
+                             std::uint32_t phase) const;
+
+    void RecordDepthPyramid(const std::shared_ptr<common::vulkan_wrapper::VulkanCommandBuffer>& cmdBuffer) const;
+
+    void RecordStatsReadback(const std::shared_ptr<common::vulkan_wrapper::VulkanCommandBuffer>& cmdBuffer,
+                             std::uint32_t currentImageIndex) const;
+
+    void ProcessInput() const;
+
+    void PrintCullingStats(std::uint32_t currentImageIndex);
+
+    void ResolveParamKeys();
+
+    std::uint32_t currentIndex_ = 0;
+    std::uint32_t currentWindowWidth_ = UINT32_MAX;
+    std::uint32_t currentWindowHeight_ = UINT32_MAX;
+    VkFormat depthImageFormat_ = VK_FORMAT_UNDEFINED;
+
+    // Pre-resolved parameter keys for per-frame reads
+    common::utility::ParamKey<std::uint32_t> maxFramesInFlightKey_;
+    common::utility::ParamKey<VkClearColorValue> clearColorKey_;
+    common::utility::ParamKey<float> mouseSensitivityKey_;
+    common::utility::ParamKey<float> cameraSpeedKey_;
+
+    // Models
+    std::shared_ptr<common::utility::GltfModelHandler> lanternModel_;
+
+    // Packed geometry of all meshes and the wall box, one cull object per mesh node of every instance and per wall
+    std::vector<VertexPos3Norm3> meshVertices_;
+    std::vector<std::uint16_t> meshIndices_;
+    std::vector<CullObject> cullObjects_;
+    std::uint32_t objectCount_ = 0;
+
+    // Supported indirect draw paths
+    bool isDrawCountSupported_ = false;
+    bool isMultiDrawIndirectSupported_ = false;
+    bool useDrawCount_ = false;
+
+    // Depth pyramid (power of two size, every level keeps the farthest depth of 2x2 texels of the previous one)
+    VkFormat depthPyramidFormat_ = VK_FORMAT_R32_SFLOAT;
+    std::uint32_t pyramidWidth_ = 0;
+    std::uint32_t pyramidHeight_ = 0;
+    std::uint32_t pyramidLevelCount_ = 0;
+    bool isMinMaxSamplerSupported_ = false;
+    bool useMinMaxSampler_ = false;
+
+    CullingPushConstants cullingPushConstants_{};
+
+    // Culling statistics, read back from the previous submission of every swap chain image
+    bool printCullingStats_ = false;
+    double statsElapsedTime_ = 0.0;
+
+    // Resource handles which are used in the per-frame code
+    common::vulkan_framework::BufferHandle meshVertexBuffer_;
+    common::vulkan_framework::BufferHandle meshIndexBuffer_;
+    common::vulkan_framework::BufferHandle objectIndexBuffer_;
+    common::vulkan_framework::BufferHandle visibilityBuffer_;
+    common::vulkan_framework::BufferHandle drawCommandBuffer_;
+    common::vulkan_framework::BufferHandle statsBuffer_;
+    common::vulkan_framework::BufferHandle statsReadbackBuffer_;
+    common::vulkan_framework::ImageHandle depthImage_;
+    common::vulkan_framework::ImageHandle depthPyramidImage_;
+    common::vulkan_framework::DescriptorSetHandle cullingDescSet_;
+    std::vector<common::vulkan_framework::DescriptorSetHandle> depthReduceDescSets_;
+
+    // Late pass loads the color and depth attachments of the early pass
+    std::shared_ptr<common::vulkan_wrapper::VulkanRenderPass> lateRenderPass_;
+
+    // Pipelines
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipelineLayout> pipelineLayout_;
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipeline> pipeline_;
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipelineLayout> cullingPipelineLayout_;
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipeline> cullingPipeline_;
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipelineLayout> depthReducePipelineLayout_;
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipeline> depthReducePipeline_;
+
+    // Command buffers
+    std::vector<std::shared_ptr<common::vulkan_wrapper::VulkanCommandBuffer>> cmdBuffersPresent_;
+
+    // Mouse related values
+    bool firstMouseTriggered_ = true;
+    float lastX_ = 0.0f;
+    float lastY_ = 0.0f;
+
+    // Camera
+    std::unique_ptr<common::utility::PerspectiveCamera> camera_;
+};
+} // namespace examples::fundamentals::model_loading::gltf_hiz_culling
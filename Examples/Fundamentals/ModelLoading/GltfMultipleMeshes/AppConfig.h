@@ -22,12 +22,19 @@ namespace AppConstants
     constexpr auto MainFragmentShaderFile = "AppConstants.MainFragmentShaderFile";
     constexpr auto MainVertexShaderKey = "AppConstants.MainVertexShaderKey";
     constexpr auto MainFragmentShaderKey = "AppConstants.MainFragmentShaderKey";
+    constexpr auto PickingVertexShaderFile = "AppConstants.PickingVertexShaderFile";
+    constexpr auto PickingFragmentShaderFile = "AppConstants.PickingFragmentShaderFile";
+    constexpr auto PickingVertexShaderKey = "AppConstants.PickingVertexShaderKey";
+    constexpr auto PickingFragmentShaderKey = "AppConstants.PickingFragmentShaderKey";
 
     // Resources
     constexpr auto MeshImage = "AppConstants.MeshImage";
     constexpr auto MeshImageView = "AppConstants.MeshImageView";
     constexpr auto DepthImage = "AppConstants.DepthImage";
     constexpr auto DepthImageView = "AppConstants.DepthImageView";
+    constexpr auto ObjectIdImage = "AppConstants.ObjectIdImage";
+    constexpr auto ObjectIdImageView = "AppConstants.ObjectIdImageView";
+    constexpr auto PickingReadbackBuffer = "AppConstants.PickingReadbackBuffer";
     constexpr auto MainSampler = "AppConstants.MainSampler";
     constexpr auto MainDescSetLayout = "AppConstants.MainDescSetLayout";
     constexpr auto LanternModelPath = "AppConstants.LanternModelPath";
@@ -38,5 +45,8 @@ namespace AppSettings
     constexpr auto ClearColor = "AppSettings.ClearColor";
     constexpr auto MouseSensitivity = "AppSettings.MouseSensitivity";
     constexpr auto CameraSpeed = "AppSettings.CameraSpeed";
+    constexpr auto SoftwareOcclusion = "AppSettings.SoftwareOcclusion";
+    constexpr auto GpuPicking = "AppSettings.GpuPicking";
+    constexpr auto DescriptorSetCacheSize = "AppSettings.DescriptorSetCacheSize";
 } // namespace AppSettings
 } // namespace examples::fundamentals::model_loading::gltf_multiple_meshes
@@ -10,6 +10,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <vector>
 
 #include "ModelLoader.h"
@@ -30,6 +31,14 @@ struct MvpData
 {
     glm::mat4 mvpMatrix;
 };
+
+// MVP matrix and object ID of the picking shaders (for Push Constants), object ID is the index of the draw item
+struct PickingMvpData
+{
+    glm::mat4 mvpMatrix;
+    std::uint32_t objectId;
+    std::uint32_t padding[3];
+};
 } // namespace examples::fundamentals::model_loading::gltf_multiple_meshes
 
 namespace common::utility
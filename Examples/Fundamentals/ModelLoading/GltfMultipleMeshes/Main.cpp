@@ -32,11 +32,19 @@ inline ParameterSchema CreateParameterSchema()
     schema.RegisterImmutableParam<std::string>(AppConstants::MainFragmentShaderFile, "drawing_model.frag.spv");
     schema.RegisterImmutableParam<std::string>(AppConstants::MainVertexShaderKey, "vertMain");
     schema.RegisterImmutableParam<std::string>(AppConstants::MainFragmentShaderKey, "fragMain");
+    schema.RegisterImmutableParam<std::string>(AppConstants::PickingVertexShaderFile, "drawing_model_picking.vert.spv");
+    schema.RegisterImmutableParam<std::string>(AppConstants::PickingFragmentShaderFile,
+                                               "drawing_model_picking.frag.spv");
+    schema.RegisterImmutableParam<std::string>(AppConstants::PickingVertexShaderKey, "pickingVertMain");
+    schema.RegisterImmutableParam<std::string>(AppConstants::PickingFragmentShaderKey, "pickingFragMain");
 
     schema.RegisterImmutableParam<std::string>(AppConstants::MeshImage, "meshImage");
     schema.RegisterImmutableParam<std::string>(AppConstants::MeshImageView, "meshImageView");
     schema.RegisterImmutableParam<std::string>(AppConstants::DepthImage, "depthImage");
     schema.RegisterImmutableParam<std::string>(AppConstants::DepthImageView, "depthImageView");
+    schema.RegisterImmutableParam<std::string>(AppConstants::ObjectIdImage, "objectIdImage");
+    schema.RegisterImmutableParam<std::string>(AppConstants::ObjectIdImageView, "objectIdImageView");
+    schema.RegisterImmutableParam<std::string>(AppConstants::PickingReadbackBuffer, "pickingReadbackBuffer");
     schema.RegisterImmutableParam<std::string>(AppConstants::MainSampler, "mainSampler");
     schema.RegisterImmutableParam<std::string>(AppConstants::MainDescSetLayout, "mainDescSetLayout");
     schema.RegisterImmutableParam<std::string>(AppConstants::LanternModelPath, "Models/Lantern.glb");
@@ -45,6 +53,9 @@ inline ParameterSchema CreateParameterSchema()
     schema.RegisterParam<VkClearColorValue>(AppSettings::ClearColor);
     schema.RegisterParam<float>(AppSettings::MouseSensitivity);
     schema.RegisterParam<float>(AppSettings::CameraSpeed);
+    schema.RegisterParam<bool>(AppSettings::SoftwareOcclusion, false);
+    schema.RegisterParam<bool>(AppSettings::GpuPicking, false);
+    schema.RegisterParam<std::uint32_t>(AppSettings::DescriptorSetCacheSize, 16);
 
     return schema;
 }
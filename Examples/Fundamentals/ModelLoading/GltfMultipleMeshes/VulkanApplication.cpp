@@ -9,8 +9,11 @@
 #include <algorithm>
 #include <array>
 #include <chrono>
+#include <cstring>
+#include <string>
 #include <glm/ext/matrix_clip_space.hpp>
 #include <glm/ext/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
 
 #include "AppConfig.h"
 #include "ApplicationData.h"
@@ -24,11 +27,26 @@ using namespace common::vulkan_wrapper;
 using namespace common::vulkan_framework;
 using namespace common::window_wrapper;
 
+namespace
+{
+    // Depth buffer of the software occlusion culling is smaller than the window by this factor
+    constexpr std::uint32_t occlusionBufferScale = 4;
+
+    // Pixels of the object ID attachment which are read around the picked point (a few pixels of tolerance), empty
+    // pixels keep the clear value
+    constexpr std::uint32_t pickRectSize = 5;
+    constexpr std::uint32_t emptyObjectId = UINT32_MAX;
+} // namespace
+
 VulkanApplication::VulkanApplication(ParameterServer&& params) : ApplicationModelLoading(std::move(params)) {}
 
 bool VulkanApplication::Init()
 {
     try {
+        ResolveParamKeys();
+
+        isGpuPickingEnabled_ = params_.Get<bool>(AppSettings::GpuPicking);
+
         currentWindowWidth_ = GetParamU32(WindowParams::Width);
         currentWindowHeight_ = GetParamU32(WindowParams::Height);
 
@@ -50,9 +68,9 @@ bool VulkanApplication::Init()
 
         CreateRenderPass();
         CreatePipeline();
-        CreateDefaultFramebuffers(resources_->GetImageView(GetParamStr(AppConstants::DepthImage),
-                                                           GetParamStr(AppConstants::DepthImageView)));
+        CreateFramebuffers();
         CreateCommandBuffers();
+        CreateOccluders();
     } catch (const std::exception& e) {
         std::cerr << e.what() << '\n';
         return false;
@@ -63,7 +81,13 @@ bool VulkanApplication::Init()
 
 void VulkanApplication::DrawFrame()
 {
+    // Culling only uses CPU data, so it runs while the GPU may still be working on the previous frames. Draw items keep
+    // the same order every frame, so object IDs of pending picks stay valid.
+    CullAndSortDraws();
+
     inFlightFences_[currentIndex_]->WaitForFence(true, UINT64_MAX);
+    ReadPickResult();
+    resources_->GetDescriptorSetCache().BeginFrame();
     inFlightFences_[currentIndex_]->ResetFence();
 
     uint32_t imageIndex = swapChain_->AcquireNextImage(imageAvailableSemaphores_[currentIndex_], nullptr);
@@ -82,7 +106,8 @@ void VulkanApplication::DrawFrame()
 
     queue_->Present({swapChain_}, {imageIndex}, {renderFinishedSemaphores_[imageIndex]});
 
-    currentIndex_ = (currentIndex_ + 1) % GetParamU32(AppConstants::MaxFramesInFlight);
+    currentIndex_ = (currentIndex_ + 1) % GetParam(maxFramesInFlightKey_);
+    ++frameNumber_;
 }
 
 void VulkanApplication::PreUpdate()
@@ -116,12 +141,21 @@ void VulkanApplication::InitInputSystem()
         lastX_ = xPos;
         lastY_ = yPos;
 
-        const float sensitivity = GetParamFloat(AppSettings::MouseSensitivity) * static_cast<float>(deltaTime_);
+        const float sensitivity = GetParam(mouseSensitivityKey_) * static_cast<float>(deltaTime_);
         xOffset *= sensitivity;
         yOffset *= sensitivity;
 
         camera_->Rotate(xOffset, yOffset);
     });
+
+    // Cursor is disabled, so the object at the center of the screen is picked. The ray cast answers immediately, the
+    // ID buffer readback answers a few frames later with the pixel exact result.
+    window_->OnMouseButton([&](const MouseButtonEvent& event) {
+        if (event.Button == GLFW_MOUSE_BUTTON_LEFT && event.Action == GLFW_PRESS) {
+            PickObject();
+            isPickRequested_ = isGpuPickingEnabled_;
+        }
+    });
 }
 
 void VulkanApplication::CreateResources()
@@ -134,10 +168,21 @@ void VulkanApplication::CreateResources()
     ModelLoader modelLoader{ASSETS_DIR};
     lanternModel_ = modelLoader.LoadBinaryGltfFromFile(GetParamStr(AppConstants::LanternModelPath));
 
-    // Load model textures
+    // Create renderable entities of the mesh nodes
+    sceneRegistry_.Clear();
+    CreateModelEntities(sceneRegistry_, *lanternModel_);
+
+    // Every material uses its base color texture, materials without a texture use the texture of the first mesh
     const auto meshMatIndex = lanternModel_->Meshes[0].MaterialIndex;
     const auto meshTexIndex = lanternModel_->Materials[meshMatIndex].PbrMetallicRoughness.BaseColorTextureIndex;
-    lanternMeshTextureHandler_ = lanternModel_->Textures[meshTexIndex];
+    materialTextureIndices_.clear();
+    for (const auto& material: lanternModel_->Materials) {
+        const auto textureIndex = material.PbrMetallicRoughness.BaseColorTextureIndex;
+        materialTextureIndices_.push_back(static_cast<std::uint32_t>(textureIndex >= 0 ? textureIndex : meshTexIndex));
+    }
+    usedTextureIndices_ = materialTextureIndices_;
+    std::ranges::sort(usedTextureIndices_);
+    usedTextureIndices_.erase(std::ranges::unique(usedTextureIndices_).begin(), usedTextureIndices_.end());
 
     ResourceDescriptor resourceCreateInfo;
 
@@ -152,6 +197,12 @@ void VulkanApplication::CreateResources()
         bufferCreateInfos.emplace_back(mesh.GetIndexBufferName(), indexBufferSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
                                        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
     }
+    if (isGpuPickingEnabled_) {
+        bufferCreateInfos.emplace_back(GetParamStr(AppConstants::PickingReadbackBuffer),
+                                       pickRectSize * pickRectSize * sizeof(std::uint32_t),
+                                       VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                       VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    }
     resourceCreateInfo.Buffers = bufferCreateInfos;
 
     // Fill shader module create infos
@@ -161,23 +212,23 @@ void VulkanApplication::CreateResources()
                                                .FileName = GetParamStr(AppConstants::MainVertexShaderFile)},
                                               {.Name = GetParamStr(AppConstants::MainFragmentShaderKey),
                                                .FileName = GetParamStr(AppConstants::MainFragmentShaderFile)}}};
+    if (isGpuPickingEnabled_) {
+        resourceCreateInfo.Shaders->Modules.push_back(
+                {.Name = GetParamStr(AppConstants::PickingVertexShaderKey),
+                 .FileName = GetParamStr(AppConstants::PickingVertexShaderFile)});
+        resourceCreateInfo.Shaders->Modules.push_back(
+                {.Name = GetParamStr(AppConstants::PickingFragmentShaderKey),
+                 .FileName = GetParamStr(AppConstants::PickingFragmentShaderFile)});
+    }
 
-    // Fill descriptor set create infos
+    // Fill descriptor set create infos, sets of the materials are taken from the descriptor set cache
     resourceCreateInfo.Descriptors = {.MaxSets = 1,
                                       .PoolSizes = {{VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1}},
                                       .Layouts = {{.Name = GetParamStr(AppConstants::MainDescSetLayout),
                                                    .Bindings = {{0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1,
-                                                                 VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}}}},
-                                      .DescriptorSets = {{.Name = GetParamStr(AppConstants::MainDescSetLayout),
-                                                          .LayoutName = GetParamStr(AppConstants::MainDescSetLayout)}}};
+                                                                 VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}}}}};
 
     resourceCreateInfo.Images = {
-        ImageResourceCreateInfo{.Name = GetParamStr(AppConstants::MeshImage),
-                                .MemProperties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-                                .Format = VK_FORMAT_R8G8B8A8_SRGB,
-                                .Dimensions = {lanternMeshTextureHandler_.Width, lanternMeshTextureHandler_.Height, 1},
-                                .Views = {ImageViewCreateInfo{.ViewName = GetParamStr(AppConstants::MeshImageView),
-                                                              .Format = VK_FORMAT_R8G8B8A8_SRGB}}},
         ImageResourceCreateInfo{
             .Name = GetParamStr(AppConstants::DepthImage),
             .MemProperties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
@@ -191,12 +242,56 @@ void VulkanApplication::CreateResources()
                                                                .levelCount = 1,
                                                                .baseArrayLayer = 0,
                                                                .layerCount = 1}}}}};
+    if (isGpuPickingEnabled_) {
+        resourceCreateInfo.Images->push_back(ImageResourceCreateInfo{
+            .Name = GetParamStr(AppConstants::ObjectIdImage),
+            .MemProperties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+            .Format = VK_FORMAT_R32_UINT,
+            .Dimensions = {currentWindowWidth_, currentWindowHeight_, 1},
+            .UsageFlags = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
+            .Views = {ImageViewCreateInfo{.ViewName = GetParamStr(AppConstants::ObjectIdImageView),
+                                          .Format = VK_FORMAT_R32_UINT}}});
+    }
+    for (const auto textureIndex: usedTextureIndices_) {
+        const auto& texture = lanternModel_->Textures[textureIndex];
+        resourceCreateInfo.Images->push_back(ImageResourceCreateInfo{
+            .Name = GetTextureImageName(textureIndex),
+            .MemProperties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+            .Format = VK_FORMAT_R8G8B8A8_SRGB,
+            .Dimensions = {texture.Width, texture.Height, 1},
+            .Views = {ImageViewCreateInfo{.ViewName = GetParamStr(AppConstants::MeshImageView),
+                                          .Format = VK_FORMAT_R8G8B8A8_SRGB}}});
+    }
 
     resourceCreateInfo.Samplers = {
         {.Name = GetParamStr(AppConstants::MainSampler),
          .FilteringBehavior = {.MagFilter = VK_FILTER_LINEAR, .MinFilter = VK_FILTER_LINEAR}}};
 
     CreateVulkanResources(resourceCreateInfo);
+
+    // Resolve handles once, draw loop doesn't look up resources by name
+    meshBufferHandles_.clear();
+    for (const auto& mesh: lanternModel_->Meshes) {
+        meshBufferHandles_.push_back({resources_->GetBufferHandle(mesh.GetVertexBufferName()),
+                                      resources_->GetBufferHandle(mesh.GetIndexBufferName())});
+    }
+    mainDescLayoutHandle_ = resources_->GetDescriptorLayoutHandle(GetParamStr(AppConstants::MainDescSetLayout));
+    const auto mainSampler = resources_->GetSamplerHandle(GetParamStr(AppConstants::MainSampler));
+    materialBindings_.clear();
+    for (const auto textureIndex: materialTextureIndices_) {
+        materialBindings_.push_back({resources_->MakeImageSamplerBinding(
+                0, resources_->GetImageHandle(GetTextureImageName(textureIndex)),
+                GetParamStr(AppConstants::MeshImageView), mainSampler)});
+    }
+
+    // Materials with the same texture share a set, least recently used sets are recycled when the cache is full
+    resources_->CreateDescriptorSetCache(GetParamU32(AppSettings::DescriptorSetCacheSize),
+                                         GetParamU32(AppConstants::MaxFramesInFlight),
+                                         {{VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1.0f}});
+    if (isGpuPickingEnabled_) {
+        objectIdImage_ = resources_->GetImageHandle(GetParamStr(AppConstants::ObjectIdImage));
+        pickingReadbackBuffer_ = resources_->GetBufferHandle(GetParamStr(AppConstants::PickingReadbackBuffer));
+    }
 }
 
 void VulkanApplication::InitResources() const
@@ -211,14 +306,18 @@ void VulkanApplication::InitResources() const
         resources_->SetBuffer(mesh.GetIndexBufferName(), indexBufferData.data(), indexBufferSize);
     }
 
-    resources_->SetImageFromTexture(cmdPool_, queue_, GetParamStr(AppConstants::MeshImage), lanternMeshTextureHandler_);
-
-    UpdateDescriptorSets();
+    for (const auto textureIndex: usedTextureIndices_) {
+        resources_->SetImageFromTexture(cmdPool_, queue_, GetTextureImageName(textureIndex),
+                                        lanternModel_->Textures[textureIndex]);
+    }
 }
 
 void VulkanApplication::CreateRenderPass()
 {
-    VkAttachmentReference colorAttachmentRef{0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+    // Object ID attachment is the second color output of the subpass, it is left in the transfer layout for the pick
+    // readback
+    const std::array colorAttachmentRefs{VkAttachmentReference{0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL},
+                                         VkAttachmentReference{2, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL}};
 
     VkAttachmentReference depthAttachmentRef{1, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL};
 
@@ -245,10 +344,41 @@ void VulkanApplication::CreateRenderPass()
                 })
                 .AddSubpass([&](auto& subpassCreateInfo) {
                     subpassCreateInfo.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
-                    subpassCreateInfo.colorAttachmentCount = 1;
-                    subpassCreateInfo.pColorAttachments = &colorAttachmentRef;
+                    subpassCreateInfo.colorAttachmentCount = isGpuPickingEnabled_ ? 2 : 1;
+                    subpassCreateInfo.pColorAttachments = colorAttachmentRefs.data();
                     subpassCreateInfo.pDepthStencilAttachment = &depthAttachmentRef;
                 });
+
+        if (isGpuPickingEnabled_) {
+            builder.AddAttachment([](auto& attachmentCreateInfo) {
+                       attachmentCreateInfo.format = VK_FORMAT_R32_UINT;
+                       attachmentCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+                       attachmentCreateInfo.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+                       attachmentCreateInfo.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+                       attachmentCreateInfo.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+                       attachmentCreateInfo.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+                       attachmentCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+                       attachmentCreateInfo.finalLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+                   })
+                    .AddDependency([](auto& dependency) {
+                        // Clears of the next frame wait for the attachment writes and the pick copy of the previous
+                        // frame, object ID and depth images are shared by the frames in flight
+                        dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
+                        dependency.dstSubpass = 0;
+                        dependency.srcStageMask =
+                                VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+                                VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT |
+                                VK_PIPELINE_STAGE_TRANSFER_BIT;
+                        dependency.dstStageMask =
+                                VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+                                VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+                        dependency.srcAccessMask =
+                                VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+                        dependency.dstAccessMask =
+                                VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+                        dependency.dependencyFlags = 0;
+                    });
+        }
     });
 
     if (!renderPass_) {
@@ -260,7 +390,7 @@ void VulkanApplication::CreatePipeline()
 {
     VkPushConstantRange mvpPushConstant;
     mvpPushConstant.offset = 0;
-    mvpPushConstant.size = sizeof(MvpData);
+    mvpPushConstant.size = isGpuPickingEnabled_ ? sizeof(PickingMvpData) : sizeof(MvpData);
     mvpPushConstant.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
 
     pipelineLayout_ = device_->CreatePipelineLayout(
@@ -285,6 +415,16 @@ void VulkanApplication::CreatePipeline()
     colorBlendAttachment.colorWriteMask =
             VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
 
+    // Integer attachments can't be blended
+    VkPipelineColorBlendAttachmentState objectIdBlendAttachment = colorBlendAttachment;
+    objectIdBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT;
+    const std::array colorBlendAttachments{colorBlendAttachment, objectIdBlendAttachment};
+
+    const auto vertexShaderKey = isGpuPickingEnabled_ ? AppConstants::PickingVertexShaderKey
+                                                      : AppConstants::MainVertexShaderKey;
+    const auto fragmentShaderKey = isGpuPickingEnabled_ ? AppConstants::PickingFragmentShaderKey
+                                                        : AppConstants::MainFragmentShaderKey;
+
     constexpr uint32_t bindingIndex = 0;
     auto bindingDescription = GenerateBindingDescription<VertexPos3Uv2>(bindingIndex);
     const auto posAttribDescription = GenerateAttributeDescription(VertexPos3Uv2, Position, bindingIndex);
@@ -294,13 +434,11 @@ void VulkanApplication::CreatePipeline()
     pipeline_ = device_->CreateGraphicsPipeline(pipelineLayout_, renderPass_, [&](auto& builder) {
         builder.AddShaderStage([&](auto& shaderStageCreateInfo) {
             shaderStageCreateInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;
-            shaderStageCreateInfo.module =
-                    resources_->GetShaderModule(GetParamStr(AppConstants::MainVertexShaderKey))->GetHandle();
+            shaderStageCreateInfo.module = resources_->GetShaderModule(GetParamStr(vertexShaderKey))->GetHandle();
         });
         builder.AddShaderStage([&](auto& shaderStageCreateInfo) {
             shaderStageCreateInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-            shaderStageCreateInfo.module =
-                    resources_->GetShaderModule(GetParamStr(AppConstants::MainFragmentShaderKey))->GetHandle();
+            shaderStageCreateInfo.module = resources_->GetShaderModule(GetParamStr(fragmentShaderKey))->GetHandle();
         });
         builder.SetVertexInputState([&](auto& vertexInputStateCreateInfo) {
             vertexInputStateCreateInfo.vertexBindingDescriptionCount = 1;
@@ -315,8 +453,8 @@ void VulkanApplication::CreatePipeline()
             viewportStateCreateInfo.pScissors = &scissor;
         });
         builder.SetColorBlendState([&](auto& blendStateCreateInfo) {
-            blendStateCreateInfo.attachmentCount = 1;
-            blendStateCreateInfo.pAttachments = &colorBlendAttachment;
+            blendStateCreateInfo.attachmentCount = isGpuPickingEnabled_ ? 2 : 1;
+            blendStateCreateInfo.pAttachments = colorBlendAttachments.data();
         });
         builder.SetDepthStencilState([&](auto& depthStencilStateCreateInfo) {
             depthStencilStateCreateInfo.depthTestEnable = VK_TRUE;
@@ -330,24 +468,36 @@ void VulkanApplication::CreatePipeline()
     }
 }
 
-void VulkanApplication::UpdateDescriptorSets() const
+void VulkanApplication::CreateFramebuffers()
+{
+    const auto depthImageView =
+            resources_->GetImageView(GetParamStr(AppConstants::DepthImage), GetParamStr(AppConstants::DepthImageView));
+    if (!isGpuPickingEnabled_) {
+        CreateDefaultFramebuffers(depthImageView);
+        return;
+    }
+
+    // Depth and object ID images are shared by all swap chain images
+    const auto objectIdImageView =
+            resources_->GetImageView(objectIdImage_, GetParamStr(AppConstants::ObjectIdImageView));
+    for (const auto& swapImage: swapChainImageViews_) {
+        auto framebuffer = device_->CreateFramebuffer(renderPass_, {swapImage, depthImageView, objectIdImageView},
+                                                      [&](auto& builder) {
+                                                          builder.SetDimensions(currentWindowWidth_,
+                                                                                currentWindowHeight_);
+                                                      });
+
+        if (!framebuffer) {
+            throw std::runtime_error("Failed to create framebuffer!");
+        }
+
+        framebuffers_.push_back(framebuffer);
+    }
+}
+
+std::string VulkanApplication::GetTextureImageName(const std::uint32_t textureIndex) const
 {
-    std::vector<VkDescriptorImageInfo> imageSamplerInfos;
-    imageSamplerInfos.emplace_back(
-            resources_->GetSampler(GetParamStr(AppConstants::MainSampler))->GetHandle(),
-            resources_->GetImageView(GetParamStr(AppConstants::MeshImage), GetParamStr(AppConstants::MeshImageView))
-                    ->GetHandle(),
-            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-
-    ImageWriteRequest samplerUpdateRequest;
-    samplerUpdateRequest.LayoutName = GetParamStr(AppConstants::MainDescSetLayout);
-    samplerUpdateRequest.BindingIndex = 0;
-    samplerUpdateRequest.Images = imageSamplerInfos;
-    samplerUpdateRequest.Type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-
-    const DescriptorUpdateInfo descriptorSetUpdateInfo = {.ImageWriteRequests = {samplerUpdateRequest}};
-
-    resources_->UpdateDescriptorSet(descriptorSetUpdateInfo);
+    return GetParamStr(AppConstants::MeshImage) + std::to_string(textureIndex);
 }
 
 void VulkanApplication::CreateCommandBuffers()
@@ -359,11 +509,103 @@ void VulkanApplication::CreateCommandBuffers()
     }
 }
 
+void VulkanApplication::CreateOccluders()
+{
+    if (!params_.Get<bool>(AppSettings::SoftwareOcclusion)) {
+        return;
+    }
+
+    // Model has no simplified occluder meshes, so the render meshes are used (they are inside of their own bounds)
+    occluderMeshes_.clear();
+    for (const auto& mesh: lanternModel_->Meshes) {
+        OccluderMesh occluder;
+        occluder.Positions.reserve(mesh.Vertices.size());
+        for (const auto& vertex: mesh.Vertices) {
+            occluder.Positions.push_back(vertex.Position);
+        }
+        occluder.Indices.assign(mesh.Indices.begin(), mesh.Indices.end());
+        occluderMeshes_.push_back(std::move(occluder));
+    }
+
+    occlusionCuller_ = std::make_unique<SoftwareOcclusionCuller>(
+            std::max(currentWindowWidth_ / occlusionBufferScale, 1u),
+            std::max(currentWindowHeight_ / occlusionBufferScale, 1u));
+}
+
+void VulkanApplication::CullAndSortDraws()
+{
+    // Cull entities with the world bounds of their meshes in the hierarchy, then draw only the visible ones
+    const glm::mat4 modelScale = glm::scale(glm::mat4(1.0f), glm::vec3(0.1f));
+    drawItems_.clear();
+    worldBounds_.Resize(sceneRegistry_.GetPool<MeshComponent>().Size());
+    sceneRegistry_.Each<MeshComponent, TransformComponent, BoundsComponent>(
+            [&](const Entity&, const MeshComponent& mesh, const TransformComponent& transform,
+                const BoundsComponent& bounds) {
+                const glm::mat4 model = modelScale * transform.World;
+                worldBounds_.SetTransformed(drawItems_.size(), bounds.Min, bounds.Max, model);
+                // Meshes without a material use the first one
+                const auto materialIndex =
+                        static_cast<std::uint32_t>(std::max(lanternModel_->Meshes[mesh.MeshIndex].MaterialIndex, 0));
+                drawItems_.push_back({mesh.MeshIndex, mesh.IndexCount, materialIndex, model});
+            });
+    worldBounds_.Resize(drawItems_.size());
+    if (bvh_.GetObjectIndices().size() != drawItems_.size()) {
+        bvh_.Build(worldBounds_);
+    } else {
+        for (std::uint32_t i = 0; i < drawItems_.size(); ++i) {
+            const glm::vec3 center{worldBounds_.CenterX[i], worldBounds_.CenterY[i], worldBounds_.CenterZ[i]};
+            const glm::vec3 extent{worldBounds_.ExtentX[i], worldBounds_.ExtentY[i], worldBounds_.ExtentZ[i]};
+            bvh_.SetObjectBounds(i, center - extent, center + extent);
+        }
+        bvh_.Refit();
+    }
+    bvh_.CullFrustum(camera_->GetFrustum(), visibleIndices_);
+
+    // Frustum visible entities are rasterized as occluders on the CPU and the ones which are hidden behind them are
+    // removed before their draw calls are recorded
+    const glm::mat4 viewProjection = camera_->GetProjectionMatrix() * camera_->GetViewMatrix();
+    const std::vector<std::uint32_t>* drawIndices = &visibleIndices_;
+    if (occlusionCuller_) {
+        const auto occlusionStart = std::chrono::steady_clock::now();
+        occlusionCuller_->BeginFrame(viewProjection);
+        for (const auto visibleIndex: visibleIndices_) {
+            const auto& drawItem = drawItems_[visibleIndex];
+            occlusionCuller_->AddOccluder(occluderMeshes_[drawItem.MeshIndex], drawItem.Model);
+        }
+        occlusionCuller_->Rasterize();
+        occlusionCuller_->CullOccluded(worldBounds_, visibleIndices_, occlusionVisibleIndices_);
+        drawIndices = &occlusionVisibleIndices_;
+
+        occlusionTimeSum_ +=
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - occlusionStart).count();
+        occlusionSavedDrawSum_ += visibleIndices_.size() - occlusionVisibleIndices_.size();
+        ++occlusionFrameCount_;
+        PrintOcclusionStats();
+    }
+
+    // Visible draws are sorted by their state keys (front to back inside of the same state, the model has only opaque
+    // materials) and the binds which are the same as the previous draw are skipped
+    drawList_.Clear();
+    for (const auto visibleIndex: *drawIndices) {
+        const auto& drawItem = drawItems_[visibleIndex];
+        const glm::vec4 center{worldBounds_.CenterX[visibleIndex], worldBounds_.CenterY[visibleIndex],
+                               worldBounds_.CenterZ[visibleIndex], 1.0f};
+        drawList_.Add({.Pass = DrawPass::Opaque,
+                       .Pipeline = 0,
+                       .Material = drawItem.MaterialIndex,
+                       .Mesh = drawItem.MeshIndex,
+                       .Depth = (viewProjection * center).w},
+                      visibleIndex);
+    }
+    drawList_.Sort();
+}
+
 void VulkanApplication::RecordPresentCommandBuffers(const std::uint32_t currentImageIndex)
 {
-    std::array<VkClearValue, 2> clearValues{};
-    clearValues[0].color = params_.Get<VkClearColorValue>(AppSettings::ClearColor);
+    std::array<VkClearValue, 3> clearValues{};
+    clearValues[0].color = GetParam(clearColorKey_);
     clearValues[1].depthStencil = {1.0f, 0};
+    clearValues[2].color.uint32[0] = emptyObjectId;
 
     const auto& currentCmdBuffer = cmdBuffersPresent_[currentImageIndex];
 
@@ -376,42 +618,206 @@ void VulkanApplication::RecordPresentCommandBuffers(const std::uint32_t currentI
                 beginInfo.framebuffer = framebuffers_[currentImageIndex]->GetHandle();
                 beginInfo.renderArea.offset = {0, 0};
                 beginInfo.renderArea.extent = VkExtent2D(currentWindowWidth_, currentWindowHeight_);
-                beginInfo.clearValueCount = clearValues.size();
+                beginInfo.clearValueCount = isGpuPickingEnabled_ ? 3 : 2;
                 beginInfo.pClearValues = clearValues.data();
             },
             VK_SUBPASS_CONTENTS_INLINE);
-    currentCmdBuffer->BindPipeline(pipeline_, VK_PIPELINE_BIND_POINT_GRAPHICS);
-    const std::vector descSets{resources_->GetDescriptorSet(GetParamStr(AppConstants::MainDescSetLayout))};
-    currentCmdBuffer->BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_, 0, descSets);
-
-    // Draw meshes
-    for (const auto& node: lanternModel_->Nodes) {
-        if (node.MeshIndex == UINT32_MAX) {
-            continue;
+
+    // Draw list is built before the recording, only the binds and draws are recorded here
+    const glm::mat4 viewProjection = camera_->GetProjectionMatrix() * camera_->GetViewMatrix();
+    drawList_.Emit([&](const std::uint32_t visibleIndex, const DrawStateChanges& changes) {
+        const auto& drawItem = drawItems_[visibleIndex];
+
+        if (changes.Pipeline) {
+            currentCmdBuffer->BindPipeline(pipeline_, VK_PIPELINE_BIND_POINT_GRAPHICS);
+        }
+        if (changes.Material) {
+            const auto& bindings = materialBindings_[drawItem.MaterialIndex];
+            const std::vector descSets{resources_->GetCachedDescriptorSet(mainDescLayoutHandle_, bindings)};
+            currentCmdBuffer->BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_, 0, descSets);
+        }
+        if (changes.Mesh) {
+            const auto& meshBuffers = meshBufferHandles_[drawItem.MeshIndex];
+            const std::vector vertexBuffers{resources_->GetBuffer(meshBuffers.VertexBuffer)};
+            currentCmdBuffer->BindVertexBuffers(vertexBuffers, 0, 1, {0});
+            currentCmdBuffer->BindIndexBuffer(resources_->GetBuffer(meshBuffers.IndexBuffer));
+        }
+
+        if (isGpuPickingEnabled_) {
+            PickingMvpData mvpData{};
+            mvpData.mvpMatrix = viewProjection * drawItem.Model;
+            mvpData.objectId = visibleIndex;
+            currentCmdBuffer->PushConstants(pipelineLayout_, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(PickingMvpData),
+                                            &mvpData);
+        } else {
+            MvpData mvpData{};
+            mvpData.mvpMatrix = viewProjection * drawItem.Model;
+            currentCmdBuffer->PushConstants(pipelineLayout_, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(MvpData), &mvpData);
         }
 
-        const auto mesh = lanternModel_->Meshes[node.MeshIndex];
+        currentCmdBuffer->DrawIndexed(drawItem.IndexCount, 1, 0, 0, 0);
+    });
+    PrintDrawListStats();
 
-        MvpData mvpData{};
-        glm::mat4 scale = glm::scale(glm::mat4(1.0f), glm::vec3(0.1f));
-        mvpData.mvpMatrix = camera_->GetProjectionMatrix() * camera_->GetViewMatrix() * scale * node.WorldTransform;
-        currentCmdBuffer->PushConstants(pipelineLayout_, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(MvpData), &mvpData);
+    currentCmdBuffer->EndRenderPass();
 
-        const std::vector vertexBuffers{resources_->GetBuffer(mesh.GetVertexBufferName())};
-        currentCmdBuffer->BindVertexBuffers(vertexBuffers, 0, 1, {0});
-        currentCmdBuffer->BindIndexBuffer(resources_->GetBuffer(mesh.GetIndexBufferName()));
-        currentCmdBuffer->DrawIndexed(mesh.Indices.size(), 1, 0, 0, 0);
+    // Only one pick is in flight, a click before its result is read is ignored
+    if (isPickRequested_ && !isPickPending_) {
+        RecordPickReadback(currentCmdBuffer);
+        isPickRequested_ = false;
     }
 
-    currentCmdBuffer->EndRenderPass();
     if (!currentCmdBuffer->EndCommandBuffer()) {
         throw std::runtime_error("Failed to end recording command buffer!");
     }
 }
 
+void VulkanApplication::RecordPickReadback(const std::shared_ptr<VulkanCommandBuffer>& cmdBuffer)
+{
+    // Cursor is disabled, so the rectangle is centered on the screen (clamped for windows smaller than it)
+    const auto width = std::min(pickRectSize, currentWindowWidth_);
+    const auto height = std::min(pickRectSize, currentWindowHeight_);
+    pickRect_.offset = {static_cast<std::int32_t>((currentWindowWidth_ - width) / 2),
+                        static_cast<std::int32_t>((currentWindowHeight_ - height) / 2)};
+    pickRect_.extent = {width, height};
+
+    const auto objectIdImage = resources_->GetImage(objectIdImage_);
+    const auto attachmentToTransfer = objectIdImage->CreateImageMemoryBarrier(
+            VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+    cmdBuffer->PipelineBarrier(VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                               {attachmentToTransfer});
+
+    VkBufferImageCopy copyRegion{};
+    copyRegion.bufferOffset = 0;
+    copyRegion.bufferRowLength = 0;
+    copyRegion.bufferImageHeight = 0;
+    copyRegion.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    copyRegion.imageOffset = {pickRect_.offset.x, pickRect_.offset.y, 0};
+    copyRegion.imageExtent = {width, height, 1};
+    cmdBuffer->CopyImageToBuffer(objectIdImage, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                                 resources_->GetBuffer(pickingReadbackBuffer_), {copyRegion});
+
+    VkMemoryBarrier transferToHost{};
+    transferToHost.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    transferToHost.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    transferToHost.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    cmdBuffer->PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, {}, {}, {transferToHost});
+
+    // Submission of this frame signals the fence of the current index
+    isPickPending_ = true;
+    pickFenceIndex_ = currentIndex_;
+    pickFrameNumber_ = frameNumber_;
+}
+
+void VulkanApplication::ReadPickResult()
+{
+    // Fence of the current index was waited by the frame pacing, fences of the other frames are only polled
+    if (!isPickPending_ || !inFlightFences_[pickFenceIndex_]->IsSignaled()) {
+        return;
+    }
+    isPickPending_ = false;
+
+    const auto pixelCount = pickRect_.extent.width * pickRect_.extent.height;
+    std::array<std::uint32_t, pickRectSize * pickRectSize> objectIds{};
+    auto* readbackBuffer = resources_->GetBufferResource(pickingReadbackBuffer_);
+    readbackBuffer->MapMemory();
+    std::memcpy(objectIds.data(), readbackBuffer->GetMappedData(), pixelCount * sizeof(std::uint32_t));
+    readbackBuffer->UnmapMemory();
+
+    // Nearest written pixel to the center of the rectangle wins
+    const auto centerX = static_cast<std::int32_t>(pickRect_.extent.width / 2);
+    const auto centerY = static_cast<std::int32_t>(pickRect_.extent.height / 2);
+    std::uint32_t pickedId = emptyObjectId;
+    std::int32_t pickedDistance = INT32_MAX;
+    for (std::uint32_t i = 0; i < pixelCount; ++i) {
+        const auto dx = static_cast<std::int32_t>(i % pickRect_.extent.width) - centerX;
+        const auto dy = static_cast<std::int32_t>(i / pickRect_.extent.width) - centerY;
+        const auto distance = dx * dx + dy * dy;
+        if (objectIds[i] != emptyObjectId && distance < pickedDistance) {
+            pickedId = objectIds[i];
+            pickedDistance = distance;
+        }
+    }
+
+    const auto latency = frameNumber_ - pickFrameNumber_;
+    if (pickedId == emptyObjectId || pickedId >= drawItems_.size()) {
+        std::cout << "GPU picked nothing (" << latency << " frames later)" << std::endl;
+        return;
+    }
+
+    const auto& mesh = lanternModel_->Meshes[drawItems_[pickedId].MeshIndex];
+    std::cout << "GPU picked mesh \"" << mesh.Name << "\" (object " << pickedId << ", " << latency << " frames later)"
+              << std::endl;
+}
+
+void VulkanApplication::PrintOcclusionStats()
+{
+    // Statistics are printed once per second
+    occlusionElapsedTime_ += deltaTime_;
+    if (occlusionElapsedTime_ < 1.0) {
+        return;
+    }
+
+    const auto& stats = occlusionCuller_->GetStats();
+    std::cout << "Software occlusion (" << GetSoftwareOcclusionBackend() << ", "
+              << occlusionCuller_->GetWorkerCount() + 1 << " threads): "
+              << occlusionTimeSum_ / occlusionFrameCount_ << " ms/frame, "
+              << static_cast<double>(occlusionSavedDrawSum_) / occlusionFrameCount_ << " draws saved/frame, "
+              << stats.OccluderTriangleCount << " occluder triangles, " << stats.TestedCount << " tested" << std::endl;
+
+    occlusionElapsedTime_ = 0.0;
+    occlusionTimeSum_ = 0.0;
+    occlusionSavedDrawSum_ = 0;
+    occlusionFrameCount_ = 0;
+}
+
+void VulkanApplication::PrintDrawListStats()
+{
+    // Statistics are printed once per second
+    drawListElapsedTime_ += deltaTime_;
+    if (drawListElapsedTime_ < 1.0) {
+        return;
+    }
+    drawListElapsedTime_ = 0.0;
+
+    const auto& stats = drawList_.GetStats();
+    std::cout << "Draw list: " << stats.DrawCount << " draws, binds avoided: " << stats.PipelineBindsAvoided
+              << " pipeline, " << stats.MaterialBindsAvoided << " material, " << stats.MeshBindsAvoided << " mesh"
+              << std::endl;
+
+    auto& descriptorSetCache = resources_->GetDescriptorSetCache();
+    std::cout << "Descriptor set cache: " << descriptorSetCache.GetHitCount() << " hits, "
+              << descriptorSetCache.GetMissCount() << " misses, " << descriptorSetCache.GetEvictionCount()
+              << " evictions, " << descriptorSetCache.GetCachedSetCount() << " cached sets" << std::endl;
+    descriptorSetCache.ResetStatistics();
+}
+
+void VulkanApplication::ResolveParamKeys()
+{
+    maxFramesInFlightKey_ = ResolveParam<std::uint32_t>(AppConstants::MaxFramesInFlight);
+    clearColorKey_ = ResolveParam<VkClearColorValue>(AppSettings::ClearColor);
+    mouseSensitivityKey_ = ResolveParam<float>(AppSettings::MouseSensitivity);
+    cameraSpeedKey_ = ResolveParam<float>(AppSettings::CameraSpeed);
+}
+
+void VulkanApplication::PickObject() const
+{
+    const glm::mat4 viewProjection = camera_->GetProjectionMatrix() * camera_->GetViewMatrix();
+    const RayHit hit = bvh_.CastRay(CreateScreenRay(viewProjection, glm::vec2(0.0f)));
+    if (hit.ObjectIndex == UINT32_MAX || hit.ObjectIndex >= drawItems_.size()) {
+        std::cout << "Picked nothing" << std::endl;
+        return;
+    }
+
+    const auto& mesh = lanternModel_->Meshes[drawItems_[hit.ObjectIndex].MeshIndex];
+    std::cout << "Picked mesh \"" << mesh.Name << "\" (object " << hit.ObjectIndex << ") at distance " << hit.Distance
+              << std::endl;
+}
+
 void VulkanApplication::ProcessInput() const
 {
-    const float cameraSpeed = GetParamFloat(AppSettings::CameraSpeed) * static_cast<float>(deltaTime_);
+    const float cameraSpeed = GetParam(cameraSpeedKey_) * static_cast<float>(deltaTime_);
     if (window_->IsKeyPressed(GLFW_KEY_W)) {
         camera_->Move(camera_->GetFrontVector() * cameraSpeed);
     }
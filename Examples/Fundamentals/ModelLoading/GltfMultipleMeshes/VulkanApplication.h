@@ -12,11 +12,18 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "ApplicationData.h"
 #include "ApplicationModelLoading.h"
+#include "BoundingVolumeHierarchy.h"
+#include "DrawList.h"
+#include "FrustumCulling.h"
 #include "ModelLoader.h"
 #include "PerspectiveCamera.h"
+#include "SceneComponents.h"
+#include "SoftwareOcclusion.h"
 #include "VulkanCommandBuffer.h"
 #include "VulkanPipeline.h"
 #include "VulkanPipelineLayout.h"
@@ -49,24 +56,106 @@ private:
 
     void CreatePipeline();
 
-    void UpdateDescriptorSets() const;
+    void CreateFramebuffers();
+
+    [[nodiscard]] std::string GetTextureImageName(std::uint32_t textureIndex) const;
 
     void CreateCommandBuffers();
 
+    void CreateOccluders();
+
+    void CullAndSortDraws();
+
     void RecordPresentCommandBuffers(std::uint32_t currentImageIndex);
 
+    void RecordPickReadback(const std::shared_ptr<common::vulkan_wrapper::VulkanCommandBuffer>& cmdBuffer);
+
+    void ReadPickResult();
+
+    void PrintOcclusionStats();
+
+    void PrintDrawListStats();
+
     void ProcessInput() const;
 
+    void PickObject() const;
+
+    void ResolveParamKeys();
+
     std::uint32_t currentIndex_ = 0;
     std::uint32_t currentWindowWidth_ = UINT32_MAX;
     std::uint32_t currentWindowHeight_ = UINT32_MAX;
     VkFormat depthImageFormat_ = VK_FORMAT_UNDEFINED;
+    std::uint64_t frameNumber_ = 0;
+
+    // Pre-resolved parameter keys for per-frame reads
+    common::utility::ParamKey<std::uint32_t> maxFramesInFlightKey_;
+    common::utility::ParamKey<VkClearColorValue> clearColorKey_;
+    common::utility::ParamKey<float> mouseSensitivityKey_;
+    common::utility::ParamKey<float> cameraSpeedKey_;
 
     // Models
     std::shared_ptr<common::utility::GltfModelHandler> lanternModel_;
 
-    // Textures
-    common::utility::TextureHandler lanternMeshTextureHandler_;
+    // Renderable entities of the model, the draw loop streams their dense component arrays
+    common::utility::SceneRegistry sceneRegistry_;
+
+    // Frustum culling of the entities, draw items and world bounds are rebuilt every frame. World bounds, draw items
+    // and the objects of the hierarchy have the same order, the visible list keeps indices of all of them. The
+    // hierarchy is built once and refitted when the world bounds change.
+    struct DrawItem
+    {
+        std::uint32_t MeshIndex;
+        std::uint32_t IndexCount;
+        std::uint32_t MaterialIndex;
+        glm::mat4 Model;
+    };
+    std::vector<DrawItem> drawItems_;
+    common::utility::BoundsArrays worldBounds_;
+    common::utility::BoundingVolumeHierarchy bvh_;
+    std::vector<std::uint32_t> visibleIndices_;
+
+    // Software occlusion culling of the frustum visible entities. Meshes of the visible entities are the occluders
+    // (indexed with mesh index), the statistics are accumulated and printed once per second.
+    std::unique_ptr<common::utility::SoftwareOcclusionCuller> occlusionCuller_;
+    std::vector<common::utility::OccluderMesh> occluderMeshes_;
+    std::vector<std::uint32_t> occlusionVisibleIndices_;
+    double occlusionElapsedTime_ = 0.0;
+    double occlusionTimeSum_ = 0.0;
+    std::uint64_t occlusionSavedDrawSum_ = 0;
+    std::uint32_t occlusionFrameCount_ = 0;
+
+    // GPU picking, draws write their draw item index to the object ID attachment. A click copies the pixels around the
+    // center of the screen to the readback buffer and they are read when the fence of that frame is signaled, so the
+    // CPU never waits for the copy.
+    bool isGpuPickingEnabled_ = false;
+    bool isPickRequested_ = false;
+    bool isPickPending_ = false;
+    std::uint32_t pickFenceIndex_ = 0;
+    std::uint64_t pickFrameNumber_ = 0;
+    VkRect2D pickRect_{};
+    common::vulkan_framework::ImageHandle objectIdImage_;
+    common::vulkan_framework::BufferHandle pickingReadbackBuffer_;
+
+    // Visible draws are recorded in the sort key order of the draw list, its bind statistics are printed once per
+    // second
+    common::utility::DrawList drawList_;
+    double drawListElapsedTime_ = 0.0;
+
+    // Resource handles which are used in the per-frame code (indexed with mesh index)
+    struct MeshBufferHandles
+    {
+        common::vulkan_framework::BufferHandle VertexBuffer;
+        common::vulkan_framework::BufferHandle IndexBuffer;
+    };
+    std::vector<MeshBufferHandles> meshBufferHandles_;
+    common::vulkan_framework::DescriptorLayoutHandle mainDescLayoutHandle_;
+
+    // Textures, every used base color texture has an image. Bindings of the materials (indexed with material index)
+    // are the keys of their sets in the descriptor set cache.
+    std::vector<std::uint32_t> materialTextureIndices_;
+    std::vector<std::uint32_t> usedTextureIndices_;
+    std::vector<std::vector<common::vulkan_framework::DescriptorSetBinding>> materialBindings_;
 
     // Pipelines
     std::shared_ptr<common::vulkan_wrapper::VulkanPipelineLayout> pipelineLayout_;
@@ -0,0 +1,54 @@
+/**
+ * @file    AppConfig.h
+ * @brief   This header file keeps key names for user-provided config key names.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include "AppCommonConfig.h"
+
+namespace examples::fundamentals::model_loading::gltf_skinning
+{
+namespace AppConstants
+{
+    constexpr auto MaxFramesInFlight = "AppConstants.MaxFramesInFlight";
+    constexpr auto BaseShaderType = "AppConstants.BaseShaderType";
+    constexpr auto MainVertexShaderFile = "AppConstants.MainVertexShaderFile";
+    constexpr auto MainFragmentShaderFile = "AppConstants.MainFragmentShaderFile";
+    constexpr auto SkinningComputeShaderFile = "AppConstants.SkinningComputeShaderFile";
+    constexpr auto MainVertexShaderKey = "AppConstants.MainVertexShaderKey";
+    constexpr auto MainFragmentShaderKey = "AppConstants.MainFragmentShaderKey";
+    constexpr auto SkinningComputeShaderKey = "AppConstants.SkinningComputeShaderKey";
+
+    // Resources
+    constexpr auto DepthImage = "AppConstants.DepthImage";
+    constexpr auto DepthImageView = "AppConstants.DepthImageView";
+    constexpr auto SkinnedModelPath = "AppConstants.SkinnedModelPath";
+    constexpr auto SkinningDescSetLayout = "AppConstants.SkinningDescSetLayout";
+    constexpr auto BindPoseBuffer = "AppConstants.BindPoseBuffer";
+    constexpr auto InstanceBuffer = "AppConstants.InstanceBuffer";
+    constexpr auto UploadStagingBuffer = "AppConstants.UploadStagingBuffer";
+    constexpr auto JointPaletteBuffer = "AppConstants.JointPaletteBuffer";
+    constexpr auto SkinnedVertexBuffer = "AppConstants.SkinnedVertexBuffer";
+    constexpr auto SkinnedIndexBuffer = "AppConstants.SkinnedIndexBuffer";
+    constexpr auto SkinnedReadbackBuffer = "AppConstants.SkinnedReadbackBuffer";
+} // namespace AppConstants
+
+namespace AppSettings
+{
+    constexpr auto ClearColor = "AppSettings.ClearColor";
+    constexpr auto MouseSensitivity = "AppSettings.MouseSensitivity";
+    constexpr auto CameraSpeed = "AppSettings.CameraSpeed";
+    constexpr auto AnimationIndex = "AppSettings.AnimationIndex";
+    constexpr auto PlaybackSpeed = "AppSettings.PlaybackSpeed";
+    constexpr auto InstanceCount = "AppSettings.InstanceCount";
+    constexpr auto PoseCount = "AppSettings.PoseCount";
+    constexpr auto InstanceSpacing = "AppSettings.InstanceSpacing";
+    constexpr auto VerifySkinning = "AppSettings.VerifySkinning";
+} // namespace AppSettings
+} // namespace examples::fundamentals::model_loading::gltf_skinning
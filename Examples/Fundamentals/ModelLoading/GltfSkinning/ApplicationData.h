@@ -0,0 +1,62 @@
+/**
+ * @file    ApplicationData.h
+ * @brief   This header file keeps user-provided application data (vertices, indices etc.).
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "glm/glm.hpp"
+
+namespace examples::fundamentals::model_loading::gltf_skinning
+{
+// Skinned vertex (written by the skinning compute shader and read by the vertex shader as 6 floats per vertex)
+struct SkinnedVertex
+{
+    glm::vec3 Position;
+    glm::vec3 Normal;
+};
+
+// View projection matrix and the vertex range of the drawn mesh node (for Push Constants)
+struct DrawPushConstants
+{
+    glm::mat4 ViewProjection;
+    std::uint32_t VertexCount; // Skinned vertices of one instance
+    std::uint32_t VertexBase;  // First vertex of the mesh node in an instance
+};
+
+// Bind pose vertex of the skinning compute shader (std430 layout), joints are indices in the palette of a pose
+struct SkinVertex
+{
+    glm::vec4 Position;
+    glm::vec4 Normal;
+    glm::uvec4 Joints;
+    glm::vec4 Weights;
+};
+
+// Placement and pose of a skinned instance (std430 layout)
+struct SkinInstance
+{
+    glm::vec4 Offset; // xyz: world position of the instance
+    std::uint32_t PoseIndex;
+    std::uint32_t Padding[3];
+};
+
+// Push constants of the skinning compute shader
+struct SkinningPushConstants
+{
+    std::uint32_t VertexCount;   // Skinned vertices of one instance
+    std::uint32_t InstanceCount;
+    std::uint32_t JointCount;    // Palette matrices of one pose
+    std::uint32_t PaletteBase;   // First palette matrix of the current frame
+};
+
+// Work group size of the skinning compute shader (local_size_x)
+inline constexpr std::uint32_t skinningGroupSize = 64;
+} // namespace examples::fundamentals::model_loading::gltf_skinning
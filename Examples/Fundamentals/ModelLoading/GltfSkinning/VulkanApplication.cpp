@@ -0,0 +1,717 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include "VulkanApplication.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <span>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+
+#include "AppConfig.h"
+#include "ApplicationData.h"
+#include "VulkanHelpers.h"
+#include "VulkanShaderModule.h"
+
+namespace examples::fundamentals::model_loading::gltf_skinning
+{
+using namespace common::utility;
+using namespace common::vulkan_wrapper;
+using namespace common::vulkan_framework;
+using namespace common::window_wrapper;
+
+VulkanApplication::VulkanApplication(ParameterServer&& params) : ApplicationModelLoading(std::move(params)) {}
+
+bool VulkanApplication::Init()
+{
+    try {
+        ResolveParamKeys();
+
+        verifyPending_ = params_.Get<bool>(AppSettings::VerifySkinning);
+
+        currentWindowWidth_ = GetParamU32(WindowParams::Width);
+        currentWindowHeight_ = GetParamU32(WindowParams::Height);
+
+        float aspectRatio = static_cast<float>(currentWindowWidth_) / static_cast<float>(currentWindowHeight_);
+        camera_ = std::make_unique<PerspectiveCamera>(glm::vec3(0.0f, 4.0f, 12.0f), aspectRatio);
+
+        InitInputSystem();
+
+        CreateDefaultSurface();
+        SelectDefaultPhysicalDevice();
+        CreateDefaultLogicalDevice();
+        CreateDefaultQueue();
+        CreateDefaultSwapChain();
+        CreateDefaultCommandPool();
+        CreateDefaultSyncObjects(GetParamU32(AppConstants::MaxFramesInFlight));
+
+        CreateResources();
+        InitResources();
+
+        CreateRenderPass();
+        CreatePipeline();
+        CreateSkinningPipeline();
+        CreateDefaultFramebuffers(resources_->GetImageView(GetParamStr(AppConstants::DepthImage),
+                                                           GetParamStr(AppConstants::DepthImageView)));
+        CreateCommandBuffers();
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return false;
+    }
+
+    return true;
+}
+
+void VulkanApplication::DrawFrame()
+{
+    inFlightFences_[currentIndex_]->WaitForFence(true, UINT64_MAX);
+    inFlightFences_[currentIndex_]->ResetFence();
+
+    // Joint matrices of all poses are written to the palette region of this frame, which is not used by the GPU anymore
+    const std::uint32_t paletteBase = currentIndex_ * poseCount_ * jointCount_;
+    resources_->UpdateBuffer(jointPaletteBuffer_, poseMatrices_.data(), poseMatrices_.size() * sizeof(glm::mat4),
+                             static_cast<std::uint64_t>(paletteBase) * sizeof(glm::mat4));
+    skinningPushConstants_.PaletteBase = paletteBase;
+
+    uint32_t imageIndex = swapChain_->AcquireNextImage(imageAvailableSemaphores_[currentIndex_], nullptr);
+
+    RecordPresentCommandBuffers(imageIndex);
+
+    if (swapImagesFences_[imageIndex] != nullptr) {
+        swapImagesFences_[imageIndex]->WaitForFence(true, UINT64_MAX);
+    }
+
+    swapImagesFences_[imageIndex] = inFlightFences_[currentIndex_];
+
+    queue_->Submit({cmdBuffersPresent_[imageIndex]}, {imageAvailableSemaphores_[currentIndex_]},
+                   {renderFinishedSemaphores_[imageIndex]}, inFlightFences_[currentIndex_],
+                   {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT});
+
+    if (verifyPending_) {
+        VerifySkinning();
+        verifyPending_ = false;
+    }
+
+    queue_->Present({swapChain_}, {imageIndex}, {renderFinishedSemaphores_[imageIndex]});
+
+    currentIndex_ = (currentIndex_ + 1) % GetParam(maxFramesInFlightKey_);
+}
+
+void VulkanApplication::PreUpdate()
+{
+    // Poll events
+    ApplicationModelLoading::PreUpdate();
+
+    // Process continuous inputs
+    ProcessInput();
+
+    UpdatePoses();
+}
+
+void VulkanApplication::InitInputSystem()
+{
+    lastX_ = static_cast<float>(currentWindowWidth_) / 2.0f;
+    lastY_ = static_cast<float>(currentWindowHeight_) / 2.0f;
+
+    window_->DisableCursor();
+
+    window_->OnMouseMove([&](const MouseMoveEvent& event) {
+        const auto xPos = static_cast<float>(event.X);
+        const auto yPos = static_cast<float>(event.Y);
+
+        if (firstMouseTriggered_) {
+            lastX_ = xPos;
+            lastY_ = yPos;
+            firstMouseTriggered_ = false;
+        }
+
+        float xOffset = xPos - lastX_;
+        float yOffset = lastY_ - yPos;
+        lastX_ = xPos;
+        lastY_ = yPos;
+
+        const float sensitivity = GetParam(mouseSensitivityKey_) * static_cast<float>(deltaTime_);
+        xOffset *= sensitivity;
+        yOffset *= sensitivity;
+
+        camera_->Rotate(xOffset, yOffset);
+    });
+}
+
+void VulkanApplication::CollectSkinnedMeshes()
+{
+    // Vertices and indices of all skinned mesh nodes are packed together. Joint indices are moved to the palette range
+    // of the node's skin, so the compute shader indexes one palette per pose without knowing about the skins.
+    for (std::uint32_t nodeIndex = 0; nodeIndex < skinnedModel_->Nodes.size(); ++nodeIndex) {
+        const auto& node = skinnedModel_->Nodes[nodeIndex];
+        if (node.MeshIndex == UINT32_MAX || node.SkinIndex == UINT32_MAX) {
+            continue;
+        }
+
+        const auto& mesh = skinnedModel_->Meshes[node.MeshIndex];
+        const auto skinJointCount = static_cast<std::uint32_t>(skinnedModel_->Skins[node.SkinIndex].Joints.size());
+        skinnedDraws_.push_back({.NodeIndex = nodeIndex,
+                                 .IndexCount = static_cast<std::uint32_t>(mesh.Indices.size()),
+                                 .FirstIndex = static_cast<std::uint32_t>(skinnedIndices_.size()),
+                                 .VertexBase = static_cast<std::int32_t>(bindPoseVertices_.size()),
+                                 .PaletteBase = jointCount_});
+
+        for (const auto& vertex: mesh.Vertices) {
+            for (int i = 0; i < 4; ++i) {
+                if (vertex.Weights[i] > 0.0f && vertex.Joints[i] >= skinJointCount) {
+                    throw std::runtime_error("Joint index of the skinned mesh is out of its skin!");
+                }
+            }
+
+            // Weights are normalized, quantized weights don't always sum up to one
+            const float weightSum = vertex.Weights.x + vertex.Weights.y + vertex.Weights.z + vertex.Weights.w;
+            bindPoseVertices_.push_back({.Position = glm::vec4(vertex.Position, 1.0f),
+                                         .Normal = glm::vec4(vertex.Normal, 0.0f),
+                                         .Joints = vertex.Joints + glm::uvec4(jointCount_),
+                                         .Weights = weightSum > 0.0f ? vertex.Weights / weightSum : vertex.Weights});
+        }
+        skinnedIndices_.insert(skinnedIndices_.end(), mesh.Indices.begin(), mesh.Indices.end());
+        jointCount_ += skinJointCount;
+    }
+
+    if (skinnedDraws_.empty()) {
+        throw std::runtime_error("Model doesn't have a skinned mesh!");
+    }
+    vertexCount_ = static_cast<std::uint32_t>(bindPoseVertices_.size());
+}
+
+void VulkanApplication::CreateResources()
+{
+    depthImageFormat_ = physicalDevice_->FindSupportedFormat(
+            {VK_FORMAT_D32_SFLOAT, VK_FORMAT_D32_SFLOAT_S8_UINT, VK_FORMAT_D24_UNORM_S8_UINT},
+            VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT);
+
+    // Load models
+    ModelLoader modelLoader{ASSETS_DIR};
+    skinnedModel_ = modelLoader.LoadBinaryGltfFromFile(GetParamStr(AppConstants::SkinnedModelPath));
+    if (!skinnedModel_) {
+        throw std::runtime_error("Failed to load skinned model!");
+    }
+
+    // Animation is optional, a model without animations is drawn in its rest pose
+    const auto animationIndex = GetParamU32(AppSettings::AnimationIndex);
+    if (animationIndex < skinnedModel_->Animations.size()) {
+        animationSampler_ = std::make_unique<AnimationSampler>(skinnedModel_->Animations[animationIndex]);
+    }
+
+    CollectSkinnedMeshes();
+
+    // Instances are placed on a grid, every instance plays one of the poses (same animation with a time offset)
+    const auto limits = physicalDevice_->GetProperties().limits;
+    instanceCount_ = GetParamU32(AppSettings::InstanceCount);
+    poseCount_ = std::max(GetParamU32(AppSettings::PoseCount), 1u);
+    if (instanceCount_ == 0 || instanceCount_ > limits.maxComputeWorkGroupCount[1]) {
+        throw std::runtime_error("Instance count is out of the dispatch limits!");
+    }
+
+    const auto spacing = GetParamFloat(AppSettings::InstanceSpacing);
+    const auto gridSize = static_cast<std::uint32_t>(std::ceil(std::sqrt(static_cast<float>(instanceCount_))));
+    instances_.resize(instanceCount_);
+    for (std::uint32_t i = 0; i < instanceCount_; ++i) {
+        const float x = (static_cast<float>(i % gridSize) - static_cast<float>(gridSize - 1) / 2.0f) * spacing;
+        const float z = -static_cast<float>(i / gridSize) * spacing;
+        instances_[i] = {.Offset = glm::vec4(x, 0.0f, z, 0.0f), .PoseIndex = i % poseCount_, .Padding = {}};
+    }
+    poseMatrices_.resize(static_cast<std::size_t>(poseCount_) * jointCount_);
+
+    const std::uint64_t skinnedBufferSize =
+            static_cast<std::uint64_t>(vertexCount_) * instanceCount_ * sizeof(SkinnedVertex);
+    if (skinnedBufferSize > limits.maxStorageBufferRange) {
+        throw std::runtime_error("Skinned vertex buffer is too large, please decrease the instance count!");
+    }
+
+    std::cout << "Skinning " << instanceCount_ << " instances of " << vertexCount_ << " vertices (" << jointCount_
+              << " joints, " << poseCount_ << " poses) on the GPU" << std::endl;
+
+    const auto bindPoseSize = static_cast<std::uint32_t>(bindPoseVertices_.size() * sizeof(SkinVertex));
+    const auto instanceSize = static_cast<std::uint32_t>(instances_.size() * sizeof(SkinInstance));
+    const auto paletteSize = static_cast<std::uint32_t>(poseMatrices_.size() * sizeof(glm::mat4) *
+                                                        GetParamU32(AppConstants::MaxFramesInFlight));
+    const auto indexSize = static_cast<std::uint32_t>(skinnedIndices_.size() * sizeof(std::uint16_t));
+
+    ResourceDescriptor resourceCreateInfo;
+
+    // Bind pose and instances don't change, so they are copied to device local memory once. Skinned vertices are
+    // written by the compute shader and read by the vertex shader, only the GPU accesses them.
+    std::vector<BufferResourceCreateInfo> bufferCreateInfos = {
+        {GetParamStr(AppConstants::BindPoseBuffer), bindPoseSize,
+         VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT},
+        {GetParamStr(AppConstants::InstanceBuffer), instanceSize,
+         VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT},
+        {GetParamStr(AppConstants::UploadStagingBuffer), bindPoseSize + instanceSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT},
+        {GetParamStr(AppConstants::JointPaletteBuffer), paletteSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT},
+        {GetParamStr(AppConstants::SkinnedVertexBuffer), static_cast<std::uint32_t>(skinnedBufferSize),
+         VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT},
+        {GetParamStr(AppConstants::SkinnedIndexBuffer), indexSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT}};
+    if (verifyPending_) {
+        bufferCreateInfos.push_back({GetParamStr(AppConstants::SkinnedReadbackBuffer),
+                                     static_cast<std::uint32_t>(vertexCount_ * sizeof(SkinnedVertex)),
+                                     VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                     VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT});
+    }
+    resourceCreateInfo.Buffers = bufferCreateInfos;
+
+    // Fill shader module create infos
+    resourceCreateInfo.Shaders = {.BasePath = SHADERS_DIR,
+                                  .ShaderType = params_.Get<ShaderBaseType>(AppConstants::BaseShaderType),
+                                  .Modules = {{.Name = GetParamStr(AppConstants::MainVertexShaderKey),
+                                               .FileName = GetParamStr(AppConstants::MainVertexShaderFile)},
+                                              {.Name = GetParamStr(AppConstants::MainFragmentShaderKey),
+                                               .FileName = GetParamStr(AppConstants::MainFragmentShaderFile)},
+                                              {.Name = GetParamStr(AppConstants::SkinningComputeShaderKey),
+                                               .FileName = GetParamStr(AppConstants::SkinningComputeShaderFile)}}};
+
+    // Fill descriptor set create infos, the drawing pipeline uses the same set to read the skinned vertices
+    resourceCreateInfo.Descriptors = {
+        .MaxSets = 1,
+        .PoolSizes = {{VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 4}},
+        .Layouts = {{.Name = GetParamStr(AppConstants::SkinningDescSetLayout),
+                     .Bindings = {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+                                  {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+                                  {2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+                                  {3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1,
+                                   VK_SHADER_STAGE_COMPUTE_BIT | VK_SHADER_STAGE_VERTEX_BIT, nullptr}}}},
+        .DescriptorSets = {{.Name = GetParamStr(AppConstants::SkinningDescSetLayout),
+                            .LayoutName = GetParamStr(AppConstants::SkinningDescSetLayout)}}};
+
+    resourceCreateInfo.Images = {ImageResourceCreateInfo{
+        .Name = GetParamStr(AppConstants::DepthImage),
+        .MemProperties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+        .Format = depthImageFormat_,
+        .Dimensions = {currentWindowWidth_, currentWindowHeight_, 1},
+        .UsageFlags = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
+        .Views = {ImageViewCreateInfo{.ViewName = GetParamStr(AppConstants::DepthImageView),
+                                      .Format = depthImageFormat_,
+                                      .SubresourceRange = {.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT,
+                                                           .baseMipLevel = 0,
+                                                           .levelCount = 1,
+                                                           .baseArrayLayer = 0,
+                                                           .layerCount = 1}}}}};
+
+    CreateVulkanResources(resourceCreateInfo);
+
+    // Resolve handles once, draw loop doesn't look up resources by name
+    jointPaletteBuffer_ = resources_->GetBufferHandle(GetParamStr(AppConstants::JointPaletteBuffer));
+    skinnedVertexBuffer_ = resources_->GetBufferHandle(GetParamStr(AppConstants::SkinnedVertexBuffer));
+    skinnedIndexBuffer_ = resources_->GetBufferHandle(GetParamStr(AppConstants::SkinnedIndexBuffer));
+    skinningDescSet_ = resources_->GetDescriptorSetHandle(GetParamStr(AppConstants::SkinningDescSetLayout));
+
+    skinningPushConstants_ = {.VertexCount = vertexCount_,
+                              .InstanceCount = instanceCount_,
+                              .JointCount = jointCount_,
+                              .PaletteBase = 0};
+}
+
+void VulkanApplication::InitResources()
+{
+    const auto bindPoseSize = bindPoseVertices_.size() * sizeof(SkinVertex);
+    const auto instanceSize = instances_.size() * sizeof(SkinInstance);
+    const auto& stagingBufferName = GetParamStr(AppConstants::UploadStagingBuffer);
+    resources_->SetBuffer(GetParamStr(AppConstants::SkinnedIndexBuffer), skinnedIndices_.data(),
+                          skinnedIndices_.size() * sizeof(std::uint16_t));
+    resources_->UpdateBuffer(stagingBufferName, bindPoseVertices_.data(), bindPoseSize, 0);
+    resources_->UpdateBuffer(stagingBufferName, instances_.data(), instanceSize, bindPoseSize);
+
+    const auto cmdBufferTransfer = cmdPool_->CreateCommandBuffers(1, VK_COMMAND_BUFFER_LEVEL_PRIMARY).front();
+    if (!cmdBufferTransfer->BeginCommandBuffer(
+                [](auto& beginInfo) { beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT; })) {
+        throw std::runtime_error("Failed to begin recording command buffer!");
+    }
+
+    const auto stagingBuffer = resources_->GetBuffer(stagingBufferName);
+    cmdBufferTransfer->CopyBuffer(stagingBuffer, resources_->GetBuffer(GetParamStr(AppConstants::BindPoseBuffer)),
+                                  {VkBufferCopy{0, 0, bindPoseSize}});
+    cmdBufferTransfer->CopyBuffer(stagingBuffer, resources_->GetBuffer(GetParamStr(AppConstants::InstanceBuffer)),
+                                  {VkBufferCopy{bindPoseSize, 0, instanceSize}});
+
+    if (!cmdBufferTransfer->EndCommandBuffer()) {
+        throw std::runtime_error("Failed to end recording command buffer!");
+    }
+
+    // Directly submit this command buffer to queue, staging buffer isn't needed after the copy
+    queue_->Submit({cmdBufferTransfer});
+    queue_->WaitIdle();
+    resources_->DeleteBuffer(stagingBufferName);
+
+    UpdateDescriptorSets();
+    UpdatePoses();
+}
+
+void VulkanApplication::UpdateDescriptorSets() const
+{
+    const std::array bufferNames{GetParamStr(AppConstants::BindPoseBuffer), GetParamStr(AppConstants::InstanceBuffer),
+                                 GetParamStr(AppConstants::JointPaletteBuffer),
+                                 GetParamStr(AppConstants::SkinnedVertexBuffer)};
+
+    DescriptorUpdateInfo descriptorSetUpdateInfo;
+    for (std::uint32_t binding = 0; binding < bufferNames.size(); ++binding) {
+        BufferWriteRequest bufferUpdateRequest;
+        bufferUpdateRequest.LayoutName = GetParamStr(AppConstants::SkinningDescSetLayout);
+        bufferUpdateRequest.BindingIndex = binding;
+        bufferUpdateRequest.Buffers = {{resources_->GetBuffer(bufferNames[binding])->GetHandle(), 0, VK_WHOLE_SIZE}};
+        bufferUpdateRequest.Type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        descriptorSetUpdateInfo.BufferWriteRequests.push_back(bufferUpdateRequest);
+    }
+
+    resources_->UpdateDescriptorSet(descriptorSetUpdateInfo);
+}
+
+void VulkanApplication::CreateRenderPass()
+{
+    VkAttachmentReference colorAttachmentRef{0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+
+    VkAttachmentReference depthAttachmentRef{1, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL};
+
+    renderPass_ = device_->CreateRenderPass([&](auto& builder) {
+        builder.AddAttachment([](auto& attachmentCreateInfo) {
+                   attachmentCreateInfo.format = VK_FORMAT_B8G8R8A8_SRGB;
+                   attachmentCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+                   attachmentCreateInfo.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+                   attachmentCreateInfo.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+                   attachmentCreateInfo.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+                   attachmentCreateInfo.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+                   attachmentCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+                   attachmentCreateInfo.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+               })
+                .AddAttachment([&](auto& attachmentCreateInfo) {
+                    attachmentCreateInfo.format = depthImageFormat_;
+                    attachmentCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+                    attachmentCreateInfo.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+                    attachmentCreateInfo.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+                    attachmentCreateInfo.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+                    attachmentCreateInfo.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+                    attachmentCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+                    attachmentCreateInfo.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+                })
+                .AddSubpass([&](auto& subpassCreateInfo) {
+                    subpassCreateInfo.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+                    subpassCreateInfo.colorAttachmentCount = 1;
+                    subpassCreateInfo.pColorAttachments = &colorAttachmentRef;
+                    subpassCreateInfo.pDepthStencilAttachment = &depthAttachmentRef;
+                });
+    });
+
+    if (!renderPass_) {
+        throw std::runtime_error("Failed to create render pass!");
+    }
+}
+
+void VulkanApplication::CreatePipeline()
+{
+    // Skinned vertices are written in the world space and read from the storage buffer, so the pipeline doesn't have
+    // a vertex input and a model matrix
+    VkPushConstantRange drawPushConstant;
+    drawPushConstant.offset = 0;
+    drawPushConstant.size = sizeof(DrawPushConstants);
+    drawPushConstant.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+
+    pipelineLayout_ = device_->CreatePipelineLayout(
+            {resources_->GetDescriptorLayout(GetParamStr(AppConstants::SkinningDescSetLayout))}, {drawPushConstant});
+
+    if (!pipelineLayout_) {
+        throw std::runtime_error("Failed to create pipeline layout!");
+    }
+
+    VkViewport viewport{0,    0,   static_cast<float>(currentWindowWidth_), static_cast<float>(currentWindowHeight_),
+                        0.0f, 1.0f};
+    VkRect2D scissor{0, 0, currentWindowWidth_, currentWindowHeight_};
+
+    VkPipelineColorBlendAttachmentState colorBlendAttachment;
+    colorBlendAttachment.blendEnable = VK_FALSE;
+    colorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.colorBlendOp = VK_BLEND_OP_ADD;
+    colorBlendAttachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+    colorBlendAttachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO;
+    colorBlendAttachment.alphaBlendOp = VK_BLEND_OP_ADD;
+    colorBlendAttachment.colorWriteMask =
+            VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+
+    pipeline_ = device_->CreateGraphicsPipeline(pipelineLayout_, renderPass_, [&](auto& builder) {
+        builder.AddShaderStage([&](auto& shaderStageCreateInfo) {
+            shaderStageCreateInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;
+            shaderStageCreateInfo.module =
+                    resources_->GetShaderModule(GetParamStr(AppConstants::MainVertexShaderKey))->GetHandle();
+        });
+        builder.AddShaderStage([&](auto& shaderStageCreateInfo) {
+            shaderStageCreateInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+            shaderStageCreateInfo.module =
+                    resources_->GetShaderModule(GetParamStr(AppConstants::MainFragmentShaderKey))->GetHandle();
+        });
+        builder.SetViewportState([&](auto& viewportStateCreateInfo) {
+            viewportStateCreateInfo.viewportCount = 1;
+            viewportStateCreateInfo.pViewports = &viewport;
+            viewportStateCreateInfo.scissorCount = 1;
+            viewportStateCreateInfo.pScissors = &scissor;
+        });
+        builder.SetColorBlendState([&](auto& blendStateCreateInfo) {
+            blendStateCreateInfo.attachmentCount = 1;
+            blendStateCreateInfo.pAttachments = &colorBlendAttachment;
+        });
+        builder.SetDepthStencilState([&](auto& depthStencilStateCreateInfo) {
+            depthStencilStateCreateInfo.depthTestEnable = VK_TRUE;
+            depthStencilStateCreateInfo.depthWriteEnable = VK_TRUE;
+            depthStencilStateCreateInfo.depthCompareOp = VK_COMPARE_OP_LESS;
+        });
+    });
+
+    if (!pipeline_) {
+        throw std::runtime_error("Failed to create graphics pipeline!");
+    }
+}
+
+void VulkanApplication::CreateSkinningPipeline()
+{
+    const auto queueFamilyProperties = physicalDevice_->GetQueueFamilyProperties();
+    if (!(queueFamilyProperties[currentQueueFamilyIndex_].queueFlags & VK_QUEUE_COMPUTE_BIT)) {
+        throw std::runtime_error("Selected queue family doesn't support compute operations!");
+    }
+
+    const VkPushConstantRange pushConstantRange{VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(SkinningPushConstants)};
+    skinningPipelineLayout_ = device_->CreatePipelineLayout(
+            {resources_->GetDescriptorLayout(GetParamStr(AppConstants::SkinningDescSetLayout))}, {pushConstantRange});
+
+    if (!skinningPipelineLayout_) {
+        throw std::runtime_error("Failed to create skinning pipeline layout!");
+    }
+
+    skinningPipeline_ = device_->CreateComputePipeline(skinningPipelineLayout_, [&](auto& builder) {
+        builder.SetShaderStage([&](auto& shaderStageCreateInfo) {
+            shaderStageCreateInfo.module =
+                    resources_->GetShaderModule(GetParamStr(AppConstants::SkinningComputeShaderKey))->GetHandle();
+        });
+    });
+
+    if (!skinningPipeline_) {
+        throw std::runtime_error("Failed to create skinning pipeline!");
+    }
+}
+
+void VulkanApplication::CreateCommandBuffers()
+{
+    cmdBuffersPresent_ = cmdPool_->CreateCommandBuffers(framebuffers_.size(), VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+
+    if (cmdBuffersPresent_.empty()) {
+        throw std::runtime_error("Failed to create command buffers!");
+    }
+}
+
+void VulkanApplication::RecordPresentCommandBuffers(const std::uint32_t currentImageIndex)
+{
+    std::array<VkClearValue, 2> clearValues{};
+    clearValues[0].color = GetParam(clearColorKey_);
+    clearValues[1].depthStencil = {1.0f, 0};
+
+    const auto& currentCmdBuffer = cmdBuffersPresent_[currentImageIndex];
+
+    if (!currentCmdBuffer->BeginCommandBuffer(nullptr)) {
+        throw std::runtime_error("Failed to begin recording command buffer!");
+    }
+
+    RecordSkinningDispatch(currentCmdBuffer);
+
+    currentCmdBuffer->BeginRenderPass(
+            [&](auto& beginInfo) {
+                beginInfo.renderPass = renderPass_->GetHandle();
+                beginInfo.framebuffer = framebuffers_[currentImageIndex]->GetHandle();
+                beginInfo.renderArea.offset = {0, 0};
+                beginInfo.renderArea.extent = VkExtent2D(currentWindowWidth_, currentWindowHeight_);
+                beginInfo.clearValueCount = clearValues.size();
+                beginInfo.pClearValues = clearValues.data();
+            },
+            VK_SUBPASS_CONTENTS_INLINE);
+    currentCmdBuffer->BindPipeline(pipeline_, VK_PIPELINE_BIND_POINT_GRAPHICS);
+
+    const std::vector descSets{resources_->GetDescriptorSet(skinningDescSet_)};
+    currentCmdBuffer->BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout_, 0, descSets);
+    currentCmdBuffer->BindIndexBuffer(resources_->GetBuffer(skinnedIndexBuffer_));
+
+    // One instanced draw per skinned mesh node, so the recorded commands don't depend on the instance count. Vertex
+    // shader reads the range of the instance in the skinned vertex buffer with the instance index and the vertex base.
+    DrawPushConstants drawPushConstants{.ViewProjection = camera_->GetProjectionMatrix() * camera_->GetViewMatrix(),
+                                        .VertexCount = vertexCount_,
+                                        .VertexBase = 0};
+    for (const auto& draw: skinnedDraws_) {
+        drawPushConstants.VertexBase = static_cast<std::uint32_t>(draw.VertexBase);
+        currentCmdBuffer->PushConstants(pipelineLayout_, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(DrawPushConstants),
+                                        &drawPushConstants);
+        currentCmdBuffer->DrawIndexed(draw.IndexCount, instanceCount_, draw.FirstIndex, 0, 0);
+    }
+
+    currentCmdBuffer->EndRenderPass();
+    if (!currentCmdBuffer->EndCommandBuffer()) {
+        throw std::runtime_error("Failed to end recording command buffer!");
+    }
+}
+
+void VulkanApplication::RecordSkinningDispatch(const std::shared_ptr<VulkanCommandBuffer>& cmdBuffer) const
+{
+    const auto skinnedBuffer = resources_->GetBuffer(skinnedVertexBuffer_)->GetHandle();
+
+    // Vertex shader reads of the previous frame must be finished before the skinned vertices are overwritten
+    VkBufferMemoryBarrier readBarrier{};
+    readBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    readBarrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    readBarrier.dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    readBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    readBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    readBarrier.buffer = skinnedBuffer;
+    readBarrier.offset = 0;
+    readBarrier.size = VK_WHOLE_SIZE;
+    cmdBuffer->PipelineBarrier(VK_PIPELINE_STAGE_VERTEX_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, {},
+                               {readBarrier});
+
+    // One invocation per vertex (x) of every instance (y)
+    cmdBuffer->BindPipeline(skinningPipeline_, VK_PIPELINE_BIND_POINT_COMPUTE);
+    const std::vector descSets{resources_->GetDescriptorSet(skinningDescSet_)};
+    cmdBuffer->BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, skinningPipelineLayout_, 0, descSets);
+    cmdBuffer->PushConstants(skinningPipelineLayout_, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(SkinningPushConstants),
+                             &skinningPushConstants_);
+    cmdBuffer->Dispatch((vertexCount_ + skinningGroupSize - 1) / skinningGroupSize, instanceCount_, 1);
+
+    // Skinned vertices must be written before they are read by the vertex shader
+    VkBufferMemoryBarrier writeBarrier = readBarrier;
+    writeBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    writeBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    cmdBuffer->PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT, {},
+                               {writeBarrier});
+}
+
+void VulkanApplication::UpdatePoses()
+{
+    // Time is wrapped in double precision, so a long running playback doesn't lose float precision
+    const float duration = animationSampler_ ? animationSampler_->GetAnimation().Duration : 0.0f;
+    if (animationSampler_) {
+        animationTime_ += deltaTime_ * GetParam(playbackSpeedKey_);
+        if (duration > 0.0f) {
+            animationTime_ = std::fmod(animationTime_, static_cast<double>(duration));
+        }
+    }
+
+    // Joint matrices are calculated once per pose (not per instance), so the CPU cost doesn't depend on the instance
+    // count. Poses are the same animation with evenly distributed time offsets.
+    for (std::uint32_t pose = 0; pose < poseCount_; ++pose) {
+        if (animationSampler_) {
+            const double poseOffset = static_cast<double>(duration) * pose / poseCount_;
+            animationSampler_->Sample(static_cast<float>(animationTime_ + poseOffset));
+            animationSampler_->Apply(*skinnedModel_);
+            skinnedModel_->NodeHierarchy.Update();
+        }
+
+        const std::span<glm::mat4> palette{poseMatrices_.data() + static_cast<std::size_t>(pose) * jointCount_,
+                                           jointCount_};
+        for (const auto& draw: skinnedDraws_) {
+            skinnedModel_->ComputeJointMatrices(skinnedModel_->Nodes[draw.NodeIndex].SkinIndex,
+                                                palette.subspan(draw.PaletteBase));
+        }
+    }
+}
+
+void VulkanApplication::VerifySkinning() const
+{
+    const auto cmdBufferTransfer = cmdPool_->CreateCommandBuffers(1, VK_COMMAND_BUFFER_LEVEL_PRIMARY).front();
+    if (!cmdBufferTransfer->BeginCommandBuffer(
+                [](auto& beginInfo) { beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT; })) {
+        throw std::runtime_error("Failed to begin recording command buffer!");
+    }
+
+    // Compute writes of the frame that was just submitted must be visible to the copy, and the copy to the host
+    VkMemoryBarrier computeToTransfer{};
+    computeToTransfer.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    computeToTransfer.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    computeToTransfer.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    cmdBufferTransfer->PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, {}, {},
+                                       {computeToTransfer});
+
+    // Only the first instance is read back
+    VkBufferCopy copyRegion{};
+    copyRegion.size = vertexCount_ * sizeof(SkinnedVertex);
+    const auto readbackHandle = resources_->GetBufferHandle(GetParamStr(AppConstants::SkinnedReadbackBuffer));
+    cmdBufferTransfer->CopyBuffer(resources_->GetBuffer(skinnedVertexBuffer_), resources_->GetBuffer(readbackHandle),
+                                  {copyRegion});
+
+    VkMemoryBarrier transferToHost{};
+    transferToHost.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    transferToHost.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    transferToHost.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    cmdBufferTransfer->PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, {}, {},
+                                       {transferToHost});
+
+    if (!cmdBufferTransfer->EndCommandBuffer()) {
+        throw std::runtime_error("Failed to end recording command buffer!");
+    }
+
+    queue_->Submit({cmdBufferTransfer});
+    queue_->WaitIdle();
+
+    std::vector<float> gpuVertices(static_cast<std::size_t>(vertexCount_) * 6);
+    auto* readbackBuffer = resources_->GetBufferResource(readbackHandle);
+    readbackBuffer->MapMemory();
+    std::memcpy(gpuVertices.data(), readbackBuffer->GetMappedData(), gpuVertices.size() * sizeof(float));
+    readbackBuffer->UnmapMemory();
+
+    // Reference vertices are skinned on the CPU with the same palette
+    const auto& instance = instances_.front();
+    const glm::mat4* palette = poseMatrices_.data() + static_cast<std::size_t>(instance.PoseIndex) * jointCount_;
+    float maxError = 0.0f;
+    for (std::uint32_t i = 0; i < vertexCount_; ++i) {
+        const auto& vertex = bindPoseVertices_[i];
+        glm::mat4 skinMatrix(0.0f);
+        for (int k = 0; k < 4; ++k) {
+            skinMatrix += vertex.Weights[k] * palette[vertex.Joints[k]];
+        }
+
+        const glm::vec3 position = glm::vec3(skinMatrix * vertex.Position) + glm::vec3(instance.Offset);
+        glm::vec3 normal = glm::mat3(skinMatrix) * glm::vec3(vertex.Normal);
+        normal = glm::length(normal) > 0.0f ? glm::normalize(normal) : normal;
+        for (int c = 0; c < 3; ++c) {
+            maxError = std::max(maxError, std::abs(position[c] - gpuVertices[i * 6 + c]));
+            maxError = std::max(maxError, std::abs(normal[c] - gpuVertices[i * 6 + 3 + c]));
+        }
+    }
+
+    constexpr float tolerance = 1e-3f;
+    std::cout << "Skinning readback (" << vertexCount_ << " vertices): max error " << maxError
+              << (maxError <= tolerance ? " (passed)" : " (failed)") << std::endl;
+}
+
+void VulkanApplication::ResolveParamKeys()
+{
+    maxFramesInFlightKey_ = ResolveParam<std::uint32_t>(AppConstants::MaxFramesInFlight);
+    clearColorKey_ = ResolveParam<VkClearColorValue>(AppSettings::ClearColor);
+    mouseSensitivityKey_ = ResolveParam<float>(AppSettings::MouseSensitivity);
+    cameraSpeedKey_ = ResolveParam<float>(AppSettings::CameraSpeed);
+    playbackSpeedKey_ = ResolveParam<float>(AppSettings::PlaybackSpeed);
+}
+
+void VulkanApplication::ProcessInput() const
+{
+    const float cameraSpeed = GetParam(cameraSpeedKey_) * static_cast<float>(deltaTime_);
+    if (window_->IsKeyPressed(GLFW_KEY_W)) {
+        camera_->Move(camera_->GetFrontVector() * cameraSpeed);
+    }
+    if (window_->IsKeyPressed(GLFW_KEY_S)) {
+        camera_->Move(-camera_->GetFrontVector() * cameraSpeed);
+    }
+    if (window_->IsKeyPressed(GLFW_KEY_A)) {
+        camera_->Move(-camera_->GetRightVector() * cameraSpeed);
+    }
+    if (window_->IsKeyPressed(GLFW_KEY_D)) {
+        camera_->Move(camera_->GetRightVector() * cameraSpeed);
+    }
+}
+} // namespace examples::fundamentals::model_loading::gltf_skinning
@@ -0,0 +1,140 @@
+/**
+ * @file    VulkanApplication.h
+ * @brief   This file contains VulkanApplication implementation.
+ * @author  Mustafa Yemural (myemural)
+ * @date    18.10.2025
+ *
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "AnimationSampler.h"
+#include "ApplicationData.h"
+#include "ApplicationModelLoading.h"
+#include "ModelLoader.h"
+#include "PerspectiveCamera.h"
+#include "VulkanCommandBuffer.h"
+#include "VulkanPipeline.h"
+#include "VulkanPipelineLayout.h"
+#include "Window.h"
+
+namespace examples::fundamentals::model_loading::gltf_skinning
+{
+class VulkanApplication final : public base::ApplicationModelLoading
+{
+public:
+    explicit VulkanApplication(common::utility::ParameterServer&& params);
+
+    ~VulkanApplication() override = default;
+
+protected:
+    bool Init() override;
+
+    void DrawFrame() override;
+
+    void PreUpdate() override;
+
+private:
+    void InitInputSystem();
+
+    void CollectSkinnedMeshes();
+
+    void CreateResources();
+
+    void InitResources();
+
+    void UpdateDescriptorSets() const;
+
+    void CreateRenderPass();
+
+    void CreatePipeline();
+
+    void CreateSkinningPipeline();
+
+    void CreateCommandBuffers();
+
+    void RecordPresentCommandBuffers(std::uint32_t currentImageIndex);
+
+    void RecordSkinningDispatch(const std::shared_ptr<common::vulkan_wrapper::VulkanCommandBuffer>& cmdBuffer) const;
+
+    void ProcessInput() const;
+
+    void UpdatePoses();
+
+    void VerifySkinning() const;
+
+    void ResolveParamKeys();
+
+    std::uint32_t currentIndex_ = 0;
+    std::uint32_t currentWindowWidth_ = UINT32_MAX;
+    std::uint32_t currentWindowHeight_ = UINT32_MAX;
+    VkFormat depthImageFormat_ = VK_FORMAT_UNDEFINED;
+
+    // Pre-resolved parameter keys for per-frame reads
+    common::utility::ParamKey<std::uint32_t> maxFramesInFlightKey_;
+    common::utility::ParamKey<VkClearColorValue> clearColorKey_;
+    common::utility::ParamKey<float> mouseSensitivityKey_;
+    common::utility::ParamKey<float> cameraSpeedKey_;
+    common::utility::ParamKey<float> playbackSpeedKey_;
+
+    // Models
+    std::shared_ptr<common::utility::GltfModelHandler> skinnedModel_;
+
+    // Animation
+    std::unique_ptr<common::utility::AnimationSampler> animationSampler_;
+    double animationTime_ = 0.0;
+
+    // Skinned mesh nodes of the model. Vertices of all of them are skinned together, so one instance is a contiguous
+    // range of vertexCount_ vertices in the skinned vertex buffer.
+    struct SkinnedDraw
+    {
+        std::uint32_t NodeIndex;
+        std::uint32_t IndexCount;
+        std::uint32_t FirstIndex;
+        std::int32_t VertexBase;
+        std::uint32_t PaletteBase; // First matrix of the node's skin in the palette of a pose
+    };
+    std::vector<SkinnedDraw> skinnedDraws_;
+    std::vector<SkinVertex> bindPoseVertices_;
+    std::vector<std::uint16_t> skinnedIndices_;
+    std::vector<SkinInstance> instances_;
+    std::uint32_t vertexCount_ = 0;
+    std::uint32_t jointCount_ = 0;
+    std::uint32_t instanceCount_ = 0;
+    std::uint32_t poseCount_ = 0;
+
+    // Joint matrices of all poses, uploaded to the region of the current frame in the palette buffer
+    std::vector<glm::mat4> poseMatrices_;
+    SkinningPushConstants skinningPushConstants_{};
+    bool verifyPending_ = false;
+
+    // Resource handles which are used in the per-frame code
+    common::vulkan_framework::BufferHandle jointPaletteBuffer_;
+    common::vulkan_framework::BufferHandle skinnedVertexBuffer_;
+    common::vulkan_framework::BufferHandle skinnedIndexBuffer_;
+    common::vulkan_framework::DescriptorSetHandle skinningDescSet_;
+
+    // Pipelines
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipelineLayout> pipelineLayout_;
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipeline> pipeline_;
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipelineLayout> skinningPipelineLayout_;
+    std::shared_ptr<common::vulkan_wrapper::VulkanPipeline> skinningPipeline_;
+
+    // Command buffers
+    std::vector<std::shared_ptr<common::vulkan_wrapper::VulkanCommandBuffer>> cmdBuffersPresent_;
+
+    // Mouse related values
+    bool firstMouseTriggered_ = true;
+    float lastX_ = 0.0f;
+    float lastY_ = 0.0f;
+
+    // Camera
+    std::unique_ptr<common::utility::PerspectiveCamera> camera_;
+};
+} // namespace examples::fundamentals::model_loading::gltf_skinning
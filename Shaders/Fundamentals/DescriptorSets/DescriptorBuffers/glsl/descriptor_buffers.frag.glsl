@@ -0,0 +1,21 @@
+#version 450
+
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+layout(set = 0, binding = 0) uniform UBO {
+    mat4 model;
+    vec4 color;
+} ubo;
+
+layout(location = 0) out vec4 outColor;
+
+void main()
+{
+    outColor = ubo.color;
+}
@@ -0,0 +1,16 @@
+#version 450
+
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+layout(location = 0) out vec4 outColor;
+
+void main()
+{
+    outColor = vec4(1.0, 0.6, 0.0, 1.0);
+}
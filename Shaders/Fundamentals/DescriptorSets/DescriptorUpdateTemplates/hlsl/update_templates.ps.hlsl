@@ -0,0 +1,12 @@
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+float4 main() : SV_Target
+{
+    return float4(1.0, 0.6, 0.0, 1.0);
+}
\ No newline at end of file
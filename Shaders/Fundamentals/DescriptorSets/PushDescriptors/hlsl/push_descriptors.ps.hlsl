@@ -0,0 +1,20 @@
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+struct UBO
+{
+    float4x4 model;
+    float4 color;
+};
+
+cbuffer ubo : register(b0, space0) { UBO ubo; }
+
+float4 main() : SV_Target
+{
+    return ubo.color;
+}
\ No newline at end of file
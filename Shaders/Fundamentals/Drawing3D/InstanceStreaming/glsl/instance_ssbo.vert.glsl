@@ -0,0 +1,37 @@
+#version 450
+
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec2 inUV;
+
+layout(location = 0) out vec2 fragUV;
+layout(location = 1) out vec4 fragColor;
+
+struct InstanceData {
+    vec4 positionScale;
+    vec4 color;
+};
+
+// Region of the current frame is selected with the dynamic offset
+layout(std430, set = 0, binding = 0) readonly buffer InstanceBuffer {
+    InstanceData instances[];
+};
+
+layout(push_constant) uniform PushConstants {
+    mat4 viewProjection;
+} pc;
+
+void main()
+{
+    const InstanceData instance = instances[gl_InstanceIndex];
+    fragUV = inUV;
+    fragColor = instance.color;
+    gl_Position = pc.viewProjection * vec4(inPosition * instance.positionScale.w + instance.positionScale.xyz, 1.0);
+}
@@ -0,0 +1,22 @@
+#version 450
+
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+layout(location = 0) in vec2 fragUV;
+layout(location = 1) in vec4 fragColor;
+
+layout(location = 0) out vec4 outColor;
+
+void main()
+{
+    // Darker face edges, so neighbour cubes can be distinguished without lighting
+    const float edgeDistance = min(min(fragUV.x, 1.0 - fragUV.x), min(fragUV.y, 1.0 - fragUV.y));
+    const float shade = mix(0.4, 1.0, smoothstep(0.0, 0.08, edgeDistance));
+    outColor = vec4(fragColor.rgb * shade, fragColor.a);
+}
@@ -0,0 +1,30 @@
+#version 450
+
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec2 inUV;
+
+// Per-instance attributes (VK_VERTEX_INPUT_RATE_INSTANCE)
+layout(location = 2) in vec4 inPositionScale;
+layout(location = 3) in vec4 inColor;
+
+layout(location = 0) out vec2 fragUV;
+layout(location = 1) out vec4 fragColor;
+
+layout(push_constant) uniform PushConstants {
+    mat4 viewProjection;
+} pc;
+
+void main()
+{
+    fragUV = inUV;
+    fragColor = inColor;
+    gl_Position = pc.viewProjection * vec4(inPosition * inPositionScale.w + inPositionScale.xyz, 1.0);
+}
@@ -0,0 +1,47 @@
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+struct VSInput
+{
+    [[vk::location(0)]] float3 pos : POSITION;
+    [[vk::location(1)]] float2 uv : TEXCOORD0;
+    uint instanceID : SV_InstanceID;
+};
+
+struct InstanceData
+{
+    float4 positionScale;
+    float4 color;
+};
+
+// Region of the current frame is selected with the dynamic offset
+[[vk::binding(0, 0)]] StructuredBuffer<InstanceData> instances;
+
+struct PushConstants {
+    float4x4 viewProjection;
+};
+[[vk::push_constant]] PushConstants pc;
+
+struct VSOutput
+{
+    float4 Position : SV_POSITION;
+    [[vk::location(0)]] float2 Uv : TEXCOORD0;
+    [[vk::location(1)]] float4 Color : COLOR0;
+};
+
+VSOutput main(VSInput input)
+{
+    const InstanceData instance = instances[input.instanceID];
+    const float3 worldPos = input.pos * instance.positionScale.w + instance.positionScale.xyz;
+
+    VSOutput output = (VSOutput)0;
+    output.Position = mul(pc.viewProjection, float4(worldPos, 1.0));
+    output.Uv = input.uv;
+    output.Color = instance.color;
+    return output;
+}
\ No newline at end of file
@@ -0,0 +1,21 @@
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+struct PSInput
+{
+    [[vk::location(0)]] float2 uv : TEXCOORD0;
+    [[vk::location(1)]] float4 color : COLOR0;
+};
+
+float4 main(PSInput input) : SV_Target
+{
+    // Darker face edges, so neighbour cubes can be distinguished without lighting
+    const float edgeDistance = min(min(input.uv.x, 1.0 - input.uv.x), min(input.uv.y, 1.0 - input.uv.y));
+    const float shade = lerp(0.4, 1.0, smoothstep(0.0, 0.08, edgeDistance));
+    return float4(input.color.rgb * shade, input.color.a);
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+struct VSInput
+{
+    [[vk::location(0)]] float3 pos : POSITION;
+    [[vk::location(1)]] float2 uv : TEXCOORD0;
+    [[vk::location(2)]] float4 positionScale : TEXCOORD1; // Per-instance (VK_VERTEX_INPUT_RATE_INSTANCE)
+    [[vk::location(3)]] float4 color : COLOR0;            // Per-instance (VK_VERTEX_INPUT_RATE_INSTANCE)
+};
+
+struct PushConstants {
+    float4x4 viewProjection;
+};
+[[vk::push_constant]] PushConstants pc;
+
+struct VSOutput
+{
+    float4 Position : SV_POSITION;
+    [[vk::location(0)]] float2 Uv : TEXCOORD0;
+    [[vk::location(1)]] float4 Color : COLOR0;
+};
+
+VSOutput main(VSInput input)
+{
+    VSOutput output = (VSOutput)0;
+    output.Position = mul(pc.viewProjection, float4(input.pos * input.positionScale.w + input.positionScale.xyz, 1.0));
+    output.Uv = input.uv;
+    output.Color = input.color;
+    return output;
+}
\ No newline at end of file
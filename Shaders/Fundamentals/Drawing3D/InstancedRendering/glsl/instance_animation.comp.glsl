@@ -0,0 +1,55 @@
+#version 450
+
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+
+struct CubeAnimation {
+    vec4 position;         // xyz: position
+    vec4 axisAngularSpeed; // xyz: normalized rotation axis, w: angular speed (radians per second)
+};
+
+layout(std430, set = 0, binding = 0) readonly buffer AnimationBuffer {
+    CubeAnimation cubes[];
+};
+
+// Region of the current frame is selected with the dynamic offset, the vertex shader reads it as its storage buffer
+layout(std430, set = 0, binding = 1) writeonly buffer TransformBuffer {
+    mat4 mvp[];
+};
+
+layout(push_constant) uniform PushConstants {
+    mat4 viewProjection;
+    float time;
+    uint instanceCount;
+} pc;
+
+void main()
+{
+    const uint index = gl_GlobalInvocationID.x;
+    if (index >= pc.instanceCount) {
+        return;
+    }
+
+    const CubeAnimation cube = cubes[index];
+    const float halfAngle = 0.5 * pc.time * cube.axisAngularSpeed.w;
+    const vec3 q = cube.axisAngularSpeed.xyz * sin(halfAngle);
+    const float w = cos(halfAngle);
+
+    // Rotation matrix of the quaternion (same with glm::mat4_cast) and translation
+    const float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    const float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+    const float wx = w * q.x, wy = w * q.y, wz = w * q.z;
+    const mat4 model = mat4(vec4(1.0 - 2.0 * (yy + zz), 2.0 * (xy + wz), 2.0 * (xz - wy), 0.0),
+                            vec4(2.0 * (xy - wz), 1.0 - 2.0 * (xx + zz), 2.0 * (yz + wx), 0.0),
+                            vec4(2.0 * (xz + wy), 2.0 * (yz - wx), 1.0 - 2.0 * (xx + yy), 0.0),
+                            vec4(cube.position.xyz, 1.0));
+
+    mvp[index] = pc.viewProjection * model;
+}
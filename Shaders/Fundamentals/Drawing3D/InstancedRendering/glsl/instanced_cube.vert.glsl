@@ -13,12 +13,13 @@ layout(location = 1) in vec2 inUV;
 
 layout(location = 0) out vec2 fragUV;
 
-layout(set = 0, binding = 1) uniform UBO {
-    mat4 mvp[20];
-} ubo;
+// Region of the current frame is selected with the dynamic offset, it is written by the CPU or the compute shader
+layout(std430, set = 0, binding = 1) readonly buffer TransformBuffer {
+    mat4 mvp[];
+};
 
 void main()
 {
     fragUV = inUV;
-    gl_Position = ubo.mvp[gl_InstanceIndex] * vec4(inPosition, 1.0);
+    gl_Position = mvp[gl_InstanceIndex] * vec4(inPosition, 1.0);
 }
\ No newline at end of file
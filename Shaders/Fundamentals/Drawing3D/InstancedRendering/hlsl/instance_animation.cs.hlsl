@@ -0,0 +1,50 @@
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+struct CubeAnimation
+{
+    float4 position;         // xyz: position
+    float4 axisAngularSpeed; // xyz: normalized rotation axis, w: angular speed (radians per second)
+};
+
+[[vk::binding(0, 0)]] StructuredBuffer<CubeAnimation> cubes;
+
+// Region of the current frame is selected with the dynamic offset, the vertex shader reads it as its storage buffer
+[[vk::binding(1, 0)]] RWStructuredBuffer<float4x4> mvp;
+
+struct PushConstants {
+    float4x4 viewProjection;
+    float time;
+    uint instanceCount;
+};
+[[vk::push_constant]] PushConstants pc;
+
+[numthreads(64, 1, 1)]
+void main(uint3 dispatchThreadID : SV_DispatchThreadID)
+{
+    const uint index = dispatchThreadID.x;
+    if (index >= pc.instanceCount) {
+        return;
+    }
+
+    const CubeAnimation cube = cubes[index];
+    const float halfAngle = 0.5 * pc.time * cube.axisAngularSpeed.w;
+    const float3 q = cube.axisAngularSpeed.xyz * sin(halfAngle);
+    const float w = cos(halfAngle);
+
+    // Rotation matrix of the quaternion (same with glm::mat4_cast) and translation, rows are the columns of glm
+    const float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    const float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+    const float wx = w * q.x, wy = w * q.y, wz = w * q.z;
+    const float4x4 model = transpose(float4x4(float4(1.0 - 2.0 * (yy + zz), 2.0 * (xy + wz), 2.0 * (xz - wy), 0.0),
+                                              float4(2.0 * (xy - wz), 1.0 - 2.0 * (xx + zz), 2.0 * (yz + wx), 0.0),
+                                              float4(2.0 * (xz + wy), 2.0 * (yz - wx), 1.0 - 2.0 * (xx + yy), 0.0),
+                                              float4(cube.position.xyz, 1.0)));
+
+    mvp[index] = mul(pc.viewProjection, model);
+}
\ No newline at end of file
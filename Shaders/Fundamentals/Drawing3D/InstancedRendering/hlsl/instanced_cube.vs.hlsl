@@ -13,11 +13,8 @@ struct VSInput
     uint instanceID : SV_InstanceID;
 };
 
-struct UBO
-{
-    float4x4 mvp[20];
-};
-[[vk::binding(1, 0)]] ConstantBuffer<UBO> ubo;
+// Region of the current frame is selected with the dynamic offset, it is written by the CPU or the compute shader
+[[vk::binding(1, 0)]] StructuredBuffer<float4x4> mvp;
 
 struct VSOutput
 {
@@ -28,7 +25,7 @@ struct VSOutput
 VSOutput main(VSInput input)
 {
     VSOutput output = (VSOutput)0;
-    output.Position = mul(ubo.mvp[input.instanceID], float4(input.pos, 1.0));
+    output.Position = mul(mvp[input.instanceID], float4(input.pos, 1.0));
     output.Uv = input.uv;
     return output;
 }
\ No newline at end of file
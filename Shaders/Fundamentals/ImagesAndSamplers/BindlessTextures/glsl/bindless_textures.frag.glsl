@@ -0,0 +1,22 @@
+#version 450
+#extension GL_EXT_nonuniform_qualifier : require
+
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+layout(location = 0) out vec4 outColor;
+layout(location = 0) in vec2 fragUV;
+layout(location = 1) flat in uint textureIndex;
+
+// Runtime sized texture array, its real size is given with variable descriptor count
+layout(set = 0, binding = 0) uniform sampler2D uTextures[];
+
+void main()
+{
+    outColor = texture(uTextures[nonuniformEXT(textureIndex)], fragUV);
+}
\ No newline at end of file
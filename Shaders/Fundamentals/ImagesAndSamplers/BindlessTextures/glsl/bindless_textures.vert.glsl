@@ -0,0 +1,27 @@
+#version 450
+
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+layout(location = 0) in vec2 inPosition;
+layout(location = 1) in vec2 inUV;
+
+// Per-instance data
+layout(location = 2) in vec2 inOffset;
+layout(location = 3) in float inScale;
+layout(location = 4) in uint inTextureIndex;
+
+layout(location = 0) out vec2 fragUV;
+layout(location = 1) flat out uint textureIndex;
+
+void main()
+{
+    gl_Position = vec4(inPosition * inScale + inOffset, 0.0, 1.0);
+    fragUV = inUV;
+    textureIndex = inTextureIndex;
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+struct PSInput
+{
+    [[vk::location(0)]] float2 uv : TEXCOORD0;
+    [[vk::location(1)]] nointerpolation uint textureIndex : TEXCOORD1;
+};
+
+// Runtime sized texture array, its real size is given with variable descriptor count
+[[vk::combinedImageSampler]][[vk::binding(0, 0)]] Texture2D uTextures[];
+[[vk::combinedImageSampler]][[vk::binding(0, 0)]] SamplerState uSamplers[];
+
+float4 main(PSInput input) : SV_Target
+{
+    uint index = NonUniformResourceIndex(input.textureIndex);
+    return uTextures[index].Sample(uSamplers[index], input.uv);
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+struct VSInput
+{
+    [[vk::location(0)]] float2 pos : POSITION;
+    [[vk::location(1)]] float2 uv : TEXCOORD0;
+
+    // Per-instance data
+    [[vk::location(2)]] float2 offset : TEXCOORD1;
+    [[vk::location(3)]] float scale : TEXCOORD2;
+    [[vk::location(4)]] uint textureIndex : TEXCOORD3;
+};
+
+struct VSOutput
+{
+    float4 Position : SV_POSITION;
+    [[vk::location(0)]] float2 Uv : TEXCOORD0;
+    [[vk::location(1)]] nointerpolation uint TextureIndex : TEXCOORD1;
+};
+
+VSOutput main(VSInput input)
+{
+    VSOutput output = (VSOutput)0;
+    output.Position = float4(input.pos * input.scale + input.offset, 0.0, 1.0);
+    output.Uv = input.uv;
+    output.TextureIndex = input.textureIndex;
+    return output;
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+#version 450
+
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+layout(location = 0) out vec4 outColor;
+layout(location = 0) in vec3 fragNormal;
+
+const vec3 lightDirection = vec3(0.3244, 0.8111, 0.4867); // normalize(0.4, 1.0, 0.6)
+const vec3 baseColor = vec3(0.8, 0.55, 0.25);
+
+void main()
+{
+    // Simple directional light, normals may be scaled by the animated node transforms
+    float diffuse = max(dot(normalize(fragNormal), lightDirection), 0.0);
+    outColor = vec4(baseColor * (0.2 + 0.8 * diffuse), 1.0);
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+#version 450
+
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec3 inNormal;
+
+layout(location = 0) out vec3 fragNormal;
+
+layout(push_constant) uniform PushConstants {
+    mat4 mvpMatrix;
+    mat4 modelMatrix;
+} pc;
+
+void main()
+{
+    fragNormal = mat3(pc.modelMatrix) * inNormal;
+    gl_Position = pc.mvpMatrix * vec4(inPosition, 1.0);
+}
\ No newline at end of file
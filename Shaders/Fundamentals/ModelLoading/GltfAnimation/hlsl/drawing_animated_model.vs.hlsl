@@ -0,0 +1,33 @@
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+struct VSInput
+{
+    [[vk::location(0)]] float3 pos : POSITION;
+    [[vk::location(1)]] float3 normal : NORMAL;
+};
+
+struct PushConstants {
+    float4x4 mvpMatrix;
+    float4x4 modelMatrix;
+};
+[[vk::push_constant]] PushConstants pc;
+
+struct VSOutput
+{
+    float4 Position : SV_POSITION;
+    [[vk::location(0)]] float3 Normal : NORMAL;
+};
+
+VSOutput main(VSInput input)
+{
+    VSOutput output = (VSOutput)0;
+    output.Position = mul(pc.mvpMatrix, float4(input.pos, 1.0));
+    output.Normal = mul((float3x3)pc.modelMatrix, input.normal);
+    return output;
+}
\ No newline at end of file
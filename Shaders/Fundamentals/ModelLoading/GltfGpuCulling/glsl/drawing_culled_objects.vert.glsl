@@ -0,0 +1,40 @@
+#version 450
+
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+struct CullObject {
+    mat4 model;
+    vec4 boundsCenter;
+    vec4 boundsExtent;
+    uint indexCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint padding;
+};
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec3 inNormal;
+layout(location = 2) in uint inObjectIndex; // Per-instance, selected by firstInstance of the draw command
+
+layout(location = 0) out vec3 fragNormal;
+
+layout(std430, set = 0, binding = 0) readonly buffer CullObjectBuffer {
+    CullObject objects[];
+};
+
+layout(push_constant) uniform PushConstants {
+    mat4 viewProjectionMatrix;
+} pc;
+
+void main()
+{
+    const mat4 modelMatrix = objects[inObjectIndex].model;
+    fragNormal = mat3(modelMatrix) * inNormal;
+    gl_Position = pc.viewProjectionMatrix * modelMatrix * vec4(inPosition, 1.0);
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+#version 450
+
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+
+struct CullObject {
+    mat4 model;
+    vec4 boundsCenter; // xyz: center of the world bounding box
+    vec4 boundsExtent; // xyz: half size of the world bounding box
+    uint indexCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint padding;
+};
+
+// Same layout with VkDrawIndexedIndirectCommand
+struct DrawCommand {
+    uint indexCount;
+    uint instanceCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint firstInstance;
+};
+
+layout(std430, set = 0, binding = 0) readonly buffer CullObjectBuffer {
+    CullObject objects[];
+};
+
+layout(std430, set = 0, binding = 1) writeonly buffer DrawCommandBuffer {
+    DrawCommand commands[];
+};
+
+layout(std430, set = 0, binding = 2) buffer DrawCountBuffer {
+    uint drawCount;
+};
+
+layout(push_constant) uniform PushConstants {
+    vec4 frustumPlanes[6];
+    uint objectCount;
+    uint compactDraws; // 1: visible commands are packed and counted, 0: culled commands have no instances
+    uint padding0;
+    uint padding1;
+} pc;
+
+// A box is outside of a plane if its center is farther than its projected radius behind it
+bool IsVisible(const vec3 center, const vec3 extent)
+{
+    for (int i = 0; i < 6; ++i) {
+        const vec4 plane = pc.frustumPlanes[i];
+        const float distance = dot(plane.xyz, center) + plane.w;
+        const float radius = dot(abs(plane.xyz), extent);
+        if (distance + radius < 0.0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void main()
+{
+    const uint objectIndex = gl_GlobalInvocationID.x;
+    if (objectIndex >= pc.objectCount) {
+        return;
+    }
+
+    const CullObject object = objects[objectIndex];
+    const bool visible = IsVisible(object.boundsCenter.xyz, object.boundsExtent.xyz);
+
+    // firstInstance selects the object in the vertex shader through the per-instance object index attribute
+    DrawCommand command;
+    command.indexCount = object.indexCount;
+    command.instanceCount = 1;
+    command.firstIndex = object.firstIndex;
+    command.vertexOffset = object.vertexOffset;
+    command.firstInstance = objectIndex;
+
+    if (pc.compactDraws != 0) {
+        if (visible) {
+            commands[atomicAdd(drawCount, 1)] = command;
+        }
+    } else {
+        command.instanceCount = visible ? 1 : 0;
+        commands[objectIndex] = command;
+        if (visible) {
+            atomicAdd(drawCount, 1);
+        }
+    }
+}
\ No newline at end of file
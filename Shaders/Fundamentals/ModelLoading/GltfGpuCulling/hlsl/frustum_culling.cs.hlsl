@@ -0,0 +1,89 @@
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+struct CullObject
+{
+    float4x4 model;
+    float4 boundsCenter; // xyz: center of the world bounding box
+    float4 boundsExtent; // xyz: half size of the world bounding box
+    uint indexCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint padding;
+};
+
+// Same layout with VkDrawIndexedIndirectCommand
+struct DrawCommand
+{
+    uint indexCount;
+    uint instanceCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint firstInstance;
+};
+
+[[vk::binding(0, 0)]] StructuredBuffer<CullObject> objects;
+[[vk::binding(1, 0)]] RWStructuredBuffer<DrawCommand> commands;
+[[vk::binding(2, 0)]] RWStructuredBuffer<uint> drawCount;
+
+struct PushConstants {
+    float4 frustumPlanes[6];
+    uint objectCount;
+    uint compactDraws; // 1: visible commands are packed and counted, 0: culled commands have no instances
+    uint padding0;
+    uint padding1;
+};
+[[vk::push_constant]] PushConstants pc;
+
+// A box is outside of a plane if its center is farther than its projected radius behind it
+bool IsVisible(const float3 center, const float3 extent)
+{
+    for (int i = 0; i < 6; ++i) {
+        const float4 plane = pc.frustumPlanes[i];
+        const float distance = dot(plane.xyz, center) + plane.w;
+        const float radius = dot(abs(plane.xyz), extent);
+        if (distance + radius < 0.0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+[numthreads(64, 1, 1)]
+void main(uint3 dispatchThreadID : SV_DispatchThreadID)
+{
+    const uint objectIndex = dispatchThreadID.x;
+    if (objectIndex >= pc.objectCount) {
+        return;
+    }
+
+    const CullObject object = objects[objectIndex];
+    const bool visible = IsVisible(object.boundsCenter.xyz, object.boundsExtent.xyz);
+
+    // firstInstance selects the object in the vertex shader through the per-instance object index attribute
+    DrawCommand command;
+    command.indexCount = object.indexCount;
+    command.instanceCount = 1;
+    command.firstIndex = object.firstIndex;
+    command.vertexOffset = object.vertexOffset;
+    command.firstInstance = objectIndex;
+
+    uint slot;
+    if (pc.compactDraws != 0) {
+        if (visible) {
+            InterlockedAdd(drawCount[0], 1, slot);
+            commands[slot] = command;
+        }
+    } else {
+        command.instanceCount = visible ? 1 : 0;
+        commands[objectIndex] = command;
+        if (visible) {
+            InterlockedAdd(drawCount[0], 1, slot);
+        }
+    }
+}
\ No newline at end of file
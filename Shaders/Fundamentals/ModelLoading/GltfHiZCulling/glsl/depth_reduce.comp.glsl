@@ -0,0 +1,55 @@
+#version 450
+
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+layout(local_size_x = 8, local_size_y = 8, local_size_z = 1) in;
+
+// Depth buffer for the first level, previous level of the pyramid for the others
+layout(set = 0, binding = 0) uniform sampler2D sourceDepth;
+
+layout(set = 0, binding = 1, r32f) uniform writeonly image2D targetLevel;
+
+layout(push_constant) uniform PushConstants {
+    uint srcWidth;
+    uint srcHeight;
+    uint dstWidth;
+    uint dstHeight;
+    uint useMinMaxSampler; // Source is exactly 2x of the target and sampled with a MAX reduction sampler
+    uint padding0;
+    uint padding1;
+    uint padding2;
+} pc;
+
+void main()
+{
+    const uvec2 target = gl_GlobalInvocationID.xy;
+    if (target.x >= pc.dstWidth || target.y >= pc.dstHeight) {
+        return;
+    }
+
+    float farthestDepth = 0.0;
+    if (pc.useMinMaxSampler != 0) {
+        // Bilinear footprint at the center of the target texel is its 2x2 source texels
+        const vec2 uv = (vec2(target) + 0.5) / vec2(pc.dstWidth, pc.dstHeight);
+        farthestDepth = textureLod(sourceDepth, uv, 0.0).r;
+    } else {
+        // Every source texel which is touched by the target texel is compared (up to 3x3 for the first level,
+        // because the depth buffer isn't a power of two)
+        const vec2 ratio = vec2(pc.srcWidth, pc.srcHeight) / vec2(pc.dstWidth, pc.dstHeight);
+        const uvec2 sourceMin = uvec2(floor(vec2(target) * ratio));
+        const uvec2 sourceMax = min(uvec2(ceil(vec2(target + 1) * ratio)), uvec2(pc.srcWidth, pc.srcHeight)) - 1;
+        for (uint y = sourceMin.y; y <= sourceMax.y; ++y) {
+            for (uint x = sourceMin.x; x <= sourceMax.x; ++x) {
+                farthestDepth = max(farthestDepth, texelFetch(sourceDepth, ivec2(x, y), 0).r);
+            }
+        }
+    }
+
+    imageStore(targetLevel, ivec2(target), vec4(farthestDepth));
+}
\ No newline at end of file
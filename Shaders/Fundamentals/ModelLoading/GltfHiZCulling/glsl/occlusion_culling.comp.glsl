@@ -0,0 +1,181 @@
+#version 450
+
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+
+struct CullObject {
+    mat4 model;
+    vec4 boundsCenter; // xyz: center of the world bounding box
+    vec4 boundsExtent; // xyz: half size of the world bounding box
+    uint indexCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint padding;
+};
+
+// Same layout with VkDrawIndexedIndirectCommand
+struct DrawCommand {
+    uint indexCount;
+    uint instanceCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint firstInstance;
+};
+
+layout(std430, set = 0, binding = 0) readonly buffer CullObjectBuffer {
+    CullObject objects[];
+};
+
+// Early commands are in [0, objectCount), late commands are in [objectCount, 2 * objectCount)
+layout(std430, set = 0, binding = 1) writeonly buffer DrawCommandBuffer {
+    DrawCommand commands[];
+};
+
+layout(std430, set = 0, binding = 2) buffer CullingStatsBuffer {
+    uint drawCounts[2]; // Draw counts of the early and late phases
+    uint visibleCount;
+    uint occludedCount;
+};
+
+// 1 if the object was visible at the end of the last frame
+layout(std430, set = 0, binding = 3) buffer VisibilityBuffer {
+    uint visibility[];
+};
+
+// Every texel keeps the farthest depth of the area it covers
+layout(set = 0, binding = 4) uniform sampler2D depthPyramid;
+
+layout(push_constant) uniform PushConstants {
+    mat4 viewProjection;
+    vec2 pyramidSize;
+    uint pyramidLevelCount;
+    uint objectCount;
+    uint compactDraws; // 1: visible commands are packed and counted, 0: culled commands have no instances
+    uint phase;        // 0: early pass (visible in the last frame), 1: late pass (occlusion test)
+    uint useMinMaxSampler;
+    uint padding;
+} pc;
+
+const uint earlyPhase = 0;
+
+// A box is outside of a plane if its center is farther than its projected radius behind it
+bool IsInFrustum(const vec3 center, const vec3 extent)
+{
+    const mat4 rows = transpose(pc.viewProjection);
+    const vec4 planes[6] = vec4[6](rows[3] + rows[0], rows[3] - rows[0], rows[3] + rows[1],
+                                   rows[3] - rows[1], rows[3] + rows[2], rows[3] - rows[2]);
+    for (int i = 0; i < 6; ++i) {
+        const vec4 plane = planes[i] / length(planes[i].xyz);
+        const float distance = dot(plane.xyz, center) + plane.w;
+        const float radius = dot(abs(plane.xyz), extent);
+        if (distance + radius < 0.0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Screen rectangle of the box is tested against the pyramid level where it covers at most 2x2 texels. The box is
+// occluded if its nearest depth is behind the farthest depth of all these texels.
+bool IsOccluded(const vec3 center, const vec3 extent)
+{
+    vec2 ndcMin = vec2(1.0);
+    vec2 ndcMax = vec2(-1.0);
+    float nearestDepth = 1.0;
+    for (int i = 0; i < 8; ++i) {
+        const vec3 corner = center + extent * vec3((i & 1) != 0 ? 1.0 : -1.0, (i & 2) != 0 ? 1.0 : -1.0,
+                                                   (i & 4) != 0 ? 1.0 : -1.0);
+        const vec4 clip = pc.viewProjection * vec4(corner, 1.0);
+
+        // Box intersects the camera plane, its projection isn't bounded
+        if (clip.w <= 1e-4) {
+            return false;
+        }
+
+        const vec3 ndc = clip.xyz / clip.w;
+        ndcMin = min(ndcMin, ndc.xy);
+        ndcMax = max(ndcMax, ndc.xy);
+        nearestDepth = min(nearestDepth, ndc.z);
+    }
+
+    const vec2 uvMin = clamp(ndcMin * 0.5 + 0.5, vec2(0.0), vec2(1.0));
+    const vec2 uvMax = clamp(ndcMax * 0.5 + 0.5, vec2(0.0), vec2(1.0));
+    const vec2 sizeInTexels = (uvMax - uvMin) * pc.pyramidSize;
+    const float level = min(ceil(log2(max(max(sizeInTexels.x, sizeInTexels.y), 1.0))),
+                            float(pc.pyramidLevelCount - 1));
+
+    float farthestDepth;
+    if (pc.useMinMaxSampler != 0) {
+        // Bilinear footprint at the center of the rectangle covers all of its texels, MAX reduction returns the
+        // farthest one with a single fetch
+        farthestDepth = textureLod(depthPyramid, (uvMin + uvMax) * 0.5, level).r;
+    } else {
+        const ivec2 levelSize = textureSize(depthPyramid, int(level));
+        const ivec2 texelMin = clamp(ivec2(uvMin * vec2(levelSize)), ivec2(0), levelSize - 1);
+        const ivec2 texelMax = clamp(ivec2(uvMax * vec2(levelSize)), ivec2(0), levelSize - 1);
+        farthestDepth = max(max(texelFetch(depthPyramid, texelMin, int(level)).r,
+                                texelFetch(depthPyramid, ivec2(texelMax.x, texelMin.y), int(level)).r),
+                            max(texelFetch(depthPyramid, ivec2(texelMin.x, texelMax.y), int(level)).r,
+                                texelFetch(depthPyramid, texelMax, int(level)).r));
+    }
+
+    return nearestDepth > farthestDepth;
+}
+
+void main()
+{
+    const uint objectIndex = gl_GlobalInvocationID.x;
+    if (objectIndex >= pc.objectCount) {
+        return;
+    }
+
+    const CullObject object = objects[objectIndex];
+    const bool inFrustum = IsInFrustum(object.boundsCenter.xyz, object.boundsExtent.xyz);
+    const bool wasVisible = visibility[objectIndex] != 0;
+
+    bool draw;
+    if (pc.phase == earlyPhase) {
+        // Objects of the last frame are drawn without the occlusion test, their depth builds the pyramid
+        draw = inFrustum && wasVisible;
+    } else {
+        // All objects are tested against the pyramid, only the newly disoccluded ones are drawn
+        const bool occluded = inFrustum && IsOccluded(object.boundsCenter.xyz, object.boundsExtent.xyz);
+        const bool visible = inFrustum && !occluded;
+        draw = visible && !wasVisible;
+        visibility[objectIndex] = visible ? 1 : 0;
+
+        if (visible) {
+            atomicAdd(visibleCount, 1);
+        } else if (occluded) {
+            atomicAdd(occludedCount, 1);
+        }
+    }
+
+    // firstInstance selects the object in the vertex shader through the per-instance object index attribute
+    DrawCommand command;
+    command.indexCount = object.indexCount;
+    command.instanceCount = 1;
+    command.firstIndex = object.firstIndex;
+    command.vertexOffset = object.vertexOffset;
+    command.firstInstance = objectIndex;
+
+    const uint commandOffset = pc.phase * pc.objectCount;
+    if (pc.compactDraws != 0) {
+        if (draw) {
+            commands[commandOffset + atomicAdd(drawCounts[pc.phase], 1)] = command;
+        }
+    } else {
+        command.instanceCount = draw ? 1 : 0;
+        commands[commandOffset + objectIndex] = command;
+        if (draw) {
+            atomicAdd(drawCounts[pc.phase], 1);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+// Depth buffer for the first level, previous level of the pyramid for the others
+[[vk::binding(0, 0)]] SamplerState sourceSampler;
+[[vk::binding(0, 0)]] Texture2D<float> sourceDepth;
+
+[[vk::binding(1, 0)]] [[vk::image_format("r32f")]] RWTexture2D<float> targetLevel;
+
+struct PushConstants {
+    uint srcWidth;
+    uint srcHeight;
+    uint dstWidth;
+    uint dstHeight;
+    uint useMinMaxSampler; // Source is exactly 2x of the target and sampled with a MAX reduction sampler
+    uint padding0;
+    uint padding1;
+    uint padding2;
+};
+[[vk::push_constant]] PushConstants pc;
+
+[numthreads(8, 8, 1)]
+void main(uint3 dispatchThreadID : SV_DispatchThreadID)
+{
+    const uint2 target = dispatchThreadID.xy;
+    if (target.x >= pc.dstWidth || target.y >= pc.dstHeight) {
+        return;
+    }
+
+    float farthestDepth = 0.0;
+    if (pc.useMinMaxSampler != 0) {
+        // Bilinear footprint at the center of the target texel is its 2x2 source texels
+        const float2 uv = (float2(target) + 0.5) / float2(pc.dstWidth, pc.dstHeight);
+        farthestDepth = sourceDepth.SampleLevel(sourceSampler, uv, 0.0);
+    } else {
+        // Every source texel which is touched by the target texel is compared (up to 3x3 for the first level,
+        // because the depth buffer isn't a power of two)
+        const float2 ratio = float2(pc.srcWidth, pc.srcHeight) / float2(pc.dstWidth, pc.dstHeight);
+        const uint2 sourceMin = uint2(floor(float2(target) * ratio));
+        const uint2 sourceMax = min(uint2(ceil(float2(target + 1) * ratio)), uint2(pc.srcWidth, pc.srcHeight)) - 1;
+        for (uint y = sourceMin.y; y <= sourceMax.y; ++y) {
+            for (uint x = sourceMin.x; x <= sourceMax.x; ++x) {
+                farthestDepth = max(farthestDepth, sourceDepth.Load(int3(x, y, 0)));
+            }
+        }
+    }
+
+    targetLevel[target] = farthestDepth;
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+struct CullObject
+{
+    float4x4 model;
+    float4 boundsCenter;
+    float4 boundsExtent;
+    uint indexCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint padding;
+};
+
+struct VSInput
+{
+    [[vk::location(0)]] float3 pos : POSITION;
+    [[vk::location(1)]] float3 normal : NORMAL;
+    [[vk::location(2)]] uint objectIndex : OBJECT_INDEX; // Per-instance, selected by firstInstance of the draw command
+};
+
+[[vk::binding(0, 0)]] StructuredBuffer<CullObject> objects;
+
+struct PushConstants {
+    float4x4 viewProjectionMatrix;
+};
+[[vk::push_constant]] PushConstants pc;
+
+struct VSOutput
+{
+    float4 Position : SV_POSITION;
+    [[vk::location(0)]] float3 Normal : NORMAL;
+};
+
+VSOutput main(VSInput input)
+{
+    const float4x4 modelMatrix = objects[input.objectIndex].model;
+
+    VSOutput output = (VSOutput)0;
+    output.Position = mul(pc.viewProjectionMatrix, mul(modelMatrix, float4(input.pos, 1.0)));
+    output.Normal = mul((float3x3)modelMatrix, input.normal);
+    return output;
+}
\ No newline at end of file
@@ -0,0 +1,175 @@
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+struct CullObject
+{
+    float4x4 model;
+    float4 boundsCenter; // xyz: center of the world bounding box
+    float4 boundsExtent; // xyz: half size of the world bounding box
+    uint indexCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint padding;
+};
+
+// Same layout with VkDrawIndexedIndirectCommand
+struct DrawCommand
+{
+    uint indexCount;
+    uint instanceCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint firstInstance;
+};
+
+// Stats: draw counts of the early and late phases, visible count, occluded count
+static const uint visibleCountIndex = 2;
+static const uint occludedCountIndex = 3;
+static const uint earlyPhase = 0;
+
+[[vk::binding(0, 0)]] StructuredBuffer<CullObject> objects;
+// Early commands are in [0, objectCount), late commands are in [objectCount, 2 * objectCount)
+[[vk::binding(1, 0)]] RWStructuredBuffer<DrawCommand> commands;
+[[vk::binding(2, 0)]] RWStructuredBuffer<uint> stats;
+// 1 if the object was visible at the end of the last frame
+[[vk::binding(3, 0)]] RWStructuredBuffer<uint> visibility;
+// Every texel keeps the farthest depth of the area it covers
+[[vk::binding(4, 0)]] SamplerState depthPyramidSampler;
+[[vk::binding(4, 0)]] Texture2D<float> depthPyramid;
+
+struct PushConstants {
+    float4x4 viewProjection;
+    float2 pyramidSize;
+    uint pyramidLevelCount;
+    uint objectCount;
+    uint compactDraws; // 1: visible commands are packed and counted, 0: culled commands have no instances
+    uint phase;        // 0: early pass (visible in the last frame), 1: late pass (occlusion test)
+    uint useMinMaxSampler;
+    uint padding;
+};
+[[vk::push_constant]] PushConstants pc;
+
+// A box is outside of a plane if its center is farther than its projected radius behind it
+bool IsInFrustum(const float3 center, const float3 extent)
+{
+    const float4x4 rows = pc.viewProjection;
+    const float4 planes[6] = {rows[3] + rows[0], rows[3] - rows[0], rows[3] + rows[1],
+                              rows[3] - rows[1], rows[3] + rows[2], rows[3] - rows[2]};
+    for (int i = 0; i < 6; ++i) {
+        const float4 plane = planes[i] / length(planes[i].xyz);
+        const float distance = dot(plane.xyz, center) + plane.w;
+        const float radius = dot(abs(plane.xyz), extent);
+        if (distance + radius < 0.0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Screen rectangle of the box is tested against the pyramid level where it covers at most 2x2 texels. The box is
+// occluded if its nearest depth is behind the farthest depth of all these texels.
+bool IsOccluded(const float3 center, const float3 extent)
+{
+    float2 ndcMin = float2(1.0, 1.0);
+    float2 ndcMax = float2(-1.0, -1.0);
+    float nearestDepth = 1.0;
+    for (int i = 0; i < 8; ++i) {
+        const float3 corner = center + extent * float3((i & 1) != 0 ? 1.0 : -1.0, (i & 2) != 0 ? 1.0 : -1.0,
+                                                       (i & 4) != 0 ? 1.0 : -1.0);
+        const float4 clip = mul(pc.viewProjection, float4(corner, 1.0));
+
+        // Box intersects the camera plane, its projection isn't bounded
+        if (clip.w <= 1e-4) {
+            return false;
+        }
+
+        const float3 ndc = clip.xyz / clip.w;
+        ndcMin = min(ndcMin, ndc.xy);
+        ndcMax = max(ndcMax, ndc.xy);
+        nearestDepth = min(nearestDepth, ndc.z);
+    }
+
+    const float2 uvMin = saturate(ndcMin * 0.5 + 0.5);
+    const float2 uvMax = saturate(ndcMax * 0.5 + 0.5);
+    const float2 sizeInTexels = (uvMax - uvMin) * pc.pyramidSize;
+    const float level = min(ceil(log2(max(max(sizeInTexels.x, sizeInTexels.y), 1.0))),
+                            float(pc.pyramidLevelCount - 1));
+
+    float farthestDepth;
+    if (pc.useMinMaxSampler != 0) {
+        // Bilinear footprint at the center of the rectangle covers all of its texels, MAX reduction returns the
+        // farthest one with a single fetch
+        farthestDepth = depthPyramid.SampleLevel(depthPyramidSampler, (uvMin + uvMax) * 0.5, level);
+    } else {
+        uint width, height, levelCount;
+        depthPyramid.GetDimensions(uint(level), width, height, levelCount);
+        const int2 levelSize = int2(width, height);
+        const int2 texelMin = clamp(int2(uvMin * float2(levelSize)), int2(0, 0), levelSize - 1);
+        const int2 texelMax = clamp(int2(uvMax * float2(levelSize)), int2(0, 0), levelSize - 1);
+        farthestDepth = max(max(depthPyramid.Load(int3(texelMin, int(level))),
+                                depthPyramid.Load(int3(texelMax.x, texelMin.y, int(level)))),
+                            max(depthPyramid.Load(int3(texelMin.x, texelMax.y, int(level))),
+                                depthPyramid.Load(int3(texelMax, int(level)))));
+    }
+
+    return nearestDepth > farthestDepth;
+}
+
+[numthreads(64, 1, 1)]
+void main(uint3 dispatchThreadID : SV_DispatchThreadID)
+{
+    const uint objectIndex = dispatchThreadID.x;
+    if (objectIndex >= pc.objectCount) {
+        return;
+    }
+
+    const CullObject object = objects[objectIndex];
+    const bool inFrustum = IsInFrustum(object.boundsCenter.xyz, object.boundsExtent.xyz);
+    const bool wasVisible = visibility[objectIndex] != 0;
+
+    uint slot;
+    bool draw;
+    if (pc.phase == earlyPhase) {
+        // Objects of the last frame are drawn without the occlusion test, their depth builds the pyramid
+        draw = inFrustum && wasVisible;
+    } else {
+        // All objects are tested against the pyramid, only the newly disoccluded ones are drawn
+        const bool occluded = inFrustum && IsOccluded(object.boundsCenter.xyz, object.boundsExtent.xyz);
+        const bool visible = inFrustum && !occluded;
+        draw = visible && !wasVisible;
+        visibility[objectIndex] = visible ? 1 : 0;
+
+        if (visible) {
+            InterlockedAdd(stats[visibleCountIndex], 1, slot);
+        } else if (occluded) {
+            InterlockedAdd(stats[occludedCountIndex], 1, slot);
+        }
+    }
+
+    // firstInstance selects the object in the vertex shader through the per-instance object index attribute
+    DrawCommand command;
+    command.indexCount = object.indexCount;
+    command.instanceCount = 1;
+    command.firstIndex = object.firstIndex;
+    command.vertexOffset = object.vertexOffset;
+    command.firstInstance = objectIndex;
+
+    const uint commandOffset = pc.phase * pc.objectCount;
+    if (pc.compactDraws != 0) {
+        if (draw) {
+            InterlockedAdd(stats[pc.phase], 1, slot);
+            commands[commandOffset + slot] = command;
+        }
+    } else {
+        command.instanceCount = draw ? 1 : 0;
+        commands[commandOffset + objectIndex] = command;
+        if (draw) {
+            InterlockedAdd(stats[pc.phase], 1, slot);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+#version 450
+
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+layout(location = 0) out vec4 outColor;
+layout(location = 1) out uint outObjectId;
+layout(location = 0) in vec2 fragUV;
+layout(location = 1) flat in uint fragObjectId;
+
+layout(set = 0, binding = 0) uniform sampler2D uCombinedSampler;
+
+void main()
+{
+    outColor = texture(uCombinedSampler, fragUV);
+    outObjectId = fragObjectId;
+}
\ No newline at end of file
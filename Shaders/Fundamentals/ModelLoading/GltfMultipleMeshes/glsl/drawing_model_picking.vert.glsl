@@ -0,0 +1,27 @@
+#version 450
+
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec2 inUV;
+
+layout(location = 0) out vec2 fragUV;
+layout(location = 1) flat out uint fragObjectId;
+
+layout(push_constant) uniform PushConstants {
+    mat4 mvpMatrix;
+    uint objectId;
+} pc;
+
+void main()
+{
+    fragUV = inUV;
+    fragObjectId = pc.objectId;
+    gl_Position = pc.mvpMatrix * vec4(inPosition, 1.0);
+}
\ No newline at end of file
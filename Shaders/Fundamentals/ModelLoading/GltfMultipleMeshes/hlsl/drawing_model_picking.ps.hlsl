@@ -0,0 +1,30 @@
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+struct PSInput
+{
+    [[vk::location(0)]] float2 uv : TEXCOORD0;
+    [[vk::location(1)]] nointerpolation uint objectId : TEXCOORD1;
+};
+
+struct PSOutput
+{
+    [[vk::location(0)]] float4 Color : SV_Target0;
+    [[vk::location(1)]] uint ObjectId : SV_Target1;
+};
+
+[[vk::binding(0, 0)]] SamplerState uSampler;
+[[vk::binding(0, 0)]] Texture2D uImage;
+
+PSOutput main(PSInput input)
+{
+    PSOutput output = (PSOutput)0;
+    output.Color = uImage.Sample(uSampler, input.uv);
+    output.ObjectId = input.objectId;
+    return output;
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+struct VSInput
+{
+    [[vk::location(0)]] float3 pos : POSITION;
+    [[vk::location(1)]] float2 uv : TEXCOORD0;
+};
+
+struct PushConstants {
+    float4x4 mvpMatrix;
+    uint objectId;
+};
+[[vk::push_constant]] PushConstants pc;
+
+struct VSOutput
+{
+    float4 Position : SV_POSITION;
+    [[vk::location(0)]] float2 Uv : TEXCOORD0;
+    [[vk::location(1)]] nointerpolation uint ObjectId : TEXCOORD1;
+};
+
+VSOutput main(VSInput input)
+{
+    VSOutput output = (VSOutput)0;
+    output.Position = mul(pc.mvpMatrix, float4(input.pos, 1.0));
+    output.Uv = input.uv;
+    output.ObjectId = pc.objectId;
+    return output;
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#version 450
+
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+layout(location = 0) out vec3 fragNormal;
+
+// Output of the skinning compute shader, position and normal of every vertex of every instance (6 floats)
+layout(std430, set = 0, binding = 3) readonly buffer SkinnedVertexBuffer {
+    float skinnedVertices[];
+};
+
+layout(push_constant) uniform PushConstants {
+    mat4 viewProjection;
+    uint vertexCount; // Skinned vertices of one instance
+    uint vertexBase;  // First vertex of the drawn mesh node in an instance
+} pc;
+
+void main()
+{
+    // Skinned vertices are in the world space, every instance reads its own range with the shared indices
+    const uint base = (gl_InstanceIndex * pc.vertexCount + pc.vertexBase + gl_VertexIndex) * 6;
+    const vec3 position = vec3(skinnedVertices[base], skinnedVertices[base + 1], skinnedVertices[base + 2]);
+    fragNormal = vec3(skinnedVertices[base + 3], skinnedVertices[base + 4], skinnedVertices[base + 5]);
+    gl_Position = pc.viewProjection * vec4(position, 1.0);
+}
\ No newline at end of file
@@ -0,0 +1,80 @@
+#version 450
+
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+
+struct SkinVertex {
+    vec4 position;
+    vec4 normal;
+    uvec4 joints; // Indices in the palette of a pose
+    vec4 weights;
+};
+
+struct SkinInstance {
+    vec4 offset; // xyz: world position of the instance
+    uint poseIndex;
+    uint padding0;
+    uint padding1;
+    uint padding2;
+};
+
+layout(std430, set = 0, binding = 0) readonly buffer BindPoseBuffer {
+    SkinVertex vertices[];
+};
+
+layout(std430, set = 0, binding = 1) readonly buffer InstanceBuffer {
+    SkinInstance instances[];
+};
+
+layout(std430, set = 0, binding = 2) readonly buffer JointPaletteBuffer {
+    mat4 jointMatrices[];
+};
+
+// Position and normal of every vertex (6 floats), read by the vertex shader of the drawing pipeline
+layout(std430, set = 0, binding = 3) writeonly buffer SkinnedVertexBuffer {
+    float skinnedVertices[];
+};
+
+layout(push_constant) uniform PushConstants {
+    uint vertexCount;
+    uint instanceCount;
+    uint jointCount;
+    uint paletteBase;
+} pc;
+
+void main()
+{
+    const uint vertexIndex = gl_GlobalInvocationID.x;
+    const uint instanceIndex = gl_GlobalInvocationID.y;
+    if (vertexIndex >= pc.vertexCount || instanceIndex >= pc.instanceCount) {
+        return;
+    }
+
+    const SkinVertex vertex = vertices[vertexIndex];
+    const SkinInstance instance = instances[instanceIndex];
+    const uint palette = pc.paletteBase + instance.poseIndex * pc.jointCount;
+
+    const mat4 skinMatrix = vertex.weights.x * jointMatrices[palette + vertex.joints.x] +
+                            vertex.weights.y * jointMatrices[palette + vertex.joints.y] +
+                            vertex.weights.z * jointMatrices[palette + vertex.joints.z] +
+                            vertex.weights.w * jointMatrices[palette + vertex.joints.w];
+
+    const vec3 position = (skinMatrix * vertex.position).xyz + instance.offset.xyz;
+    vec3 normal = mat3(skinMatrix) * vertex.normal.xyz;
+    normal = length(normal) > 0.0 ? normalize(normal) : normal;
+
+    const uint base = (instanceIndex * pc.vertexCount + vertexIndex) * 6;
+    skinnedVertices[base + 0] = position.x;
+    skinnedVertices[base + 1] = position.y;
+    skinnedVertices[base + 2] = position.z;
+    skinnedVertices[base + 3] = normal.x;
+    skinnedVertices[base + 4] = normal.y;
+    skinnedVertices[base + 5] = normal.z;
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+struct PSInput
+{
+    [[vk::location(0)]] float3 normal : NORMAL;
+};
+
+static const float3 lightDirection = float3(0.3244, 0.8111, 0.4867); // normalize(0.4, 1.0, 0.6)
+static const float3 baseColor = float3(0.8, 0.55, 0.25);
+
+float4 main(PSInput input) : SV_Target
+{
+    // Simple directional light
+    float diffuse = max(dot(normalize(input.normal), lightDirection), 0.0);
+    return float4(baseColor * (0.2 + 0.8 * diffuse), 1.0);
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+struct VSInput
+{
+    uint vertexID : SV_VertexID;
+    uint instanceID : SV_InstanceID;
+};
+
+// Output of the skinning compute shader, position and normal of every vertex of every instance (6 floats)
+[[vk::binding(3, 0)]] StructuredBuffer<float> skinnedVertices;
+
+struct PushConstants {
+    float4x4 viewProjection;
+    uint vertexCount; // Skinned vertices of one instance
+    uint vertexBase;  // First vertex of the drawn mesh node in an instance
+};
+[[vk::push_constant]] PushConstants pc;
+
+struct VSOutput
+{
+    float4 Position : SV_POSITION;
+    [[vk::location(0)]] float3 Normal : NORMAL;
+};
+
+VSOutput main(VSInput input)
+{
+    // Skinned vertices are in the world space, every instance reads its own range with the shared indices
+    const uint base = (input.instanceID * pc.vertexCount + pc.vertexBase + input.vertexID) * 6;
+    const float3 position = float3(skinnedVertices[base], skinnedVertices[base + 1], skinnedVertices[base + 2]);
+
+    VSOutput output = (VSOutput)0;
+    output.Position = mul(pc.viewProjection, float4(position, 1.0));
+    output.Normal = float3(skinnedVertices[base + 3], skinnedVertices[base + 4], skinnedVertices[base + 5]);
+    return output;
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+// ------------------------------------------------------------------------
+// Author: Mustafa Yemural
+// Description:
+// ------------------------------------------------------------------------
+// Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+// Licensed under the MIT License.
+// ------------------------------------------------------------------------
+
+struct SkinVertex
+{
+    float4 position;
+    float4 normal;
+    uint4 joints; // Indices in the palette of a pose
+    float4 weights;
+};
+
+struct SkinInstance
+{
+    float4 offset; // xyz: world position of the instance
+    uint poseIndex;
+    uint padding0;
+    uint padding1;
+    uint padding2;
+};
+
+[[vk::binding(0, 0)]] StructuredBuffer<SkinVertex> vertices;
+[[vk::binding(1, 0)]] StructuredBuffer<SkinInstance> instances;
+[[vk::binding(2, 0)]] StructuredBuffer<float4x4> jointMatrices;
+
+// Position and normal of every vertex (6 floats), read by the vertex shader of the drawing pipeline
+[[vk::binding(3, 0)]] RWStructuredBuffer<float> skinnedVertices;
+
+struct PushConstants {
+    uint vertexCount;
+    uint instanceCount;
+    uint jointCount;
+    uint paletteBase;
+};
+[[vk::push_constant]] PushConstants pc;
+
+[numthreads(64, 1, 1)]
+void main(uint3 dispatchThreadID : SV_DispatchThreadID)
+{
+    const uint vertexIndex = dispatchThreadID.x;
+    const uint instanceIndex = dispatchThreadID.y;
+    if (vertexIndex >= pc.vertexCount || instanceIndex >= pc.instanceCount) {
+        return;
+    }
+
+    const SkinVertex vertex = vertices[vertexIndex];
+    const SkinInstance instance = instances[instanceIndex];
+    const uint palette = pc.paletteBase + instance.poseIndex * pc.jointCount;
+
+    const float4x4 skinMatrix = vertex.weights.x * jointMatrices[palette + vertex.joints.x] +
+                                vertex.weights.y * jointMatrices[palette + vertex.joints.y] +
+                                vertex.weights.z * jointMatrices[palette + vertex.joints.z] +
+                                vertex.weights.w * jointMatrices[palette + vertex.joints.w];
+
+    const float3 position = mul(skinMatrix, vertex.position).xyz + instance.offset.xyz;
+    float3 normal = mul((float3x3)skinMatrix, vertex.normal.xyz);
+    normal = length(normal) > 0.0 ? normalize(normal) : normal;
+
+    const uint base = (instanceIndex * pc.vertexCount + vertexIndex) * 6;
+    skinnedVertices[base + 0] = position.x;
+    skinnedVertices[base + 1] = position.y;
+    skinnedVertices[base + 2] = position.z;
+    skinnedVertices[base + 3] = normal.x;
+    skinnedVertices[base + 4] = normal.y;
+    skinnedVertices[base + 5] = normal.z;
+}
\ No newline at end of file
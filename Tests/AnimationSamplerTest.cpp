@@ -0,0 +1,221 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include "AnimationSampler.h"
+
+using namespace common::utility;
+
+namespace
+{
+// Rotation channels are more than the AVX2 width, so both the SIMD batch and the scalar remainder are tested
+constexpr std::uint32_t rotationChannelCount = 11;
+
+// Polynomial slerp of the sampler is an approximation, the other interpolations use exact values of the keyframes
+constexpr float maxSlerpError = 1e-5f;
+
+glm::vec4 ToVec4(const glm::quat& rotation) { return {rotation.x, rotation.y, rotation.z, rotation.w}; }
+
+glm::vec3 RotationAxis(const std::uint32_t index)
+{
+    return glm::normalize(glm::vec3(1.0f, static_cast<float>(index), 2.0f));
+}
+
+// Channel i rotates node i around its own axis from angle i * 0.1 to i * 0.25 + 0.5, the odd channels store the end
+// quaternion with the opposite sign, so the shortest path has to be found
+GltfAnimation CreateAnimation()
+{
+    GltfAnimation animation;
+    animation.Duration = 4.0f;
+
+    for (std::uint32_t i = 0; i < rotationChannelCount; ++i) {
+        const auto value = static_cast<float>(i);
+        const glm::quat from = glm::angleAxis(value * 0.1f, RotationAxis(i));
+        const glm::quat to = glm::angleAxis(value * 0.25f + 0.5f, RotationAxis(i));
+        const float sign = i % 2 == 0 ? 1.0f : -1.0f;
+        animation.Channels.push_back({.NodeIndex = i,
+                                      .Path = GltfAnimationPath::ROTATION,
+                                      .Interpolation = GltfInterpolation::LINEAR,
+                                      .Times = {0.0f, 4.0f},
+                                      .Values = {ToVec4(from), sign * ToVec4(to)}});
+    }
+
+    // Node 0 is also translated and scaled with the other interpolation types
+    animation.Channels.push_back({.NodeIndex = 0,
+                                  .Path = GltfAnimationPath::TRANSLATION,
+                                  .Interpolation = GltfInterpolation::LINEAR,
+                                  .Times = {1.0f, 2.0f, 3.0f},
+                                  .Values = {glm::vec4(0.0f), glm::vec4(2.0f, 4.0f, -6.0f, 0.0f),
+                                             glm::vec4(2.0f, 0.0f, 0.0f, 0.0f)}});
+    animation.Channels.push_back({.NodeIndex = 0,
+                                  .Path = GltfAnimationPath::SCALE,
+                                  .Interpolation = GltfInterpolation::STEP,
+                                  .Times = {0.0f, 1.0f, 2.0f},
+                                  .Values = {glm::vec4(1.0f), glm::vec4(2.0f), glm::vec4(3.0f)}});
+
+    // Zero tangents, so the spline is a smoothstep between the values
+    animation.Channels.push_back({.NodeIndex = 1,
+                                  .Path = GltfAnimationPath::TRANSLATION,
+                                  .Interpolation = GltfInterpolation::CUBICSPLINE,
+                                  .Times = {0.0f, 4.0f},
+                                  .Values = {glm::vec4(0.0f), glm::vec4(0.0f), glm::vec4(0.0f), glm::vec4(0.0f),
+                                             glm::vec4(8.0f, -4.0f, 2.0f, 0.0f), glm::vec4(0.0f)}});
+
+    return animation;
+}
+
+// Expected values of the channels at a time in [0, 4]
+std::vector<glm::vec4> ComputeReference(const float time)
+{
+    std::vector<glm::vec4> values;
+    const float t = time / 4.0f;
+    for (std::uint32_t i = 0; i < rotationChannelCount; ++i) {
+        const auto value = static_cast<float>(i);
+        const float angle = value * 0.1f + (value * 0.25f + 0.5f - value * 0.1f) * t;
+        values.push_back(ToVec4(glm::angleAxis(angle, RotationAxis(i))));
+    }
+
+    if (time <= 1.0f) {
+        values.emplace_back(0.0f);
+    } else if (time < 2.0f) {
+        values.push_back(glm::vec4(2.0f, 4.0f, -6.0f, 0.0f) * (time - 1.0f));
+    } else if (time < 3.0f) {
+        values.push_back(glm::vec4(2.0f, 4.0f, -6.0f, 0.0f) +
+                         (glm::vec4(2.0f, 0.0f, 0.0f, 0.0f) - glm::vec4(2.0f, 4.0f, -6.0f, 0.0f)) * (time - 2.0f));
+    } else {
+        values.emplace_back(2.0f, 0.0f, 0.0f, 0.0f);
+    }
+    values.emplace_back(time < 1.0f ? 1.0f : time < 2.0f ? 2.0f : 3.0f);
+    values.push_back(glm::vec4(8.0f, -4.0f, 2.0f, 0.0f) * (3.0f * t * t - 2.0f * t * t * t));
+
+    return values;
+}
+
+bool IsMatching(const AnimationSampler& sampler, const float time, const char* stage)
+{
+    const auto expected = ComputeReference(time);
+    const auto values = sampler.GetValues();
+
+    bool isPassed = true;
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        // q and -q are the same rotation, clamped odd channels return the stored end quaternion with the opposite sign
+        const bool isRotation = i < rotationChannelCount;
+        const float sign = isRotation && glm::dot(values[i], expected[i]) < 0.0f ? -1.0f : 1.0f;
+        const glm::vec4 difference = glm::abs(values[i] - sign * expected[i]);
+        const float tolerance = isRotation ? maxSlerpError : 1e-6f;
+        if (std::max({difference.x, difference.y, difference.z, difference.w}) > tolerance) {
+            std::cerr << "Sampled value differs from the reference " << stage << ", time: " << time
+                      << ", channel: " << i << std::endl;
+            isPassed = false;
+        }
+    }
+
+    return isPassed;
+}
+
+bool TestSample()
+{
+    const GltfAnimation animation = CreateAnimation();
+    AnimationSampler sampler{animation};
+
+    // Forward playback moves the cached cursors, times are on, between and outside of the keyframes
+    bool isPassed = true;
+    for (const float time: {0.0f, 0.5f, 1.0f, 1.25f, 2.0f, 2.5f, 3.0f, 3.75f}) {
+        sampler.Sample(time);
+        isPassed = IsMatching(sampler, time, "in the forward playback") && isPassed;
+    }
+
+    // Rewind searches the keyframes again, looping wraps the time with the duration
+    sampler.Sample(1.5f);
+    isPassed = IsMatching(sampler, 1.5f, "after a rewind") && isPassed;
+    sampler.Sample(4.0f + 2.5f);
+    isPassed = IsMatching(sampler, 2.5f, "after a loop") && isPassed;
+    sampler.Sample(-1.5f);
+    isPassed = IsMatching(sampler, 2.5f, "at a negative time") && isPassed;
+
+    // Without looping values are clamped at the last keyframes
+    sampler.Sample(10.0f, false);
+    isPassed = IsMatching(sampler, 4.0f, "after the end") && isPassed;
+
+    sampler.ResetCursors();
+    sampler.Sample(0.75f);
+    return IsMatching(sampler, 0.75f, "after ResetCursors") && isPassed;
+}
+
+bool TestApply()
+{
+    const GltfAnimation animation = CreateAnimation();
+    AnimationSampler sampler{animation};
+
+    // Node 1 is the child of node 0, the other nodes are roots
+    GltfModelHandler model;
+    model.Nodes.resize(rotationChannelCount);
+    std::vector<std::uint32_t> parentIndices(rotationChannelCount, TransformHierarchy::NoParent);
+    std::vector<glm::mat4> localTransforms(rotationChannelCount, glm::mat4(1.0f));
+    model.Nodes[1].ParentIndex = 0;
+    parentIndices[1] = 0;
+    model.NodeHierarchy.Build(parentIndices, localTransforms);
+
+    sampler.Sample(1.5f);
+    sampler.Apply(model);
+    model.NodeHierarchy.Update();
+
+    bool isPassed = true;
+    const auto values = sampler.GetValues();
+    const glm::mat4 expected0 = glm::translate(glm::mat4(1.0f), glm::vec3(values[rotationChannelCount])) *
+                                glm::mat4_cast(model.Nodes[0].Rotation) * glm::scale(glm::mat4(1.0f), glm::vec3(2.0f));
+    const glm::mat4 expected1 = glm::translate(glm::mat4(1.0f), glm::vec3(values[rotationChannelCount + 2])) *
+                                glm::mat4_cast(model.Nodes[1].Rotation);
+    const auto& world1 = model.NodeHierarchy.GetWorldTransform(model.NodeHierarchy.GetFlatIndex(1));
+    for (int column = 0; column < 4; ++column) {
+        const glm::vec4 difference0 = glm::abs(model.Nodes[0].LocalTransform[column] - expected0[column]);
+        const glm::vec4 difference1 = glm::abs(world1[column] - (expected0 * expected1)[column]);
+        if (std::max({difference0.x, difference0.y, difference0.z, difference0.w, difference1.x, difference1.y,
+                      difference1.z, difference1.w}) > 1e-5f) {
+            std::cerr << "Applied transforms differ from the sampled values, column: " << column << std::endl;
+            isPassed = false;
+        }
+    }
+    if (model.Nodes[0].Rotation != glm::quat(values[0].w, values[0].x, values[0].y, values[0].z)) {
+        std::cerr << "Sampled rotation isn't written to the node" << std::endl;
+        isPassed = false;
+    }
+
+    return isPassed;
+}
+
+bool TestInvalidAnimation()
+{
+    GltfAnimation animation;
+    animation.Channels.emplace_back();
+    try {
+        AnimationSampler sampler{animation};
+    } catch (const std::runtime_error&) {
+        return true;
+    }
+
+    std::cerr << "Channel without keyframes is accepted" << std::endl;
+    return false;
+}
+} // namespace
+
+int main()
+{
+    bool isPassed = TestSample();
+    isPassed = TestApply() && isPassed;
+    isPassed = TestInvalidAnimation() && isPassed;
+
+    std::cout << (isPassed ? "All animation sampler tests passed" : "Animation sampler tests failed") << std::endl;
+    return isPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include "BatchTransform.h"
+
+using namespace common::utility;
+
+namespace
+{
+// Counts around the SIMD widths (4 for SSE2, 8 for AVX2), so both the vector loop and the scalar remainder are tested
+constexpr std::size_t objectCounts[] = {0, 1, 3, 4, 7, 8, 9};
+
+struct TransformInput
+{
+    glm::vec3 Position;
+    glm::quat Rotation;
+    glm::vec3 Scale;
+};
+
+std::vector<TransformInput> CreateInputs(const std::size_t count, TransformArrays& transforms)
+{
+    transforms.Resize(count);
+    std::vector<TransformInput> inputs(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto value = static_cast<float>(i);
+        inputs[i] = {glm::vec3{value * 0.5f - 2.0f, 1.0f - value * 0.25f, value * 0.75f - 3.0f},
+                     glm::angleAxis(0.7f * value + 0.3f, glm::normalize(glm::vec3(1.0f, value, 2.0f))),
+                     glm::vec3{1.0f + value * 0.1f, 0.5f + value * 0.2f, 2.0f - value * 0.15f}};
+        transforms.Set(i, inputs[i].Position, inputs[i].Rotation, inputs[i].Scale);
+    }
+
+    return inputs;
+}
+
+glm::mat4 ComposeReference(const TransformInput& input)
+{
+    return glm::translate(glm::mat4(1.0f), input.Position) * glm::mat4_cast(input.Rotation) *
+           glm::scale(glm::mat4(1.0f), input.Scale);
+}
+
+// Kernels compose the matrices with the same operations in the same order as glm, so the results must be equal, not
+// only near. The test target is compiled without FMA contraction, otherwise the glm reference could round differently.
+bool IsEqual(const glm::mat4& actual, const glm::mat4& expected)
+{
+    for (int column = 0; column < 4; ++column) {
+        for (int row = 0; row < 4; ++row) {
+            if (actual[column][row] != expected[column][row]) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool TestComposeModelMatrices(const std::size_t count)
+{
+    TransformArrays transforms;
+    const auto inputs = CreateInputs(count, transforms);
+
+    // One extra matrix after the objects detects writes past the end
+    const glm::mat4 guard{42.0f};
+    std::vector<glm::mat4> models(count + 1, guard);
+    ComposeModelMatrices(transforms, models);
+
+    bool isPassed = true;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!IsEqual(models[i], ComposeReference(inputs[i]))) {
+            std::cerr << "ComposeModelMatrices differs from glm, count: " << count << ", object: " << i << std::endl;
+            isPassed = false;
+        }
+    }
+    if (models[count] != guard) {
+        std::cerr << "Model matrix after the last object is overwritten, count: " << count << std::endl;
+        isPassed = false;
+    }
+
+    return isPassed;
+}
+
+bool TestComposeMvpMatrices(const std::size_t count)
+{
+    const glm::mat4 projection = glm::perspective(glm::radians(45.0f), 4.0f / 3.0f, 0.1f, 100.0f);
+    // Camera isn't axis aligned, so most view-projection elements aren't zero and another summation order would
+    // change the rounding
+    const glm::mat4 view =
+            glm::lookAt(glm::vec3(3.0f, 2.0f, 6.0f), glm::vec3(0.5f, -0.3f, 0.2f), glm::vec3(0.0f, 1.0f, 0.0f));
+    const glm::mat4 viewProjection = projection * view;
+
+    TransformArrays transforms;
+    const auto inputs = CreateInputs(count, transforms);
+
+    const glm::mat4 guard{42.0f};
+    std::vector<glm::mat4> mvps(count + 1, guard);
+    std::vector<glm::mat4> scalarMvps(count + 1, guard);
+    ComposeMvpMatrices(transforms, viewProjection, mvps);
+    ComposeMvpMatricesScalar(transforms, viewProjection, scalarMvps);
+
+    bool isPassed = true;
+    for (std::size_t i = 0; i < count; ++i) {
+        const glm::mat4 expected = viewProjection * ComposeReference(inputs[i]);
+        if (!IsEqual(mvps[i], expected)) {
+            std::cerr << "ComposeMvpMatrices differs from glm, count: " << count << ", object: " << i << std::endl;
+            isPassed = false;
+        }
+        if (!IsEqual(scalarMvps[i], expected)) {
+            std::cerr << "ComposeMvpMatricesScalar differs from glm, count: " << count << ", object: " << i
+                      << std::endl;
+            isPassed = false;
+        }
+    }
+    if (mvps[count] != guard || scalarMvps[count] != guard) {
+        std::cerr << "MVP matrix after the last object is overwritten, count: " << count << std::endl;
+        isPassed = false;
+    }
+
+    return isPassed;
+}
+} // namespace
+
+int main()
+{
+    std::cout << "Batch transform backend: " << GetBatchTransformBackend() << std::endl;
+
+    bool isPassed = true;
+    for (const auto count: objectCounts) {
+        isPassed = TestComposeModelMatrices(count) && isPassed;
+        isPassed = TestComposeMvpMatrices(count) && isPassed;
+    }
+
+    std::cout << (isPassed ? "All batch transform tests passed" : "Batch transform tests failed") << std::endl;
+    return isPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
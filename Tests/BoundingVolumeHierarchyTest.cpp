@@ -0,0 +1,232 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+
+#include "BoundingVolumeHierarchy.h"
+
+using namespace common::utility;
+
+namespace
+{
+// Grid of 6x6x6 boxes, sizes change with the index, so the tree has leaves with different sizes and nearest hits are
+// unique
+constexpr int gridSize = 6;
+constexpr float gridSpacing = 3.0f;
+
+struct Boxes
+{
+    std::vector<glm::vec3> Mins;
+    std::vector<glm::vec3> Maxs;
+    BoundsArrays Bounds;
+
+    void Set(const std::uint32_t index, const glm::vec3& min, const glm::vec3& max)
+    {
+        Mins[index] = min;
+        Maxs[index] = max;
+        Bounds.Set(index, min, max);
+    }
+};
+
+Boxes CreateBoxes()
+{
+    Boxes boxes;
+    for (int x = 0; x < gridSize; ++x) {
+        for (int y = 0; y < gridSize; ++y) {
+            for (int z = 0; z < gridSize; ++z) {
+                const glm::vec3 center =
+                        glm::vec3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)) * gridSpacing;
+                const float extent = 0.5f + 0.05f * static_cast<float>((x + 2 * y + 3 * z) % 7);
+                boxes.Mins.push_back(center - glm::vec3(extent));
+                boxes.Maxs.push_back(center + glm::vec3(extent));
+            }
+        }
+    }
+
+    boxes.Bounds.Resize(boxes.Mins.size());
+    for (std::size_t i = 0; i < boxes.Mins.size(); ++i) {
+        boxes.Bounds.Set(i, boxes.Mins[i], boxes.Maxs[i]);
+    }
+
+    return boxes;
+}
+
+Frustum CreateFrustum()
+{
+    // Camera looks at a corner of the grid, so a part of the boxes is visible
+    const glm::mat4 projection = glm::perspective(glm::radians(45.0f), 4.0f / 3.0f, 0.1f, 12.0f);
+    const glm::mat4 view =
+            glm::lookAt(glm::vec3(-4.0f, 3.0f, -5.0f), glm::vec3(4.0f, 5.0f, 6.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    return ExtractFrustum(projection * view);
+}
+
+// Every box is tested, same slab test as the tree
+RayHit CastRayLinear(const Boxes& boxes, const Ray& ray)
+{
+    RayHit hit;
+    const glm::vec3 inverseDirection = 1.0f / ray.Direction;
+    for (std::uint32_t i = 0; i < boxes.Mins.size(); ++i) {
+        const glm::vec3 t1 = (boxes.Mins[i] - ray.Origin) * inverseDirection;
+        const glm::vec3 t2 = (boxes.Maxs[i] - ray.Origin) * inverseDirection;
+        const glm::vec3 tNear = glm::min(t1, t2);
+        const glm::vec3 tFar = glm::max(t1, t2);
+        const float entry = std::max({tNear.x, tNear.y, tNear.z, 0.0f});
+        if (entry <= std::min({tFar.x, tFar.y, tFar.z}) && entry < hit.Distance) {
+            hit = {i, entry};
+        }
+    }
+
+    return hit;
+}
+
+bool TestFrustum(const BoundingVolumeHierarchy& bvh, const Boxes& boxes, const char* stage)
+{
+    const Frustum frustum = CreateFrustum();
+    std::vector<std::uint32_t> expected;
+    CullBoundsScalar(frustum, boxes.Bounds, expected);
+
+    std::vector<std::uint32_t> visibleIndices;
+    std::vector<BvhRange> visibleRanges;
+    const auto indexCount = bvh.CullFrustum(frustum, visibleIndices);
+    const auto rangeCount = bvh.CullFrustum(frustum, visibleRanges);
+
+    // Ranges are in the increasing order and merged, so they don't touch each other
+    std::vector<std::uint32_t> rangeIndices;
+    bool isPassed = true;
+    for (std::size_t i = 0; i < visibleRanges.size(); ++i) {
+        const auto& range = visibleRanges[i];
+        if (i > 0 && range.First <= visibleRanges[i - 1].First + visibleRanges[i - 1].Count) {
+            std::cerr << "Visible ranges aren't sorted and merged after " << stage << std::endl;
+            isPassed = false;
+        }
+        for (auto j = range.First; j < range.First + range.Count; ++j) {
+            rangeIndices.push_back(bvh.GetObjectIndices()[j]);
+        }
+    }
+
+    std::ranges::sort(visibleIndices);
+    std::ranges::sort(rangeIndices);
+    if (expected.empty() || expected.size() == boxes.Mins.size()) {
+        std::cerr << "Frustum of the test doesn't cull a part of the boxes" << std::endl;
+        isPassed = false;
+    }
+    if (indexCount != expected.size() || visibleIndices != expected) {
+        std::cerr << "Visible indices differ from linear culling after " << stage << std::endl;
+        isPassed = false;
+    }
+    if (rangeCount != expected.size() || rangeIndices != expected) {
+        std::cerr << "Visible ranges differ from linear culling after " << stage << std::endl;
+        isPassed = false;
+    }
+
+    return isPassed;
+}
+
+bool TestRays(const BoundingVolumeHierarchy& bvh, const Boxes& boxes, const char* stage)
+{
+    // Rays along the axes (infinite inverse directions) and diagonal, from outside of the grid, from inside of a box
+    // and from between the boxes. Last ray misses all boxes.
+    const std::vector<Ray> rays = {
+            {glm::vec3(-5.0f, 0.1f, 0.2f), glm::vec3(1.0f, 0.0f, 0.0f)},
+            {glm::vec3(9.1f, 30.0f, 5.6f), glm::vec3(0.0f, -1.0f, 0.0f)},
+            {glm::vec3(-2.0f, -3.0f, -4.0f), glm::normalize(glm::vec3(1.0f, 1.0f, 1.2f))},
+            {glm::vec3(6.1f, 6.2f, 5.9f), glm::normalize(glm::vec3(-0.3f, 1.0f, 0.2f))},
+            {glm::vec3(1.5f, 1.6f, 1.4f), glm::normalize(glm::vec3(0.4f, -0.2f, 1.0f))},
+            {glm::vec3(-5.0f, 40.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f)}};
+
+    bool isPassed = true;
+    for (std::size_t i = 0; i < rays.size(); ++i) {
+        const RayHit expected = CastRayLinear(boxes, rays[i]);
+        const RayHit hit = bvh.CastRay(rays[i]);
+        if (hit.ObjectIndex != expected.ObjectIndex || hit.Distance != expected.Distance) {
+            std::cerr << "Ray hit differs from the linear search after " << stage << ", ray: " << i << std::endl;
+            isPassed = false;
+        }
+    }
+
+    // First ray hits the box at the origin, it is ignored when it is after the maximum distance
+    if (bvh.CastRay(rays[0], 1.0f).ObjectIndex != UINT32_MAX) {
+        std::cerr << "Ray hit after the maximum distance is returned after " << stage << std::endl;
+        isPassed = false;
+    }
+
+    return isPassed;
+}
+
+bool TestBuildAndRefit()
+{
+    Boxes boxes = CreateBoxes();
+    BoundingVolumeHierarchy bvh;
+    bvh.Build(boxes.Bounds);
+
+    bool isPassed = true;
+    std::vector<std::uint32_t> objectIndices = bvh.GetObjectIndices();
+    std::ranges::sort(objectIndices);
+    for (std::uint32_t i = 0; i < boxes.Mins.size(); ++i) {
+        if (i >= objectIndices.size() || objectIndices[i] != i) {
+            std::cerr << "Object isn't placed in the tree once, object: " << i << std::endl;
+            isPassed = false;
+            break;
+        }
+    }
+    isPassed = TestFrustum(bvh, boxes, "Build") && isPassed;
+    isPassed = TestRays(bvh, boxes, "Build") && isPassed;
+
+    // Boxes move a little, and two far boxes move in front of the camera and the first ray, so the refitted tree gives
+    // the same results only if the bounds of their old nodes grow
+    for (std::uint32_t i = 0; i < boxes.Mins.size(); i += 13) {
+        const glm::vec3 offset{static_cast<float>(i % 5) - 2.0f, 1.5f, static_cast<float>(i % 3) - 1.0f};
+        boxes.Set(i, boxes.Mins[i] + offset, boxes.Maxs[i] + offset);
+    }
+    boxes.Set(215, glm::vec3(-0.5f, 3.5f, 0.0f), glm::vec3(0.5f, 4.5f, 1.0f));
+    boxes.Set(100, glm::vec3(-3.5f, -0.4f, -0.3f), glm::vec3(-2.5f, 0.6f, 0.7f));
+    for (std::uint32_t i = 0; i < boxes.Mins.size(); ++i) {
+        bvh.SetObjectBounds(i, boxes.Mins[i], boxes.Maxs[i]);
+    }
+    if (bvh.Refit() == 0) {
+        std::cerr << "Refit doesn't recalculate any node" << std::endl;
+        isPassed = false;
+    }
+    if (bvh.Refit() != 0) {
+        std::cerr << "Refit without moved objects recalculates nodes" << std::endl;
+        isPassed = false;
+    }
+    isPassed = TestFrustum(bvh, boxes, "Refit") && isPassed;
+
+    return TestRays(bvh, boxes, "Refit") && isPassed;
+}
+
+bool TestEmpty()
+{
+    BoundingVolumeHierarchy bvh;
+    bvh.Build(BoundsArrays{});
+
+    std::vector<BvhRange> visibleRanges{{0, 1}};
+    const bool isPassed = bvh.IsEmpty() && bvh.CullFrustum(CreateFrustum(), visibleRanges) == 0 &&
+                          visibleRanges.empty() && bvh.CastRay(Ray{}).ObjectIndex == UINT32_MAX;
+    if (!isPassed) {
+        std::cerr << "Empty tree returns objects" << std::endl;
+    }
+
+    return isPassed;
+}
+} // namespace
+
+int main()
+{
+    bool isPassed = TestBuildAndRefit();
+    isPassed = TestEmpty() && isPassed;
+
+    std::cout << (isPassed ? "All bounding volume hierarchy tests passed" : "Bounding volume hierarchy tests failed")
+              << std::endl;
+    return isPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
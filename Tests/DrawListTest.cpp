@@ -0,0 +1,143 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "DrawList.h"
+
+using namespace common::utility;
+
+namespace
+{
+struct ExpectedDraw
+{
+    std::uint32_t DrawIndex;
+    DrawStateChanges Changes;
+};
+
+bool TestOrderAndChanges()
+{
+    // Draws 2 and 5, and 1 and 7 have the same keys, so they have to keep their adding order. Negative depth of draw 6
+    // is clamped to 0.
+    const std::vector<DrawKeyFields> draws = {
+            {DrawPass::Opaque, 1, 2, 3, 5.0f},      {DrawPass::Transparent, 0, 0, 0, 2.0f},
+            {DrawPass::Opaque, 0, 1, 1, 9.0f},      {DrawPass::Opaque, 1, 2, 3, 1.0f},
+            {DrawPass::Transparent, 1, 1, 1, 7.0f}, {DrawPass::Opaque, 0, 1, 1, 9.0f},
+            {DrawPass::Opaque, 0, 0, 4, -3.0f},     {DrawPass::Transparent, 0, 0, 0, 2.0f}};
+
+    // Opaque draws are grouped by state and sorted front to back, transparent draws are sorted back to front. First
+    // transparent draw binds the pipeline again, although its pipeline is the same as the last opaque draw.
+    const std::vector<ExpectedDraw> expected = {
+            {6, {true, true, true}}, {2, {false, true, true}}, {5, {false, false, false}}, {3, {true, true, true}},
+            {0, {false, false, false}}, {4, {true, true, true}}, {1, {true, true, true}}, {7, {false, false, false}}};
+
+    DrawList drawList;
+    for (std::uint32_t i = 0; i < draws.size(); ++i) {
+        drawList.Add(draws[i], i);
+    }
+    drawList.Sort();
+
+    bool isPassed = true;
+    std::uint32_t position = 0;
+    drawList.Emit([&](const std::uint32_t drawIndex, const DrawStateChanges& changes) {
+        const auto& [expectedIndex, expectedChanges] = expected[position];
+        if (drawIndex != expectedIndex || changes.Pipeline != expectedChanges.Pipeline ||
+            changes.Material != expectedChanges.Material || changes.Mesh != expectedChanges.Mesh) {
+            std::cerr << "Sorted draw or its state changes are wrong, position: " << position << std::endl;
+            isPassed = false;
+        }
+        ++position;
+    });
+
+    const DrawListStats& stats = drawList.GetStats();
+    if (position != expected.size() || stats.DrawCount != 8 || stats.PipelineBindCount != 4 ||
+        stats.MaterialBindCount != 5 || stats.MeshBindCount != 5 || stats.PipelineBindsAvoided != 4 ||
+        stats.MaterialBindsAvoided != 3 || stats.MeshBindsAvoided != 3) {
+        std::cerr << "Draw list statistics are wrong" << std::endl;
+        isPassed = false;
+    }
+
+    // Close depths keep their order (depth keeps 16 mantissa bits)
+    drawList.Clear();
+    drawList.Add({DrawPass::Opaque, 0, 0, 0, 1.001f}, 0);
+    drawList.Add({DrawPass::Opaque, 0, 0, 0, 1.0f}, 1);
+    drawList.Sort();
+    if (drawList.Size() != 2 || drawList.GetDrawIndices() != std::vector<std::uint32_t>{1, 0}) {
+        std::cerr << "Close depths aren't sorted front to back" << std::endl;
+        isPassed = false;
+    }
+
+    return isPassed;
+}
+
+bool TestRadixSort()
+{
+    // Fixed pseudo random draws (linear congruential generator). States repeat, so the depth digits decide the order of
+    // the draws with the same state.
+    std::uint32_t state = 1234;
+    const auto next = [&state](const std::uint32_t range) {
+        state = state * 1664525u + 1013904223u;
+        return (state >> 8) % range;
+    };
+
+    constexpr std::uint32_t drawCount = 1000;
+    DrawList drawList;
+    std::vector<std::pair<std::uint64_t, std::uint32_t>> expected(drawCount);
+    for (std::uint32_t i = 0; i < drawCount; ++i) {
+        const DrawKeyFields fields = {.Pass = next(10) == 0 ? DrawPass::Transparent : DrawPass::Opaque,
+                                      .Pipeline = next(4),
+                                      .Material = next(8),
+                                      .Mesh = next(4),
+                                      .Depth = static_cast<float>(next(1000)) * 0.1f};
+        drawList.Add(fields, i);
+        expected[i] = {DrawList::MakeKey(fields), i};
+    }
+
+    drawList.Sort();
+    std::ranges::stable_sort(expected, {}, &std::pair<std::uint64_t, std::uint32_t>::first);
+
+    const auto drawIndices = drawList.GetDrawIndices();
+    for (std::uint32_t i = 0; i < drawCount; ++i) {
+        if (drawIndices[i] != expected[i].second) {
+            std::cerr << "Radix sort differs from the stable sort, position: " << i << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool TestInvalidKeys()
+{
+    bool isPassed = true;
+    for (const DrawKeyFields& fields: {DrawKeyFields{.Pipeline = 1u << DrawList::PipelineBits},
+                                       DrawKeyFields{.Material = 1u << DrawList::MaterialBits},
+                                       DrawKeyFields{.Mesh = 1u << DrawList::MeshBits}}) {
+        try {
+            static_cast<void>(DrawList::MakeKey(fields));
+            std::cerr << "Out of range key field is accepted" << std::endl;
+            isPassed = false;
+        } catch (const std::runtime_error&) {
+        }
+    }
+
+    return isPassed;
+}
+} // namespace
+
+int main()
+{
+    bool isPassed = TestOrderAndChanges();
+    isPassed = TestRadixSort() && isPassed;
+    isPassed = TestInvalidKeys() && isPassed;
+
+    std::cout << (isPassed ? "All draw list tests passed" : "Draw list tests failed") << std::endl;
+    return isPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
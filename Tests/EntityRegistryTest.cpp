@@ -0,0 +1,198 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "EntityRegistry.h"
+
+using namespace common::utility;
+
+namespace
+{
+struct Position
+{
+    float Value = 0.0f;
+};
+
+struct Velocity
+{
+    float Value = 0.0f;
+};
+
+using Registry = EntityRegistry<Position, Velocity>;
+
+// Sparse and dense arrays of a pool must point to each other after every change
+template<typename Component>
+bool IsPoolConsistent(const ComponentPool<Component>& pool)
+{
+    const auto entities = pool.GetEntities();
+    for (std::uint32_t i = 0; i < entities.size(); ++i) {
+        if (pool.GetDenseIndex(entities[i]) != i) {
+            return false;
+        }
+    }
+
+    return entities.size() == pool.GetComponents().size();
+}
+
+bool TestLifetime()
+{
+    Registry registry;
+    const Entity first = registry.Create();
+    const Entity second = registry.Create();
+    const Entity third = registry.Create();
+
+    bool isPassed = true;
+    if (!registry.Destroy(second) || registry.Destroy(second) || registry.IsAlive(second)) {
+        std::cerr << "Destroyed entity is still alive or destroyed twice" << std::endl;
+        isPassed = false;
+    }
+
+    // Index of the destroyed entity is reused with a new generation, so the old handle stays stale
+    const Entity reused = registry.Create();
+    if (reused.Index != second.Index || reused.Generation == second.Generation || registry.IsAlive(second) ||
+        !registry.IsAlive(reused)) {
+        std::cerr << "Reused entity index doesn't get a new generation" << std::endl;
+        isPassed = false;
+    }
+    if (!registry.IsAlive(first) || !registry.IsAlive(third) || registry.GetAliveCount() != 3) {
+        std::cerr << "Alive entities are wrong after the index reuse" << std::endl;
+        isPassed = false;
+    }
+
+    try {
+        registry.Emplace<Position>(second, 1.0f);
+        std::cerr << "Component is added to a destroyed entity" << std::endl;
+        isPassed = false;
+    } catch (const std::runtime_error&) {
+    }
+    if (registry.TryGet<Position>(second) != nullptr || registry.Remove<Position>(second)) {
+        std::cerr << "Stale entity handle reaches the components of the reused entity" << std::endl;
+        isPassed = false;
+    }
+
+    registry.Clear();
+    if (registry.GetAliveCount() != 0 || registry.IsAlive(first)) {
+        std::cerr << "Entities are alive after Clear" << std::endl;
+        isPassed = false;
+    }
+
+    return isPassed;
+}
+
+bool TestComponents()
+{
+    Registry registry;
+    std::vector<Entity> entities;
+    for (int i = 0; i < 4; ++i) {
+        entities.push_back(registry.Create());
+        registry.Emplace<Position>(entities.back(), static_cast<float>(i));
+    }
+
+    // Emplace on an existing component replaces its value
+    registry.Emplace<Position>(entities[1], 10.0f);
+    registry.Emplace<Velocity>(entities[2], 5.0f);
+
+    bool isPassed = true;
+    if (registry.GetPool<Position>().Size() != 4 || registry.TryGet<Position>(entities[1])->Value != 10.0f) {
+        std::cerr << "Emplace on an existing component doesn't replace it" << std::endl;
+        isPassed = false;
+    }
+    if (!registry.Has<Velocity>(entities[2]) || registry.Has<Velocity>(entities[0])) {
+        std::cerr << "Has returns wrong results" << std::endl;
+        isPassed = false;
+    }
+
+    // First component is removed, the last one is moved into its slot and must still be found
+    const bool isRemoved = registry.Remove<Position>(entities[0]) && !registry.Remove<Position>(entities[0]);
+    if (!isRemoved || !IsPoolConsistent(registry.GetPool<Position>()) || registry.Has<Position>(entities[0]) ||
+        registry.TryGet<Position>(entities[3])->Value != 3.0f ||
+        registry.TryGet<Position>(entities[1])->Value != 10.0f) {
+        std::cerr << "Components are wrong after a removal" << std::endl;
+        isPassed = false;
+    }
+
+    // Destroy removes the components of all types
+    registry.Destroy(entities[2]);
+    if (registry.GetPool<Position>().Size() != 2 || registry.GetPool<Velocity>().Size() != 0 ||
+        !IsPoolConsistent(registry.GetPool<Position>())) {
+        std::cerr << "Components of a destroyed entity aren't removed" << std::endl;
+        isPassed = false;
+    }
+
+    return isPassed;
+}
+
+bool TestEach()
+{
+    // Every entity has a position, every third entity has a velocity. Velocities are added in the reverse order, so
+    // the pools aren't in the same order before Pack.
+    constexpr int entityCount = 12;
+    Registry registry;
+    std::vector<Entity> entities;
+    for (int i = 0; i < entityCount; ++i) {
+        entities.push_back(registry.Create());
+        registry.Emplace<Position>(entities.back(), static_cast<float>(i));
+    }
+    for (int i = entityCount - 1; i >= 0; i -= 3) {
+        registry.Emplace<Velocity>(entities[i], 0.5f * static_cast<float>(i));
+    }
+
+    const auto step = [&](const char* stage) {
+        int visitCount = 0;
+        bool isMatching = true;
+        registry.Each<Velocity, Position>([&](const Entity entity, const Velocity& velocity, Position& position) {
+            isMatching = isMatching && velocity.Value == 0.5f * static_cast<float>(entity.Index) &&
+                         registry.TryGet<Position>(entity) == &position;
+            position.Value += velocity.Value;
+            ++visitCount;
+        });
+        if (!isMatching || visitCount != entityCount / 3) {
+            std::cerr << "Each visits wrong components " << stage << ", visit count: " << visitCount << std::endl;
+            return false;
+        }
+        return true;
+    };
+
+    bool isPassed = step("before Pack");
+
+    registry.Pack<Velocity, Position>();
+    const auto velocityEntities = registry.GetPool<Velocity>().GetEntities();
+    const auto positionEntities = registry.GetPool<Position>().GetEntities();
+    for (std::size_t i = 0; i < velocityEntities.size(); ++i) {
+        if (positionEntities[i] != velocityEntities[i] || !IsPoolConsistent(registry.GetPool<Position>())) {
+            std::cerr << "Pack doesn't order the position pool like the velocity pool" << std::endl;
+            isPassed = false;
+            break;
+        }
+    }
+    isPassed = step("after Pack") && isPassed;
+
+    // Positions of the entities with a velocity are moved twice, the others aren't changed by Each or Pack
+    for (int i = 0; i < entityCount; ++i) {
+        const float expected = static_cast<float>(i) + ((entityCount - 1 - i) % 3 == 0 ? static_cast<float>(i) : 0.0f);
+        if (registry.TryGet<Position>(entities[i])->Value != expected) {
+            std::cerr << "Position is wrong after Each and Pack, entity: " << i << std::endl;
+            isPassed = false;
+        }
+    }
+
+    return isPassed;
+}
+} // namespace
+
+int main()
+{
+    bool isPassed = TestLifetime();
+    isPassed = TestComponents() && isPassed;
+    isPassed = TestEach() && isPassed;
+
+    std::cout << (isPassed ? "All entity registry tests passed" : "Entity registry tests failed") << std::endl;
+    return isPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,495 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include "BoundingVolumeHierarchy.h"
+#include "DrawList.h"
+#include "FrustumCulling.h"
+#include "GlfwModelHandler.h"
+#include "PerspectiveCamera.h"
+#include "SoftwareOcclusion.h"
+#include "TransformHierarchy.h"
+
+using namespace common::utility;
+
+namespace
+{
+// Object count of every benchmark if it isn't given as the first argument
+constexpr std::uint32_t defaultObjectCount = 100000;
+
+// Camera and depth buffer of the software occlusion culling are same with the glTF multiple meshes example
+constexpr std::uint32_t windowWidth = 800;
+constexpr std::uint32_t windowHeight = 600;
+constexpr std::uint32_t occlusionBufferScale = 4;
+
+// Recursive and flat hierarchies multiply the same matrices in the same order, the bound only allows FMA contraction
+constexpr float maxHierarchyError = 1e-4f;
+
+// Previous recursive approach of the model loader, it is the reference of the hierarchy benchmark
+void ComputeWorldTransformRecursive(std::vector<GltfNode>& nodes,
+                                    const std::uint32_t nodeIndex,
+                                    const glm::mat4& parentWorldMatrix)
+{
+    auto& node = nodes[nodeIndex];
+    node.WorldTransform = parentWorldMatrix * node.LocalTransform;
+
+    for (const auto childIndex: node.ChildIndices) {
+        ComputeWorldTransformRecursive(nodes, childIndex, node.WorldTransform);
+    }
+}
+
+bool RunHierarchyBenchmark(const std::uint32_t count)
+{
+    // Random tree with a fixed seed. Nodes are created parent first but stored in shuffled order, so the hierarchy has
+    // to sort them. Every 1000th node starts a new root.
+    std::mt19937 generator{1234};
+    std::uniform_real_distribution distribution{-1.0f, 1.0f};
+    const auto randomTransform = [&]() {
+        const glm::vec3 position{distribution(generator), distribution(generator), distribution(generator)};
+        const glm::quat rotation = glm::normalize(glm::quat(distribution(generator), distribution(generator),
+                                                            distribution(generator), distribution(generator)));
+        return glm::translate(glm::mat4(1.0f), position) * glm::mat4_cast(rotation) *
+               glm::scale(glm::mat4(1.0f), glm::vec3(0.25f * distribution(generator) + 1.0f));
+    };
+
+    std::vector<std::uint32_t> storageIndices(count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        storageIndices[i] = i;
+    }
+    std::ranges::shuffle(storageIndices, generator);
+
+    std::vector<GltfNode> nodes(count);
+    std::vector<std::uint32_t> roots;
+    for (std::uint32_t i = 0; i < count; ++i) {
+        auto& node = nodes[storageIndices[i]];
+        node.LocalTransform = randomTransform();
+        if (i % 1000 == 0) {
+            roots.push_back(storageIndices[i]);
+            continue;
+        }
+
+        node.ParentIndex = storageIndices[std::uniform_int_distribution<std::uint32_t>{0, i - 1}(generator)];
+        nodes[node.ParentIndex].ChildIndices.push_back(storageIndices[i]);
+    }
+
+    std::vector<std::uint32_t> parentIndices(count);
+    std::vector<glm::mat4> localTransforms(count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        parentIndices[i] = nodes[i].ParentIndex;
+        localTransforms[i] = nodes[i].LocalTransform;
+    }
+
+    TransformHierarchy hierarchy;
+    hierarchy.Build(parentIndices, localTransforms);
+
+    // Every path is repeated and the average time is reported
+    constexpr int iterationCount = 20;
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+
+    const auto recursiveStart = std::chrono::steady_clock::now();
+    for (int iteration = 0; iteration < iterationCount; ++iteration) {
+        for (const auto root: roots) {
+            ComputeWorldTransformRecursive(nodes, root, glm::mat4(1.0f));
+        }
+    }
+    const auto recursiveEnd = std::chrono::steady_clock::now();
+
+    for (int iteration = 0; iteration < iterationCount; ++iteration) {
+        hierarchy.MarkAllDirty();
+        hierarchy.Update();
+    }
+    const auto flatEnd = std::chrono::steady_clock::now();
+
+    float maxError = 0.0f;
+    for (std::uint32_t i = 0; i < count; ++i) {
+        const auto& flatWorld = hierarchy.GetWorldTransform(hierarchy.GetFlatIndex(i));
+        for (int column = 0; column < 4; ++column) {
+            for (int row = 0; row < 4; ++row) {
+                maxError = std::max(maxError, std::abs(nodes[i].WorldTransform[column][row] - flatWorld[column][row]));
+            }
+        }
+    }
+
+    // Typical frame: 1% of the nodes are animated, only their subtrees are recalculated
+    const std::uint32_t changedCount = std::max(count / 100, 1u);
+    std::uniform_int_distribution<std::uint32_t> nodeDistribution{0, count - 1};
+    std::vector<std::uint32_t> changedNodes(changedCount);
+    std::vector<glm::mat4> changedTransforms(changedCount);
+    for (std::uint32_t i = 0; i < changedCount; ++i) {
+        changedNodes[i] = hierarchy.GetFlatIndex(nodeDistribution(generator));
+        changedTransforms[i] = randomTransform();
+    }
+
+    std::uint32_t updatedCount = 0;
+    Milliseconds dirtyDuration{0.0};
+    for (int iteration = 0; iteration < iterationCount; ++iteration) {
+        const auto dirtyStart = std::chrono::steady_clock::now();
+        for (std::uint32_t i = 0; i < changedCount; ++i) {
+            hierarchy.SetLocalTransform(changedNodes[i], changedTransforms[i]);
+        }
+        updatedCount = hierarchy.Update();
+        dirtyDuration += std::chrono::steady_clock::now() - dirtyStart;
+    }
+
+    std::cout << "Transform hierarchy (" << count << " nodes): recursive "
+              << Milliseconds(recursiveEnd - recursiveStart).count() / iterationCount << " ms, flat "
+              << Milliseconds(flatEnd - recursiveEnd).count() / iterationCount << " ms, flat with " << changedCount
+              << " dirty nodes " << dirtyDuration.count() / iterationCount << " ms (" << updatedCount
+              << " updated), max error " << maxError << std::endl;
+
+    return maxError <= maxHierarchyError;
+}
+
+bool RunCullingBenchmark(const PerspectiveCamera& camera, const std::uint32_t count)
+{
+    // Random boxes with a fixed seed around the camera, so a part of them is in the frustum
+    std::mt19937 generator{1234};
+    std::uniform_real_distribution positionDistribution{-50.0f, 50.0f};
+    std::uniform_real_distribution sizeDistribution{0.1f, 2.0f};
+    BoundsArrays bounds;
+    bounds.Resize(count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        const glm::vec3 center = camera.GetPosition() + glm::vec3{positionDistribution(generator),
+                                                                    positionDistribution(generator),
+                                                                    positionDistribution(generator)};
+        const glm::vec3 extent{sizeDistribution(generator), sizeDistribution(generator), sizeDistribution(generator)};
+        bounds.Set(i, center - extent, center + extent);
+    }
+
+    const Frustum frustum = camera.GetFrustum();
+    std::vector<std::uint32_t> scalarVisible;
+    std::vector<std::uint32_t> simdVisible;
+    scalarVisible.reserve(count);
+    simdVisible.reserve(count);
+
+    // Every path is repeated and the average time is reported
+    constexpr int iterationCount = 20;
+    using Nanoseconds = std::chrono::duration<double, std::nano>;
+
+    const auto scalarStart = std::chrono::steady_clock::now();
+    for (int iteration = 0; iteration < iterationCount; ++iteration) {
+        CullBoundsScalar(frustum, bounds, scalarVisible);
+    }
+    const auto scalarEnd = std::chrono::steady_clock::now();
+    for (int iteration = 0; iteration < iterationCount; ++iteration) {
+        CullBounds(frustum, bounds, simdVisible);
+    }
+    const auto simdEnd = std::chrono::steady_clock::now();
+
+    const double objectCount = static_cast<double>(count) * iterationCount;
+    std::cout << "Frustum culling (" << count << " objects): " << simdVisible.size() << " visible, "
+              << count - simdVisible.size() << " culled, scalar "
+              << Nanoseconds(scalarEnd - scalarStart).count() / objectCount << " ns/object, "
+              << GetFrustumCullingBackend() << " " << Nanoseconds(simdEnd - scalarEnd).count() / objectCount
+              << " ns/object, results " << (scalarVisible == simdVisible ? "match" : "differ") << std::endl;
+
+    return scalarVisible == simdVisible;
+}
+
+bool RunOcclusionBenchmark(const PerspectiveCamera& camera, const std::uint32_t count)
+{
+    // Box walls in front of the camera with gaps between them, random boxes with a fixed seed are behind and between
+    // the walls, so a part of them is hidden
+    const glm::vec3 front = camera.GetFrontVector();
+    const glm::vec3 right = camera.GetRightVector();
+    const glm::vec3 up = glm::cross(right, front);
+    const glm::vec3 wallCenter = camera.GetPosition() + front * 10.0f;
+
+    std::vector<OccluderMesh> walls;
+    for (int x = -2; x <= 2; ++x) {
+        for (int y = -1; y <= 1; ++y) {
+            const glm::vec3 center =
+                    wallCenter + right * (static_cast<float>(x) * 5.0f) + up * (static_cast<float>(y) * 4.0f);
+            const glm::vec3 extent = glm::abs(right) * 2.0f + glm::abs(up) * 1.5f + glm::abs(front) * 0.25f;
+            walls.push_back(CreateBoxOccluder(center - extent, center + extent));
+        }
+    }
+
+    std::mt19937 generator{1234};
+    std::uniform_real_distribution sideDistribution{-15.0f, 15.0f};
+    std::uniform_real_distribution depthDistribution{5.0f, 60.0f};
+    std::uniform_real_distribution sizeDistribution{0.1f, 1.0f};
+    BoundsArrays bounds;
+    bounds.Resize(count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        const glm::vec3 center = camera.GetPosition() + front * depthDistribution(generator) +
+                                 right * sideDistribution(generator) + up * sideDistribution(generator);
+        const glm::vec3 extent{sizeDistribution(generator), sizeDistribution(generator), sizeDistribution(generator)};
+        bounds.Set(i, center - extent, center + extent);
+    }
+
+    std::vector<std::uint32_t> frustumVisible;
+    CullBounds(camera.GetFrustum(), bounds, frustumVisible);
+
+    const glm::mat4 viewProjection = camera.GetProjectionMatrix() * camera.GetViewMatrix();
+    constexpr std::uint32_t width = windowWidth / occlusionBufferScale;
+    constexpr std::uint32_t height = windowHeight / occlusionBufferScale;
+    SoftwareOcclusionCuller singleThreadCuller{width, height, 0};
+    SoftwareOcclusionCuller multiThreadCuller{width, height};
+
+    // Every path is repeated and the average time is reported
+    constexpr int iterationCount = 20;
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+    using Nanoseconds = std::chrono::duration<double, std::nano>;
+
+    const auto rasterize = [&](SoftwareOcclusionCuller& culler) {
+        const auto start = std::chrono::steady_clock::now();
+        for (int iteration = 0; iteration < iterationCount; ++iteration) {
+            culler.BeginFrame(viewProjection);
+            for (const auto& wall: walls) {
+                culler.AddOccluder(wall, glm::mat4(1.0f));
+            }
+            culler.Rasterize();
+        }
+        return Milliseconds(std::chrono::steady_clock::now() - start).count() / iterationCount;
+    };
+    const double singleThreadTime = rasterize(singleThreadCuller);
+    const double multiThreadTime = rasterize(multiThreadCuller);
+
+    std::vector<std::uint32_t> singleThreadVisible;
+    std::vector<std::uint32_t> multiThreadVisible;
+    singleThreadCuller.CullOccluded(bounds, frustumVisible, singleThreadVisible);
+    const auto testStart = std::chrono::steady_clock::now();
+    for (int iteration = 0; iteration < iterationCount; ++iteration) {
+        multiThreadCuller.CullOccluded(bounds, frustumVisible, multiThreadVisible);
+    }
+    const auto testEnd = std::chrono::steady_clock::now();
+
+    const double testedCount = static_cast<double>(std::max<std::size_t>(frustumVisible.size(), 1)) * iterationCount;
+    std::cout << "Software occlusion (" << count << " objects, " << frustumVisible.size() << " in the frustum, "
+              << width << "x" << height << " depth buffer): " << frustumVisible.size() - multiThreadVisible.size()
+              << " occluded, " << GetSoftwareOcclusionBackend() << " rasterization 1 thread " << singleThreadTime
+              << " ms, " << multiThreadCuller.GetWorkerCount() + 1 << " threads " << multiThreadTime << " ms, test "
+              << Nanoseconds(testEnd - testStart).count() / testedCount << " ns/object, results "
+              << (singleThreadVisible == multiThreadVisible ? "match" : "differ") << std::endl;
+
+    return singleThreadVisible == multiThreadVisible;
+}
+
+bool RunBvhBenchmark(const PerspectiveCamera& camera, const std::uint32_t count)
+{
+    // Random boxes with a fixed seed around the camera, so a part of them is in the frustum
+    std::mt19937 generator{1234};
+    std::uniform_real_distribution positionDistribution{-50.0f, 50.0f};
+    std::uniform_real_distribution sizeDistribution{0.1f, 2.0f};
+    std::vector<glm::vec3> centers(count);
+    std::vector<glm::vec3> extents(count);
+    BoundsArrays bounds;
+    bounds.Resize(count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        centers[i] = camera.GetPosition() + glm::vec3{positionDistribution(generator),
+                                                        positionDistribution(generator),
+                                                        positionDistribution(generator)};
+        extents[i] = glm::vec3{sizeDistribution(generator), sizeDistribution(generator), sizeDistribution(generator)};
+        bounds.Set(i, centers[i] - extents[i], centers[i] + extents[i]);
+    }
+
+    // Every path is repeated and the average time is reported
+    constexpr int iterationCount = 20;
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+
+    BoundingVolumeHierarchy bvh;
+    const auto buildStart = std::chrono::steady_clock::now();
+    bvh.Build(bounds);
+    const auto buildEnd = std::chrono::steady_clock::now();
+
+    const Frustum frustum = camera.GetFrustum();
+    std::vector<std::uint32_t> linearVisible;
+    std::vector<BvhRange> visibleRanges;
+    std::size_t bvhVisibleCount = 0;
+    const auto linearStart = std::chrono::steady_clock::now();
+    for (int iteration = 0; iteration < iterationCount; ++iteration) {
+        CullBounds(frustum, bounds, linearVisible);
+    }
+    const auto linearEnd = std::chrono::steady_clock::now();
+    for (int iteration = 0; iteration < iterationCount; ++iteration) {
+        bvhVisibleCount = bvh.CullFrustum(frustum, visibleRanges);
+    }
+    const auto bvhEnd = std::chrono::steady_clock::now();
+
+    // Typical frame: 1% of the objects move a little, only their paths are refitted
+    const std::uint32_t movedCount = std::max(count / 100, 1u);
+    std::uniform_int_distribution<std::uint32_t> objectDistribution{0, count - 1};
+    std::uniform_real_distribution offsetDistribution{-0.5f, 0.5f};
+    std::uint32_t refitCount = 0;
+    Milliseconds refitDuration{0.0};
+    for (int iteration = 0; iteration < iterationCount; ++iteration) {
+        for (std::uint32_t i = 0; i < movedCount; ++i) {
+            const auto objectIndex = objectDistribution(generator);
+            centers[objectIndex] += glm::vec3{offsetDistribution(generator), offsetDistribution(generator),
+                                              offsetDistribution(generator)};
+            bvh.SetObjectBounds(objectIndex, centers[objectIndex] - extents[objectIndex],
+                                centers[objectIndex] + extents[objectIndex]);
+        }
+
+        const auto refitStart = std::chrono::steady_clock::now();
+        refitCount = bvh.Refit();
+        refitDuration += std::chrono::steady_clock::now() - refitStart;
+    }
+
+    // Rays through random points of the screen, the linear version tests every box
+    constexpr std::uint32_t rayCount = 1000;
+    const glm::mat4 viewProjection = camera.GetProjectionMatrix() * camera.GetViewMatrix();
+    std::uniform_real_distribution ndcDistribution{-1.0f, 1.0f};
+    std::vector<Ray> rays(rayCount);
+    for (auto& ray: rays) {
+        ray = CreateScreenRay(viewProjection, {ndcDistribution(generator), ndcDistribution(generator)});
+    }
+    std::uint32_t matchCount = 0;
+    Milliseconds linearRayDuration{0.0};
+    Milliseconds bvhRayDuration{0.0};
+    for (const auto& ray: rays) {
+        const auto linearRayStart = std::chrono::steady_clock::now();
+        RayHit linearHit;
+        const glm::vec3 inverseDirection = 1.0f / ray.Direction;
+        for (std::uint32_t i = 0; i < count; ++i) {
+            const glm::vec3 t1 = (centers[i] - extents[i] - ray.Origin) * inverseDirection;
+            const glm::vec3 t2 = (centers[i] + extents[i] - ray.Origin) * inverseDirection;
+            const glm::vec3 tNear = glm::min(t1, t2);
+            const glm::vec3 tFar = glm::max(t1, t2);
+            const float entry = std::max({tNear.x, tNear.y, tNear.z, 0.0f});
+            if (entry <= std::min({tFar.x, tFar.y, tFar.z}) && entry < linearHit.Distance) {
+                linearHit = {i, entry};
+            }
+        }
+        const auto bvhRayStart = std::chrono::steady_clock::now();
+        const RayHit bvhHit = bvh.CastRay(ray);
+        const auto bvhRayEnd = std::chrono::steady_clock::now();
+
+        linearRayDuration += bvhRayStart - linearRayStart;
+        bvhRayDuration += bvhRayEnd - bvhRayStart;
+        matchCount += bvhHit.ObjectIndex == linearHit.ObjectIndex ? 1 : 0;
+    }
+
+    std::cout << "BVH (" << count << " objects, " << bvh.GetNodeCount() << " nodes): build "
+              << Milliseconds(buildEnd - buildStart).count() << " ms, frustum linear "
+              << Milliseconds(linearEnd - linearStart).count() / iterationCount << " ms, BVH "
+              << Milliseconds(bvhEnd - linearEnd).count() / iterationCount << " ms (" << bvhVisibleCount
+              << " visible in " << visibleRanges.size() << " ranges, linear " << linearVisible.size() << "), refit of "
+              << movedCount << " moved objects " << refitDuration.count() / iterationCount << " ms (" << refitCount
+              << " nodes), ray linear " << linearRayDuration.count() * 1000.0 / rayCount << " us, BVH "
+              << bvhRayDuration.count() * 1000.0 / rayCount << " us (" << matchCount << "/" << rayCount
+              << " hits match)" << std::endl;
+
+    return bvhVisibleCount == linearVisible.size() && matchCount == rayCount;
+}
+
+bool RunDrawListBenchmark(const std::uint32_t count)
+{
+    // Random draws with a fixed seed in a typical scene mix: a few pipelines, more materials and meshes, 10% of the
+    // draws are transparent
+    std::mt19937 generator{1234};
+    std::uniform_int_distribution<std::uint32_t> pipelineDistribution{0, 7};
+    std::uniform_int_distribution<std::uint32_t> materialDistribution{0, 255};
+    std::uniform_int_distribution<std::uint32_t> meshDistribution{0, 1023};
+    std::uniform_real_distribution depthDistribution{0.1f, 100.0f};
+    std::uniform_real_distribution transparentDistribution{0.0f, 1.0f};
+    std::vector<DrawKeyFields> draws(count);
+    for (auto& draw: draws) {
+        draw = {.Pass = transparentDistribution(generator) < 0.1f ? DrawPass::Transparent : DrawPass::Opaque,
+                .Pipeline = pipelineDistribution(generator),
+                .Material = materialDistribution(generator),
+                .Mesh = meshDistribution(generator),
+                .Depth = depthDistribution(generator)};
+    }
+
+    const auto fillDrawList = [&](DrawList& drawList) {
+        drawList.Clear();
+        for (std::uint32_t i = 0; i < count; ++i) {
+            drawList.Add(draws[i], i);
+        }
+    };
+
+    // Binds of the adding order are the reference
+    DrawList drawList;
+    fillDrawList(drawList);
+    drawList.Emit([](std::uint32_t, const DrawStateChanges&) {});
+    const DrawListStats unsortedStats = drawList.GetStats();
+
+    // Every path is repeated and the average time is reported, filling of the lists isn't measured
+    constexpr int iterationCount = 20;
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+
+    std::vector<std::pair<std::uint64_t, std::uint32_t>> comparisonKeys(count);
+    Milliseconds comparisonDuration{0.0};
+    Milliseconds radixDuration{0.0};
+    for (int iteration = 0; iteration < iterationCount; ++iteration) {
+        for (std::uint32_t i = 0; i < count; ++i) {
+            comparisonKeys[i] = {DrawList::MakeKey(draws[i]), i};
+        }
+        const auto comparisonStart = std::chrono::steady_clock::now();
+        std::sort(comparisonKeys.begin(), comparisonKeys.end());
+        comparisonDuration += std::chrono::steady_clock::now() - comparisonStart;
+
+        fillDrawList(drawList);
+        const auto radixStart = std::chrono::steady_clock::now();
+        drawList.Sort();
+        radixDuration += std::chrono::steady_clock::now() - radixStart;
+    }
+
+    const auto sortedIndices = drawList.GetDrawIndices();
+    std::uint32_t matchCount = 0;
+    for (std::uint32_t i = 0; i < count; ++i) {
+        matchCount += sortedIndices[i] == comparisonKeys[i].second ? 1 : 0;
+    }
+
+    drawList.Emit([](std::uint32_t, const DrawStateChanges&) {});
+    const DrawListStats& sortedStats = drawList.GetStats();
+
+    std::cout << "Draw list (" << count << " draws): std::sort " << comparisonDuration.count() / iterationCount
+              << " ms, radix sort " << radixDuration.count() / iterationCount << " ms (" << matchCount << "/" << count
+              << " match), binds unsorted/sorted: pipeline " << unsortedStats.PipelineBindCount << "/"
+              << sortedStats.PipelineBindCount << ", material " << unsortedStats.MaterialBindCount << "/"
+              << sortedStats.MaterialBindCount << ", mesh " << unsortedStats.MeshBindCount << "/"
+              << sortedStats.MeshBindCount << std::endl;
+
+    return matchCount == count;
+}
+} // namespace
+
+// Usage: SceneBenchmarks [object count]. Timings are printed, the run fails only if two paths which must produce the
+// same result (recursive and flat hierarchy, scalar and SIMD culling, single and multi-threaded occlusion, linear and
+// BVH culling and ray casts, std::sort and radix sort) differ.
+int main(const int argc, char* argv[])
+{
+    std::uint32_t count = defaultObjectCount;
+    if (argc > 1) {
+        try {
+            count = static_cast<std::uint32_t>(std::stoul(argv[1]));
+        } catch (const std::exception&) {
+            std::cerr << "Object count is not valid: " << argv[1] << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    if (count == 0) {
+        std::cerr << "Object count must be greater than zero!" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const PerspectiveCamera camera{glm::vec3(0.0f, 0.0f, 4.0f),
+                                   static_cast<float>(windowWidth) / static_cast<float>(windowHeight)};
+
+    bool isPassed = RunHierarchyBenchmark(count);
+    isPassed = RunCullingBenchmark(camera, count) && isPassed;
+    isPassed = RunOcclusionBenchmark(camera, count) && isPassed;
+    isPassed = RunBvhBenchmark(camera, count) && isPassed;
+    isPassed = RunDrawListBenchmark(count) && isPassed;
+
+    std::cout << (isPassed ? "All scene benchmark results match" : "Scene benchmark results differ") << std::endl;
+    return isPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
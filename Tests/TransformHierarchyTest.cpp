@@ -0,0 +1,190 @@
+/**
+ * Copyright (c) 2025 Mustafa Yemural - www.mustafayemural.com
+ * Released under the MIT License
+ * https://opensource.org/licenses/MIT
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include <glm/ext/matrix_transform.hpp>
+
+#include "TransformHierarchy.h"
+
+using namespace common::utility;
+
+namespace
+{
+constexpr std::uint32_t noParent = TransformHierarchy::NoParent;
+
+// Two trees in shuffled source order: 1 -> {2 -> {0 -> {5}}, 4} and 3 -> {6}
+const std::vector<std::uint32_t> parentIndices = {2, noParent, 1, noParent, 1, 0, 3};
+
+// Translations and scales are small multiples of 0.5, every product is exact and world transforms are compared with
+// the reference exactly
+std::vector<glm::mat4> CreateLocalTransforms(const float offset)
+{
+    std::vector<glm::mat4> localTransforms(parentIndices.size());
+    for (std::size_t i = 0; i < localTransforms.size(); ++i) {
+        const auto value = static_cast<float>(i) + offset;
+        localTransforms[i] = glm::translate(glm::mat4(1.0f), glm::vec3{value, 2.0f * value, -value}) *
+                             glm::scale(glm::mat4(1.0f), glm::vec3{1.0f + 0.5f * value});
+    }
+
+    return localTransforms;
+}
+
+// World transforms in source order with the same multiplication order as the hierarchy (parent world * local)
+std::vector<glm::mat4> ComputeReference(const std::vector<glm::mat4>& localTransforms)
+{
+    std::vector<glm::mat4> worldTransforms(localTransforms.size());
+    for (std::size_t i = 0; i < localTransforms.size(); ++i) {
+        std::vector<std::uint32_t> path{static_cast<std::uint32_t>(i)};
+        while (parentIndices[path.back()] != noParent) {
+            path.push_back(parentIndices[path.back()]);
+        }
+
+        // Path is from the node to its root, the root transform is the start
+        glm::mat4 world = localTransforms[path.back()];
+        for (auto node = path.rbegin() + 1; node != path.rend(); ++node) {
+            world = world * localTransforms[*node];
+        }
+        worldTransforms[i] = world;
+    }
+
+    return worldTransforms;
+}
+
+bool IsMatching(const TransformHierarchy& hierarchy, const std::vector<glm::mat4>& expected, const char* stage)
+{
+    bool isPassed = true;
+    for (std::uint32_t i = 0; i < expected.size(); ++i) {
+        if (hierarchy.GetWorldTransform(hierarchy.GetFlatIndex(i)) != expected[i]) {
+            std::cerr << "World transform differs from the reference after " << stage << ", node: " << i << std::endl;
+            isPassed = false;
+        }
+    }
+
+    return isPassed;
+}
+
+bool TestOrder()
+{
+    TransformHierarchy hierarchy;
+    hierarchy.Build(parentIndices, CreateLocalTransforms(0.0f));
+
+    bool isPassed = hierarchy.Size() == parentIndices.size();
+    for (std::uint32_t i = 0; i < hierarchy.Size(); ++i) {
+        const auto parent = hierarchy.GetParent(i);
+        const auto source = hierarchy.GetSourceIndex(i);
+        if (hierarchy.GetFlatIndex(source) != i) {
+            std::cerr << "Flat and source indices don't match, flat index: " << i << std::endl;
+            isPassed = false;
+        }
+        if (parent != noParent && (parent >= i || hierarchy.GetSubtreeEnd(parent) < hierarchy.GetSubtreeEnd(i))) {
+            std::cerr << "Node isn't in the subtree range of its parent, flat index: " << i << std::endl;
+            isPassed = false;
+        }
+        if (parentIndices[source] != (parent == noParent ? noParent : hierarchy.GetSourceIndex(parent))) {
+            std::cerr << "Parent of the node is changed, flat index: " << i << std::endl;
+            isPassed = false;
+        }
+    }
+
+    // Subtree of node 1 is {1, 2, 0, 5, 4}, subtree of node 3 is {3, 6}
+    if (hierarchy.GetSubtreeEnd(hierarchy.GetFlatIndex(1)) - hierarchy.GetFlatIndex(1) != 5 ||
+        hierarchy.GetSubtreeEnd(hierarchy.GetFlatIndex(3)) - hierarchy.GetFlatIndex(3) != 2) {
+        std::cerr << "Subtree sizes of the roots are wrong" << std::endl;
+        isPassed = false;
+    }
+
+    return IsMatching(hierarchy, ComputeReference(CreateLocalTransforms(0.0f)), "Build") && isPassed;
+}
+
+bool TestDirtyUpdate()
+{
+    auto localTransforms = CreateLocalTransforms(0.0f);
+    TransformHierarchy hierarchy;
+    hierarchy.Build(parentIndices, localTransforms);
+
+    bool isPassed = true;
+    if (hierarchy.Update() != 0) {
+        std::cerr << "Update without dirty nodes recalculates transforms" << std::endl;
+        isPassed = false;
+    }
+
+    // Changing node 2 recalculates only its subtree {2, 0, 5}
+    const auto changedTransforms = CreateLocalTransforms(3.0f);
+    localTransforms[2] = changedTransforms[2];
+    hierarchy.SetLocalTransform(hierarchy.GetFlatIndex(2), localTransforms[2]);
+    if (const auto updatedCount = hierarchy.Update(); updatedCount != 3) {
+        std::cerr << "Dirty subtree update count is " << updatedCount << ", expected 3" << std::endl;
+        isPassed = false;
+    }
+    isPassed = IsMatching(hierarchy, ComputeReference(localTransforms), "subtree update") && isPassed;
+
+    // Two separate dirty nodes in different trees, clean nodes between them are skipped
+    localTransforms[5] = changedTransforms[5];
+    localTransforms[6] = changedTransforms[6];
+    hierarchy.SetLocalTransform(hierarchy.GetFlatIndex(5), localTransforms[5]);
+    hierarchy.SetLocalTransform(hierarchy.GetFlatIndex(6), localTransforms[6]);
+    if (const auto updatedCount = hierarchy.Update(); updatedCount != 2) {
+        std::cerr << "Separate dirty nodes update count is " << updatedCount << ", expected 2" << std::endl;
+        isPassed = false;
+    }
+    isPassed = IsMatching(hierarchy, ComputeReference(localTransforms), "leaf updates") && isPassed;
+
+    hierarchy.MarkAllDirty();
+    if (const auto updatedCount = hierarchy.Update(); updatedCount != parentIndices.size()) {
+        std::cerr << "Full update count is " << updatedCount << ", expected " << parentIndices.size() << std::endl;
+        isPassed = false;
+    }
+
+    return IsMatching(hierarchy, ComputeReference(localTransforms), "full update") && isPassed;
+}
+
+bool TestInvalidHierarchies()
+{
+    const auto isThrowing = [](const std::vector<std::uint32_t>& parents, const std::size_t transformCount) {
+        try {
+            TransformHierarchy hierarchy;
+            hierarchy.Build(parents, std::vector<glm::mat4>(transformCount, glm::mat4(1.0f)));
+        } catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    };
+
+    bool isPassed = true;
+    if (!isThrowing({noParent, 2, 1}, 3)) {
+        std::cerr << "Hierarchy with a cycle is accepted" << std::endl;
+        isPassed = false;
+    }
+    if (!isThrowing({noParent, 5}, 2)) {
+        std::cerr << "Hierarchy with an out of range parent is accepted" << std::endl;
+        isPassed = false;
+    }
+    if (!isThrowing({noParent, 0}, 3)) {
+        std::cerr << "Hierarchy with different parent and transform counts is accepted" << std::endl;
+        isPassed = false;
+    }
+    if (isThrowing({}, 0)) {
+        std::cerr << "Empty hierarchy is rejected" << std::endl;
+        isPassed = false;
+    }
+
+    return isPassed;
+}
+} // namespace
+
+int main()
+{
+    bool isPassed = TestOrder();
+    isPassed = TestDirtyUpdate() && isPassed;
+    isPassed = TestInvalidHierarchies() && isPassed;
+
+    std::cout << (isPassed ? "All transform hierarchy tests passed" : "Transform hierarchy tests failed") << std::endl;
+    return isPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}